@@ -40,18 +40,6 @@
 ** CI global data...
 */
 
-/*
- * Declaring the CI_LAB_IngestBuffer as a union
- * ensures it is aligned appropriately to
- * store a CFE_SB_Msg_t type.
- */
-typedef union
-{
-    CFE_SB_Msg_t MsgHdr;
-    uint8        bytes[CI_LAB_MAX_INGEST];
-    uint16       hwords[2];
-} CI_LAB_IngestBuffer_t;
-
 typedef union
 {
     CFE_SB_Msg_t   MsgHdr;
@@ -66,8 +54,24 @@ typedef struct
     uint32          SocketID;
     OS_SockAddr_t   SocketAddress;
 
+    /*
+     * OSAL queue behind the command pipe, for waiting on the pipe and
+     * the socket at once.  If this is not possible the task waits on
+     * the pipe alone, and reads the socket between commands.
+     */
+    bool            WaitOnInput;
+    uint32          CommandQueue;
+
     CI_LAB_HkTlm_Buffer_t HkBuffer;
-    CI_LAB_IngestBuffer_t IngestBuffer;
+
+    /*
+     * Uplink packets are received directly into SB zero copy
+     * buffers, which are then sent on without copying.  A buffer
+     * is held here until a valid packet has been received into it.
+     */
+    CFE_SB_MsgPtr_t         IngestMsg[CI_LAB_INGEST_BATCH];
+    CFE_SB_ZeroCopyHandle_t IngestHandle[CI_LAB_INGEST_BATCH];
+    OS_SockRecvMsg_t        IngestRecv[CI_LAB_INGEST_BATCH];
 } CI_LAB_GlobalData_t;
 
 CI_LAB_GlobalData_t CI_LAB_Global;
@@ -102,6 +106,7 @@ int32 CI_LAB_ReportHousekeeping(const CFE_SB_CmdHdr_t *data);
 void CI_Lab_AppMain(void)
 {
     int32  status;
+    int32  RcvTimeout;
     uint32 RunStatus = CFE_ES_RunStatus_APP_RUN;
 
     CFE_ES_PerfLogEntry(CI_LAB_MAIN_TASK_PERF_ID);
@@ -115,8 +120,18 @@ void CI_Lab_AppMain(void)
     {
         CFE_ES_PerfLogExit(CI_LAB_MAIN_TASK_PERF_ID);
 
-        /* Pend on receipt of command packet -- timeout set to 500 millisecs */
-        status = CFE_SB_RcvMsg(&CI_LAB_Global.MsgPtr, CI_LAB_Global.CommandPipe, 500);
+        /* Pend on receipt of command or uplink packet -- timeout set to 500 millisecs */
+        if (CI_LAB_Global.WaitOnInput)
+        {
+            CI_LAB_WaitForInput();
+            RcvTimeout = CFE_SB_POLL;
+        }
+        else
+        {
+            RcvTimeout = CI_LAB_RCV_TIMEOUT;
+        }
+
+        status = CFE_SB_RcvMsg(&CI_LAB_Global.MsgPtr, CI_LAB_Global.CommandPipe, RcvTimeout);
 
         CFE_ES_PerfLogEntry(CI_LAB_MAIN_TASK_PERF_ID);
 
@@ -139,12 +154,23 @@ void CI_Lab_AppMain(void)
 /*
 ** CI delete callback function.
 ** This function will be called in the event that the CI app is killed.
-** It will close the network socket for CI
+** It will close the network socket for CI and release the ingest buffers
 */
 void CI_LAB_delete_callback(void)
 {
+    uint32 i;
+
     OS_printf("CI delete callback -- Closing CI Network socket.\n");
     OS_close(CI_LAB_Global.SocketID);
+
+    for (i = 0; i < CI_LAB_INGEST_BATCH; i++)
+    {
+        if (CI_LAB_Global.IngestMsg[i] != NULL)
+        {
+            CFE_SB_ZeroCopyReleasePtr(CI_LAB_Global.IngestMsg[i], CI_LAB_Global.IngestHandle[i]);
+            CI_LAB_Global.IngestMsg[i] = NULL;
+        }
+    }
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *  */
@@ -154,8 +180,9 @@ void CI_LAB_delete_callback(void)
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
 void CI_LAB_TaskInit(void)
 {
-    int32  status;
-    uint16 DefaultListenPort;
+    int32    status;
+    uint16   DefaultListenPort;
+    OS_FdSet ReadSet;
 
     memset(&CI_LAB_Global, 0, sizeof(CI_LAB_Global));
 
@@ -194,6 +221,17 @@ void CI_LAB_TaskInit(void)
         }
     }
 
+    /*
+    ** Wait on the command pipe and the socket together, if the queue
+    ** behind the pipe can be waited on with select
+    */
+    if (CFE_SB_GetPipeQueueId(CI_LAB_Global.CommandPipe, &CI_LAB_Global.CommandQueue) == CFE_SUCCESS)
+    {
+        OS_SelectFdZero(&ReadSet);
+        OS_SelectFdAdd(&ReadSet, CI_LAB_Global.CommandQueue);
+        CI_LAB_Global.WaitOnInput = (OS_SelectMultiple(&ReadSet, NULL, 0) != OS_ERR_OPERATION_NOT_SUPPORTED);
+    }
+
     CI_LAB_ResetCounters_Internal();
 
     /*
@@ -222,13 +260,14 @@ void CI_LAB_TaskInit(void)
 /* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
 void CI_LAB_ProcessCommandPacket(void)
 {
-    CFE_SB_MsgId_t MsgId;
-    MsgId = CFE_SB_GetMsgId(CI_LAB_Global.MsgPtr);
+    CFE_SB_MsgHdrView_t HdrView;
+
+    CFE_SB_GetMsgHdrView(CI_LAB_Global.MsgPtr, &HdrView);
 
-    switch (CFE_SB_MsgIdToValue(MsgId))
+    switch (CFE_SB_MsgIdToValue(HdrView.MsgId))
     {
         case CI_LAB_CMD_MID:
-            CI_LAB_ProcessGroundCommand();
+            CI_LAB_ProcessGroundCommand(&HdrView);
             break;
 
         case CI_LAB_SEND_HK_MID:
@@ -238,7 +277,7 @@ void CI_LAB_ProcessCommandPacket(void)
         default:
             CI_LAB_Global.HkBuffer.HkTlm.Payload.CommandErrorCounter++;
             CFE_EVS_SendEvent(CI_LAB_COMMAND_ERR_EID, CFE_EVS_EventType_ERROR, "CI: invalid command packet,MID = 0x%x",
-                              (unsigned int)CFE_SB_MsgIdToValue(MsgId));
+                              (unsigned int)CFE_SB_MsgIdToValue(HdrView.MsgId));
             break;
     }
 
@@ -252,14 +291,10 @@ void CI_LAB_ProcessCommandPacket(void)
 /*                                                                            */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
 
-void CI_LAB_ProcessGroundCommand(void)
+void CI_LAB_ProcessGroundCommand(const CFE_SB_MsgHdrView_t *HdrView)
 {
-    uint16 CommandCode;
-
-    CommandCode = CFE_SB_GetCmdCode(CI_LAB_Global.MsgPtr);
-
     /* Process "known" CI task ground commands */
-    switch (CommandCode)
+    switch (HdrView->CmdCode)
     {
         case CI_LAB_NOOP_CC:
             CI_LAB_Noop((const CI_LAB_Noop_t *)CI_LAB_Global.MsgPtr);
@@ -349,38 +384,135 @@ void CI_LAB_ResetCounters_Internal(void)
 
 } /* End of CI_LAB_ResetCounters() */
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* CI_LAB_WaitForInput() --                                                   */
+/*                                                                            */
+/*    Waits until the command pipe holds a message or an uplink packet is     */
+/*    queued on the socket, or for at most CI_LAB_RCV_TIMEOUT.                */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void CI_LAB_WaitForInput(void)
+{
+    OS_FdSet ReadSet;
+    int32    status;
+
+    OS_SelectFdZero(&ReadSet);
+    OS_SelectFdAdd(&ReadSet, CI_LAB_Global.CommandQueue);
+    if (CI_LAB_Global.SocketConnected)
+    {
+        OS_SelectFdAdd(&ReadSet, CI_LAB_Global.SocketID);
+    }
+
+    status = OS_SelectMultiple(&ReadSet, NULL, CI_LAB_RCV_TIMEOUT);
+    if (status != OS_SUCCESS && status != OS_ERROR_TIMEOUT)
+    {
+        /* should not happen, but do not spin if it does */
+        OS_TaskDelay(CI_LAB_RCV_TIMEOUT);
+    }
+
+    return;
+
+} /* End of CI_LAB_WaitForInput() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* CI_LAB_GetIngestBuffers() -- Obtain SB buffers to receive uplink into      */
+/*                                                                            */
+/*    Returns the number of leading entries of the ingest buffer list, up to  */
+/*    Count, that hold a buffer ready to receive a packet.                    */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+uint32 CI_LAB_GetIngestBuffers(uint32 Count)
+{
+    uint32 i;
+
+    for (i = 0; i < Count; i++)
+    {
+        if (CI_LAB_Global.IngestMsg[i] == NULL)
+        {
+            CI_LAB_Global.IngestMsg[i] = CFE_SB_ZeroCopyGetPtr(CI_LAB_MAX_INGEST, &CI_LAB_Global.IngestHandle[i]);
+            if (CI_LAB_Global.IngestMsg[i] == NULL)
+            {
+                break;
+            }
+        }
+
+        CI_LAB_Global.IngestRecv[i].buffer     = CI_LAB_Global.IngestMsg[i];
+        CI_LAB_Global.IngestRecv[i].buflen     = CI_LAB_MAX_INGEST;
+        CI_LAB_Global.IngestRecv[i].msglen     = 0;
+        CI_LAB_Global.IngestRecv[i].RemoteAddr = NULL;
+    }
+
+    return i;
+
+} /* End of CI_LAB_GetIngestBuffers() */
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
 /*                                                                            */
 /* CI_LAB_ReadUpLink() --                                                     */
 /*                                                                            */
+/*    Reads the packets already queued on the socket, up to                   */
+/*    CI_LAB_INGEST_BUDGET, and sends each valid one on the software bus in   */
+/*    the buffer it was received into.                                        */
+/*                                                                            */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
 void CI_LAB_ReadUpLink(void)
 {
-    int   i;
-    int32 status;
+    uint32          Budget = CI_LAB_INGEST_BUDGET;
+    uint32          Count;
+    uint32          MsgLen;
+    uint32          i;
+    int32           status;
+    CFE_SB_MsgPtr_t MsgPtr;
 
-    for (i = 0; i <= 10; i++)
+    while (Budget > 0)
     {
-        status = OS_SocketRecvFrom(CI_LAB_Global.SocketID, CI_LAB_Global.IngestBuffer.bytes,
-                                   sizeof(CI_LAB_Global.IngestBuffer), &CI_LAB_Global.SocketAddress, OS_CHECK);
-        if (status >= ((int32)CFE_SB_CMD_HDR_SIZE) && status <= ((int32)CI_LAB_MAX_INGEST))
+        Count = CI_LAB_GetIngestBuffers(Budget < CI_LAB_INGEST_BATCH ? Budget : CI_LAB_INGEST_BATCH);
+        if (Count == 0)
+        {
+            break; /* no SB buffers available, try again on the next wakeup */
+        }
+
+        status = OS_SocketRecvFromMulti(CI_LAB_Global.SocketID, CI_LAB_Global.IngestRecv, Count, OS_CHECK);
+        if (status <= 0)
         {
-            CFE_ES_PerfLogEntry(CI_LAB_SOCKET_RCV_PERF_ID);
-            CI_LAB_Global.HkBuffer.HkTlm.Payload.IngestPackets++;
-            status = CFE_SB_SendMsg(&CI_LAB_Global.IngestBuffer.MsgHdr);
-            CFE_ES_PerfLogExit(CI_LAB_SOCKET_RCV_PERF_ID);
+            break; /* no (more) messages */
         }
-        else if (status > 0)
+
+        for (i = 0; i < (uint32)status; i++)
         {
-            /* bad size, report as ingest error */
-            CI_LAB_Global.HkBuffer.HkTlm.Payload.IngestErrors++;
-            CFE_EVS_SendEvent(CI_LAB_INGEST_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "CI: L%d, cmd %0x %0x dropped, bad length=%d\n", __LINE__,
-                              CI_LAB_Global.IngestBuffer.hwords[0], CI_LAB_Global.IngestBuffer.hwords[1], (int)status);
+            MsgPtr = CI_LAB_Global.IngestMsg[i];
+            MsgLen = CI_LAB_Global.IngestRecv[i].msglen;
+
+            /* the datagram must hold exactly the packet its header describes */
+            if (MsgLen >= CFE_SB_CMD_HDR_SIZE && MsgLen <= CI_LAB_MAX_INGEST &&
+                CFE_SB_GetTotalMsgLength(MsgPtr) == MsgLen)
+            {
+                CFE_ES_PerfLogEntry(CI_LAB_SOCKET_RCV_PERF_ID);
+                CI_LAB_Global.HkBuffer.HkTlm.Payload.IngestPackets++;
+
+                /* the buffer belongs to the software bus from here on, even if the send fails */
+                CFE_SB_ZeroCopySend(MsgPtr, CI_LAB_Global.IngestHandle[i]);
+                CI_LAB_Global.IngestMsg[i] = NULL;
+                CFE_ES_PerfLogExit(CI_LAB_SOCKET_RCV_PERF_ID);
+            }
+            else if (MsgLen > 0)
+            {
+                /* bad size, report as ingest error and keep the buffer for the next packet */
+                CI_LAB_Global.HkBuffer.HkTlm.Payload.IngestErrors++;
+                CFE_EVS_SendEvent(CI_LAB_INGEST_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "CI: L%d, cmd %02x%02x %02x%02x dropped, bad length=%d\n", __LINE__,
+                                  MsgPtr->Byte[0], MsgPtr->Byte[1], MsgPtr->Byte[2], MsgPtr->Byte[3],
+                                  (int)MsgLen);
+            }
         }
-        else
+
+        Budget -= status;
+
+        if ((uint32)status < Count)
         {
-            break; /* no (more) messages */
+            break; /* socket drained */
         }
     }
 
@@ -395,21 +527,20 @@ void CI_LAB_ReadUpLink(void)
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
 bool CI_LAB_VerifyCmdLength(CFE_SB_MsgPtr_t msg, uint16 ExpectedLength)
 {
-    bool   result       = true;
-    uint16 ActualLength = CFE_SB_GetTotalMsgLength(msg);
+    bool                result = true;
+    CFE_SB_MsgHdrView_t HdrView;
+
+    CFE_SB_GetMsgHdrView(msg, &HdrView);
 
     /*
     ** Verify the command packet length...
     */
-    if (ExpectedLength != ActualLength)
+    if (ExpectedLength != HdrView.TotalLength)
     {
-        CFE_SB_MsgId_t MessageID   = CFE_SB_GetMsgId(msg);
-        uint16         CommandCode = CFE_SB_GetCmdCode(msg);
-
         CFE_EVS_SendEvent(CI_LAB_LEN_ERR_EID, CFE_EVS_EventType_ERROR,
                           "Invalid msg length: ID = 0x%X,  CC = %u, Len = %u, Expected = %u",
-                          (unsigned int)CFE_SB_MsgIdToValue(MessageID), (unsigned int)CommandCode,
-                          (unsigned int)ActualLength, (unsigned int)ExpectedLength);
+                          (unsigned int)CFE_SB_MsgIdToValue(HdrView.MsgId), (unsigned int)HdrView.CmdCode,
+                          (unsigned int)HdrView.TotalLength, (unsigned int)ExpectedLength);
         result = false;
         CI_LAB_Global.HkBuffer.HkTlm.Payload.CommandErrorCounter++;
     }
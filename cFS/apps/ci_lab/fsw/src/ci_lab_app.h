@@ -48,6 +48,15 @@
 #define CI_LAB_BASE_UDP_PORT 1234
 #define CI_LAB_MAX_INGEST    768
 #define CI_LAB_PIPE_DEPTH    32
+#define CI_LAB_RCV_TIMEOUT   500 /* longest wait for a command or uplink packet, in msec */
+
+/*
+** Number of SB buffers held for receiving uplink packets, which is
+** the most packets read from the socket in one call, and the most
+** packets ingested each time the task wakes up.
+*/
+#define CI_LAB_INGEST_BATCH  16
+#define CI_LAB_INGEST_BUDGET 64
 
 /************************************************************************
 ** Type Definitions
@@ -63,9 +72,11 @@
 void CI_Lab_AppMain(void);
 void CI_LAB_TaskInit(void);
 void CI_LAB_ProcessCommandPacket(void);
-void CI_LAB_ProcessGroundCommand(void);
+void CI_LAB_ProcessGroundCommand(const CFE_SB_MsgHdrView_t *HdrView);
 void CI_LAB_ResetCounters_Internal(void);
 void CI_LAB_ReadUpLink(void);
+void CI_LAB_WaitForInput(void);
+uint32 CI_LAB_GetIngestBuffers(uint32 Count);
 
 bool CI_LAB_VerifyCmdLength(CFE_SB_MsgPtr_t msg, uint16 ExpectedLength);
 
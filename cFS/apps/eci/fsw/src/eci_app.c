@@ -423,6 +423,12 @@ static int32 param_table_register(void) {
       } else {
          /* cFE table services will notify app if parameter table update */
          CFE_TBL_NotifyByMessage(TableHandle_Param[idx], ECI_TBL_MANAGE_MID, ECI_TBL_MANAGE_CC, idx);
+
+#if ECI_PARAM_TBL_VALIDATION_BUDGET > 0
+         /* Validate in the background so large tables do not hold up the step cycle, */
+         /* if cFE table services has no validation workers the app validates them    */
+         CFE_TBL_ValidateInBackground(TableHandle_Param[idx], ECI_PARAM_TBL_VALIDATION_BUDGET);
+#endif
       } /* End if-else statement */
 
    } /* End for-loop */
@@ -1453,13 +1459,15 @@ static void do_step(void) {
  ********************************************************************/
 static void app_pipe(const CFE_SB_MsgPtr_t msg) {
 
+   CFE_SB_MsgHdrView_t hdrView;
    CFE_SB_MsgId_t messageID;
    uint16 commandCode;
    uint16 ActualLength;
 
-   /* Obtain the message ID */
-   messageID = CFE_SB_GetMsgId(msg);
-   ActualLength = CFE_SB_GetTotalMsgLength(msg);
+   /* Decode the message header once */
+   CFE_SB_GetMsgHdrView(msg, &hdrView);
+   messageID = hdrView.MsgId;
+   ActualLength = hdrView.TotalLength;
 
    /* Execute based on message Id */
    switch (messageID) {
@@ -1470,7 +1478,7 @@ static void app_pipe(const CFE_SB_MsgPtr_t msg) {
       case ECI_CMD_MID:
 
          /* Obtain command code */           
-         commandCode = CFE_SB_GetCmdCode(msg);
+         commandCode = hdrView.CmdCode;
 
          switch (commandCode) {
 
@@ -1556,7 +1564,8 @@ static void app_pipe(const CFE_SB_MsgPtr_t msg) {
          {
             while (CFE_SB_RcvMsg(&ECI_AppData.DataMsgPtr, ECI_AppData.DataPipe, CFE_SB_POLL) >= CFE_SUCCESS)
             {
-               rcv_msg(ECI_AppData.DataMsgPtr, CFE_SB_GetMsgId(ECI_AppData.DataMsgPtr), CFE_SB_GetTotalMsgLength(ECI_AppData.DataMsgPtr), DATAPIPE);
+               CFE_SB_GetMsgHdrView(ECI_AppData.DataMsgPtr, &hdrView);
+               rcv_msg(ECI_AppData.DataMsgPtr, hdrView.MsgId, hdrView.TotalLength, DATAPIPE);
             } /* End while-loop */
 
             do_step(); 
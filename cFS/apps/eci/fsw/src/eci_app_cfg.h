@@ -41,6 +41,13 @@
 #define ECI_CMD_MSG_QUEUE_SIZE         25
 /** Maximum sequence number (14 bits) */
 #define ECI_MAX_CMD_SEQUENCE_NUMBER    16383
+/** 
+ * Duty cycle (percentage of elapsed time) that a cFE table validation worker
+ * may spend validating parameter tables, or zero to validate parameter tables
+ * in the app's main loop.  A non-zero value changes how parameter table
+ * validations are reported, see CFE_TBL_ValidateInBackground().
+ */
+#define ECI_PARAM_TBL_VALIDATION_BUDGET 0
 /**@}*/
 
 #endif  /* ECI_APP_CFG_H */
@@ -34,6 +34,8 @@
 
 #define TO_LAB_HK_TLM_MID     0x0880
 #define TO_LAB_DATA_TYPES_MID 0x0881
+#define TO_LAB_PKT_STATS_MID  0x0882
+#define TO_LAB_COMPRESSED_MID 0x0885
 
 #endif /* _to_lab_msgids_h_ */
 
@@ -36,6 +36,9 @@ typedef struct
     CFE_SB_MsgId_t Stream;
     CFE_SB_Qos_t   Flags;
     uint16         BufLimit;
+    uint16         Decimation; /* forward every Nth packet, 0 or 1 forwards all */
+    uint8          Queue;      /* output queue, 0 is served most, see TO_LAB_QUEUE_WEIGHTS */
+    uint8          Compress;   /* nonzero to compress, see TO_SET_COMPRESSION_CC */
 } TO_LAB_Sub_t;
 
 typedef struct
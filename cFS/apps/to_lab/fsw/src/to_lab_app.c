@@ -34,6 +34,9 @@
 #include "to_lab_perfids.h"
 #include "to_lab_version.h"
 #include "to_lab_sub_table.h"
+#include "to_lab_compress.h"
+
+#include "cfe_psp.h"
 
 /*
 ** Global Data Section
@@ -50,6 +53,63 @@ typedef union
     TO_LAB_DataTypes_t DataTypes;
 } TO_LAB_DataTypes_Buffer_t;
 
+typedef union
+{
+    CFE_SB_Msg_t      MsgHdr;
+    TO_LAB_PktStats_t PktStats;
+} TO_LAB_PktStats_Buffer_t;
+
+typedef union
+{
+    CFE_SB_Msg_t MsgHdr;
+    uint8        Bytes[CFE_SB_TLM_HDR_SIZE + sizeof(TO_LAB_CompressHdr_t) + TO_LAB_COMPRESS_MAX_PKT];
+} TO_LAB_Compressed_Buffer_t;
+
+/*
+ * The last packet sent of a compressed message ID, which the next one
+ * is coded against
+ */
+typedef struct
+{
+    bool   InUse;
+    uint16 Length;   /* 0 if there is no reference yet */
+    uint16 SinceKey; /* packets coded against a reference since the last one that was not */
+    uint64 Ticks;    /* timebase ticks spent compressing */
+    uint8  Data[TO_LAB_COMPRESS_MAX_PKT];
+} TO_LAB_CompressRef_t;
+
+/*
+ * Decimation, output queue and statistics of one message ID
+ */
+typedef struct
+{
+    CFE_SB_MsgId_t Stream;
+    uint16         Decimation;
+    uint16         Skipped; /* packets skipped since the last one forwarded */
+    uint8          Queue;
+    bool           HighPriority;
+    uint8          CompressSlot; /* reference and statistics slot plus one, 0 if not compressed */
+    uint32         PacketsSent;
+    uint32         PacketsDecimated;
+    uint32         PacketsDropped;
+} TO_LAB_Filter_t;
+
+/*
+ * Packets waiting for the downlink, stored back to back at 4 byte
+ * alignment.  When there is no room at the end, storage continues from
+ * the start and Wrap marks where the older packets end.
+ */
+typedef struct
+{
+    uint32 Head;
+    uint32 Tail;
+    uint32 Wrap;
+    bool   Wrapped;
+    uint16 Packets;
+    uint32 Deficit; /* bytes this queue may still send in the current round */
+    uint32 Buf[TO_LAB_QUEUE_BYTES / 4];
+} TO_LAB_OutputQueue_t;
+
 typedef struct
 {
     CFE_SB_PipeId_t Tlm_pipe;
@@ -57,10 +117,64 @@ typedef struct
     uint32          TLMsockid;
     bool            downlink_on;
     char            tlm_dest_IP[17];
+    OS_SockAddr_t   tlm_dest_addr;
     bool            suppress_sendto;
 
+    /*
+     * OSAL queues behind the two pipes, for waiting on both at once.
+     * If this is not possible the task polls the pipes at TO_TASK_MSEC.
+     */
+    bool            wait_on_pipes;
+    uint32          Cmd_queue;
+    uint32          Tlm_queue;
+
+    /*
+     * Packets received since the last send, gathered into BatchBuf
+     * because each receive from the pipe releases the previous buffer
+     */
+    OS_SockSendMsg_t BatchMsgs[TO_LAB_MAX_BATCH];
+    uint32           BatchCount;
+    uint32           BatchBytes;
+    uint32           HkPacketsSent;
+    uint32           HkSendCalls;
+    uint8            BatchBuf[TO_LAB_BATCH_BYTES];
+
+    /*
+     * Frame being filled in TO_LAB_OUTPUT_FRAMES mode
+     */
+    uint8     OutputMode;
+    uint8     FrameBuf[TO_LAB_FRAME_SIZE];
+    uint32    FrameBytes;
+    uint16    FramePackets;
+    uint16    FrameSequence;
+    OS_time_t FrameStart;
+
+    /*
+     * Per-MsgId filters, found through FilterIndex which holds the
+     * filter number plus one for each message ID value, or 0 if none
+     */
+    TO_LAB_Filter_t Filters[TO_LAB_MAX_FILTERS];
+    uint16          FilterCount;
+    uint16          FilterIndex[CFE_PLATFORM_SB_HIGHEST_VALID_MSGID + 1];
+
+    /*
+     * Output queues, and the token bucket that limits the downlink rate
+     */
+    TO_LAB_OutputQueue_t Queues[TO_LAB_NUM_QUEUES];
+    uint32               DownlinkRate;
+    uint32               DownlinkBurst;
+    uint32               Tokens;
+    OS_time_t            TokenTime;
+
+    /*
+     * Compression references, numbered as HkTlm.Payload.Compress
+     */
+    TO_LAB_CompressRef_t       CompressRefs[TO_LAB_MAX_COMPRESSED];
+    TO_LAB_Compressed_Buffer_t CompressBuf;
+
     TO_LAB_HkTlm_Buffer_t     HkBuf;
     TO_LAB_DataTypes_Buffer_t DataTypesBuf;
+    TO_LAB_PktStats_Buffer_t  PktStatsBuf;
 } TO_LAB_GlobalData_t;
 
 TO_LAB_GlobalData_t TO_LAB_Global;
@@ -84,6 +198,23 @@ int32 TO_LAB_init(void);
 void TO_LAB_exec_local_command(CFE_SB_MsgPtr_t cmd);
 void TO_LAB_process_commands(void);
 void TO_LAB_forward_telemetry(void);
+void TO_LAB_send_batch(void);
+void TO_LAB_wait_for_input(void);
+void TO_LAB_queue_datagram(const void *data, uint16 size);
+void TO_LAB_frame_packet(const CFE_SB_Msg_t *PktPtr, uint16 size);
+void TO_LAB_close_frame(void);
+int32 TO_LAB_frame_wait_msec(void);
+TO_LAB_Filter_t *TO_LAB_get_filter(CFE_SB_MsgId_t MsgId);
+TO_LAB_Filter_t *TO_LAB_add_filter(CFE_SB_MsgId_t MsgId);
+void TO_LAB_remove_filter(CFE_SB_MsgId_t MsgId);
+void TO_LAB_enqueue_packet(const CFE_SB_Msg_t *PktPtr, uint16 size);
+void TO_LAB_output_packet(const CFE_SB_Msg_t *PktPtr, uint16 size);
+void TO_LAB_service_queues(void);
+bool TO_LAB_take_tokens(uint16 size);
+bool TO_LAB_queues_empty(void);
+bool TO_LAB_enable_compression(TO_LAB_Filter_t *Filter, bool Enable);
+const CFE_SB_Msg_t *TO_LAB_compress_packet(const TO_LAB_Filter_t *Filter, const CFE_SB_Msg_t *PktPtr, uint16 *size);
+uint64 TO_LAB_timebase(void);
 
 /*
  * Individual Command Handler prototypes
@@ -96,6 +227,11 @@ int32 TO_LAB_RemovePacket(const TO_LAB_RemovePacket_t *data);
 int32 TO_LAB_ResetCounters(const TO_LAB_ResetCounters_t *data);
 int32 TO_LAB_SendDataTypes(const TO_LAB_SendDataTypes_t *data);
 int32 TO_LAB_SendHousekeeping(const CFE_SB_CmdHdr_t *data);
+int32 TO_LAB_SetOutputMode(const TO_LAB_SetOutputMode_t *data);
+int32 TO_LAB_SetPktFilter(const TO_LAB_SetPktFilter_t *data);
+int32 TO_LAB_SendPktStats(const TO_LAB_SendPktStats_t *data);
+int32 TO_LAB_SetDownlinkRate(const TO_LAB_SetDownlinkRate_t *data);
+int32 TO_LAB_SetCompression(const TO_LAB_SetCompression_t *data);
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                   */
@@ -123,7 +259,7 @@ void TO_Lab_AppMain(void)
     {
         CFE_ES_PerfLogExit(TO_MAIN_TASK_PERF_ID);
 
-        OS_TaskDelay(TO_TASK_MSEC); /*2 Hz*/
+        TO_LAB_wait_for_input();
 
         CFE_ES_PerfLogEntry(TO_MAIN_TASK_PERF_ID);
 
@@ -164,6 +300,8 @@ int32 TO_LAB_init(void)
     char   ToTlmPipeName[16];
     uint16 ToTlmPipeDepth;
 
+    TO_LAB_Filter_t *Filter;
+
     CFE_ES_RegisterApp();
     TO_LAB_Global.downlink_on = false;
     PipeDepth                 = TO_LAB_CMD_PIPE_DEPTH;
@@ -181,6 +319,20 @@ int32 TO_LAB_init(void)
     */
     CFE_SB_InitMsg(&TO_LAB_Global.HkBuf.MsgHdr, TO_LAB_HK_TLM_MID, sizeof(TO_LAB_Global.HkBuf.HkTlm), true);
 
+    TO_LAB_Global.OutputMode                       = TO_LAB_OUTPUT_MODE_DEFAULT;
+    TO_LAB_Global.HkBuf.HkTlm.Payload.OutputMode   = TO_LAB_OUTPUT_MODE_DEFAULT;
+    TO_LAB_Global.DownlinkRate                     = TO_LAB_DOWNLINK_RATE;
+    TO_LAB_Global.DownlinkBurst                    = TO_LAB_DOWNLINK_BURST;
+    TO_LAB_Global.Tokens                           = TO_LAB_DOWNLINK_BURST;
+    TO_LAB_Global.HkBuf.HkTlm.Payload.DownlinkRate = TO_LAB_DOWNLINK_RATE;
+    OS_GetLocalTime(&TO_LAB_Global.TokenTime);
+
+    for (i = 0; i < TO_LAB_MAX_COMPRESSED; ++i)
+    {
+        TO_LAB_Global.HkBuf.HkTlm.Payload.Compress[i].Stream = TO_UNUSED;
+    }
+    CFE_SB_InitMsg(&TO_LAB_Global.CompressBuf.MsgHdr, TO_LAB_COMPRESSED_MID, sizeof(TO_LAB_Global.CompressBuf), true);
+
     status = CFE_TBL_Register(&TO_SubTblHandle, "TO_LAB_Subs", sizeof(*TO_LAB_Subs), CFE_TBL_OPT_DEFAULT, NULL);
 
     if (status != CFE_SUCCESS)
@@ -224,6 +376,11 @@ int32 TO_LAB_init(void)
                           __LINE__, (int)status);
     }
 
+    /* Wait on both pipes together, if the queues behind them can be waited on */
+    TO_LAB_Global.wait_on_pipes =
+        (CFE_SB_GetPipeQueueId(TO_LAB_Global.Cmd_pipe, &TO_LAB_Global.Cmd_queue) == CFE_SUCCESS &&
+         CFE_SB_GetPipeQueueId(TO_LAB_Global.Tlm_pipe, &TO_LAB_Global.Tlm_queue) == CFE_SUCCESS);
+
     /* Subscriptions for TLM pipe*/
     for (i = 0; (i < (sizeof(TO_LAB_Subs->Subs) / sizeof(TO_LAB_Subs->Subs[0]))); i++)
     {
@@ -236,6 +393,25 @@ int32 TO_LAB_init(void)
         {
             status = CFE_SB_SubscribeEx(TO_LAB_Subs->Subs[i].Stream, TO_LAB_Global.Tlm_pipe, TO_LAB_Subs->Subs[i].Flags,
                                         TO_LAB_Subs->Subs[i].BufLimit);
+
+            Filter = TO_LAB_add_filter(TO_LAB_Subs->Subs[i].Stream);
+            if (Filter != NULL)
+            {
+                Filter->HighPriority = (TO_LAB_Subs->Subs[i].Flags.Priority != 0);
+                Filter->Decimation   = TO_LAB_Subs->Subs[i].Decimation;
+                Filter->Skipped      = TO_LAB_Subs->Subs[i].Decimation;
+                if (TO_LAB_Subs->Subs[i].Queue < TO_LAB_NUM_QUEUES)
+                {
+                    Filter->Queue = TO_LAB_Subs->Subs[i].Queue;
+                }
+                if (TO_LAB_Subs->Subs[i].Compress != 0 && !TO_LAB_enable_compression(Filter, true))
+                {
+                    CFE_EVS_SendEvent(TO_COMPRESS_ERR_EID, CFE_EVS_EventType_ERROR,
+                                      "L%d TO Can't compress 0x%x, all %d slots in use", __LINE__,
+                                      (unsigned int)CFE_SB_MsgIdToValue(TO_LAB_Subs->Subs[i].Stream),
+                                      TO_LAB_MAX_COMPRESSED);
+                }
+            }
         }
 
         if (status != CFE_SUCCESS)
@@ -267,6 +443,12 @@ int32 TO_LAB_EnableOutput(const TO_LAB_EnableOutput_t *data)
     (void)CFE_SB_MessageStringGet(TO_LAB_Global.tlm_dest_IP, pCmd->dest_IP, "", sizeof(TO_LAB_Global.tlm_dest_IP),
                                   sizeof(pCmd->dest_IP));
     TO_LAB_Global.suppress_sendto = false;
+
+    /* resolve the destination once, rather than for every packet */
+    OS_SocketAddrInit(&TO_LAB_Global.tlm_dest_addr, OS_SocketDomain_INET);
+    OS_SocketAddrSetPort(&TO_LAB_Global.tlm_dest_addr, cfgTLM_PORT);
+    OS_SocketAddrFromString(&TO_LAB_Global.tlm_dest_addr, TO_LAB_Global.tlm_dest_IP);
+
     CFE_EVS_SendEvent(TO_TLMOUTENA_INF_EID, CFE_EVS_EventType_INFORMATION, "TO telemetry output enabled for IP %s",
                       TO_LAB_Global.tlm_dest_IP);
 
@@ -280,6 +462,47 @@ int32 TO_LAB_EnableOutput(const TO_LAB_EnableOutput_t *data)
     return CFE_SUCCESS;
 } /* End of TO_LAB_EnableOutput() */
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_LAB_wait_for_input() -- Wait for a command or telemetry      */
+/*                                                                 */
+/*    Returns as soon as either pipe holds a message, or after     */
+/*    TO_TASK_MSEC, or when a partly filled frame is due to be     */
+/*    sent or queued packets may be sent.  Falls back to a fixed   */
+/*    delay if the pipes cannot be waited on.                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void TO_LAB_wait_for_input(void)
+{
+    OS_FdSet ReadSet;
+    int32    status = OS_ERR_OPERATION_NOT_SUPPORTED;
+    int32    msecs  = TO_LAB_frame_wait_msec();
+
+    /* packets held back by the downlink rate are sent as tokens accrue */
+    if (msecs > TO_LAB_SHAPER_MSEC && !TO_LAB_queues_empty())
+    {
+        msecs = TO_LAB_SHAPER_MSEC;
+    }
+
+    if (TO_LAB_Global.wait_on_pipes)
+    {
+        OS_SelectFdZero(&ReadSet);
+        OS_SelectFdAdd(&ReadSet, TO_LAB_Global.Cmd_queue);
+        OS_SelectFdAdd(&ReadSet, TO_LAB_Global.Tlm_queue);
+
+        status = OS_SelectMultiple(&ReadSet, NULL, msecs);
+        if (status == OS_ERR_OPERATION_NOT_SUPPORTED)
+        {
+            TO_LAB_Global.wait_on_pipes = false;
+        }
+    }
+
+    if (status != OS_SUCCESS && status != OS_ERROR_TIMEOUT)
+    {
+        OS_TaskDelay(msecs); /*2 Hz, or sooner to flush a frame*/
+    }
+} /* End of TO_LAB_wait_for_input() */
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* TO_process_commands() -- Process command pipe message           */
@@ -361,6 +584,26 @@ void TO_LAB_exec_local_command(CFE_SB_MsgPtr_t cmd)
             TO_LAB_EnableOutput((const TO_LAB_EnableOutput_t *)cmd);
             break;
 
+        case TO_SET_OUTPUT_MODE_CC:
+            TO_LAB_SetOutputMode((const TO_LAB_SetOutputMode_t *)cmd);
+            break;
+
+        case TO_SET_PKT_FILTER_CC:
+            TO_LAB_SetPktFilter((const TO_LAB_SetPktFilter_t *)cmd);
+            break;
+
+        case TO_SEND_PKT_STATS_CC:
+            TO_LAB_SendPktStats((const TO_LAB_SendPktStats_t *)cmd);
+            break;
+
+        case TO_SET_DOWNLINK_RATE_CC:
+            TO_LAB_SetDownlinkRate((const TO_LAB_SetDownlinkRate_t *)cmd);
+            break;
+
+        case TO_SET_COMPRESSION_CC:
+            TO_LAB_SetCompression((const TO_LAB_SetCompression_t *)cmd);
+            break;
+
         default:
             CFE_EVS_SendEvent(TO_FNCODE_ERR_EID, CFE_EVS_EventType_ERROR,
                               "L%d TO: Invalid Function Code Rcvd In Ground Command 0x%x", __LINE__, CommandCode);
@@ -388,8 +631,38 @@ int32 TO_LAB_Noop(const TO_LAB_Noop_t *data)
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 int32 TO_LAB_ResetCounters(const TO_LAB_ResetCounters_t *data)
 {
+    uint16 i;
+
     TO_LAB_Global.HkBuf.HkTlm.Payload.CommandErrorCounter = 0;
     TO_LAB_Global.HkBuf.HkTlm.Payload.CommandCounter      = 0;
+    TO_LAB_Global.HkBuf.HkTlm.Payload.PacketsSent         = 0;
+    TO_LAB_Global.HkBuf.HkTlm.Payload.PacketsDropped      = 0;
+    TO_LAB_Global.HkBuf.HkTlm.Payload.SendCalls           = 0;
+    TO_LAB_Global.HkBuf.HkTlm.Payload.PacketsPerSend      = 0;
+    TO_LAB_Global.HkBuf.HkTlm.Payload.MaxPacketsPerSend   = 0;
+    TO_LAB_Global.HkBuf.HkTlm.Payload.FramesSent          = 0;
+    TO_LAB_Global.HkBuf.HkTlm.Payload.PacketsFramed       = 0;
+    TO_LAB_Global.HkBuf.HkTlm.Payload.PacketsDecimated    = 0;
+    TO_LAB_Global.HkBuf.HkTlm.Payload.QueueOverflows      = 0;
+    TO_LAB_Global.HkPacketsSent                           = 0;
+    TO_LAB_Global.HkSendCalls                             = 0;
+
+    for (i = 0; i < TO_LAB_Global.FilterCount; ++i)
+    {
+        TO_LAB_Global.Filters[i].PacketsSent      = 0;
+        TO_LAB_Global.Filters[i].PacketsDecimated = 0;
+        TO_LAB_Global.Filters[i].PacketsDropped   = 0;
+    }
+
+    for (i = 0; i < TO_LAB_MAX_COMPRESSED; ++i)
+    {
+        TO_LAB_Global.HkBuf.HkTlm.Payload.Compress[i].RatioPercent      = 0;
+        TO_LAB_Global.HkBuf.HkTlm.Payload.Compress[i].PacketsCompressed = 0;
+        TO_LAB_Global.HkBuf.HkTlm.Payload.Compress[i].BytesIn           = 0;
+        TO_LAB_Global.HkBuf.HkTlm.Payload.Compress[i].BytesOut          = 0;
+        TO_LAB_Global.HkBuf.HkTlm.Payload.Compress[i].Usecs             = 0;
+        TO_LAB_Global.CompressRefs[i].Ticks                             = 0;
+    }
     return CFE_SUCCESS;
 } /* End of TO_LAB_ResetCounters() */
 
@@ -451,11 +724,200 @@ int32 TO_LAB_SendDataTypes(const TO_LAB_SendDataTypes_t *data)
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 int32 TO_LAB_SendHousekeeping(const CFE_SB_CmdHdr_t *data)
 {
+    TO_LAB_HkTlm_Payload_t *Payload = &TO_LAB_Global.HkBuf.HkTlm.Payload;
+    uint32                  i;
+
+    for (i = 0; i < TO_LAB_NUM_QUEUES; ++i)
+    {
+        Payload->QueuePackets[i] = TO_LAB_Global.Queues[i].Packets;
+    }
+
+    for (i = 0; i < TO_LAB_MAX_COMPRESSED; ++i)
+    {
+        if (Payload->Compress[i].BytesIn != 0)
+        {
+            Payload->Compress[i].RatioPercent =
+                ((uint64)Payload->Compress[i].BytesOut * 100) / Payload->Compress[i].BytesIn;
+        }
+        Payload->Compress[i].Usecs =
+            (TO_LAB_Global.CompressRefs[i].Ticks * 1000000) / CFE_PSP_GetTimerTicksPerSecond();
+    }
+
+    if (Payload->SendCalls != TO_LAB_Global.HkSendCalls)
+    {
+        Payload->PacketsPerSend = (Payload->PacketsSent - TO_LAB_Global.HkPacketsSent) /
+                                  (Payload->SendCalls - TO_LAB_Global.HkSendCalls);
+    }
+    else
+    {
+        Payload->PacketsPerSend = 0;
+    }
+    TO_LAB_Global.HkPacketsSent = Payload->PacketsSent;
+    TO_LAB_Global.HkSendCalls   = Payload->SendCalls;
+
     CFE_SB_TimeStampMsg(&TO_LAB_Global.HkBuf.MsgHdr);
     CFE_SB_SendMsg(&TO_LAB_Global.HkBuf.MsgHdr);
     return CFE_SUCCESS;
 } /* End of TO_LAB_SendHousekeeping() */
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_LAB_SetOutputMode() -- Packets or frames                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 TO_LAB_SetOutputMode(const TO_LAB_SetOutputMode_t *data)
+{
+    const TO_LAB_SetOutputMode_Payload_t *pCmd = &data->Payload;
+
+    if (pCmd->Mode != TO_LAB_OUTPUT_PACKETS && pCmd->Mode != TO_LAB_OUTPUT_FRAMES)
+    {
+        CFE_EVS_SendEvent(TO_OUTPUTMODE_ERR_EID, CFE_EVS_EventType_ERROR, "L%d TO Invalid output mode %u", __LINE__,
+                          (unsigned int)pCmd->Mode);
+        ++TO_LAB_Global.HkBuf.HkTlm.Payload.CommandErrorCounter;
+        return CFE_SUCCESS;
+    }
+
+    /* send what was framed in the old mode before switching */
+    TO_LAB_close_frame();
+    TO_LAB_send_batch();
+
+    TO_LAB_Global.OutputMode                     = pCmd->Mode;
+    TO_LAB_Global.HkBuf.HkTlm.Payload.OutputMode = pCmd->Mode;
+
+    CFE_EVS_SendEvent(TO_OUTPUTMODE_INF_EID, CFE_EVS_EventType_INFORMATION, "TO output mode %s",
+                      (pCmd->Mode == TO_LAB_OUTPUT_FRAMES) ? "frames" : "packets");
+
+    ++TO_LAB_Global.HkBuf.HkTlm.Payload.CommandCounter;
+    return CFE_SUCCESS;
+} /* End of TO_LAB_SetOutputMode() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_LAB_SetPktFilter() -- Decimation and queue of a message ID   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 TO_LAB_SetPktFilter(const TO_LAB_SetPktFilter_t *data)
+{
+    const TO_LAB_SetPktFilter_Payload_t *pCmd   = &data->Payload;
+    TO_LAB_Filter_t *                    Filter = TO_LAB_get_filter(pCmd->Stream);
+
+    if (Filter == NULL || pCmd->Queue >= TO_LAB_NUM_QUEUES)
+    {
+        CFE_EVS_SendEvent(TO_PKTFILTER_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "L%d TO Can't set filter of 0x%x to queue %u, not subscribed or no such queue", __LINE__,
+                          (unsigned int)CFE_SB_MsgIdToValue(pCmd->Stream), (unsigned int)pCmd->Queue);
+        ++TO_LAB_Global.HkBuf.HkTlm.Payload.CommandErrorCounter;
+        return CFE_SUCCESS;
+    }
+
+    Filter->Decimation = pCmd->Decimation;
+    Filter->Skipped    = pCmd->Decimation;
+    Filter->Queue      = pCmd->Queue;
+
+    CFE_EVS_SendEvent(TO_PKTFILTER_INF_EID, CFE_EVS_EventType_INFORMATION, "L%d TO Filter 0x%x, every %u, queue %u",
+                      __LINE__, (unsigned int)CFE_SB_MsgIdToValue(pCmd->Stream), (unsigned int)pCmd->Decimation,
+                      (unsigned int)pCmd->Queue);
+
+    ++TO_LAB_Global.HkBuf.HkTlm.Payload.CommandCounter;
+    return CFE_SUCCESS;
+} /* End of TO_LAB_SetPktFilter() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_LAB_SendPktStats() -- Output per-MsgId statistics            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 TO_LAB_SendPktStats(const TO_LAB_SendPktStats_t *data)
+{
+    TO_LAB_PktStats_Payload_t *Payload = &TO_LAB_Global.PktStatsBuf.PktStats.Payload;
+    TO_LAB_PktStats_Entry_t *  Entry;
+    TO_LAB_Filter_t *          Filter;
+    uint16                     i;
+
+    i = 0;
+    do
+    {
+        CFE_SB_InitMsg(&TO_LAB_Global.PktStatsBuf.MsgHdr, TO_LAB_PKT_STATS_MID,
+                       sizeof(TO_LAB_Global.PktStatsBuf.PktStats), true);
+
+        Payload->FirstEntry = i;
+        while (i < TO_LAB_Global.FilterCount && Payload->EntryCount < TO_LAB_PKT_STATS_ENTRIES)
+        {
+            Filter = &TO_LAB_Global.Filters[i];
+            Entry  = &Payload->Entry[Payload->EntryCount];
+
+            Entry->Stream           = Filter->Stream;
+            Entry->Decimation       = Filter->Decimation;
+            Entry->Queue            = Filter->Queue;
+            Entry->PacketsSent      = Filter->PacketsSent;
+            Entry->PacketsDecimated = Filter->PacketsDecimated;
+            Entry->PacketsDropped   = Filter->PacketsDropped;
+
+            ++Payload->EntryCount;
+            ++i;
+        }
+
+        CFE_SB_SetTotalMsgLength(&TO_LAB_Global.PktStatsBuf.MsgHdr,
+                                 sizeof(TO_LAB_PktStats_t) - ((TO_LAB_PKT_STATS_ENTRIES - Payload->EntryCount) *
+                                                              sizeof(TO_LAB_PktStats_Entry_t)));
+        CFE_SB_TimeStampMsg(&TO_LAB_Global.PktStatsBuf.MsgHdr);
+        CFE_SB_SendMsg(&TO_LAB_Global.PktStatsBuf.MsgHdr);
+    } while (i < TO_LAB_Global.FilterCount);
+
+    ++TO_LAB_Global.HkBuf.HkTlm.Payload.CommandCounter;
+    return CFE_SUCCESS;
+} /* End of TO_LAB_SendPktStats() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_LAB_SetDownlinkRate() -- Limit the telemetry output rate     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 TO_LAB_SetDownlinkRate(const TO_LAB_SetDownlinkRate_t *data)
+{
+    const TO_LAB_SetDownlinkRate_Payload_t *pCmd = &data->Payload;
+
+    TO_LAB_Global.DownlinkRate  = pCmd->BytesPerSec;
+    TO_LAB_Global.DownlinkBurst = (pCmd->BurstBytes != 0) ? pCmd->BurstBytes : pCmd->BytesPerSec;
+    TO_LAB_Global.Tokens        = TO_LAB_Global.DownlinkBurst;
+    OS_GetLocalTime(&TO_LAB_Global.TokenTime);
+
+    TO_LAB_Global.HkBuf.HkTlm.Payload.DownlinkRate = pCmd->BytesPerSec;
+
+    CFE_EVS_SendEvent(TO_DOWNLINKRATE_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "TO downlink rate %lu bytes/sec, burst %lu bytes", (unsigned long)TO_LAB_Global.DownlinkRate,
+                      (unsigned long)TO_LAB_Global.DownlinkBurst);
+
+    ++TO_LAB_Global.HkBuf.HkTlm.Payload.CommandCounter;
+    return CFE_SUCCESS;
+} /* End of TO_LAB_SetDownlinkRate() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_LAB_SetCompression() -- Compress a message ID or stop        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 TO_LAB_SetCompression(const TO_LAB_SetCompression_t *data)
+{
+    const TO_LAB_SetCompression_Payload_t *pCmd   = &data->Payload;
+    TO_LAB_Filter_t *                      Filter = TO_LAB_get_filter(pCmd->Stream);
+
+    if (Filter == NULL || !TO_LAB_enable_compression(Filter, pCmd->Enable != 0))
+    {
+        CFE_EVS_SendEvent(TO_COMPRESS_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "L%d TO Can't compress 0x%x, not subscribed or all %d slots in use", __LINE__,
+                          (unsigned int)CFE_SB_MsgIdToValue(pCmd->Stream), TO_LAB_MAX_COMPRESSED);
+        ++TO_LAB_Global.HkBuf.HkTlm.Payload.CommandErrorCounter;
+        return CFE_SUCCESS;
+    }
+
+    CFE_EVS_SendEvent(TO_COMPRESS_INF_EID, CFE_EVS_EventType_INFORMATION, "L%d TO Compression of 0x%x %s", __LINE__,
+                      (unsigned int)CFE_SB_MsgIdToValue(pCmd->Stream), (pCmd->Enable != 0) ? "on" : "off");
+
+    ++TO_LAB_Global.HkBuf.HkTlm.Payload.CommandCounter;
+    return CFE_SUCCESS;
+} /* End of TO_LAB_SetCompression() */
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* TO_openTLM() -- Open TLM                                        */
@@ -484,6 +946,7 @@ void TO_LAB_openTLM(void)
 int32 TO_LAB_AddPacket(const TO_LAB_AddPacket_t *data)
 {
     const TO_LAB_AddPacket_Payload_t *pCmd = &data->Payload;
+    TO_LAB_Filter_t *                 Filter;
     int32                             status;
 
     status = CFE_SB_SubscribeEx(pCmd->Stream, TO_LAB_Global.Tlm_pipe, pCmd->Flags, pCmd->BufLimit);
@@ -492,9 +955,17 @@ int32 TO_LAB_AddPacket(const TO_LAB_AddPacket_t *data)
         CFE_EVS_SendEvent(TO_ADDPKT_ERR_EID, CFE_EVS_EventType_ERROR, "L%d TO Can't subscribe 0x%x status %i", __LINE__,
                           (unsigned int)CFE_SB_MsgIdToValue(pCmd->Stream), (int)status);
     else
+    {
+        Filter = TO_LAB_add_filter(pCmd->Stream);
+        if (Filter != NULL)
+        {
+            Filter->HighPriority = (pCmd->Flags.Priority != 0);
+            Filter->Queue        = Filter->HighPriority ? 0 : TO_LAB_DEFAULT_QUEUE;
+        }
         CFE_EVS_SendEvent(TO_ADDPKT_INF_EID, CFE_EVS_EventType_INFORMATION, "L%d TO AddPkt 0x%x, QoS %d.%d, limit %d",
                           __LINE__, (unsigned int)CFE_SB_MsgIdToValue(pCmd->Stream), pCmd->Flags.Priority,
                           pCmd->Flags.Reliability, pCmd->BufLimit);
+    }
 
     ++TO_LAB_Global.HkBuf.HkTlm.Payload.CommandCounter;
     return CFE_SUCCESS;
@@ -516,8 +987,12 @@ int32 TO_LAB_RemovePacket(const TO_LAB_RemovePacket_t *data)
                           "L%d TO Can't Unsubscribe to Stream 0x%x on pipe %d, status %i", __LINE__,
                           (unsigned int)CFE_SB_MsgIdToValue(pCmd->Stream), TO_LAB_Global.Tlm_pipe, (int)status);
     else
+    {
+        TO_LAB_enable_compression(TO_LAB_get_filter(pCmd->Stream), false);
+        TO_LAB_remove_filter(pCmd->Stream);
         CFE_EVS_SendEvent(TO_REMOVEPKT_INF_EID, CFE_EVS_EventType_INFORMATION, "L%d TO RemovePkt 0x%x", __LINE__,
                           (unsigned int)CFE_SB_MsgIdToValue(pCmd->Stream));
+    }
     ++TO_LAB_Global.HkBuf.HkTlm.Payload.CommandCounter;
     return CFE_SUCCESS;
 } /* End of TO_LAB_RemovePacket() */
@@ -545,6 +1020,13 @@ int32 TO_LAB_RemoveAll(const TO_LAB_RemoveAll_t *data)
         }
     }
 
+    for (i = 0; i < TO_LAB_Global.FilterCount; ++i)
+    {
+        TO_LAB_enable_compression(&TO_LAB_Global.Filters[i], false);
+    }
+    memset(TO_LAB_Global.FilterIndex, 0, sizeof(TO_LAB_Global.FilterIndex));
+    TO_LAB_Global.FilterCount = 0;
+
     /* remove commands as well */
     status = CFE_SB_Unsubscribe(TO_LAB_CMD_MID, TO_LAB_Global.Cmd_pipe);
     if (status != CFE_SUCCESS)
@@ -567,51 +1049,693 @@ int32 TO_LAB_RemoveAll(const TO_LAB_RemoveAll_t *data)
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* TO_forward_telemetry() -- Forward telemetry                     */
+/* TO_LAB_send_batch() -- Send the gathered packets                */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-void TO_LAB_forward_telemetry(void)
+void TO_LAB_send_batch(void)
 {
-    OS_SockAddr_t d_addr;
-    int32         status;
-    int32         CFE_SB_status;
-    uint16        size;
-    CFE_SB_Msg_t *PktPtr;
+    TO_LAB_HkTlm_Payload_t *Payload = &TO_LAB_Global.HkBuf.HkTlm.Payload;
+    int32                   status;
+
+    if (TO_LAB_Global.BatchCount == 0)
+    {
+        return;
+    }
+
+    CFE_ES_PerfLogEntry(TO_SOCKET_SEND_PERF_ID);
+
+    status = OS_SocketSendToMulti(TO_LAB_Global.TLMsockid, TO_LAB_Global.BatchMsgs, TO_LAB_Global.BatchCount,
+                                  &TO_LAB_Global.tlm_dest_addr);
+
+    CFE_ES_PerfLogExit(TO_SOCKET_SEND_PERF_ID);
+
+    ++Payload->SendCalls;
+
+    if (status < 0)
+    {
+        CFE_EVS_SendEvent(TO_TLMOUTSTOP_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "L%d TO sendto error %d. Tlm output supressed\n", __LINE__, (int)status);
+        TO_LAB_Global.suppress_sendto = true;
+        Payload->PacketsDropped += TO_LAB_Global.BatchCount;
+    }
+    else
+    {
+        /* a short count means the socket buffer is full, the rest are lost */
+        Payload->PacketsSent += status;
+        Payload->PacketsDropped += TO_LAB_Global.BatchCount - status;
+        if (status > Payload->MaxPacketsPerSend)
+        {
+            Payload->MaxPacketsPerSend = status;
+        }
+    }
+
+    TO_LAB_Global.BatchCount = 0;
+    TO_LAB_Global.BatchBytes = 0;
+} /* End of TO_LAB_send_batch() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_LAB_queue_datagram() -- Add a datagram to the next send      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void TO_LAB_queue_datagram(const void *data, uint16 size)
+{
+    uint8 *BatchPtr;
+
+    if (TO_LAB_Global.BatchCount == TO_LAB_MAX_BATCH || (TO_LAB_Global.BatchBytes + size) > TO_LAB_BATCH_BYTES)
+    {
+        TO_LAB_send_batch();
+    }
+
+    if (TO_LAB_Global.suppress_sendto == true)
+    {
+        /* the send above failed, drop the rest as the per-packet sends did */
+    }
+    else if (size > TO_LAB_BATCH_BYTES)
+    {
+        /* too large to gather, send it straight from where it is */
+        TO_LAB_Global.BatchMsgs[0].buffer = data;
+        TO_LAB_Global.BatchMsgs[0].buflen = size;
+        TO_LAB_Global.BatchCount          = 1;
+        TO_LAB_send_batch();
+    }
+    else
+    {
+        BatchPtr = &TO_LAB_Global.BatchBuf[TO_LAB_Global.BatchBytes];
+        memcpy(BatchPtr, data, size);
+
+        TO_LAB_Global.BatchMsgs[TO_LAB_Global.BatchCount].buffer = BatchPtr;
+        TO_LAB_Global.BatchMsgs[TO_LAB_Global.BatchCount].buflen = size;
+        ++TO_LAB_Global.BatchCount;
+        TO_LAB_Global.BatchBytes += size;
+    }
+} /* End of TO_LAB_queue_datagram() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_LAB_frame_packet() -- Add a packet to the current frame      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void TO_LAB_frame_packet(const CFE_SB_Msg_t *PktPtr, uint16 size)
+{
+    if ((TO_LAB_Global.FrameBytes + size) > TO_LAB_FRAME_SIZE)
+    {
+        TO_LAB_close_frame();
+    }
+
+    if (TO_LAB_Global.FramePackets == 0)
+    {
+        TO_LAB_Global.FrameBytes = sizeof(TO_LAB_FrameHdr_t);
+        OS_GetLocalTime(&TO_LAB_Global.FrameStart);
+    }
+
+    memcpy(&TO_LAB_Global.FrameBuf[TO_LAB_Global.FrameBytes], PktPtr, size);
+    TO_LAB_Global.FrameBytes += size;
+    ++TO_LAB_Global.FramePackets;
+} /* End of TO_LAB_frame_packet() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_LAB_close_frame() -- Add the current frame to the next send  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void TO_LAB_close_frame(void)
+{
+    TO_LAB_HkTlm_Payload_t *Payload = &TO_LAB_Global.HkBuf.HkTlm.Payload;
+    TO_LAB_FrameHdr_t *     Hdr     = (TO_LAB_FrameHdr_t *)TO_LAB_Global.FrameBuf;
+
+    if (TO_LAB_Global.FramePackets == 1)
+    {
+        /* nothing to gain from a header, send the packet as it is */
+        TO_LAB_queue_datagram(&TO_LAB_Global.FrameBuf[sizeof(TO_LAB_FrameHdr_t)],
+                              TO_LAB_Global.FrameBytes - sizeof(TO_LAB_FrameHdr_t));
+    }
+    else if (TO_LAB_Global.FramePackets > 1)
+    {
+        Hdr->Sync[0]        = (TO_LAB_FRAME_SYNC >> 24) & 0xFF;
+        Hdr->Sync[1]        = (TO_LAB_FRAME_SYNC >> 16) & 0xFF;
+        Hdr->Sync[2]        = (TO_LAB_FRAME_SYNC >> 8) & 0xFF;
+        Hdr->Sync[3]        = TO_LAB_FRAME_SYNC & 0xFF;
+        Hdr->Sequence[0]    = TO_LAB_Global.FrameSequence >> 8;
+        Hdr->Sequence[1]    = TO_LAB_Global.FrameSequence & 0xFF;
+        Hdr->PacketCount[0] = TO_LAB_Global.FramePackets >> 8;
+        Hdr->PacketCount[1] = TO_LAB_Global.FramePackets & 0xFF;
+
+        ++TO_LAB_Global.FrameSequence;
+        ++Payload->FramesSent;
+        Payload->PacketsFramed += TO_LAB_Global.FramePackets;
+
+        TO_LAB_queue_datagram(TO_LAB_Global.FrameBuf, TO_LAB_Global.FrameBytes);
+    }
+
+    TO_LAB_Global.FramePackets = 0;
+    TO_LAB_Global.FrameBytes   = 0;
+} /* End of TO_LAB_close_frame() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_LAB_frame_wait_msec() -- Time until the frame must be sent   */
+/*                                                                 */
+/*    Returns TO_TASK_MSEC when no frame is being filled.          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 TO_LAB_frame_wait_msec(void)
+{
+    OS_time_t Now;
+    int32     Elapsed;
+
+    if (TO_LAB_Global.FramePackets == 0 || TO_LAB_FRAME_FLUSH_MSEC >= TO_TASK_MSEC)
+    {
+        return TO_TASK_MSEC;
+    }
+
+    OS_GetLocalTime(&Now);
+    Elapsed = (int32)(Now.seconds - TO_LAB_Global.FrameStart.seconds) * 1000 +
+              ((int32)Now.microsecs - (int32)TO_LAB_Global.FrameStart.microsecs) / 1000;
+
+    /* a clock that stepped back also sends the frame now */
+    if (Elapsed < 0 || Elapsed >= TO_LAB_FRAME_FLUSH_MSEC)
+    {
+        return 0;
+    }
+
+    return TO_LAB_FRAME_FLUSH_MSEC - Elapsed;
+} /* End of TO_LAB_frame_wait_msec() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_LAB_get_filter() -- Find the filter of a message ID          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+TO_LAB_Filter_t *TO_LAB_get_filter(CFE_SB_MsgId_t MsgId)
+{
+    CFE_SB_MsgId_Atom_t Value = CFE_SB_MsgIdToValue(MsgId);
+
+    if (Value > CFE_PLATFORM_SB_HIGHEST_VALID_MSGID || TO_LAB_Global.FilterIndex[Value] == 0)
+    {
+        return NULL;
+    }
+
+    return &TO_LAB_Global.Filters[TO_LAB_Global.FilterIndex[Value] - 1];
+} /* End of TO_LAB_get_filter() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_LAB_add_filter() -- Find or create the filter of a message ID */
+/*                                                                 */
+/*    A new filter forwards every packet to TO_LAB_DEFAULT_QUEUE.  */
+/*    Returns NULL if the message ID is out of range or there are  */
+/*    no free filters, in which case the packets are treated the   */
+/*    same way.                                                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+TO_LAB_Filter_t *TO_LAB_add_filter(CFE_SB_MsgId_t MsgId)
+{
+    CFE_SB_MsgId_Atom_t Value  = CFE_SB_MsgIdToValue(MsgId);
+    TO_LAB_Filter_t *   Filter = TO_LAB_get_filter(MsgId);
+
+    if (Filter != NULL || Value > CFE_PLATFORM_SB_HIGHEST_VALID_MSGID ||
+        TO_LAB_Global.FilterCount >= TO_LAB_MAX_FILTERS)
+    {
+        return Filter;
+    }
+
+    Filter = &TO_LAB_Global.Filters[TO_LAB_Global.FilterCount];
+    memset(Filter, 0, sizeof(*Filter));
+    Filter->Stream = MsgId;
+    Filter->Queue  = TO_LAB_DEFAULT_QUEUE;
+
+    ++TO_LAB_Global.FilterCount;
+    TO_LAB_Global.FilterIndex[Value] = TO_LAB_Global.FilterCount;
+
+    return Filter;
+} /* End of TO_LAB_add_filter() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_LAB_remove_filter() -- Forget the filter of a message ID     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void TO_LAB_remove_filter(CFE_SB_MsgId_t MsgId)
+{
+    TO_LAB_Filter_t *Filter = TO_LAB_get_filter(MsgId);
+    TO_LAB_Filter_t *Last;
+
+    if (Filter == NULL)
+    {
+        return;
+    }
+
+    /* keep the filters packed by moving the last one into the gap */
+    Last = &TO_LAB_Global.Filters[TO_LAB_Global.FilterCount - 1];
+    TO_LAB_Global.FilterIndex[CFE_SB_MsgIdToValue(MsgId)] = 0;
+    if (Last != Filter)
+    {
+        *Filter                                                     = *Last;
+        TO_LAB_Global.FilterIndex[CFE_SB_MsgIdToValue(Last->Stream)] = (Filter - TO_LAB_Global.Filters) + 1;
+    }
+
+    --TO_LAB_Global.FilterCount;
+} /* End of TO_LAB_remove_filter() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_LAB_enqueue_packet() -- Decimate and queue a packet          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void TO_LAB_enqueue_packet(const CFE_SB_Msg_t *PktPtr, uint16 size)
+{
+    TO_LAB_HkTlm_Payload_t *Payload = &TO_LAB_Global.HkBuf.HkTlm.Payload;
+    TO_LAB_Filter_t *       Filter  = TO_LAB_get_filter(CFE_SB_GetMsgId(PktPtr));
+    TO_LAB_OutputQueue_t *  Queue;
+    uint32                  Needed = (size + 3) & ~3;
+    uint32                  Offset;
+
+    if (Filter != NULL && Filter->Decimation > 1)
+    {
+        if (Filter->Skipped < (Filter->Decimation - 1))
+        {
+            ++Filter->Skipped;
+            ++Filter->PacketsDecimated;
+            ++Payload->PacketsDecimated;
+            return;
+        }
+        Filter->Skipped = 0;
+    }
+
+    if (Needed > TO_LAB_QUEUE_BYTES)
+    {
+        /* can never be queued, send it at once regardless of the rate */
+        TO_LAB_output_packet(PktPtr, size);
+        return;
+    }
+
+    Queue = &TO_LAB_Global.Queues[(Filter != NULL) ? Filter->Queue : TO_LAB_DEFAULT_QUEUE];
+
+    if (TO_LAB_Global.DownlinkRate == 0 && Queue->Packets == 0)
+    {
+        /*
+         * no rate limit and nothing queued ahead of it, so send it at once.
+         * A queue only fills when the rate was just lifted, and it is then
+         * drained before its packets are sent directly again.
+         */
+        TO_LAB_output_packet(PktPtr, size);
+        return;
+    }
+
+    if (Queue->Packets == 0)
+    {
+        Queue->Head    = 0;
+        Queue->Tail    = 0;
+        Queue->Wrapped = false;
+    }
+
+    if (!Queue->Wrapped && (Queue->Tail + Needed) > TO_LAB_QUEUE_BYTES && Needed <= Queue->Head)
+    {
+        Queue->Wrap    = Queue->Tail;
+        Queue->Tail    = 0;
+        Queue->Wrapped = true;
+    }
+
+    if ((Queue->Wrapped && (Queue->Tail + Needed) > Queue->Head) ||
+        (!Queue->Wrapped && (Queue->Tail + Needed) > TO_LAB_QUEUE_BYTES))
+    {
+        if (Filter != NULL)
+        {
+            ++Filter->PacketsDropped;
+        }
+        ++Payload->QueueOverflows;
+        return;
+    }
+
+    Offset = Queue->Tail;
+    memcpy((uint8 *)Queue->Buf + Offset, PktPtr, size);
+    Queue->Tail += Needed;
+    ++Queue->Packets;
+} /* End of TO_LAB_enqueue_packet() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_LAB_output_packet() -- Frame or send a packet                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void TO_LAB_output_packet(const CFE_SB_Msg_t *PktPtr, uint16 size)
+{
+    TO_LAB_Filter_t *Filter = TO_LAB_get_filter(CFE_SB_GetMsgId(PktPtr));
+
+    if (Filter != NULL)
+    {
+        ++Filter->PacketsSent;
+
+        if (Filter->CompressSlot != 0)
+        {
+            PktPtr = TO_LAB_compress_packet(Filter, PktPtr, &size);
+        }
+    }
+
+    /* high priority packets are never held back in a frame */
+    if (TO_LAB_Global.OutputMode == TO_LAB_OUTPUT_FRAMES && size <= (TO_LAB_FRAME_SIZE - sizeof(TO_LAB_FrameHdr_t)) &&
+        (Filter == NULL || !Filter->HighPriority))
+    {
+        TO_LAB_frame_packet(PktPtr, size);
+    }
+    else
+    {
+        TO_LAB_queue_datagram(PktPtr, size);
+    }
+} /* End of TO_LAB_output_packet() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_LAB_enable_compression() -- Give a filter a compression slot */
+/*                                                                 */
+/*    Returns false if Filter is NULL, or if compression is to be  */
+/*    enabled but all slots are in use.                            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool TO_LAB_enable_compression(TO_LAB_Filter_t *Filter, bool Enable)
+{
+    TO_LAB_CompressStats_t *Stats;
+    uint32                  i;
+
+    if (Filter == NULL)
+    {
+        return false;
+    }
+
+    if (!Enable)
+    {
+        if (Filter->CompressSlot != 0)
+        {
+            TO_LAB_Global.CompressRefs[Filter->CompressSlot - 1].InUse                   = false;
+            TO_LAB_Global.HkBuf.HkTlm.Payload.Compress[Filter->CompressSlot - 1].Stream = TO_UNUSED;
+            Filter->CompressSlot                                                         = 0;
+        }
+        return true;
+    }
+
+    if (Filter->CompressSlot != 0)
+    {
+        return true;
+    }
+
+    for (i = 0; i < TO_LAB_MAX_COMPRESSED; ++i)
+    {
+        if (!TO_LAB_Global.CompressRefs[i].InUse)
+        {
+            TO_LAB_Global.CompressRefs[i].InUse    = true;
+            TO_LAB_Global.CompressRefs[i].Length   = 0;
+            TO_LAB_Global.CompressRefs[i].SinceKey = 0;
+            TO_LAB_Global.CompressRefs[i].Ticks    = 0;
+
+            Stats = &TO_LAB_Global.HkBuf.HkTlm.Payload.Compress[i];
+            memset(Stats, 0, sizeof(*Stats));
+            Stats->Stream = Filter->Stream;
+
+            Filter->CompressSlot = i + 1;
+            return true;
+        }
+    }
+
+    return false;
+} /* End of TO_LAB_enable_compression() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_LAB_timebase() -- The PSP timebase as one count              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint64 TO_LAB_timebase(void)
+{
+    uint32 Tbu;
+    uint32 Tbl;
+    uint32 Rollover = CFE_PSP_GetTimerLow32Rollover();
+
+    CFE_PSP_Get_Timebase(&Tbu, &Tbl);
+
+    if (Rollover == 0)
+    {
+        return ((uint64)Tbu << 32) | Tbl;
+    }
+
+    return ((uint64)Tbu * Rollover) + Tbl;
+} /* End of TO_LAB_timebase() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_LAB_compress_packet() -- Compress a packet if it gets smaller */
+/*                                                                 */
+/*    Returns the packet to send in its place and its size, which  */
+/*    may be the packet itself.                                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+const CFE_SB_Msg_t *TO_LAB_compress_packet(const TO_LAB_Filter_t *Filter, const CFE_SB_Msg_t *PktPtr, uint16 *size)
+{
+    TO_LAB_CompressRef_t *  Ref   = &TO_LAB_Global.CompressRefs[Filter->CompressSlot - 1];
+    TO_LAB_CompressStats_t *Stats = &TO_LAB_Global.HkBuf.HkTlm.Payload.Compress[Filter->CompressSlot - 1];
+    TO_LAB_CompressHdr_t *  Hdr   = (TO_LAB_CompressHdr_t *)&TO_LAB_Global.CompressBuf.Bytes[CFE_SB_TLM_HDR_SIZE];
+    const uint8 *           Pkt   = (const uint8 *)PktPtr;
+    const uint32            Overhead = CFE_SB_TLM_HDR_SIZE + sizeof(TO_LAB_CompressHdr_t);
+    uint64                  Start;
+    uint32                  Coded = 0;
+    bool                    Delta;
+
+    Stats->BytesIn += *size;
+
+    if (*size > TO_LAB_COMPRESS_MAX_PKT)
+    {
+        Stats->BytesOut += *size;
+        return PktPtr;
+    }
+
+    /* the ground loses track after a lost packet until one is coded on its own */
+    Delta = (Ref->Length == *size && Ref->SinceKey < TO_LAB_COMPRESS_KEYFRAME);
+
+    Start = TO_LAB_timebase();
+    if (*size > (Overhead + 1))
+    {
+        Coded = TO_LAB_Compress(&TO_LAB_Global.CompressBuf.Bytes[Overhead], *size - Overhead - 1, Pkt,
+                                Delta ? Ref->Data : NULL, *size);
+    }
+
+    if (Coded != 0)
+    {
+        Hdr->StreamId[0]    = Pkt[0];
+        Hdr->StreamId[1]    = Pkt[1];
+        Hdr->Method         = Delta ? TO_LAB_COMPRESS_DELTA : TO_LAB_COMPRESS_RAW;
+        Hdr->RefSequence[0] = Ref->Data[2];
+        Hdr->RefSequence[1] = Ref->Data[3];
+        Hdr->Length[0]      = *size >> 8;
+        Hdr->Length[1]      = *size & 0xFF;
+    }
+
+    /* a packet sent as it is starts the differences afresh, the same as a raw one */
+    Ref->SinceKey = (Coded != 0 && Delta) ? (Ref->SinceKey + 1) : 0;
+    Ref->Length   = *size;
+    memcpy(Ref->Data, Pkt, *size);
 
-    OS_SocketAddrInit(&d_addr, OS_SocketDomain_INET);
-    OS_SocketAddrSetPort(&d_addr, cfgTLM_PORT);
-    OS_SocketAddrFromString(&d_addr, TO_LAB_Global.tlm_dest_IP);
-    status = 0;
+    Ref->Ticks += TO_LAB_timebase() - Start;
+
+    if (Coded == 0)
+    {
+        Stats->BytesOut += *size;
+        return PktPtr;
+    }
+
+    *size = Overhead + Coded;
+    CFE_SB_SetTotalMsgLength(&TO_LAB_Global.CompressBuf.MsgHdr, *size);
+
+    ++Stats->PacketsCompressed;
+    Stats->BytesOut += *size;
+    return &TO_LAB_Global.CompressBuf.MsgHdr;
+} /* End of TO_LAB_compress_packet() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_LAB_take_tokens() -- Check a send against the downlink rate  */
+/*                                                                 */
+/*    Returns true, and uses up the tokens, if size bytes may be   */
+/*    sent now.  A packet larger than the burst size goes once the */
+/*    bucket is full.                                              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool TO_LAB_take_tokens(uint16 size)
+{
+    if (TO_LAB_Global.DownlinkRate == 0)
+    {
+        return true;
+    }
+
+    if (TO_LAB_Global.Tokens >= size)
+    {
+        TO_LAB_Global.Tokens -= size;
+        return true;
+    }
+
+    if (TO_LAB_Global.Tokens >= TO_LAB_Global.DownlinkBurst)
+    {
+        TO_LAB_Global.Tokens = 0;
+        return true;
+    }
+
+    return false;
+} /* End of TO_LAB_take_tokens() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_LAB_queues_empty() -- True if no packets are waiting         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool TO_LAB_queues_empty(void)
+{
+    uint32 i;
+
+    for (i = 0; i < TO_LAB_NUM_QUEUES; ++i)
+    {
+        if (TO_LAB_Global.Queues[i].Packets != 0)
+        {
+            return false;
+        }
+    }
+
+    return true;
+} /* End of TO_LAB_queues_empty() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_LAB_service_queues() -- Send queued packets                  */
+/*                                                                 */
+/*    The queues are served by deficit round robin, each getting   */
+/*    its weight in quanta per round, until they are empty or the  */
+/*    downlink rate is used up.                                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void TO_LAB_service_queues(void)
+{
+    static const uint32   Weights[TO_LAB_NUM_QUEUES] = TO_LAB_QUEUE_WEIGHTS;
+    TO_LAB_OutputQueue_t *Queue;
+    CFE_SB_Msg_t *        PktPtr;
+    OS_time_t             Now;
+    int64                 Elapsed;
+    uint64                Credit;
+    uint16                size;
+    uint32                i;
+    bool                  Backlog;
+
+    if (TO_LAB_Global.DownlinkRate != 0)
+    {
+        OS_GetLocalTime(&Now);
+        Elapsed = ((int64)Now.seconds - TO_LAB_Global.TokenTime.seconds) * 1000000 +
+                  ((int64)Now.microsecs - TO_LAB_Global.TokenTime.microsecs);
+        Credit = (Elapsed > 0) ? ((uint64)Elapsed * TO_LAB_Global.DownlinkRate) / 1000000 : 0;
+
+        /* the time is only moved on once at least one token is earned */
+        if (Elapsed < 0 || Credit > 0)
+        {
+            TO_LAB_Global.TokenTime = Now;
+        }
+
+        if (Credit >= (TO_LAB_Global.DownlinkBurst - TO_LAB_Global.Tokens))
+        {
+            TO_LAB_Global.Tokens = TO_LAB_Global.DownlinkBurst;
+        }
+        else
+        {
+            TO_LAB_Global.Tokens += Credit;
+        }
+    }
 
     do
     {
-        CFE_SB_status = CFE_SB_RcvMsg(&PktPtr, TO_LAB_Global.Tlm_pipe, CFE_SB_POLL);
+        Backlog = false;
 
-        if ((CFE_SB_status == CFE_SUCCESS) && (TO_LAB_Global.suppress_sendto == false))
+        for (i = 0; i < TO_LAB_NUM_QUEUES; ++i)
         {
-            size = CFE_SB_GetTotalMsgLength(PktPtr);
+            Queue = &TO_LAB_Global.Queues[i];
+            if (Queue->Packets == 0)
+            {
+                continue;
+            }
 
-            if (TO_LAB_Global.downlink_on == true)
+            /* cap the credit built up while waiting for the downlink rate */
+            Queue->Deficit += Weights[i] * TO_LAB_QUEUE_QUANTUM;
+            if (Queue->Deficit > (Weights[i] * TO_LAB_QUEUE_QUANTUM) + TO_LAB_QUEUE_BYTES)
             {
-                CFE_ES_PerfLogEntry(TO_SOCKET_SEND_PERF_ID);
+                Queue->Deficit = (Weights[i] * TO_LAB_QUEUE_QUANTUM) + TO_LAB_QUEUE_BYTES;
+            }
 
-                status = OS_SocketSendTo(TO_LAB_Global.TLMsockid, PktPtr, size, &d_addr);
+            while (Queue->Packets != 0)
+            {
+                PktPtr = (CFE_SB_Msg_t *)((uint8 *)Queue->Buf + Queue->Head);
+                size   = CFE_SB_GetTotalMsgLength(PktPtr);
+
+                if (size > Queue->Deficit)
+                {
+                    break;
+                }
+
+                if (!TO_LAB_take_tokens(size))
+                {
+                    return;
+                }
 
-                CFE_ES_PerfLogExit(TO_SOCKET_SEND_PERF_ID);
+                Queue->Deficit -= size;
+                TO_LAB_output_packet(PktPtr, size);
+
+                Queue->Head += (size + 3) & ~3;
+                --Queue->Packets;
+                if (Queue->Wrapped && Queue->Head >= Queue->Wrap)
+                {
+                    Queue->Head    = 0;
+                    Queue->Wrapped = false;
+                }
             }
-            else
+
+            if (Queue->Packets == 0)
             {
-                status = 0;
+                Queue->Deficit = 0;
             }
-            if (status < 0)
+            else
             {
-                CFE_EVS_SendEvent(TO_TLMOUTSTOP_ERR_EID, CFE_EVS_EventType_ERROR,
-                                  "L%d TO sendto error %d. Tlm output supressed\n", __LINE__, (int)status);
-                TO_LAB_Global.suppress_sendto = true;
+                Backlog = true;
             }
         }
+    } while (Backlog);
+} /* End of TO_LAB_service_queues() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_forward_telemetry() -- Forward telemetry                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void TO_LAB_forward_telemetry(void)
+{
+    int32         CFE_SB_status;
+    uint16        size;
+    CFE_SB_Msg_t *PktPtr;
+
+    do
+    {
+        CFE_SB_status = CFE_SB_RcvMsg(&PktPtr, TO_LAB_Global.Tlm_pipe, CFE_SB_POLL);
+
+        if ((CFE_SB_status == CFE_SUCCESS) && (TO_LAB_Global.suppress_sendto == false) &&
+            (TO_LAB_Global.downlink_on == true))
+        {
+            size = CFE_SB_GetTotalMsgLength(PktPtr);
+            TO_LAB_enqueue_packet(PktPtr, size);
+        }
         /* If CFE_SB_status != CFE_SUCCESS, then no packet was received from CFE_SB_RcvMsg() */
     } while (CFE_SB_status == CFE_SUCCESS);
+
+    TO_LAB_service_queues();
+
+    /* bound the time a packet can wait in a partly filled frame */
+    if (TO_LAB_Global.FramePackets != 0 && TO_LAB_frame_wait_msec() == 0)
+    {
+        TO_LAB_close_frame();
+    }
+
+    TO_LAB_send_batch();
 } /* End of TO_forward_telemetry() */
 
 /************************/
@@ -47,7 +47,7 @@
 
 /*****************************************************************************/
 
-#define TO_TASK_MSEC 500 /* run at 2 Hz */
+#define TO_TASK_MSEC 500 /* longest wait for commands or telemetry, run at least at 2 Hz */
 #define TO_UNUSED    CFE_SB_MSGID_RESERVED
 
 /**
@@ -60,6 +60,85 @@
  */
 #define TO_LAB_TLM_PIPE_DEPTH OS_QUEUE_MAX_DEPTH
 
+/**
+ * Maximum number of telemetry packets passed to the socket in one send
+ */
+#define TO_LAB_MAX_BATCH 32
+
+/**
+ * Size of the area that telemetry packets are gathered in between sends.
+ * Packets larger than this are sent on their own.
+ */
+#define TO_LAB_BATCH_BYTES 16384
+
+/**
+ * Output mode at startup, see TO_SET_OUTPUT_MODE_CC
+ */
+#define TO_LAB_OUTPUT_MODE_DEFAULT TO_LAB_OUTPUT_PACKETS
+
+/**
+ * Largest frame, including the frame header.  The default keeps each
+ * frame within one Ethernet MTU; raise it to send jumbo datagrams.
+ * Packets too large for a frame are sent on their own.
+ */
+#define TO_LAB_FRAME_SIZE 1400
+
+/**
+ * Longest time a packet waits in a partly filled frame, in msec
+ */
+#define TO_LAB_FRAME_FLUSH_MSEC 100
+
+/**
+ * Size of each output queue.  Packets wait here while the downlink rate
+ * is exceeded, and are dropped when their queue is full.  Packets larger
+ * than this are sent at once.
+ */
+#define TO_LAB_QUEUE_BYTES 16384
+
+/**
+ * Relative share of the downlink given to each output queue when they
+ * are all backlogged, in units of TO_LAB_QUEUE_QUANTUM bytes per round
+ */
+#define TO_LAB_QUEUE_WEIGHTS \
+    {                        \
+        4, 2, 1              \
+    }
+#define TO_LAB_QUEUE_QUANTUM 512
+
+/**
+ * Queue for message IDs added by command at low priority, or with no
+ * subscription entry.  Those added at high priority use queue 0.
+ */
+#define TO_LAB_DEFAULT_QUEUE 1
+
+/**
+ * Downlink rate limit at startup in bytes per second, 0 for no limit,
+ * and the most bytes sent at once after an idle period
+ */
+#define TO_LAB_DOWNLINK_RATE  0
+#define TO_LAB_DOWNLINK_BURST 16384
+
+/**
+ * Wakeup interval while packets wait for the downlink rate, in msec
+ */
+#define TO_LAB_SHAPER_MSEC 10
+
+/**
+ * Largest packet that is compressed, larger ones are sent as they are
+ */
+#define TO_LAB_COMPRESS_MAX_PKT 1024
+
+/**
+ * Compressed packets between those coded without a reference, so that
+ * the ground can recover after losing a packet
+ */
+#define TO_LAB_COMPRESS_KEYFRAME 16
+
+/**
+ * Number of message IDs with decimation, queue and statistics
+ */
+#define TO_LAB_MAX_FILTERS CFE_PLATFORM_SB_MAX_MSG_IDS
+
 #define cfgTLM_ADDR        "192.168.1.81"
 #define cfgTLM_PORT        1235
 #define TO_LAB_VERSION_NUM "5.1.0"
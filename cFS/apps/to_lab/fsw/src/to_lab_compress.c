@@ -0,0 +1,119 @@
+/************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: to_lab_compress.c
+**
+** Purpose:
+**  TO Lab telemetry packet coder, see to_lab_compress.h for the format
+**
+** Notes:
+**
+*************************************************************************/
+
+#include "to_lab_compress.h"
+
+#define TO_LAB_CODE_BYTE(i) ((Ref != NULL) ? (Pkt[i] ^ Ref[i]) : Pkt[i])
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_LAB_PutLength() -- Write the length bytes after a nibble     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static bool TO_LAB_PutLength(uint8 *Out, uint32 *OutLen, uint32 OutSize, uint32 Length)
+{
+    if (Length < 15)
+    {
+        return true;
+    }
+
+    Length -= 15;
+    while (true)
+    {
+        if (*OutLen >= OutSize)
+        {
+            return false;
+        }
+
+        if (Length < 255)
+        {
+            Out[(*OutLen)++] = Length;
+            return true;
+        }
+
+        Out[(*OutLen)++] = 255;
+        Length -= 255;
+    }
+} /* End of TO_LAB_PutLength() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_LAB_Compress() -- Code a packet                              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint32 TO_LAB_Compress(uint8 *Out, uint32 OutSize, const uint8 *Pkt, const uint8 *Ref, uint32 Size)
+{
+    uint32 In     = 0;
+    uint32 OutLen = 0;
+    uint32 LitStart;
+    uint32 LitLen;
+    uint32 ZeroLen;
+    uint32 i;
+
+    do
+    {
+        /* literals run up to the next pair of zeros, a lone zero is cheaper as a literal */
+        LitStart = In;
+        while (In < Size && !(TO_LAB_CODE_BYTE(In) == 0 && (In + 1) < Size && TO_LAB_CODE_BYTE(In + 1) == 0))
+        {
+            ++In;
+        }
+        LitLen = In - LitStart;
+
+        ZeroLen = 0;
+        while (In < Size && TO_LAB_CODE_BYTE(In) == 0)
+        {
+            ++ZeroLen;
+            ++In;
+        }
+
+        if (OutLen >= OutSize)
+        {
+            return 0;
+        }
+        Out[OutLen++] = ((LitLen < 15 ? LitLen : 15) << 4) | (ZeroLen < 15 ? ZeroLen : 15);
+
+        if (!TO_LAB_PutLength(Out, &OutLen, OutSize, LitLen) || (OutSize - OutLen) < LitLen)
+        {
+            return 0;
+        }
+
+        for (i = LitStart; i < (LitStart + LitLen); ++i)
+        {
+            Out[OutLen++] = TO_LAB_CODE_BYTE(i);
+        }
+
+        if (!TO_LAB_PutLength(Out, &OutLen, OutSize, ZeroLen))
+        {
+            return 0;
+        }
+    } while (In < Size);
+
+    return OutLen;
+} /* End of TO_LAB_Compress() */
@@ -0,0 +1,58 @@
+/************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: to_lab_compress.h
+**
+** Purpose:
+**  Define the TO Lab telemetry packet coder
+**
+** Notes:
+**  The coded form is a series of sequences, each a token byte followed
+**  by literal bytes.  The high nibble of the token is the number of
+**  literal bytes and the low nibble the number of zero bytes that follow
+**  them.  A nibble of 15 is followed by further length bytes, added to
+**  it, up to and including the first byte that is not 255.  The literal
+**  length bytes come before the literals and the zero length bytes after
+**  them.  The last sequence ends the packet, so it may have no zeros.
+**
+*************************************************************************/
+
+#ifndef _to_lab_compress_h_
+#define _to_lab_compress_h_
+
+#include "common_types.h"
+
+/*****************************************************************************/
+
+/**
+ * Code a packet, optionally as its difference from a reference packet
+ *
+ * When Ref is not NULL each byte of the packet is XORed with the byte
+ * at the same place in Ref before coding, so that fields that did not
+ * change become runs of zeros.  Ref must be at least Size bytes long.
+ *
+ * Returns the number of bytes written to Out, or 0 if the coded packet
+ * would not fit in OutSize bytes.
+ */
+uint32 TO_LAB_Compress(uint8 *Out, uint32 OutSize, const uint8 *Pkt, const uint8 *Ref, uint32 Size);
+
+/******************************************************************************/
+
+#endif /* _to_lab_compress_h_ */
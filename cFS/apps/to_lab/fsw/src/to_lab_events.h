@@ -53,6 +53,13 @@
 #define TO_REMOVEALLPKTS_INF_EID 17
 #define TO_NOOP_INF_EID          18
 #define TO_TBL_ERR_EID           19
+#define TO_OUTPUTMODE_INF_EID    20
+#define TO_OUTPUTMODE_ERR_EID    21
+#define TO_PKTFILTER_INF_EID     22
+#define TO_PKTFILTER_ERR_EID     23
+#define TO_DOWNLINKRATE_INF_EID  24
+#define TO_COMPRESS_INF_EID      25
+#define TO_COMPRESS_ERR_EID      26
 
 /******************************************************************************/
 
@@ -36,14 +36,60 @@
 #define TO_REMOVE_PKT_CC      4 /*  remove packet     */
 #define TO_REMOVE_ALL_PKT_CC  5 /*  remove all packet */
 #define TO_OUTPUT_ENABLE_CC   6 /*  output enable     */
+#define TO_SET_OUTPUT_MODE_CC   7  /*  set output mode   */
+#define TO_SET_PKT_FILTER_CC    8  /*  set packet filter */
+#define TO_SEND_PKT_STATS_CC    9  /*  send packet stats */
+#define TO_SET_DOWNLINK_RATE_CC 10 /*  set downlink rate */
+#define TO_SET_COMPRESSION_CC   11 /*  set compression   */
+
+/*
+** Output modes
+*/
+#define TO_LAB_OUTPUT_PACKETS 0 /* one datagram per telemetry packet */
+#define TO_LAB_OUTPUT_FRAMES  1 /* telemetry packets packed into frames */
+
+/*
+** Output queues, queue 0 is given the largest share of the downlink
+*/
+#define TO_LAB_NUM_QUEUES 3
+
+/*
+** Number of message IDs that can be compressed at once
+*/
+#define TO_LAB_MAX_COMPRESSED 8
 
 /******************************************************************************/
 
 typedef struct
 {
-    uint8 CommandCounter;
-    uint8 CommandErrorCounter;
-    uint8 spareToAlign[2];
+    CFE_SB_MsgId_t Stream;            /* compressed message ID, reserved if the slot is free */
+    uint16         RatioPercent;      /* BytesOut as a percentage of BytesIn */
+    uint32         PacketsCompressed; /* packets sent compressed */
+    uint32         BytesIn;           /* bytes of the packets offered for compression */
+    uint32         BytesOut;          /* bytes sent for those packets, compressed or not */
+    uint32         Usecs;             /* time spent compressing */
+} TO_LAB_CompressStats_t;
+
+typedef struct
+{
+    uint8  CommandCounter;
+    uint8  CommandErrorCounter;
+    uint8  spareToAlign[2];
+    uint32 PacketsSent;       /* telemetry packets queued on the socket */
+    uint32 PacketsDropped;    /* packets the socket could not queue */
+    uint32 SendCalls;         /* sends to the socket, each of one or more packets */
+    uint16 PacketsPerSend;    /* average packets per send since the previous HK packet */
+    uint16 MaxPacketsPerSend; /* most packets passed in a single send */
+    uint32 FramesSent;        /* frames queued on the socket, each counted once in PacketsSent */
+    uint32 PacketsFramed;     /* telemetry packets packed into frames */
+    uint8  OutputMode;        /* TO_LAB_OUTPUT_PACKETS or TO_LAB_OUTPUT_FRAMES */
+    uint8  spare[3];
+    uint32 PacketsDecimated;  /* packets skipped by per-MsgId decimation */
+    uint32 QueueOverflows;    /* packets discarded because their output queue was full */
+    uint32 DownlinkRate;      /* output limit in bytes per second, 0 if unlimited */
+    uint16 QueuePackets[TO_LAB_NUM_QUEUES]; /* packets waiting in each output queue */
+    uint16 spare2;
+    TO_LAB_CompressStats_t Compress[TO_LAB_MAX_COMPRESSED];
 } TO_LAB_HkTlm_Payload_t;
 
 typedef struct
@@ -157,6 +203,146 @@ typedef struct
 
 /******************************************************************************/
 
+typedef struct
+{
+    uint8 Mode;
+    uint8 spare[3];
+} TO_LAB_SetOutputMode_Payload_t;
+
+typedef struct
+{
+    uint8                          CmdHeader[CFE_SB_CMD_HDR_SIZE];
+    TO_LAB_SetOutputMode_Payload_t Payload;
+} TO_LAB_SetOutputMode_t;
+
+/******************************************************************************/
+
+typedef struct
+{
+    CFE_SB_MsgId_t Stream;
+    uint16         Decimation; /* forward every Nth packet, 0 or 1 forwards all */
+    uint8          Queue;      /* output queue, less than TO_LAB_NUM_QUEUES */
+    uint8          spare;
+} TO_LAB_SetPktFilter_Payload_t;
+
+typedef struct
+{
+    uint8                         CmdHeader[CFE_SB_CMD_HDR_SIZE];
+    TO_LAB_SetPktFilter_Payload_t Payload;
+} TO_LAB_SetPktFilter_t;
+
+typedef TO_LAB_NoArgsCmd_t TO_LAB_SendPktStats_t;
+
+/******************************************************************************/
+
+typedef struct
+{
+    uint32 BytesPerSec; /* 0 removes the limit */
+    uint32 BurstBytes;  /* most bytes sent at once after an idle period, 0 for one second's worth */
+} TO_LAB_SetDownlinkRate_Payload_t;
+
+typedef struct
+{
+    uint8                            CmdHeader[CFE_SB_CMD_HDR_SIZE];
+    TO_LAB_SetDownlinkRate_Payload_t Payload;
+} TO_LAB_SetDownlinkRate_t;
+
+/******************************************************************************/
+
+typedef struct
+{
+    CFE_SB_MsgId_t Stream;
+    uint8          Enable;
+    uint8          spare;
+} TO_LAB_SetCompression_Payload_t;
+
+typedef struct
+{
+    uint8                           CmdHeader[CFE_SB_CMD_HDR_SIZE];
+    TO_LAB_SetCompression_Payload_t Payload;
+} TO_LAB_SetCompression_t;
+
+/******************************************************************************/
+
+/*
+** Per-MsgId statistics, sent in response to TO_SEND_PKT_STATS_CC as
+** one or more packets of up to TO_LAB_PKT_STATS_ENTRIES entries each.
+** The packet length covers only the entries in use.
+*/
+#define TO_LAB_PKT_STATS_ENTRIES 32
+
+typedef struct
+{
+    CFE_SB_MsgId_t Stream;
+    uint16         Decimation;
+    uint8          Queue;
+    uint8          spare;
+    uint32         PacketsSent;      /* packets passed on from the output queue */
+    uint32         PacketsDecimated; /* packets skipped by decimation */
+    uint32         PacketsDropped;   /* packets discarded because the output queue was full */
+} TO_LAB_PktStats_Entry_t;
+
+typedef struct
+{
+    uint16                  FirstEntry; /* index of Entry[0] among all entries */
+    uint16                  EntryCount; /* entries in this packet */
+    TO_LAB_PktStats_Entry_t Entry[TO_LAB_PKT_STATS_ENTRIES];
+} TO_LAB_PktStats_Payload_t;
+
+typedef struct
+{
+    uint8                     TlmHeader[CFE_SB_TLM_HDR_SIZE];
+    TO_LAB_PktStats_Payload_t Payload;
+} TO_LAB_PktStats_t;
+
+/******************************************************************************/
+
+/*
+** Downlink frame header
+**
+** In TO_LAB_OUTPUT_FRAMES mode each datagram that carries more than one
+** telemetry packet starts with this header, followed by the packets back
+** to back.  Each packet is delimited by the length in its own primary
+** header.  All fields are big endian.  The sync marker cannot be the start
+** of a telemetry packet, since it has the command type bit set.
+*/
+#define TO_LAB_FRAME_SYNC 0x1ACFFC1D
+
+typedef struct
+{
+    uint8 Sync[4];        /* TO_LAB_FRAME_SYNC */
+    uint8 Sequence[2];    /* frame count, wraps at 65536 */
+    uint8 PacketCount[2]; /* number of packets in the frame */
+} TO_LAB_FrameHdr_t;
+
+/******************************************************************************/
+
+/*
+** Compressed packet
+**
+** A packet of a message ID with compression enabled is sent as a
+** TO_LAB_COMPRESSED_MID telemetry packet holding this header and the
+** coded packet, see to_lab_compress.h.  With TO_LAB_COMPRESS_DELTA the
+** packet was coded as its difference from the previous packet of the same
+** message ID that was sent, whose sequence count is given so that the
+** receiver can tell whether it has it.  Packets that do not get smaller
+** are sent as they are, and also serve as the next reference.  All fields
+** are big endian.
+*/
+#define TO_LAB_COMPRESS_RAW   0 /* coded on its own */
+#define TO_LAB_COMPRESS_DELTA 1 /* coded as the difference from the reference */
+
+typedef struct
+{
+    uint8 StreamId[2];    /* first two bytes of the original packet */
+    uint8 Method;         /* TO_LAB_COMPRESS_RAW or TO_LAB_COMPRESS_DELTA */
+    uint8 spare;
+    uint8 RefSequence[2]; /* sequence count of the reference packet */
+    uint8 Length[2];      /* length of the original packet */
+} TO_LAB_CompressHdr_t;
+
+/******************************************************************************/
+
 #endif /* _to_lab_msg_h_ */
 
 /************************/
@@ -94,6 +94,7 @@
 #endif
 
 #define CFE_ES_MEMSTATS_TLM_MID     CFE_MISSION_TLM_MID_BASE1 + CFE_MISSION_ES_MEMSTATS_TLM_MSG /* 0x0810 */
+#define CFE_ES_TASK_UTIL_TLM_MID    CFE_MISSION_TLM_MID_BASE1 + CFE_MISSION_ES_TASK_UTIL_TLM_MSG /* 0x0811 */
 
 /*
  * MID definitions by these older names are required to make some existing apps compile
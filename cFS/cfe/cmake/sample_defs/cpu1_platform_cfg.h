@@ -514,6 +514,25 @@
 #define CFE_PLATFORM_TIME_CFG_LATCH_FLY   8
 
 
+/**
+**  \cfetimecfg Define Number of Minor Frames per Second
+**
+**  \par Description:
+**       Define the number of minor frames each second (tone) is divided into.
+**       When non-zero, TIME creates a dedicated timebase that ticks once per
+**       minor frame and calls the functions registered with
+**       #CFE_TIME_RegisterMinorFrameCallback with the number of the minor
+**       frame, which restarts at zero after each valid tone.  For example, 100
+**       gives a 100Hz schedule with 10 millisecond minor frames.
+**
+**  \par Limits
+**       This number may be zero, in which case no minor frame timebase is
+**       created.  Otherwise it must divide 1000000 evenly, so that each minor
+**       frame is a whole number of microseconds.
+*/
+#define CFE_PLATFORM_TIME_CFG_MINOR_FRAMES   0
+
+
 /**
 **  \cfeescfg Define Max Number of Applications
 **
@@ -666,6 +685,24 @@
 #define CFE_PLATFORM_ES_APP_KILL_TIMEOUT 5
 
 
+/**
+**  \cfeescfg Define ES Task Utilization Sample Period
+**
+**  \par Description:
+**       The period, in milliseconds, at which ES samples the CPU time and context
+**       switch counts of every task and sends the task utilization telemetry packet.
+**       The sampling is done by the ES background task, so the period is rounded up
+**       to a multiple of one quarter of #CFE_PLATFORM_ES_APP_SCAN_RATE.  A value of 0
+**       disables sampling until it is enabled by the
+**       \link #CFE_ES_SET_TASK_UTIL_PERIOD_CC Set Task Utilization Period Command \endlink.
+**
+**  \par Limits
+**       There is a lower limit of 0 and an upper limit of 3600000 (one hour) on this
+**       configuration paramater. millisecond units.
+*/
+#define CFE_PLATFORM_ES_TASK_UTIL_PERIOD 0
+
+
 /**
 **  \cfeescfg ES Ram Disk Sector Size
 **
@@ -1350,6 +1387,25 @@
 */
 #define CFE_PLATFORM_TBL_START_TASK_STACK_SIZE             CFE_PLATFORM_ES_DEFAULT_STACK_SIZE
 
+/**
+**  \cfeescfg Define Core Task CPU Affinity
+**
+**  \par Description:
+**       Defines the CPUs that each cFE core task may run on, as a mask where
+**       bit N selects CPU N.  Child tasks of a core app, such as the cFE_TIME
+**       Tone and 1HZ tasks, run on the same CPUs as the app's main task.
+**
+**  \par Limits
+**       A value of zero places no restriction on the task.  A mask must select
+**       at least one CPU that exists on the target, or the task cannot be created.
+**       Targets that do not support CPU affinity ignore these values.
+*/
+#define CFE_PLATFORM_EVS_START_TASK_CPU_AFFINITY           0
+#define CFE_PLATFORM_SB_START_TASK_CPU_AFFINITY            0
+#define CFE_PLATFORM_ES_START_TASK_CPU_AFFINITY            0
+#define CFE_PLATFORM_TIME_START_TASK_CPU_AFFINITY          0
+#define CFE_PLATFORM_TBL_START_TASK_CPU_AFFINITY           0
+
 /**
 **  \cfeescfg Define Maximum Number of Registered CDS Blocks
 **
@@ -1628,6 +1684,22 @@
 */
 #define CFE_PLATFORM_TBL_MAX_SNGL_TABLE_SIZE   16384
 
+/**
+**  \cfetblcfg Size of a Table CRC Region
+**
+**  \par Description:
+**       Table Services maintains a CRC for each region of this many bytes within a
+**       table buffer.  When a delta table image is loaded, only the CRCs of the
+**       regions touched by the image are recomputed before being combined into
+**       the CRC of the whole table.  Delta dumps are also performed at this granularity.
+**
+**  \par Limits
+**       This parameter must be greater than zero.  Smaller regions reduce the work
+**       needed for small delta loads, but every table buffer holds one 16-bit CRC
+**       per region of the largest allowed table.
+*/
+#define CFE_PLATFORM_TBL_CRC_REGION_SIZE       1024
+
 /**
 **  \cfetblcfg Maximum Number of Tables Allowed to be Registered
 **
@@ -1701,6 +1773,45 @@
 */
 #define CFE_PLATFORM_TBL_MAX_NUM_VALIDATIONS     10
 
+/**
+**  \cfetblcfg Number of Background Table Validation Workers
+**
+**  \par Description:
+**       Defines the number of child tasks Table Services starts to validate
+**       tables whose owners have opted into background validation with
+**       #CFE_TBL_ValidateInBackground.  Each worker validates one table at a time.
+**
+**  \par Limits
+**       This number may be zero, in which case tables are always validated by
+**       their owning applications.
+*/
+#define CFE_PLATFORM_TBL_NUM_VALIDATION_WORKERS      1
+
+/**
+**  \cfetblcfg Background Table Validation Worker Priority
+**
+**  \par Description:
+**       Defines the priority of the background table validation workers.
+**       This should be lower (a higher number) than the priority of the
+**       applications whose tables they validate.
+**
+**  \par Limits
+**       Not Applicable
+*/
+#define CFE_PLATFORM_TBL_VALIDATION_WORKER_PRIORITY  200
+
+/**
+**  \cfetblcfg Background Table Validation Worker Stack Size
+**
+**  \par Description:
+**       Defines the stack size of the background table validation workers,
+**       which must accommodate the deepest table validation function.
+**
+**  \par Limits
+**       There is a lower limit of 2048 on this configuration paramater.
+*/
+#define CFE_PLATFORM_TBL_VALIDATION_WORKER_STACK_SIZE CFE_PLATFORM_ES_DEFAULT_STACK_SIZE
+
 /**
 **  \cfetblcfg Default Filename for a Table Registry Dump
 **
@@ -471,6 +471,7 @@
 #define CFE_MISSION_SB_ONESUB_TLM_MSG         14
 #define CFE_MISSION_ES_SHELL_TLM_MSG          15
 #define CFE_MISSION_ES_MEMSTATS_TLM_MSG       16
+#define CFE_MISSION_ES_TASK_UTIL_TLM_MSG      17
 
 /**
 **  \cfeescfg Mission Max Apps in a message
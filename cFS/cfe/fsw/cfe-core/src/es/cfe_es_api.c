@@ -814,6 +814,7 @@ int32 CFE_ES_GetTaskInfo(CFE_ES_TaskInfo_t *TaskInfo, uint32 OSTaskId)
 {
    int32  ReturnCode = CFE_SUCCESS;
    uint32 TaskId;
+   OS_task_prop_t TaskProp;
 
    CFE_ES_LockSharedData(__func__,__LINE__);
 
@@ -854,6 +855,22 @@ int32 CFE_ES_GetTaskInfo(CFE_ES_TaskInfo_t *TaskInfo, uint32 OSTaskId)
          */
          TaskInfo->ExecutionCounter =  CFE_ES_Global.TaskTable[TaskId].ExecutionCounter;
 
+         /*
+         ** Get the CPU placement of the task
+         */
+         if (OS_TaskGetInfo(OSTaskId, &TaskProp) == OS_SUCCESS)
+         {
+            TaskInfo->CpuAffinity = TaskProp.cpu_affinity;
+            TaskInfo->CurrentCpu = TaskProp.current_cpu;
+            TaskInfo->Migrations = TaskProp.migrations;
+         }
+         else
+         {
+            TaskInfo->CpuAffinity = OS_TASK_CPU_AFFINITY_ANY;
+            TaskInfo->CurrentCpu = OS_TASK_CPU_UNKNOWN;
+            TaskInfo->Migrations = 0;
+         }
+
          ReturnCode = CFE_SUCCESS;
 
       }
@@ -954,10 +971,12 @@ int32 CFE_ES_CreateChildTask(uint32 *TaskIdPtr,
             }
 
             /*
-            ** Step 2: Create the new task using the OS API call
+            ** Step 2: Create the new task using the OS API call,
+            ** on the same CPUs as the parent app
             */
-            Result = OS_TaskCreate(TaskIdPtr, TaskName, FunctionPtr, StackPtr,
-                                StackSize, Priority, OS_FP_ENABLED );
+            Result = OS_TaskCreateWithAffinity(TaskIdPtr, TaskName, FunctionPtr, StackPtr,
+                                StackSize, Priority, OS_FP_ENABLED,
+                                CFE_ES_Global.AppTable[AppId].StartParams.CpuAffinity);
 
             /*
             ** Step 3: Record the task information in the task table
@@ -269,6 +269,7 @@ int32 CFE_ES_ParseFileEntry(const char **TokenList, uint32 NumTokens)
    unsigned int Priority;
    unsigned int StackSize;
    unsigned int ExceptionAction;
+   unsigned int CpuAffinity;
    uint32 ApplicationId;
    int32  CreateStatus = CFE_ES_ERR_APP_CREATE;
 
@@ -302,6 +303,19 @@ int32 CFE_ES_ParseFileEntry(const char **TokenList, uint32 NumTokens)
    StackSize = strtoul(TokenList[5], NULL, 0);
    ExceptionAction = strtoul(TokenList[7], NULL, 0);
 
+   /*
+    * The CPU affinity mask is an optional ninth column, so that existing
+    * startup scripts still load.  Bit N allows CPU N; 0 allows any CPU.
+    */
+   if ( NumTokens > 8 )
+   {
+      CpuAffinity = strtoul(TokenList[8], NULL, 0);
+   }
+   else
+   {
+      CpuAffinity = OS_TASK_CPU_AFFINITY_ANY;
+   }
+
    if(strcmp(EntryType,"CFE_APP")==0)
    {
       CFE_ES_WriteToSysLog("ES Startup: Loading file: %s, APP: %s\n",
@@ -320,7 +334,8 @@ int32 CFE_ES_ParseFileEntry(const char **TokenList, uint32 NumTokens)
       */
       CreateStatus = CFE_ES_AppCreate(&ApplicationId, FileName,
                                EntryPoint, AppName, (uint32) Priority,
-                               (uint32) StackSize, (uint32) ExceptionAction );
+                               (uint32) StackSize, (uint32) ExceptionAction,
+                               (uint32) CpuAffinity );
    }
    else if(strcmp(EntryType,"CFE_LIB")==0)
    {
@@ -359,7 +374,8 @@ int32 CFE_ES_AppCreate(uint32 *ApplicationIdPtr,
                        const char   *AppName,
                        uint32  Priority,
                        uint32  StackSize,
-                       uint32  ExceptionAction)
+                       uint32  ExceptionAction,
+                       uint32  CpuAffinity)
 {
    cpuaddr StartAddr;
    int32   ReturnCode;
@@ -469,6 +485,7 @@ int32 CFE_ES_AppCreate(uint32 *ApplicationIdPtr,
 
       CFE_ES_Global.AppTable[i].StartParams.ExceptionAction = ExceptionAction;
       CFE_ES_Global.AppTable[i].StartParams.Priority = Priority;
+      CFE_ES_Global.AppTable[i].StartParams.CpuAffinity = CpuAffinity;
 
       /*
       ** Fill out the Task Info
@@ -485,13 +502,14 @@ int32 CFE_ES_AppCreate(uint32 *ApplicationIdPtr,
       /*
       ** Create the primary task for the newly loaded task
       */
-      ReturnCode = OS_TaskCreate(&CFE_ES_Global.AppTable[i].TaskInfo.MainTaskId,   /* task id */
+      ReturnCode = OS_TaskCreateWithAffinity(&CFE_ES_Global.AppTable[i].TaskInfo.MainTaskId,   /* task id */
                        AppName,             /* task name */
                        (osal_task_entry)StartAddr,   /* task function pointer */
                        NULL,                /* stack pointer */
                        StackSize,           /* stack size */
                        Priority,            /* task priority */
-                       OS_FP_ENABLED);     /* task options */
+                       OS_FP_ENABLED,       /* task options */
+                       CpuAffinity);        /* CPUs the task may run on */
 
 
       if(ReturnCode != OS_SUCCESS)
@@ -878,6 +896,156 @@ bool CFE_ES_RunAppTableScan(uint32 ElapsedTime, void *Arg)
 
 } /* End Function */
 
+/*
+**---------------------------------------------------------------------------------------
+**   Name: CFE_ES_RunTaskUtilSample
+**
+**   Purpose: Background job that samples the CPU use of every task once per sample
+**            period and sends the task utilization packet.  The first sample after
+**            the period is changed only records the starting counters.
+**---------------------------------------------------------------------------------------
+*/
+bool CFE_ES_RunTaskUtilSample(uint32 ElapsedTime, void *Arg)
+{
+   CFE_ES_TaskUtilState_t *State = (CFE_ES_TaskUtilState_t *)Arg;
+
+   if (State->SamplePeriod == 0)
+   {
+       /* sampling is off, let the background task idle */
+       return false;
+   }
+
+   if (State->SampleTimer > ElapsedTime)
+   {
+       State->SampleTimer -= ElapsedTime;
+       return true;
+   }
+
+   State->SampleTimer = State->SamplePeriod;
+
+   CFE_ES_SampleTaskUtil(State, &CFE_ES_TaskData.TaskUtilPacket.Payload);
+
+   if (State->NeedBaseline)
+   {
+       State->NeedBaseline = false;
+   }
+   else
+   {
+       CFE_SB_TimeStampMsg((CFE_SB_Msg_t *) &CFE_ES_TaskData.TaskUtilPacket);
+       CFE_SB_SendMsg((CFE_SB_Msg_t *) &CFE_ES_TaskData.TaskUtilPacket);
+   }
+
+   return true;
+
+} /* End Function */
+
+/*
+**---------------------------------------------------------------------------------------
+**   Name: CFE_ES_SampleTaskUtil
+**
+**   Purpose: Fills the task utilization payload with the CPU time and context switches
+**            of every registered task since the last sample, and records the current
+**            counters as the start of the next period.
+**
+**            Only the task and app IDs are copied under the ES shared data lock.
+**            The tasks are sampled after it is released, as reading the statistics
+**            of every task may take a while.  The state and payload are only used by
+**            the caller, so they need no lock.
+**---------------------------------------------------------------------------------------
+*/
+void CFE_ES_SampleTaskUtil(CFE_ES_TaskUtilState_t *State, CFE_ES_TaskUtilTlm_Payload_t *Payload)
+{
+   uint32                   i;
+   uint32                   NumTasks;
+   uint32                   Elapsed;
+   uint32                   CpuTime;
+   uint32                   TaskIds[OS_MAX_TASKS];
+   uint32                   AppIds[OS_MAX_TASKS];
+   OS_time_t                Now;
+   OS_task_prop_t           TaskProp;
+   CFE_ES_TaskRecord_t     *TaskPtr;
+   CFE_ES_TaskUtilSample_t *LastPtr;
+   CFE_ES_TaskUtil_t       *UtilPtr;
+
+   CFE_ES_LockSharedData(__func__,__LINE__);
+
+   for ( i = 0; i < OS_MAX_TASKS; i++ )
+   {
+       TaskPtr = &CFE_ES_Global.TaskTable[i];
+       if ( TaskPtr->RecordUsed == true )
+       {
+           TaskIds[i] = TaskPtr->TaskId;
+           AppIds[i] = TaskPtr->AppId;
+       }
+       else
+       {
+           TaskIds[i] = 0;
+           AppIds[i] = 0;
+       }
+   }
+
+   CFE_ES_UnlockSharedData(__func__,__LINE__);
+
+   CFE_PSP_GetTime(&Now);
+   Elapsed = ((Now.seconds - State->LastSampleTime.seconds) * 1000000) +
+           Now.microsecs - State->LastSampleTime.microsecs;
+   State->LastSampleTime = Now;
+
+   memset(Payload, 0, sizeof(*Payload));
+   Payload->SamplePeriod = Elapsed;
+   NumTasks = 0;
+
+   for ( i = 0; i < OS_MAX_TASKS; i++ )
+   {
+       LastPtr = &State->LastSample[i];
+
+       if ( TaskIds[i] == 0 ||
+               OS_TaskGetInfo(TaskIds[i], &TaskProp) != OS_SUCCESS )
+       {
+           LastPtr->TaskId = 0;
+           continue;
+       }
+
+       if ( LastPtr->TaskId != TaskIds[i] )
+       {
+           /* a new task in this slot, so its whole run time falls in this period */
+           memset(LastPtr, 0, sizeof(*LastPtr));
+           LastPtr->TaskId = TaskIds[i];
+       }
+
+       CpuTime = ((TaskProp.cpu_time.seconds - LastPtr->CpuTime.seconds) * 1000000) +
+               TaskProp.cpu_time.microsecs - LastPtr->CpuTime.microsecs;
+
+       UtilPtr = &Payload->Task[NumTasks];
+       UtilPtr->TaskId = TaskIds[i];
+       UtilPtr->AppId = AppIds[i];
+       UtilPtr->CpuTime = CpuTime;
+       UtilPtr->VoluntarySwitches = TaskProp.voluntary_switches - LastPtr->VoluntarySwitches;
+       UtilPtr->InvoluntarySwitches = TaskProp.involuntary_switches - LastPtr->InvoluntarySwitches;
+       UtilPtr->CurrentCpu = TaskProp.current_cpu;
+
+       if ( Elapsed == 0 || CpuTime >= Elapsed )
+       {
+           UtilPtr->CpuUtil = (Elapsed == 0) ? 0 : 10000;
+       }
+       else
+       {
+           UtilPtr->CpuUtil = (uint32)(((uint64)CpuTime * 10000) / Elapsed);
+       }
+
+       Payload->TotalCpuUtil += UtilPtr->CpuUtil;
+
+       LastPtr->CpuTime = TaskProp.cpu_time;
+       LastPtr->VoluntarySwitches = TaskProp.voluntary_switches;
+       LastPtr->InvoluntarySwitches = TaskProp.involuntary_switches;
+
+       ++NumTasks;
+   }
+
+   Payload->NumTasks = NumTasks;
+
+} /* End Function */
+
 
 /*
 **---------------------------------------------------------------------------------------
@@ -974,7 +1142,8 @@ void CFE_ES_ProcessControlRequest(uint32 AppID)
                                            (char *)AppStartParams.Name,
                                            AppStartParams.Priority,
                                            AppStartParams.StackSize,
-                                           AppStartParams.ExceptionAction);
+                                           AppStartParams.ExceptionAction,
+                                           AppStartParams.CpuAffinity);
 
             if ( Status == CFE_SUCCESS )
             {
@@ -1010,7 +1179,8 @@ void CFE_ES_ProcessControlRequest(uint32 AppID)
                                            (char *)AppStartParams.Name,
                                            AppStartParams.Priority,
                                            AppStartParams.StackSize,
-                                           AppStartParams.ExceptionAction);
+                                           AppStartParams.ExceptionAction,
+                                           AppStartParams.CpuAffinity);
             if ( Status == CFE_SUCCESS )
             {
                CFE_EVS_SendEvent(CFE_ES_RELOAD_APP_INF_EID, CFE_EVS_EventType_INFORMATION,
@@ -1367,6 +1537,7 @@ void CFE_ES_GetAppInfoInternal(uint32 AppId, CFE_ES_AppInfo_t *AppInfoPtr )
 
    int32              ReturnCode;
    OS_module_prop_t   ModuleInfo;
+   OS_task_prop_t     TaskProp;
    uint32             TaskIndex;
    uint32             i;
 
@@ -1394,6 +1565,7 @@ void CFE_ES_GetAppInfoInternal(uint32 AppId, CFE_ES_AppInfo_t *AppInfoPtr )
    CFE_SB_SET_MEMADDR(AppInfoPtr->StartAddress, CFE_ES_Global.AppTable[AppId].StartParams.StartAddress);
    AppInfoPtr->ExceptionAction = CFE_ES_Global.AppTable[AppId].StartParams.ExceptionAction;
    AppInfoPtr->Priority = CFE_ES_Global.AppTable[AppId].StartParams.Priority;
+   AppInfoPtr->CpuAffinity = CFE_ES_Global.AppTable[AppId].StartParams.CpuAffinity;
 
    AppInfoPtr->MainTaskId = CFE_ES_Global.AppTable[AppId].TaskInfo.MainTaskId;
    strncpy((char *)AppInfoPtr->MainTaskName, (char *)CFE_ES_Global.AppTable[AppId].TaskInfo.MainTaskName,
@@ -1421,6 +1593,20 @@ void CFE_ES_GetAppInfoInternal(uint32 AppId, CFE_ES_AppInfo_t *AppInfoPtr )
       AppInfoPtr->ExecutionCounter = CFE_ES_Global.TaskTable[TaskIndex].ExecutionCounter;
    }
 
+   /*
+   ** Get where the main task is running, as far as the OSAL knows
+   */
+   if (OS_TaskGetInfo(AppInfoPtr->MainTaskId, &TaskProp) == OS_SUCCESS)
+   {
+      AppInfoPtr->MainTaskCurrentCpu = TaskProp.current_cpu;
+      AppInfoPtr->MainTaskMigrations = TaskProp.migrations;
+   }
+   else
+   {
+      AppInfoPtr->MainTaskCurrentCpu = OS_TASK_CPU_UNKNOWN;
+      AppInfoPtr->MainTaskMigrations = 0;
+   }
+
    /*
    ** Get the address information from the OSAL
    */
@@ -41,11 +41,12 @@
 */
 #include "common_types.h"
 #include "osapi.h"
+#include "cfe_es_msg.h"
 
 /*
 ** Macro Definitions
 */
-#define CFE_ES_STARTSCRIPT_MAX_TOKENS_PER_LINE      8
+#define CFE_ES_STARTSCRIPT_MAX_TOKENS_PER_LINE      9
 
 /*
 ** Type Definitions
@@ -81,6 +82,8 @@ typedef struct
   uint16                ExceptionAction;
   uint16                Priority;
 
+  uint32                CpuAffinity;        /* CPUs the main task and child tasks may run on, 0 for any */
+
 } CFE_ES_AppStartParams_t;
 
 /*
@@ -146,6 +149,37 @@ typedef struct
     uint8  LastScanCommandCount;
 } CFE_ES_AppTableScanState_t;
 
+/*
+** Longest task utilization sample period, in milliseconds.  The CPU time of
+** a task over a period is kept in microseconds, in 32 bits.
+*/
+#define CFE_ES_TASK_UTIL_MAX_PERIOD     3600000
+
+/*
+** CFE_ES_TaskUtilSample_t holds the counters of one task at the last
+** utilization sample, indexed the same as the ES task table
+*/
+typedef struct
+{
+    uint32    TaskId;                   /* Task the counters belong to, 0 if none */
+    OS_time_t CpuTime;
+    uint32    VoluntarySwitches;
+    uint32    InvoluntarySwitches;
+} CFE_ES_TaskUtilSample_t;
+
+/*
+** CFE_ES_TaskUtilState_t is an internal structure used to keep state of
+** the background task utilization sampling
+*/
+typedef struct
+{
+    uint32                  SamplePeriod;       /* Milliseconds between samples, 0 when stopped */
+    uint32                  SampleTimer;        /* Milliseconds until the next sample is due */
+    bool                    NeedBaseline;       /* Next sample only sets the starting counters */
+    OS_time_t               LastSampleTime;
+    CFE_ES_TaskUtilSample_t LastSample[OS_MAX_TASKS];
+} CFE_ES_TaskUtilState_t;
+
 
 
 /*****************************************************************************/
@@ -173,7 +207,8 @@ int32 CFE_ES_AppCreate(uint32 *ApplicationIdPtr,
                        const char   *AppName,
                        uint32  Priority,
                        uint32  StackSize,
-                       uint32  ExceptionAction);
+                       uint32  ExceptionAction,
+                       uint32  CpuAffinity);
 /*
 ** Internal function to load a a new cFE shared Library
 */
@@ -198,6 +233,16 @@ int32 CFE_ES_AppDumpAllInfo(void);
 */
 bool CFE_ES_RunAppTableScan(uint32 ElapsedTime, void *Arg);
 
+/*
+** Sample the CPU use of every task and send the task utilization packet when due
+*/
+bool CFE_ES_RunTaskUtilSample(uint32 ElapsedTime, void *Arg);
+
+/*
+** Fill the task utilization payload with the CPU use of every task since the last sample
+*/
+void CFE_ES_SampleTaskUtil(CFE_ES_TaskUtilState_t *State, CFE_ES_TaskUtilTlm_Payload_t *Payload);
+
 /*
 ** Scan for new exceptions stored in the PSP
 */
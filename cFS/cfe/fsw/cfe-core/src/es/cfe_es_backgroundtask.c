@@ -94,6 +94,12 @@ const CFE_ES_BackgroundJobEntry_t CFE_ES_BACKGROUND_JOB_TABLE[] =
                 .JobArg = &CFE_ES_TaskData.BackgroundERLogDumpState,
                 .ActivePeriod = CFE_PLATFORM_ES_APP_SCAN_RATE,
                 .IdlePeriod = CFE_PLATFORM_ES_APP_SCAN_RATE
+        },
+        {   /* Task utilization sampling, idle while the sample period is zero */
+                .RunFunc = CFE_ES_RunTaskUtilSample,
+                .JobArg = &CFE_ES_TaskData.BackgroundTaskUtilState,
+                .ActivePeriod = CFE_PLATFORM_ES_APP_SCAN_RATE / 4,
+                .IdlePeriod = 0
         }
 };
 
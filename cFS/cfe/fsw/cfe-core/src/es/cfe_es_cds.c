@@ -298,6 +298,7 @@ int32 CFE_ES_RegisterCDSEx(CFE_ES_CDSHandle_t *HandlePtr, int32 BlockSize, const
            /* Save CDS Name in Registry */
            strncpy(RegRecPtr->Name, Name, sizeof(RegRecPtr->Name)-1);
            RegRecPtr->Name[sizeof(RegRecPtr->Name)-1] = 0;
+           CFE_NameIndex_Insert(&CFE_ES_Global.CDSVars.RegistryIndex, RegRecPtr->Name, RegIndx);
                
            /* Return the index into the registry as the handle to the CDS */
            *HandlePtr = RegIndx;
@@ -486,6 +487,8 @@ int32 CFE_ES_InitCDSRegistry(void)
         CFE_ES_Global.CDSVars.Registry[i].Taken = false;
         CFE_ES_Global.CDSVars.Registry[i].Table = false;
     }
+
+    CFE_ES_InitCDSRegistryIndex();
     
     /* Copy the number of registry entries to the CDS */
     Status = CFE_PSP_WriteToCDS(&CFE_ES_Global.CDSVars.MaxNumRegEntries, 
@@ -636,25 +639,17 @@ int32 CFE_ES_UnlockCDSRegistry(void)
 
 int32 CFE_ES_FindCDSInRegistry(const char *CDSName)
 {
-    int32 RegIndx = CFE_ES_CDS_NOT_FOUND;
-    int32 i = -1;
+    int32 RegIndx;
 
-    do
-    {
-        /* Point to next record in the CDS Registry */
-        i++;
+    /* The index performs the case sensitive name comparison */
+    RegIndx = CFE_NameIndex_Find(&CFE_ES_Global.CDSVars.RegistryIndex, CDSName);
 
-        /* Check to see if the record is currently being used */
-        if (CFE_ES_Global.CDSVars.Registry[i].Taken == true)
-        {
-            /* Perform a case sensitive name comparison */
-            if (strcmp(CDSName, CFE_ES_Global.CDSVars.Registry[i].Name) == 0)
-            {
-                /* If the names match, then return the index */
-                RegIndx = i;
-            }
-        }
-    } while ( (RegIndx == CFE_ES_CDS_NOT_FOUND) && (i < (CFE_ES_Global.CDSVars.MaxNumRegEntries-1)) );
+    /* Check to see if the record is currently being used */
+    if ((RegIndx == CFE_NAME_INDEX_NOT_FOUND) ||
+        (CFE_ES_Global.CDSVars.Registry[RegIndx].Taken != true))
+    {
+        return CFE_ES_CDS_NOT_FOUND;
+    }
 
     return RegIndx;
 }   /* End of CFE_ES_FindCDSInRegistry() */
@@ -688,6 +683,32 @@ int32 CFE_ES_FindFreeCDSRegistryEntry(void)
 }   /* End of CFE_ES_FindFreeCDSRegistryEntry() */
 
 
+/*******************************************************************
+**
+** CFE_ES_InitCDSRegistryIndex
+**
+** NOTE: For complete prolog information, see 'cfe_es_cds.h'
+********************************************************************/
+
+void CFE_ES_InitCDSRegistryIndex(void)
+{
+    uint32 i;
+
+    CFE_NameIndex_Init(&CFE_ES_Global.CDSVars.RegistryIndex,
+                       CFE_ES_Global.CDSVars.RegistryIndexSlots,
+                       CFE_NAME_INDEX_SLOTS(CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES));
+
+    for (i=0; (i<CFE_ES_Global.CDSVars.MaxNumRegEntries) && (i<CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES); i++)
+    {
+        if (CFE_ES_Global.CDSVars.Registry[i].Taken == true)
+        {
+            CFE_NameIndex_Insert(&CFE_ES_Global.CDSVars.RegistryIndex,
+                                 CFE_ES_Global.CDSVars.Registry[i].Name, i);
+        }
+    }
+}   /* End of CFE_ES_InitCDSRegistryIndex() */
+
+
 /*******************************************************************
 **
 ** CFE_ES_RebuildCDS
@@ -716,6 +737,9 @@ int32 CFE_ES_RebuildCDS(void)
                             
         if (Status == CFE_PSP_SUCCESS)
         {
+            /* Index the names of the recovered registry entries */
+            CFE_ES_InitCDSRegistryIndex();
+
             /* Calculate the starting offset of the memory pool */
             PoolOffset = (CDS_REG_OFFSET + (CFE_ES_Global.CDSVars.MaxNumRegEntries * sizeof(CFE_ES_CDS_RegRec_t)) + 3) & 0xfffffffc;;
 
@@ -814,6 +838,7 @@ int32 CFE_ES_DeleteCDS(const char *CDSName, bool CalledByTblServices)
                 else
                 {
                     /* Remove entry from the CDS Registry */
+                    CFE_NameIndex_Remove(&CFE_ES_Global.CDSVars.RegistryIndex, RegRecPtr->Name, RegIndx);
                     RegRecPtr->Taken = false;
         
                     Status = CFE_ES_UpdateCDSRegistry();
@@ -47,6 +47,7 @@
 #include "cfe_platform_cfg.h"
 #include "cfe_es.h"
 #include "cfe_es_cds_mempool.h"
+#include "private/cfe_name_index.h"
 
 /*
 ** Macro Definitions
@@ -80,6 +81,8 @@ typedef struct
     uint32               MemPoolSize;
     uint32               MaxNumRegEntries;                      /**< \brief Maximum number of Registry entries */
     CFE_ES_CDS_RegRec_t  Registry[CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES];  /**< \brief CDS Registry (Local Copy) */
+    CFE_NameIndex_t      RegistryIndex;                         /**< \brief Hashed index of CDS Registry names */
+    CFE_NameIndex_Slot_t RegistryIndexSlots[CFE_NAME_INDEX_SLOTS(CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES)]; /**< \brief Storage for #RegistryIndex */
     char                 ValidityField[8];
 } CFE_ES_CDSVariables_t;
 
@@ -190,6 +193,22 @@ int32  CFE_ES_FindCDSInRegistry(const char *CDSName);
 ******************************************************************************/
 int32  CFE_ES_FindFreeCDSRegistryEntry(void);
 
+/*****************************************************************************/
+/**
+** \brief Rebuilds the name index of the CDS Registry
+**
+** \par Description
+**        Discards the contents of the index used by #CFE_ES_FindCDSInRegistry
+**        and adds the name of every CDS Registry entry that is in use.
+**
+** \par Assumptions, External Events, and Notes:
+**        This function must be called whenever the local copy of the CDS
+**        Registry is replaced as a whole, such as when it is initialized or
+**        restored from the CDS.
+**
+******************************************************************************/
+void   CFE_ES_InitCDSRegistryIndex(void);
+
 /*****************************************************************************/
 /**
 ** \brief Locks access to the CDS Registry
@@ -138,7 +138,8 @@ CFE_ES_ObjectTable_t  CFE_ES_ObjectTable[CFE_PLATFORM_ES_OBJECT_TABLE_SIZE] =
            .ObjectName = "CFE_EVS",
            .FuncPtrUnion.MainAppPtr = CFE_EVS_TaskMain,
            .ObjectPriority = CFE_PLATFORM_EVS_START_TASK_PRIORITY,
-           .ObjectSize = CFE_PLATFORM_EVS_START_TASK_STACK_SIZE
+           .ObjectSize = CFE_PLATFORM_EVS_START_TASK_STACK_SIZE,
+           .ObjectAffinity = CFE_PLATFORM_EVS_START_TASK_CPU_AFFINITY
    },
    {
            .ObjectType = CFE_ES_NULL_ENTRY
@@ -148,7 +149,8 @@ CFE_ES_ObjectTable_t  CFE_ES_ObjectTable[CFE_PLATFORM_ES_OBJECT_TABLE_SIZE] =
            .ObjectName = "CFE_SB",
            .FuncPtrUnion.MainAppPtr = CFE_SB_TaskMain,
            .ObjectPriority = CFE_PLATFORM_SB_START_TASK_PRIORITY,
-           .ObjectSize = CFE_PLATFORM_SB_START_TASK_STACK_SIZE
+           .ObjectSize = CFE_PLATFORM_SB_START_TASK_STACK_SIZE,
+           .ObjectAffinity = CFE_PLATFORM_SB_START_TASK_CPU_AFFINITY
    },
    {
            .ObjectType = CFE_ES_NULL_ENTRY
@@ -158,7 +160,8 @@ CFE_ES_ObjectTable_t  CFE_ES_ObjectTable[CFE_PLATFORM_ES_OBJECT_TABLE_SIZE] =
            .ObjectName = "CFE_ES",
            .FuncPtrUnion.MainAppPtr = CFE_ES_TaskMain,
            .ObjectPriority = CFE_PLATFORM_ES_START_TASK_PRIORITY,
-           .ObjectSize = CFE_PLATFORM_ES_START_TASK_STACK_SIZE
+           .ObjectSize = CFE_PLATFORM_ES_START_TASK_STACK_SIZE,
+           .ObjectAffinity = CFE_PLATFORM_ES_START_TASK_CPU_AFFINITY
    },
    {
            .ObjectType = CFE_ES_NULL_ENTRY
@@ -168,7 +171,8 @@ CFE_ES_ObjectTable_t  CFE_ES_ObjectTable[CFE_PLATFORM_ES_OBJECT_TABLE_SIZE] =
            .ObjectName = "CFE_TIME",
            .FuncPtrUnion.MainAppPtr = CFE_TIME_TaskMain,
            .ObjectPriority = CFE_PLATFORM_TIME_START_TASK_PRIORITY,
-           .ObjectSize = CFE_PLATFORM_TIME_START_TASK_STACK_SIZE
+           .ObjectSize = CFE_PLATFORM_TIME_START_TASK_STACK_SIZE,
+           .ObjectAffinity = CFE_PLATFORM_TIME_START_TASK_CPU_AFFINITY
    },
    {
            .ObjectType = CFE_ES_NULL_ENTRY
@@ -179,7 +183,8 @@ CFE_ES_ObjectTable_t  CFE_ES_ObjectTable[CFE_PLATFORM_ES_OBJECT_TABLE_SIZE] =
            .ObjectName = "CFE_TBL",
            .FuncPtrUnion.MainAppPtr = CFE_TBL_TaskMain,
            .ObjectPriority = CFE_PLATFORM_TBL_START_TASK_PRIORITY,
-           .ObjectSize = CFE_PLATFORM_TBL_START_TASK_STACK_SIZE
+           .ObjectSize = CFE_PLATFORM_TBL_START_TASK_STACK_SIZE,
+           .ObjectAffinity = CFE_PLATFORM_TBL_START_TASK_CPU_AFFINITY
    },
 #else
    {
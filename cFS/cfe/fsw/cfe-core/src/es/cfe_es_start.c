@@ -822,6 +822,7 @@ void  CFE_ES_CreateObjects(void)
                CFE_ES_Global.AppTable[j].StartParams.StartAddress = (cpuaddr)CFE_ES_ObjectTable[i].FuncPtrUnion.VoidPtr;
                CFE_ES_Global.AppTable[j].StartParams.ExceptionAction = CFE_ES_ExceptionAction_PROC_RESTART;
                CFE_ES_Global.AppTable[j].StartParams.Priority = CFE_ES_ObjectTable[i].ObjectPriority;
+               CFE_ES_Global.AppTable[j].StartParams.CpuAffinity = CFE_ES_ObjectTable[i].ObjectAffinity;
                
                
                /*
@@ -833,13 +834,14 @@ void  CFE_ES_CreateObjects(void)
                /*
                ** Create the task
                */
-               ReturnCode = OS_TaskCreate(&CFE_ES_Global.AppTable[j].TaskInfo.MainTaskId, /* task id */
+               ReturnCode = OS_TaskCreateWithAffinity(&CFE_ES_Global.AppTable[j].TaskInfo.MainTaskId, /* task id */
                                   CFE_ES_ObjectTable[i].ObjectName,              /* task name */
                                   CFE_ES_ObjectTable[i].FuncPtrUnion.MainAppPtr, /* task function pointer */
                                   NULL,                                          /* stack pointer */
                                   CFE_ES_ObjectTable[i].ObjectSize,              /* stack size */
                                   CFE_ES_ObjectTable[i].ObjectPriority,          /* task priority */
-                                  OS_FP_ENABLED);                                /* task options */
+                                  OS_FP_ENABLED,                                 /* task options */
+                                  CFE_ES_ObjectTable[i].ObjectAffinity);         /* CPUs the task may run on */
 
                if(ReturnCode != OS_SUCCESS)
                {
@@ -79,6 +79,7 @@ typedef struct
     uint32                   ObjectPriority;               /* object priority */
     uint32                   ObjectSize;                   /* size used for stack, queue size, etc. */
     uint32                   ObjectFlags;                  /* extra flags to pass */
+    uint32                   ObjectAffinity;               /* CPUs a task may run on, 0 for any */
 
 } CFE_ES_ObjectTable_t;
 
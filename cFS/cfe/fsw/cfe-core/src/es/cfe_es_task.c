@@ -279,6 +279,18 @@ int32 CFE_ES_TaskInit(void)
             CFE_SB_ValueToMsgId(CFE_ES_MEMSTATS_TLM_MID),
             sizeof(CFE_ES_TaskData.MemStatsPacket), true);
 
+    /*
+    ** Initialize task utilization telemetry packet, and start sampling
+    ** at the configured period (which may be zero, leaving it off)
+    */
+    CFE_SB_InitMsg(&CFE_ES_TaskData.TaskUtilPacket,
+            CFE_SB_ValueToMsgId(CFE_ES_TASK_UTIL_TLM_MID),
+            sizeof(CFE_ES_TaskData.TaskUtilPacket), true);
+
+    memset(&CFE_ES_TaskData.BackgroundTaskUtilState, 0, sizeof(CFE_ES_TaskData.BackgroundTaskUtilState));
+    CFE_ES_TaskData.BackgroundTaskUtilState.SamplePeriod = CFE_PLATFORM_ES_TASK_UTIL_PERIOD;
+    CFE_ES_TaskData.BackgroundTaskUtilState.NeedBaseline = true;
+
     /*
     ** Create Software Bus message pipe
     */
@@ -643,6 +655,13 @@ void CFE_ES_TaskPipe(CFE_SB_MsgPtr_t Msg)
                     }
                     break;
 
+                case CFE_ES_SET_TASK_UTIL_PERIOD_CC:
+                    if (CFE_ES_VerifyCmdLength(Msg, sizeof(CFE_ES_SetTaskUtilPeriod_t)))
+                    {
+                        CFE_ES_SetTaskUtilPeriodCmd((CFE_ES_SetTaskUtilPeriod_t*)Msg);
+                    }
+                    break;
+
                 default:
                     CFE_EVS_SendEvent(CFE_ES_CC1_ERR_EID, CFE_EVS_EventType_ERROR,
                      "Invalid ground command code: ID = 0x%X, CC = %d",
@@ -709,6 +728,8 @@ int32 CFE_ES_HousekeepingCmd(const CFE_SB_CmdHdr_t *data)
     CFE_ES_TaskData.HkPacket.Payload.PerfDataCount = CFE_ES_ResetDataPtr->Perf.MetaData.DataCount;
     CFE_ES_TaskData.HkPacket.Payload.PerfDataToWrite = CFE_ES_GetPerfLogDumpRemaining();
 
+    CFE_ES_TaskData.HkPacket.Payload.TaskUtilPeriod = CFE_ES_TaskData.BackgroundTaskUtilState.SamplePeriod;
+
     /*
      * Fill out the perf trigger/filter mask objects
      * The entire array in the HK payload object (external size) must be filled,
@@ -994,7 +1015,8 @@ int32 CFE_ES_StartAppCmd(const CFE_ES_StartApp_t *data)
                    LocalAppName,
                    (uint32) cmd->Priority,
                    (uint32) cmd->StackSize,
-                   (uint32) cmd->ExceptionAction);
+                   (uint32) cmd->ExceptionAction,
+                   OS_TASK_CPU_AFFINITY_ANY);
 
         /*
         ** Send appropriate event message
@@ -1722,6 +1744,45 @@ int32 CFE_ES_SetMaxPRCountCmd(const CFE_ES_SetMaxPRCount_t *data)
     return CFE_SUCCESS;
 } /* End of CFE_ES_RestartCmd() */
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CFE_ES_SetTaskUtilPeriodCmd() -- Set task utilization period    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 CFE_ES_SetTaskUtilPeriodCmd(const CFE_ES_SetTaskUtilPeriod_t *data)
+{
+    const CFE_ES_SetTaskUtilPeriodCmd_Payload_t *cmd = &data->Payload;
+    CFE_ES_TaskUtilState_t *State = &CFE_ES_TaskData.BackgroundTaskUtilState;
+
+    if (cmd->SamplePeriod > CFE_ES_TASK_UTIL_MAX_PERIOD)
+    {
+        CFE_EVS_SendEvent(CFE_ES_TASK_UTIL_PERIOD_ERR_EID, CFE_EVS_EventType_ERROR,
+                "Task utilization sample period %u ms is greater than %u ms",
+                (unsigned int)cmd->SamplePeriod, (unsigned int)CFE_ES_TASK_UTIL_MAX_PERIOD);
+
+        CFE_ES_TaskData.CommandErrorCounter++;
+    }
+    else
+    {
+        /*
+        ** Start over from a fresh baseline, so the first packet
+        ** sent covers one whole period at the new rate
+        */
+        State->SamplePeriod = cmd->SamplePeriod;
+        State->SampleTimer = 0;
+        State->NeedBaseline = true;
+        CFE_ES_BackgroundWakeup();
+
+        CFE_EVS_SendEvent(CFE_ES_TASK_UTIL_PERIOD_EID, CFE_EVS_EventType_INFORMATION,
+                "Task utilization sample period set to %d ms", (int)cmd->SamplePeriod);
+
+        CFE_ES_TaskData.CommandCounter++;
+    }
+
+    return CFE_SUCCESS;
+} /* End of CFE_ES_SetTaskUtilPeriodCmd() */
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* CFE_ES_DeleteCDSCmd() -- Delete Specified Critical Data Store   */
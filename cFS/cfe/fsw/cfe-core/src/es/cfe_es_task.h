@@ -118,6 +118,11 @@ typedef struct
   */
   CFE_ES_MemStatsTlm_t MemStatsPacket;
 
+  /*
+  ** Task utilization telemetry packet
+  */
+  CFE_ES_TaskUtilTlm_t  TaskUtilPacket;
+
   /*
   ** ES Task operational data (not reported in housekeeping)
   */
@@ -145,6 +150,11 @@ typedef struct
    */
   CFE_ES_AppTableScanState_t BackgroundAppScanState;
 
+  /*
+   * Persistent state data associated with background task utilization sampling
+   */
+  CFE_ES_TaskUtilState_t     BackgroundTaskUtilState;
+
 } CFE_ES_TaskData_t;
 
 /*
@@ -196,6 +206,7 @@ int32 CFE_ES_ClearERLogCmd(const CFE_ES_ClearERLog_t *data);
 int32 CFE_ES_WriteERLogCmd(const CFE_ES_WriteERLog_t *data);
 int32 CFE_ES_ResetPRCountCmd(const CFE_ES_ResetPRCount_t *data);
 int32 CFE_ES_SetMaxPRCountCmd(const CFE_ES_SetMaxPRCount_t *data);
+int32 CFE_ES_SetTaskUtilPeriodCmd(const CFE_ES_SetTaskUtilPeriod_t *data);
 int32 CFE_ES_DeleteCDSCmd(const CFE_ES_DeleteCDS_t *data);
 int32 CFE_ES_StartPerfDataCmd(const CFE_ES_StartPerfData_t *data);
 int32 CFE_ES_StopPerfDataCmd(const CFE_ES_StopPerfData_t *data);
@@ -85,6 +85,15 @@
     #error CFE_PLATFORM_ES_APP_KILL_TIMEOUT cannot be greater than 100!
 #endif
 
+/*
+** ES Task Utilization Sample Period
+*/
+#if CFE_PLATFORM_ES_TASK_UTIL_PERIOD  <  0
+    #error CFE_PLATFORM_ES_TASK_UTIL_PERIOD cannot be less than 0!
+#elif CFE_PLATFORM_ES_TASK_UTIL_PERIOD  >  3600000
+    #error CFE_PLATFORM_ES_TASK_UTIL_PERIOD cannot be greater than one hour!
+#endif
+
 /*
 ** ES / cFE RAM disk parameters 
 */
@@ -251,6 +251,12 @@ typedef struct
                                                  \brief The Application's Main Task ID */
    uint32   NumOfChildTasks;                /**< \cfetlmmnemonic \ES_CHILDTASKS
                                                  \brief Number of Child tasks for an App */
+   uint32   CpuAffinity;                    /**< \cfetlmmnemonic \ES_CPUAFFINITY
+                                                 \brief CPUs the Application's tasks may run on, bit N for CPU N, 0 for any */
+   uint32   MainTaskCurrentCpu;             /**< \cfetlmmnemonic \ES_MAINTASKCPU
+                                                 \brief The CPU the Application's Main Task last ran on, 0xFFFFFFFF if unknown */
+   uint32   MainTaskMigrations;             /**< \cfetlmmnemonic \ES_MAINTASKMIGR
+                                                 \brief Number of times the Application's Main Task moved between CPUs */
 
 } CFE_ES_AppInfo_t;
 
@@ -264,6 +270,9 @@ typedef struct
    uint8    TaskName[OS_MAX_API_NAME]; /**< \brief Task Name */
    uint32   AppId;                     /**< \brief Parent Application ID */
    uint8    AppName[OS_MAX_API_NAME];  /**< \brief Parent Application Name */
+   uint32   CpuAffinity;               /**< \brief CPUs the Task may run on, bit N for CPU N, 0 for any */
+   uint32   CurrentCpu;                /**< \brief CPU the Task last ran on, 0xFFFFFFFF if unknown */
+   uint32   Migrations;                /**< \brief Number of times the Task moved between CPUs */
 
 } CFE_ES_TaskInfo_t;
 
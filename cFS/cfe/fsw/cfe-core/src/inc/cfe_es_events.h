@@ -1516,6 +1516,36 @@
 **/
 #define CFE_ES_ERLOG_PENDING_ERR_EID    93
 
+/** \brief <tt> 'Task utilization sample period set to \%d ms' </tt>
+**  \event <tt> 'Task utilization sample period set to \%d ms' </tt>
+**
+**  \par Type: INFORMATION
+**
+**  \par Cause:
+**
+**  This event message is always generated in response to the Executive Services
+**  \link #CFE_ES_SET_TASK_UTIL_PERIOD_CC Set Task Utilization Period Command \endlink.
+**
+**  The \c 'd' field identifies, in decimal, the new sample period.  A period of zero
+**  means sampling is stopped.
+**/
+#define CFE_ES_TASK_UTIL_PERIOD_EID     94
+
+/** \brief <tt> 'Task utilization sample period \%u ms is greater than \%u ms' </tt>
+**  \event <tt> 'Task utilization sample period \%u ms is greater than \%u ms' </tt>
+**
+**  \par Type: ERROR
+**
+**  \par Cause:
+**
+**  This event message is generated when an Executive Services
+**  \link #CFE_ES_SET_TASK_UTIL_PERIOD_CC Set Task Utilization Period Command \endlink
+**  requests a period longer than the CPU time counters can measure.
+**
+**  The first \c 'u' field is the requested period and the second is the longest allowed.
+**/
+#define CFE_ES_TASK_UTIL_PERIOD_ERR_EID 95
+
 
 #endif /* _cfe_es_events_ */
 
@@ -1101,6 +1101,48 @@
 */
 #define CFE_ES_QUERY_ALL_TASKS_CC     24
 
+/** \cfeescmd Set the Task Utilization Sample Period
+**
+**  \par Description
+**       This command sets how often ES samples the CPU time and context switch
+**       counts of every registered task and sends the results in the
+**       #CFE_ES_TaskUtilTlm_t telemetry packet.  A period of zero stops the
+**       sampling, so that it costs nothing when it is not needed.
+**
+**  \cfecmdmnemonic \ES_SETTASKUTILPERIOD
+**
+**  \par Command Structure
+**       #CFE_ES_SetTaskUtilPeriod_t
+**
+**  \par Command Verification
+**       Successful execution of this command may be verified with
+**       the following telemetry:
+**       - \b \c \ES_CMDPC - command execution counter will
+**         increment
+**       - \b \c \ES_TASKUTILPERIOD - Current task utilization sample period
+**         will go to the command specified value.
+**       - The #CFE_ES_TASK_UTIL_PERIOD_EID informational event message will be
+**         generated.
+**
+**  \par Error Conditions
+**       This command may fail for the following reason(s):
+**       - The command packet length is incorrect
+**       - The period is greater than one hour
+**
+**       Evidence of failure may be found in the following telemetry:
+**       - \b \c \ES_CMDEC - command error counter will increment
+**       - A command specific error event message is issued for all error
+**         cases
+**
+**  \par Criticality
+**       This command is not inherently dangerous.  A short period adds the cost
+**       of reading the statistics of every task to the ES background task at
+**       that rate.
+**
+**  \sa #CFE_ES_QUERY_ALL_TASKS_CC
+*/
+#define CFE_ES_SET_TASK_UTIL_PERIOD_CC    25
+
 
 /** \} */
 
@@ -1322,6 +1364,24 @@ typedef struct
     CFE_ES_SetMaxPRCountCmd_Payload_t   Payload;
 } CFE_ES_SetMaxPRCount_t;
 
+/**
+** \brief Set Task Utilization Sample Period Command
+**
+** For command details, see #CFE_ES_SET_TASK_UTIL_PERIOD_CC
+**
+**/
+typedef struct
+{
+  uint32                SamplePeriod;                   /**< \brief Milliseconds between task utilization samples,
+                                                                    0 to stop sampling */
+} CFE_ES_SetTaskUtilPeriodCmd_Payload_t;
+
+typedef struct
+{
+    uint8                                   CmdHeader[CFE_SB_CMD_HDR_SIZE];    /**< \brief cFE Software Bus Command Message Header */
+    CFE_ES_SetTaskUtilPeriodCmd_Payload_t   Payload;
+} CFE_ES_SetTaskUtilPeriod_t;
+
 /**
 ** \brief Delete Critical Data Store Command
 **
@@ -1487,6 +1547,41 @@ typedef struct
     CFE_ES_PoolStatsTlm_Payload_t   Payload;
 } CFE_ES_MemStatsTlm_t;
 
+/**
+** \brief Utilization of one task over a sample period
+**/
+typedef struct
+{
+  uint32                TaskId;                         /**< \brief Task Id */
+  uint32                AppId;                          /**< \brief Parent Application ID */
+  uint32                CpuTime;                        /**< \brief Microseconds of CPU time used during the period */
+  uint32                CpuUtil;                        /**< \brief CPU time as a share of the period, in hundredths
+                                                                    of a percent of one CPU */
+  uint32                VoluntarySwitches;              /**< \brief Times the task gave up the CPU during the period */
+  uint32                InvoluntarySwitches;            /**< \brief Times the task was preempted during the period */
+  uint32                CurrentCpu;                     /**< \brief CPU the task last ran on, 0xFFFFFFFF if unknown */
+} CFE_ES_TaskUtil_t;
+
+/**
+**  \cfeestlm Task Utilization Packet
+**/
+typedef struct
+{
+  uint32                SamplePeriod;                   /**< \cfetlmmnemonic \ES_UTILPERIOD
+                                                             \brief Measured length of the sample period, in microseconds */
+  uint32                NumTasks;                       /**< \cfetlmmnemonic \ES_UTILNUMTASKS
+                                                             \brief Number of valid entries in Task */
+  uint32                TotalCpuUtil;                   /**< \cfetlmmnemonic \ES_UTILTOTAL
+                                                             \brief Sum of CpuUtil over all tasks */
+  CFE_ES_TaskUtil_t     Task[OS_MAX_TASKS];             /**< \brief Utilization of each registered task */
+} CFE_ES_TaskUtilTlm_Payload_t;
+
+typedef struct
+{
+    uint8                           TlmHeader[CFE_SB_TLM_HDR_SIZE]; /**< \brief cFE Software Bus Telemetry Message Header */
+    CFE_ES_TaskUtilTlm_Payload_t    Payload;
+} CFE_ES_TaskUtilTlm_t;
+
 /*************************************************************************/
 
 /** 
@@ -1576,6 +1671,8 @@ typedef struct
                                               \brief Number of free blocks remaining in the OS heap */
   uint32                HeapMaxBlockSize;  /**< \cfetlmmnemonic \ES_HEAPMAXBLK
                                               \brief Number of bytes in the largest free block */
+  uint32                TaskUtilPeriod;    /**< \cfetlmmnemonic \ES_TASKUTILPERIOD
+                                              \brief Milliseconds between task utilization samples, 0 if stopped */
 } CFE_ES_HousekeepingTlm_Payload_t;
 
 typedef struct
@@ -168,6 +168,24 @@ typedef union {
 
 #define CFE_SB_CMD_HDR_SIZE     (sizeof(CFE_SB_CmdHdr_t))/**< \brief Size of #CFE_SB_CmdHdr_t in bytes */
 #define CFE_SB_TLM_HDR_SIZE     (sizeof(CFE_SB_TlmHdr_t))/**< \brief Size of #CFE_SB_TlmHdr_t in bytes */
+#define CFE_SB_PRI_HDR_SIZE     (sizeof(CCSDS_PriHdr_t))/**< \brief Size of the primary header alone, for messages without a secondary header */
+#define CFE_SB_SEC_HDR_OFFSET   (sizeof(CCSDS_SpacePacket_t))/**< \brief Offset of the command or telemetry secondary header */
+
+/** \brief Decoded Software Bus Message Header
+**
+** Holds every header field of a message, decoded once by #CFE_SB_GetMsgHdrView,
+** so code that needs several fields of the same message does not have to
+** extract each one from the packed big endian header separately.
+*/
+typedef struct {
+    CFE_SB_MsgId_t      MsgId;          /**< \brief Message ID, as returned by #CFE_SB_GetMsgId */
+    CFE_TIME_SysTime_t  Time;           /**< \brief Packet time, as returned by #CFE_SB_GetMsgTime */
+    uint16              TotalLength;    /**< \brief Total message length, as returned by #CFE_SB_GetTotalMsgLength */
+    uint16              HdrSize;        /**< \brief Size of all headers, i.e. the offset of the data returned by #CFE_SB_GetUserData */
+    uint16              CmdCode;        /**< \brief Command code, as returned by #CFE_SB_GetCmdCode */
+    uint8               PktType;        /**< \brief #CFE_SB_PKTTYPE_CMD or #CFE_SB_PKTTYPE_TLM */
+    bool                HasSecHdr;      /**< \brief Whether the message has a secondary header */
+} CFE_SB_MsgHdrView_t;
 
 /** \brief  CFE_SB_TimeOut_t to primitive type definition
 **
@@ -371,6 +389,32 @@ int32 CFE_SB_GetPipeName(char *PipeNameBuf, size_t PipeNameSize, CFE_SB_PipeId_t
 ** \sa #CFE_SB_CreatePipe #CFE_SB_DeletePipe #CFE_SB_SetPipeOpts #CFE_SB_PIPEOPTS_IGNOREMINE
 **/
 int32  CFE_SB_GetPipeIdByName(CFE_SB_PipeId_t *PipeIdPtr, const char *PipeName);
+
+/*****************************************************************************/
+/**
+** \brief Get the OSAL queue ID of a pipe.
+**
+** \par Description
+**          This routine gets the ID of the OSAL queue that holds the messages
+**          waiting on a pipe.  An application can add this ID to an OS_FdSet
+**          and wait with OS_SelectMultiple for a message on the pipe and for
+**          activity on its sockets at the same time.
+**
+** \par Assumptions, External Events, and Notes:
+**          -# Messages must still be read from the pipe with #CFE_SB_RcvMsg.
+**             The queue must never be read or written directly.
+**
+** \param[in]  PipeId       The pipe ID of the pipe.
+**
+** \param[out] *QueueIdPtr  The OSAL queue ID of the pipe.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS         \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT \copybrief CFE_SB_BAD_ARGUMENT
+**
+** \sa #CFE_SB_CreatePipe #CFE_SB_RcvMsg
+**/
+int32  CFE_SB_GetPipeQueueId(CFE_SB_PipeId_t PipeId, uint32 *QueueIdPtr);
 /**@}*/
 
 /** @defgroup CFEAPISBSubscription cFE Message Subscription Control APIs
@@ -1126,6 +1170,32 @@ uint16 CFE_SB_GetUserDataLength(const CFE_SB_Msg_t *MsgPtr);
 **/
 uint16 CFE_SB_GetTotalMsgLength(const CFE_SB_Msg_t *MsgPtr);
 
+/*****************************************************************************/
+/**
+** \brief Decodes all header fields of a software bus message at once.
+**
+** \par Description
+**          This routine fills in a #CFE_SB_MsgHdrView_t with the message ID,
+**          total length, header size, packet type, command code and time of a
+**          software bus message.  Each field holds the same value the
+**          corresponding single field accessor would return.
+**
+** \par Assumptions, External Events, and Notes:
+**          - This is cheaper than calling several of the single field accessors
+**            on the same message, which is the common case when dispatching
+**            commands or forwarding telemetry.
+**          - The view is a copy; it is not updated if the message is changed.
+**
+** \param[in]  MsgPtr      A pointer to the buffer that contains the software bus message.
+**                         This must point to the first byte of the message header.
+**
+** \param[out] ViewPtr     A pointer to the structure that receives the decoded header.
+**
+** \sa #CFE_SB_GetMsgId, #CFE_SB_GetTotalMsgLength, #CFE_SB_GetUserData,
+**     #CFE_SB_GetCmdCode, #CFE_SB_GetMsgTime
+**/
+void CFE_SB_GetMsgHdrView(const CFE_SB_Msg_t *MsgPtr, CFE_SB_MsgHdrView_t *ViewPtr);
+
 /*****************************************************************************/
 /**
 ** \brief Gets the command code field from a software bus message.
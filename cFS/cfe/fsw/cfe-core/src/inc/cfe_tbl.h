@@ -66,6 +66,10 @@
 #define CFE_TBL_OPT_NOT_CRITICAL (0x0000) /**< \brief Not critical table */
 #define CFE_TBL_OPT_CRITICAL     (0x0008) /**< \brief Critical table */
 
+#define CFE_TBL_OPT_MAPPED_MSK   (0x0010) /**< \brief Table mapped image mask */
+#define CFE_TBL_OPT_NOT_MAPPED   (0x0000) /**< \brief Table buffers allocated from the Table Services memory pool */
+#define CFE_TBL_OPT_MAPPED       (0x0010) /**< \brief Table buffers mapped directly from the table image file, @note Implies double buffering */
+
 /** @brief Default table options */
 #define CFE_TBL_OPT_DEFAULT      (CFE_TBL_OPT_SNGL_BUFFER | CFE_TBL_OPT_LOAD_DUMP)
 /**@}*/
@@ -247,6 +251,17 @@ typedef struct
 **                                                                 the update of the double buffered table from being quick and
 **                                                                 it could be blocked.  Therefore, critical tables should not be
 **                                                                 updated by Interrupt Service Routines.
+**                                 \arg #CFE_TBL_OPT_MAPPED-       When this option is selected, the Table Service 
+**                                                                 will not allocate memory for the table.  Instead,
+**                                                                 each load maps the data portion of the table image
+**                                                                 file directly into memory (see #OS_FileMap) rather
+**                                                                 than copying it into a buffer.  The mapping is
+**                                                                 private, so modifications made by the Application
+**                                                                 are never written back to the file.  Mapped tables
+**                                                                 are implicitly double buffered and may only be loaded
+**                                                                 from files containing a complete table image.  This
+**                                                                 option is mutually exclusive of the #CFE_TBL_OPT_USR_DEF_ADDR,
+**                                                                 #CFE_TBL_OPT_DUMP_ONLY and #CFE_TBL_OPT_CRITICAL options.
 **
 ** \param[in] TblValidationFuncPtr is a pointer to a function that will be executed in the context of the Table 
 **                                 Management Service when the contents of a table need to be validated.  If set 
@@ -554,7 +569,9 @@ int32   CFE_TBL_DumpToBuffer( CFE_TBL_Handle_t TblHandle );
 **        table kept in the Critical Data Store.
 **
 ** \par Assumptions, External Events, and Notes:
-**        None
+**        -# An Application that writes to the contents of its table must call this function
+**           afterwards.  It recomputes the CRC of the table, which the next partial table
+**           load starts from.
 **
 ** \param[in]  TblHandle      Handle of Table that was modified.
 **
@@ -862,6 +879,48 @@ int32 CFE_TBL_GetInfo( CFE_TBL_Info_t *TblInfoPtr, const char *TblName );
 **
 ******************************************************************************/
 int32 CFE_TBL_NotifyByMessage(CFE_TBL_Handle_t TblHandle, CFE_SB_MsgId_t MsgId, uint16 CommandCode, uint32 Parameter);
+
+/*****************************************************************************/
+/**
+** \brief Instruct cFE Table Services to validate a table in the background
+**
+** \par Description
+**        This API hands the validation of the specified table over to the Table Services
+**        validation workers, which run at a lower priority than most applications.  Once
+**        the application has opted in, validation requests for the table are no longer
+**        reported by #CFE_TBL_GetStatus or performed by #CFE_TBL_Manage, so a lengthy
+**        validation does not hold up the application's main loop.  When a validation
+**        completes, the application is notified with the message registered via
+**        #CFE_TBL_NotifyByMessage, after which #CFE_TBL_Manage will perform any update.
+**
+** \par Assumptions, External Events, and Notes:
+**        - Only the application that owns the table is allowed to change how it is validated
+**        - The validation function is called from a Table Services task, so it must not
+**          depend on the context of the owning application.
+**        - After each validation, the worker remains idle long enough that the time spent
+**          validating is no more than \c DutyCyclePct percent of the elapsed time.  This is
+**          a wall-clock duty cycle, not a CPU time limit: time the worker spends preempted
+**          while validating counts as validation time.
+**
+** \param[in]  TblHandle      Handle of Table to be validated in the background.
+** 
+** \param[in]  DutyCyclePct   Percentage (1 to 100) of the elapsed time that a worker may spend validating
+**                            this table, or zero to return to validation by #CFE_TBL_Manage.
+** 
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS                 \copybrief CFE_SUCCESS
+** \retval #CFE_ES_ERR_APPNAME          \copybrief CFE_ES_ERR_APPNAME
+** \retval #CFE_ES_ERR_BUFFER           \copybrief CFE_ES_ERR_BUFFER
+** \retval #CFE_TBL_ERR_BAD_APP_ID      \copybrief CFE_TBL_ERR_BAD_APP_ID
+** \retval #CFE_TBL_ERR_NO_ACCESS       \copybrief CFE_TBL_ERR_NO_ACCESS
+** \retval #CFE_TBL_ERR_INVALID_HANDLE  \copybrief CFE_TBL_ERR_INVALID_HANDLE
+** \retval #CFE_TBL_ERR_INVALID_OPTIONS \copybrief CFE_TBL_ERR_INVALID_OPTIONS
+** \retval #CFE_TBL_NOT_IMPLEMENTED     \copybrief CFE_TBL_NOT_IMPLEMENTED
+**
+** \sa #CFE_TBL_NotifyByMessage, #CFE_TBL_Manage, #CFE_TBL_Validate
+**
+******************************************************************************/
+int32 CFE_TBL_ValidateInBackground(CFE_TBL_Handle_t TblHandle, uint32 DutyCyclePct);
 /**@}*/
 
 #endif  /* _cfe_tbl_ */
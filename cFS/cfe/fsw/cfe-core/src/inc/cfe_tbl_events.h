@@ -46,7 +46,7 @@
 ** and when you're done adding, set this to the highest EID you used. It may
 ** be worthwhile to, on occasion, re-number the EID's to put them back in order.
 */
-#define CFE_TBL_MAX_EID                         103
+#define CFE_TBL_MAX_EID                         107
 
 /******************* Macro Definitions ***********************/
 /*
@@ -1099,6 +1099,64 @@
 **/
 #define CFE_TBL_HANDLE_ACCESS_ERR_EID          103
 
+/** \brief <tt> %s: Mapped tbl '%s' requires a complete image (offset=%lu, len=%lu, exp=%lu) </tt>
+**  \event <tt> %s: Mapped tbl '%s' requires a complete image (offset=%lu, len=%lu, exp=%lu) </tt>
+**
+**  \par Type: ERROR
+**
+**  \par Cause:
+**
+**  A table registered with the #CFE_TBL_OPT_MAPPED option was loaded from a file
+**  containing a partial or short table image.  Mapped tables reference the file
+**  contents directly and can only be loaded from complete table images.
+**
+**  The \c offset and \c len fields are taken from the table file header and
+**  \c exp is the registered size of the table.
+**/
+#define CFE_TBL_MAPPED_PARTIAL_ERR_EID         104
+
+/** \brief <tt> %s: Unable to map image for '%s' (Stat=%ld) </tt>
+**  \event <tt> %s: Unable to map image for '%s' (Stat=%ld) </tt>
+**
+**  \par Type: ERROR
+**
+**  \par Cause:
+**
+**  The OS was unable to map the table image contained in the load file into
+**  memory for a table registered with the #CFE_TBL_OPT_MAPPED option.  The
+**  \c Stat field contains the status returned by #OS_FileMap.
+**/
+#define CFE_TBL_FILE_MAP_ERR_EID               105
+
+/** \brief <tt> %s: Bad delta segment %lu for '%s' (offset=%lu, len=%lu) </tt>
+**  \event <tt> %s: Bad delta segment %lu for '%s' (offset=%lu, len=%lu) </tt>
+**
+**  \par Type: ERROR
+**
+**  \par Cause:
+**
+**  A segment of a delta table image is empty, extends beyond the end of the table,
+**  or contains more data than the table file header indicates for the whole image.
+**
+**  The segment number, starting with zero, and the \c offset and \c len fields are
+**  taken from the offending segment header.
+**/
+#define CFE_TBL_DELTA_SEGMENT_ERR_EID          106
+
+/** \brief <tt> No differences between inactive and active buffers of '%s', no delta dump written </tt>
+**  \event <tt> No differences between inactive and active buffers of '%s', no delta dump written </tt>
+**
+**  \par Type: INFORMATION
+**
+**  \par Cause:
+**
+**  A \link #CFE_TBL_DUMP_CC Dump Table command \endlink requested a delta dump
+**  (#CFE_TBL_BufferSelect_DELTA) of a table whose inactive buffer is identical
+**  to its active buffer.  Since a delta image with no segments cannot be loaded,
+**  no file is written.
+**/
+#define CFE_TBL_DELTA_DUMP_EMPTY_INF_EID       107
+
 /** \} */
 
 
@@ -48,7 +48,12 @@ enum CFE_TBL_BufferSelect
    /**
     * @brief Select the Active buffer for validate or dump
     */
-   CFE_TBL_BufferSelect_ACTIVE                        = 1
+   CFE_TBL_BufferSelect_ACTIVE                        = 1,
+
+   /**
+    * @brief Select the regions of the Inactive buffer that differ from the Active buffer for dump
+    */
+   CFE_TBL_BufferSelect_DELTA                         = 2
 };
 
 /**
@@ -68,12 +73,26 @@ typedef uint16                                           CFE_TBL_BufferSelect_En
  */
 typedef struct
 {
-    uint32                   Reserved;                             /**< Future Use: NumTblSegments in File?   */
+    uint32                   NumSegments;                          /**< Number of delta segments in File, zero for a contiguous image */
     uint32                   Offset;                               /**< Byte Offset at which load should commence */
     uint32                   NumBytes;                             /**< Number of bytes to load into table */
     char                     TableName[CFE_MISSION_TBL_MAX_FULL_NAME_LEN]; /**< Fully qualified name of table to load */
 } CFE_TBL_File_Hdr_t;
 
+/**
+ * @brief The definition of the header that precedes each segment of a delta table image.
+ *
+ * When the NumSegments field of the CFE_TBL_File_Hdr_t is non-zero, the table data consists of
+ * that many segments, each made of this header followed by NumBytes bytes of table data.
+ * The NumBytes field of the CFE_TBL_File_Hdr_t then holds the total size of all segments,
+ * including their headers, and its Offset field must be zero.
+ */
+typedef struct
+{
+    uint32                   Offset;                               /**< Byte Offset within the table at which the segment is loaded */
+    uint32                   NumBytes;                             /**< Number of bytes of table data in the segment */
+} CFE_TBL_File_SegHdr_t;
+
 
 
 
@@ -531,11 +531,14 @@ typedef struct
 typedef struct
 {
     uint16                ActiveTableFlag;                        /**< \brief #CFE_TBL_BufferSelect_INACTIVE=Inactive Table, 
-                                                                            #CFE_TBL_BufferSelect_ACTIVE=Active Table */
+                                                                            #CFE_TBL_BufferSelect_ACTIVE=Active Table,
+                                                                            #CFE_TBL_BufferSelect_DELTA=Inactive Table Changes */
                                                                 /**< Selects either the "Inactive" 
                                                                      (#CFE_TBL_BufferSelect_INACTIVE) buffer or the 
                                                                      "Active" (#CFE_TBL_BufferSelect_ACTIVE) buffer 
-                                                                     to be dumped */
+                                                                     to be dumped.  #CFE_TBL_BufferSelect_DELTA dumps
+                                                                     only the regions of the "Inactive" buffer that
+                                                                     differ from the "Active" buffer, as a delta image */
     char                  TableName[CFE_MISSION_TBL_MAX_FULL_NAME_LEN]; /**< \brief Full name of table to be dumped */
                                                                 /**< ASCII string containing full table name 
                                                                      identifier of table to be dumped */
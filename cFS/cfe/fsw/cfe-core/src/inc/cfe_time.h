@@ -171,6 +171,17 @@ typedef struct
 */
 typedef int32 (*CFE_TIME_SynchCallbackPtr_t)(void);
 
+/**
+**   \brief Time Minor Frame Callback Function Ptr Type
+**
+**   \par Description
+**        Applications that wish to run at a fixed rate above 1 Hz, in step with the cFE Time
+**        Synchronization signal, must register a callback function with the following prototype via the
+**        #CFE_TIME_RegisterMinorFrameCallback API.  The argument is the number of the minor frame
+**        within the current second, from 0 to #CFE_PLATFORM_TIME_CFG_MINOR_FRAMES - 1.
+*/
+typedef int32 (*CFE_TIME_MinorFrameCallbackPtr_t)(uint32 MinorFrame);
+
 /*****************************************************************************/
 /*
 ** Exported Functions
@@ -511,6 +522,85 @@ CFE_TIME_SysTime_t  CFE_TIME_Subtract(CFE_TIME_SysTime_t Time1, CFE_TIME_SysTime
 **                
 ******************************************************************************/
 CFE_TIME_Compare_t  CFE_TIME_Compare(CFE_TIME_SysTime_t TimeA, CFE_TIME_SysTime_t TimeB);
+
+/*****************************************************************************/
+/**
+** \brief Adds a time value to each of an array of time values
+**
+** \par Description
+**        This routine computes Result[i] = #CFE_TIME_Add (TimeA[i], TimeB)
+**        for i from 0 to Count - 1.  The arithmetic is branch free, so the
+**        compiler can process several time values per instruction.
+**
+** \par Assumptions, External Events, and Notes:
+**        - Result may be the same array as TimeA.
+**
+** \param[out] Result   Array of at least Count elements that receives the sums.
+**
+** \param[in]  TimeA    Array of Count time values.
+**
+** \param[in]  TimeB    The time value to add to each element of TimeA.
+**
+** \param[in]  Count    Number of time values to process.
+**
+** \sa #CFE_TIME_Add, #CFE_TIME_SubtractArray, #CFE_TIME_CompareArray
+**
+******************************************************************************/
+void CFE_TIME_AddArray(CFE_TIME_SysTime_t *Result, const CFE_TIME_SysTime_t *TimeA,
+                       CFE_TIME_SysTime_t TimeB, uint32 Count);
+
+/*****************************************************************************/
+/**
+** \brief Subtracts a time value from each of an array of time values
+**
+** \par Description
+**        This routine computes Result[i] = #CFE_TIME_Subtract (TimeA[i], TimeB)
+**        for i from 0 to Count - 1.  The arithmetic is branch free, so the
+**        compiler can process several time values per instruction.
+**
+** \par Assumptions, External Events, and Notes:
+**        - Result may be the same array as TimeA.
+**
+** \param[out] Result   Array of at least Count elements that receives the differences.
+**
+** \param[in]  TimeA    Array of Count time values.
+**
+** \param[in]  TimeB    The time value to subtract from each element of TimeA.
+**
+** \param[in]  Count    Number of time values to process.
+**
+** \sa #CFE_TIME_Subtract, #CFE_TIME_AddArray, #CFE_TIME_CompareArray
+**
+******************************************************************************/
+void CFE_TIME_SubtractArray(CFE_TIME_SysTime_t *Result, const CFE_TIME_SysTime_t *TimeA,
+                            CFE_TIME_SysTime_t TimeB, uint32 Count);
+
+/*****************************************************************************/
+/**
+** \brief Compares each of an array of time values with a time value
+**
+** \par Description
+**        This routine computes Result[i] = #CFE_TIME_Compare (TimeA[i], TimeB)
+**        for i from 0 to Count - 1, with the same roll-over handling.  The
+**        comparison is branch free, so the compiler can process several time
+**        values per instruction.
+**
+** \par Assumptions, External Events, and Notes:
+**          None
+**
+** \param[out] Result   Array of at least Count elements that receives the comparisons.
+**
+** \param[in]  TimeA    Array of Count time values.
+**
+** \param[in]  TimeB    The time value to compare each element of TimeA with.
+**
+** \param[in]  Count    Number of time values to process.
+**
+** \sa #CFE_TIME_Compare, #CFE_TIME_AddArray, #CFE_TIME_SubtractArray
+**
+******************************************************************************/
+void CFE_TIME_CompareArray(CFE_TIME_Compare_t *Result, const CFE_TIME_SysTime_t *TimeA,
+                           CFE_TIME_SysTime_t TimeB, uint32 Count);
 /**@}*/
 
 /** @defgroup CFEAPITIMEConvert cFE Time Conversion APIs
@@ -582,6 +672,52 @@ uint32  CFE_TIME_Sub2MicroSecs(uint32 SubSeconds);
 ******************************************************************************/
 uint32  CFE_TIME_Micro2SubSecs(uint32 MicroSeconds);
 
+/*****************************************************************************/
+/**
+** \brief Converts an array of sub-seconds counts to microseconds
+**
+** \par Description
+**        This routine computes MicroSeconds[i] = #CFE_TIME_Sub2MicroSecs (SubSeconds[i])
+**        for i from 0 to Count - 1.  The rounding is done without branches,
+**        so the compiler can convert several values per instruction.
+**
+** \par Assumptions, External Events, and Notes:
+**        - MicroSeconds may be the same array as SubSeconds.
+**
+** \param[out] MicroSeconds  Array of at least Count elements that receives the results.
+**
+** \param[in]  SubSeconds    Array of Count sub-seconds counts to convert.
+**
+** \param[in]  Count         Number of values to convert.
+**
+** \sa #CFE_TIME_Sub2MicroSecs, #CFE_TIME_Micro2SubSecsArray
+**
+******************************************************************************/
+void CFE_TIME_Sub2MicroSecsArray(uint32 *MicroSeconds, const uint32 *SubSeconds, uint32 Count);
+
+/*****************************************************************************/
+/**
+** \brief Converts an array of microseconds counts to sub-seconds
+**
+** \par Description
+**        This routine computes SubSeconds[i] = #CFE_TIME_Micro2SubSecs (MicroSeconds[i])
+**        for i from 0 to Count - 1.  The rounding is done without branches,
+**        so the compiler can convert several values per instruction.
+**
+** \par Assumptions, External Events, and Notes:
+**        - SubSeconds may be the same array as MicroSeconds.
+**
+** \param[out] SubSeconds    Array of at least Count elements that receives the results.
+**
+** \param[in]  MicroSeconds  Array of Count microseconds counts to convert.
+**
+** \param[in]  Count         Number of values to convert.
+**
+** \sa #CFE_TIME_Micro2SubSecs, #CFE_TIME_Sub2MicroSecsArray
+**
+******************************************************************************/
+void CFE_TIME_Micro2SubSecsArray(uint32 *SubSeconds, const uint32 *MicroSeconds, uint32 Count);
+
 #ifndef CFE_OMIT_DEPRECATED_6_7
 /*****************************************************************************/
 /**
@@ -843,6 +979,57 @@ int32  CFE_TIME_RegisterSynchCallback(CFE_TIME_SynchCallbackPtr_t CallbackFuncPt
 **
 ******************************************************************************/
 int32  CFE_TIME_UnregisterSynchCallback(CFE_TIME_SynchCallbackPtr_t CallbackFuncPtr);   
+
+
+/*****************************************************************************/
+/**
+** \brief Registers a callback function that is called at the start of every minor frame
+**
+** \par Description
+**        This routine passes a callback function pointer for an Application that wishes to
+**        be notified at the start of every minor frame.  Each second, as marked by the time
+**        synchronization signal, is divided into #CFE_PLATFORM_TIME_CFG_MINOR_FRAMES minor
+**        frames timed by a dedicated high priority timebase.
+**
+** \par Assumptions, External Events, and Notes:
+**        Only a single callback per application is supported, and this function should only
+**        be called from a single thread within each application (typically the apps main thread).
+**        The callback runs in the context of the timebase and must return quickly; it should
+**        typically just give a semaphore that the application's own task pends on.
+**        Callbacks are never called if #CFE_PLATFORM_TIME_CFG_MINOR_FRAMES is zero.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS                       \copybrief CFE_SUCCESS
+** \retval #CFE_TIME_TOO_MANY_SYNCH_CALLBACKS \copybrief CFE_TIME_TOO_MANY_SYNCH_CALLBACKS
+** \retval #CFE_ES_ERR_APPID                  \copybrief CFE_ES_ERR_APPID
+**
+** \sa #CFE_TIME_UnregisterMinorFrameCallback, #CFE_TIME_RegisterSynchCallback
+**
+******************************************************************************/
+int32  CFE_TIME_RegisterMinorFrameCallback(CFE_TIME_MinorFrameCallbackPtr_t CallbackFuncPtr);
+
+
+/*****************************************************************************/
+/**
+** \brief Unregisters a callback function that is called at the start of every minor frame
+**
+** \par Description
+**        This routine removes the specified callback function pointer from the list
+**        of Callback functions that are called at the start of every minor frame.
+**
+** \par Assumptions, External Events, and Notes:
+**        Only a single callback per application is supported, and this function should only
+**        be called from a single thread within each application (typically the apps main thread).
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS                      \copybrief CFE_SUCCESS
+** \retval #CFE_TIME_CALLBACK_NOT_REGISTERED \copybrief CFE_TIME_CALLBACK_NOT_REGISTERED
+** \retval #CFE_ES_ERR_APPID                 \copybrief CFE_ES_ERR_APPID
+**
+** \sa #CFE_TIME_RegisterMinorFrameCallback
+**
+******************************************************************************/
+int32  CFE_TIME_UnregisterMinorFrameCallback(CFE_TIME_MinorFrameCallbackPtr_t CallbackFuncPtr);
 /**@}*/
 
 /** @defgroup CFEAPITIMEMisc cFE Miscellaneous Time APIs
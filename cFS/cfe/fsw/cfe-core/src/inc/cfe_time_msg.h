@@ -97,6 +97,9 @@
 **       - Tone Signal Task Counter (\TIME_TSTASKCNT)
 **       - Local 1 Hz Interrupt Counter (\TIME_1HZISRCNT)
 **       - Local 1 Hz Task Counter (\TIME_1HZTASKCNT)
+**       - Minor Frame Counter (\TIME_MFCNT)
+**       - Minor Frame Slip Counter (\TIME_MFSLIPCNT)
+**       - Minor Frame Jitter Minimum and Maximum (\TIME_MFJITTERMIN, \TIME_MFJITTERMAX)
 **       - Reference Time Version Counter (\TIME_VERSIONCNT)
 **
 **  \cfecmdmnemonic \TIME_RESETCTRS
@@ -1091,6 +1094,16 @@ typedef struct
 	                                               \brief  Local 1Hz ISR execution count */
     uint32                LocalTaskCounter;   /**< \cfetlmmnemonic \TIME_1HZTASKCNT
 	                                               \brief  Local 1Hz task execution count */
+    uint32                MinorFrameCounter;  /**< \cfetlmmnemonic \TIME_MFCNT
+	                                               \brief  Minor frame timebase tick count */
+    uint32                MinorFrameSlipCounter;  /**< \cfetlmmnemonic \TIME_MFSLIPCNT
+	                                               \brief  Minor frames skipped because a tick was late */
+    int32                 MinorFrameJitterLast;   /**< \cfetlmmnemonic \TIME_MFJITTER
+	                                               \brief  Deviation of the most recent minor frame period (micro-seconds) */
+    int32                 MinorFrameJitterMin;    /**< \cfetlmmnemonic \TIME_MFJITTERMIN
+	                                               \brief  Smallest minor frame period deviation (micro-seconds), zero until measured */
+    int32                 MinorFrameJitterMax;    /**< \cfetlmmnemonic \TIME_MFJITTERMAX
+	                                               \brief  Largest minor frame period deviation (micro-seconds), zero until measured */
 
     /*
      ** Miscellaneous counters (not subject to reset command)...
@@ -0,0 +1,282 @@
+/*
+**  GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**  Copyright (c) 2006-2019 United States Government as represented by
+**  the Administrator of the National Aeronautics and Space Administration.
+**  All Rights Reserved.
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**    http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+*/
+
+/**
+ * \file cfe_name_index.h
+ *
+ * Hashed name index shared by the cFE core registries.
+ *
+ * Several core registries (tables, CDS blocks, SB pipes) are fixed size arrays
+ * of records that are looked up by name.  This index maps a name to the array
+ * position of its record using an open addressing hash table (linear probing,
+ * backward shift deletion), so lookups no longer scan the whole registry.
+ *
+ * The index does not copy names; each slot points at the name stored in the
+ * registry record itself.  The owning module is responsible for inserting a
+ * name after it is written into the record, removing it before the record's
+ * name is cleared or overwritten, and serializing updates with its own
+ * registry lock.
+ *
+ * The functions are defined inline here, rather than in one of the core
+ * modules, so that every module (and its unit test, which links the other
+ * modules as stubs) carries a working copy.
+ */
+
+#ifndef CFE_NAME_INDEX_H_
+#define CFE_NAME_INDEX_H_
+
+#include <string.h>
+#include "common_types.h"
+
+/**
+ * Value returned by CFE_NameIndex_Find() when a name is not in the index
+ */
+#define CFE_NAME_INDEX_NOT_FOUND        (-1)
+
+/**
+ * Number of slots an index needs to hold MaxEntries names
+ *
+ * Keeping the index at most half full keeps probe sequences short,
+ * including those of unsuccessful lookups.
+ */
+#define CFE_NAME_INDEX_SLOTS(MaxEntries)    (2 * (MaxEntries))
+
+/**
+ * A single position in the hash table
+ */
+typedef struct
+{
+    const char  *Name;      /**< Name stored in the registry record, NULL if the slot is empty */
+    uint32       Hash;      /**< Hash of Name, saved so it need not be recomputed on deletion */
+    int32        Entry;     /**< Registry array index of the record */
+} CFE_NameIndex_Slot_t;
+
+/**
+ * A name index over caller supplied slot storage
+ */
+typedef struct
+{
+    CFE_NameIndex_Slot_t *Slots;    /**< Slot storage, see #CFE_NAME_INDEX_SLOTS */
+    uint32                NumSlots; /**< Number of elements in Slots */
+} CFE_NameIndex_t;
+
+/**
+ * @brief Computes the hash of a name
+ *
+ * 32 bit FNV-1a, which is cheap to compute and spreads the long common
+ * prefixes typical of registry names ("APP.Table...") well.
+ *
+ * @returns The hash value
+ */
+static inline uint32 CFE_NameIndex_Hash(const char *Name)
+{
+    uint32 Hash = 2166136261U;
+
+    while (*Name != '\0')
+    {
+        Hash ^= (uint8)*Name;
+        Hash *= 16777619U;
+        ++Name;
+    }
+
+    return Hash;
+}
+
+/**
+ * @brief Removes every name from an index
+ */
+static inline void CFE_NameIndex_Clear(CFE_NameIndex_t *IndexPtr)
+{
+    uint32 i;
+
+    for (i = 0; i < IndexPtr->NumSlots; ++i)
+    {
+        IndexPtr->Slots[i].Name = NULL;
+        IndexPtr->Slots[i].Hash = 0;
+        IndexPtr->Slots[i].Entry = CFE_NAME_INDEX_NOT_FOUND;
+    }
+}
+
+/**
+ * @brief Prepares an empty index using the given slot storage
+ *
+ * @param IndexPtr  The index to initialize
+ * @param Slots     Storage for the index, at least #CFE_NAME_INDEX_SLOTS entries
+ * @param NumSlots  Number of elements in Slots
+ */
+static inline void CFE_NameIndex_Init(CFE_NameIndex_t *IndexPtr, CFE_NameIndex_Slot_t *Slots, uint32 NumSlots)
+{
+    IndexPtr->Slots = Slots;
+    IndexPtr->NumSlots = NumSlots;
+
+    CFE_NameIndex_Clear(IndexPtr);
+}
+
+/**
+ * @brief Finds the slot holding a name
+ *
+ * @returns The slot position, or the position of the empty slot that ends
+ *          the probe sequence if the name is not in the index.
+ */
+static inline uint32 CFE_NameIndex_Probe(const CFE_NameIndex_t *IndexPtr, const char *Name, uint32 Hash)
+{
+    uint32 i = Hash % IndexPtr->NumSlots;
+    uint32 Count = IndexPtr->NumSlots;
+
+    while (IndexPtr->Slots[i].Name != NULL && Count > 0)
+    {
+        if (IndexPtr->Slots[i].Hash == Hash && strcmp(IndexPtr->Slots[i].Name, Name) == 0)
+        {
+            break;
+        }
+
+        i = (i + 1) % IndexPtr->NumSlots;
+        --Count;
+    }
+
+    return i;
+}
+
+/**
+ * @brief Looks up a name
+ *
+ * An index that has not been initialized is treated as empty.
+ *
+ * The caller should still confirm that the record at the returned position
+ * is in use, exactly as it would have when scanning the registry.
+ *
+ * @returns The registry index associated with the name, or
+ *          #CFE_NAME_INDEX_NOT_FOUND if it is not in the index.
+ */
+static inline int32 CFE_NameIndex_Find(const CFE_NameIndex_t *IndexPtr, const char *Name)
+{
+    uint32 i;
+
+    if (IndexPtr->NumSlots == 0)
+    {
+        return CFE_NAME_INDEX_NOT_FOUND;
+    }
+
+    i = CFE_NameIndex_Probe(IndexPtr, Name, CFE_NameIndex_Hash(Name));
+
+    if (IndexPtr->Slots[i].Name == NULL || strcmp(IndexPtr->Slots[i].Name, Name) != 0)
+    {
+        return CFE_NAME_INDEX_NOT_FOUND;
+    }
+
+    return IndexPtr->Slots[i].Entry;
+}
+
+/**
+ * @brief Associates a name with a registry index
+ *
+ * If the name is already in the index, it is moved to the new registry
+ * index; a name only ever refers to one record.
+ *
+ * @param IndexPtr  The index to update
+ * @param Name      Name stored in the registry record; must remain valid
+ *                  and unchanged until it is removed from the index.
+ * @param Entry     Registry array index of the record
+ *
+ * @returns true if the name was added, false if the index is full
+ */
+static inline bool CFE_NameIndex_Insert(CFE_NameIndex_t *IndexPtr, const char *Name, int32 Entry)
+{
+    uint32 Hash = CFE_NameIndex_Hash(Name);
+    uint32 i;
+
+    if (IndexPtr->NumSlots == 0)
+    {
+        return false;
+    }
+
+    i = CFE_NameIndex_Probe(IndexPtr, Name, Hash);
+
+    if (IndexPtr->Slots[i].Name != NULL && strcmp(IndexPtr->Slots[i].Name, Name) != 0)
+    {
+        /* Every slot was probed without finding the name or an empty slot */
+        return false;
+    }
+
+    IndexPtr->Slots[i].Name = Name;
+    IndexPtr->Slots[i].Hash = Hash;
+    IndexPtr->Slots[i].Entry = Entry;
+
+    return true;
+}
+
+/**
+ * @brief Removes a name from the index
+ *
+ * Nothing is removed unless the name currently refers to the given registry
+ * index, so removing a stale record cannot disturb a newer one of the same name.
+ * Later members of the probe sequence are shifted back into the vacated slot,
+ * so the index never accumulates deleted markers.
+ *
+ * @param IndexPtr  The index to update
+ * @param Name      Name of the record, which must not yet have been cleared
+ * @param Entry     Registry array index of the record
+ */
+static inline void CFE_NameIndex_Remove(CFE_NameIndex_t *IndexPtr, const char *Name, int32 Entry)
+{
+    uint32 Hole;
+    uint32 Next;
+    uint32 Home;
+
+    if (IndexPtr->NumSlots == 0)
+    {
+        return;
+    }
+
+    Hole = CFE_NameIndex_Probe(IndexPtr, Name, CFE_NameIndex_Hash(Name));
+    Next = Hole;
+
+    if (IndexPtr->Slots[Hole].Name == NULL || IndexPtr->Slots[Hole].Entry != Entry ||
+        strcmp(IndexPtr->Slots[Hole].Name, Name) != 0)
+    {
+        return;
+    }
+
+    while (true)
+    {
+        Next = (Next + 1) % IndexPtr->NumSlots;
+
+        if (IndexPtr->Slots[Next].Name == NULL || Next == Hole)
+        {
+            break;
+        }
+
+        /* A slot may only move back if its home position is not between the hole and itself */
+        Home = IndexPtr->Slots[Next].Hash % IndexPtr->NumSlots;
+        if ((Hole <= Next) ? (Hole < Home && Home <= Next) : (Hole < Home || Home <= Next))
+        {
+            continue;
+        }
+
+        IndexPtr->Slots[Hole] = IndexPtr->Slots[Next];
+        Hole = Next;
+    }
+
+    IndexPtr->Slots[Hole].Name = NULL;
+    IndexPtr->Slots[Hole].Hash = 0;
+    IndexPtr->Slots[Hole].Entry = CFE_NAME_INDEX_NOT_FOUND;
+}
+
+#endif /* CFE_NAME_INDEX_H_ */
@@ -172,6 +172,11 @@ int32  CFE_SB_CreatePipe(CFE_SB_PipeId_t *PipeIdPtr, uint16  Depth, const char *
     CFE_SB.PipeTbl[PipeTblIdx].ToTrashBuff = NULL;
     strcpy(&CFE_SB.PipeTbl[PipeTblIdx].AppName[0],&AppName[0]);
 
+    /* OS_QueueCreate() has already rejected names that do not fit */
+    strncpy(CFE_SB.PipeTbl[PipeTblIdx].PipeName, PipeName, OS_MAX_API_NAME - 1);
+    CFE_SB.PipeTbl[PipeTblIdx].PipeName[OS_MAX_API_NAME - 1] = '\0';
+    CFE_NameIndex_Insert(&CFE_SB.PipeNameIndex, CFE_SB.PipeTbl[PipeTblIdx].PipeName, PipeTblIdx);
+
     /* Increment the Pipes in use ctr and if it's > the high water mark,*/
     /* adjust the high water mark */
     CFE_SB.StatTlmMsg.Payload.PipesInUse++;
@@ -349,6 +354,8 @@ int32 CFE_SB_DeletePipeFull(CFE_SB_PipeId_t PipeId,uint32 AppId)
     OS_QueueDelete(CFE_SB.PipeTbl[PipeTblIdx].SysQueueId);
 
     /* remove the pipe from the pipe table */
+    CFE_NameIndex_Remove(&CFE_SB.PipeNameIndex, CFE_SB.PipeTbl[PipeTblIdx].PipeName, PipeTblIdx);
+    CFE_SB.PipeTbl[PipeTblIdx].PipeName[0]   = '\0';
     CFE_SB.PipeTbl[PipeTblIdx].InUse         = CFE_SB_NOT_IN_USE;
     CFE_SB.PipeTbl[PipeTblIdx].SysQueueId    = CFE_SB_UNUSED_QUEUE;
     CFE_SB.PipeTbl[PipeTblIdx].PipeId        = CFE_SB_INVALID_PIPE;
@@ -549,11 +556,9 @@ int32 CFE_SB_GetPipeName(char *PipeNameBuf, size_t PipeNameSize, CFE_SB_PipeId_t
  */
 int32 CFE_SB_GetPipeIdByName(CFE_SB_PipeId_t *PipeIdPtr, const char *PipeName)
 {
-    uint8         PipeTblIdx = 0;
+    int32         PipeTblIdx = 0;
     int32         Status = CFE_SUCCESS;
-    int32         RtnFromVal = 0;
     uint32        TskId = 0;
-    uint32        QueueId = 0;
     char          FullName[(OS_MAX_API_NAME * 2)];
 
     if(PipeName == NULL || PipeIdPtr == NULL)
@@ -571,55 +576,27 @@ int32 CFE_SB_GetPipeIdByName(CFE_SB_PipeId_t *PipeIdPtr, const char *PipeName)
         /* get TaskId of caller for events */
         TskId = OS_TaskGetId();
 
-        RtnFromVal = OS_QueueGetIdByName(&QueueId, PipeName);
-
-        if(RtnFromVal == OS_SUCCESS)
-        {
-            /* take semaphore to prevent a task switch while iterating
-             * through the PipeTbl.
-             */
-            CFE_SB_LockSharedData(__func__,__LINE__);
-
-            for(PipeTblIdx = 0;
-                PipeTblIdx < CFE_PLATFORM_SB_MAX_PIPES;
-                PipeTblIdx++)
-            {
-                if(CFE_SB.PipeTbl[PipeTblIdx].InUse != 0
-                    && CFE_SB.PipeTbl[PipeTblIdx].SysQueueId == QueueId)
-                {
-                    /* grab the ID before we release the lock */
-                    *PipeIdPtr = CFE_SB.PipeTbl[PipeTblIdx].PipeId;
-
-                    break;
-                }/* end if */
-
-            }/* end for */
-
-            CFE_SB_UnlockSharedData(__func__,__LINE__);
-
-            if(PipeTblIdx == CFE_PLATFORM_SB_MAX_PIPES)
-            {
-                /* should never get here! */
-                CFE_SB.HKTlmMsg.Payload.GetPipeIdByNameErrorCounter++;
-
-                CFE_EVS_SendEventWithAppID(CFE_SB_GETPIPEIDBYNAME_NAME_ERR_EID,
-                    CFE_EVS_EventType_ERROR, CFE_SB.AppId,
-                    "Pipe ID By Name Error:Bad Argument,Requestor %s",
-                    CFE_SB_GetAppTskName(TskId,FullName));
+        /* take semaphore to prevent a task switch while
+         * looking up the pipe name.
+         */
+        CFE_SB_LockSharedData(__func__,__LINE__);
 
-                Status = CFE_SB_BAD_ARGUMENT;
-            }
-            else
-            {
-                CFE_EVS_SendEventWithAppID(CFE_SB_GETPIPEIDBYNAME_EID,
-                    CFE_EVS_EventType_DEBUG,CFE_SB.AppId,
-                    "PipeIdByName name=%s id=%d",
-                    PipeName, *PipeIdPtr);
+        PipeTblIdx = CFE_NameIndex_Find(&CFE_SB.PipeNameIndex, PipeName);
 
-                Status = CFE_SUCCESS;
-            }
+        if(PipeTblIdx != CFE_NAME_INDEX_NOT_FOUND
+            && CFE_SB.PipeTbl[PipeTblIdx].InUse != 0)
+        {
+            /* grab the ID before we release the lock */
+            *PipeIdPtr = CFE_SB.PipeTbl[PipeTblIdx].PipeId;
         }
         else
+        {
+            PipeTblIdx = CFE_NAME_INDEX_NOT_FOUND;
+        }/* end if */
+
+        CFE_SB_UnlockSharedData(__func__,__LINE__);
+
+        if(PipeTblIdx == CFE_NAME_INDEX_NOT_FOUND)
         {
             CFE_SB.HKTlmMsg.Payload.GetPipeIdByNameErrorCounter++;
 
@@ -629,6 +606,15 @@ int32 CFE_SB_GetPipeIdByName(CFE_SB_PipeId_t *PipeIdPtr, const char *PipeName)
                 CFE_SB_GetAppTskName(TskId,FullName));
 
             Status = CFE_SB_BAD_ARGUMENT;
+        }
+        else
+        {
+            CFE_EVS_SendEventWithAppID(CFE_SB_GETPIPEIDBYNAME_EID,
+                CFE_EVS_EventType_DEBUG,CFE_SB.AppId,
+                "PipeIdByName name=%s id=%d",
+                PipeName, *PipeIdPtr);
+
+            Status = CFE_SUCCESS;
         }/* end if */
 
     }/* end if */
@@ -637,6 +623,35 @@ int32 CFE_SB_GetPipeIdByName(CFE_SB_PipeId_t *PipeIdPtr, const char *PipeName)
 
 }/* end CFE_SB_GetPipeIdByName */
 
+/*
+ *  Function:  CFE_SB_GetPipeQueueId - See API and header file for details
+ */
+int32 CFE_SB_GetPipeQueueId(CFE_SB_PipeId_t PipeId, uint32 *QueueIdPtr)
+{
+    uint8         PipeTblIdx;
+    int32         Status = CFE_SB_BAD_ARGUMENT;
+
+    if(QueueIdPtr == NULL)
+    {
+        return CFE_SB_BAD_ARGUMENT;
+    }
+
+    CFE_SB_LockSharedData(__func__,__LINE__);
+
+    PipeTblIdx = CFE_SB_GetPipeIdx(PipeId);
+
+    if((CFE_SB_ValidatePipeId(PipeId) == CFE_SUCCESS)&&(PipeTblIdx != CFE_SB_INVALID_PIPE))
+    {
+        *QueueIdPtr = CFE_SB.PipeTbl[PipeTblIdx].SysQueueId;
+        Status = CFE_SUCCESS;
+    }/* end if */
+
+    CFE_SB_UnlockSharedData(__func__,__LINE__);
+
+    return Status;
+
+}/* end CFE_SB_GetPipeQueueId */
+
 
 /*
  * Function: CFE_SB_SubscribeEx - See API and header file for details
@@ -1180,6 +1195,7 @@ int32  CFE_SB_SendMsgFull(CFE_SB_Msg_t    *MsgPtr,
     CFE_SB_RouteEntry_t     *RtgTblPtr;
     CFE_SB_BufferD_t        *BufDscPtr;
     uint16                  TotalMsgSize;
+    CFE_SB_MsgRouteView_t   RouteView;
     CFE_SB_MsgRouteIdx_t    RtgTblIdx;
     uint32                  TskId = 0;
     uint16                  i;
@@ -1203,7 +1219,9 @@ int32  CFE_SB_SendMsgFull(CFE_SB_Msg_t    *MsgPtr,
         return CFE_SB_BAD_ARGUMENT;
     }/* end if */
 
-    MsgId = CFE_SB_GetMsgId(MsgPtr);
+    /* decode only the header fields needed for routing, and just once */
+    CFE_SB_GetMsgRouteView(MsgPtr, &RouteView);
+    MsgId = RouteView.MsgId;
 
     /* validate the msgid in the message */
     if(!CFE_SB_IsValidMsgId(MsgId))
@@ -1223,7 +1241,7 @@ int32  CFE_SB_SendMsgFull(CFE_SB_Msg_t    *MsgPtr,
         return CFE_SB_BAD_ARGUMENT;
     }/* end if */
 
-    TotalMsgSize = CFE_SB_GetTotalMsgLength(MsgPtr);
+    TotalMsgSize = RouteView.TotalLength;
 
     /* Verify the size of the pkt is < or = the mission defined max */
     if(TotalMsgSize > CFE_MISSION_SB_MAX_SB_MSG_SIZE){
@@ -194,8 +194,12 @@ void CFE_SB_InitPipeTbl(void){
         CFE_SB.PipeTbl[i].SysQueueId    = CFE_SB_UNUSED_QUEUE;
         CFE_SB.PipeTbl[i].PipeId        = CFE_SB_INVALID_PIPE;
         CFE_SB.PipeTbl[i].CurrentBuff   = NULL;
+        CFE_SB.PipeTbl[i].PipeName[0]   = '\0';
     }/* end for */
 
+    CFE_NameIndex_Init(&CFE_SB.PipeNameIndex, CFE_SB.PipeNameIndexSlots,
+                       CFE_NAME_INDEX_SLOTS(CFE_PLATFORM_SB_MAX_PIPES));
+
 }/* end CFE_SB_InitPipeTbl */
 
 
@@ -37,6 +37,7 @@
 */
 #include "common_types.h"
 #include "private/cfe_private.h"
+#include "private/cfe_name_index.h"
 #include "cfe_sb.h"
 #include "cfe_sb_msg.h"
 #include "cfe_time.h"
@@ -155,6 +156,19 @@ typedef struct
     CFE_SB_MsgRouteIdx_Atom_t RouteIdx;     /**< Holding value, do not use directly in code */
 } CFE_SB_MsgRouteIdx_t;
 
+/******************************************************************************/
+/**
+ * @brief The header fields needed to route a message
+ *
+ * A subset of #CFE_SB_MsgHdrView_t for the send path, which only needs the
+ * message ID and length and should not pay for decoding the packet time.
+ */
+typedef struct
+{
+    CFE_SB_MsgId_t  MsgId;          /**< Message ID, as returned by #CFE_SB_GetMsgId */
+    uint16          TotalLength;    /**< Total message length, as returned by #CFE_SB_GetTotalMsgLength */
+} CFE_SB_MsgRouteView_t;
+
 
 /******************************************************************************
 **  Typedef:  CFE_SB_BufferD_t
@@ -246,6 +260,7 @@ typedef struct {
 typedef struct {
      uint8              InUse;
      CFE_SB_PipeId_t    PipeId;
+     char               PipeName[OS_MAX_API_NAME];
      char               AppName[OS_MAX_API_NAME];
      uint8              Opts;
      uint8              Spare;
@@ -288,6 +303,8 @@ typedef struct {
     uint32              StopRecurseFlags[CFE_PLATFORM_ES_MAX_APPLICATIONS];
     void               *ZeroCopyTail;
     CFE_SB_PipeD_t      PipeTbl[CFE_PLATFORM_SB_MAX_PIPES];
+    CFE_NameIndex_t     PipeNameIndex;
+    CFE_NameIndex_Slot_t PipeNameIndexSlots[CFE_NAME_INDEX_SLOTS(CFE_PLATFORM_SB_MAX_PIPES)];
     CFE_SB_HousekeepingTlm_t        HKTlmMsg;
     CFE_SB_StatsTlm_t               StatTlmMsg;
     CFE_SB_PipeId_t     CmdPipe;
@@ -429,6 +446,23 @@ int32 CFE_SB_RemoveDest(CFE_SB_RouteEntry_t *RouteEntry, CFE_SB_DestinationD_t *
 **/
 uint16 CFE_SB_MsgHdrSize(const CFE_SB_Msg_t *MsgPtr);
 
+/*****************************************************************************/
+/**
+** \brief Decodes the header fields needed to route a software bus message.
+**
+** \par Description
+**          This routine fills in a #CFE_SB_MsgRouteView_t with the message ID
+**          and total length of a software bus message, the same values
+**          #CFE_SB_GetMsgHdrView would return for them.
+**
+** \param[in]  MsgPtr      A pointer to the buffer that contains the software bus message.
+**
+** \param[out] ViewPtr     A pointer to the structure that receives the decoded fields.
+**
+** \sa #CFE_SB_GetMsgHdrView
+**/
+void CFE_SB_GetMsgRouteView(const CFE_SB_Msg_t *MsgPtr, CFE_SB_MsgRouteView_t *ViewPtr);
+
 
 /*
  * Software Bus Message Handler Function prototypes
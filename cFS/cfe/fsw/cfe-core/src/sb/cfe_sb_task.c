@@ -318,20 +318,19 @@ int32 CFE_SB_AppInit(void){
 bool CFE_SB_VerifyCmdLength(CFE_SB_MsgPtr_t Msg, uint16 ExpectedLength)
 {
     bool result       = true;
-    uint16  ActualLength = CFE_SB_GetTotalMsgLength(Msg);
+    CFE_SB_MsgHdrView_t HdrView;
+
+    CFE_SB_GetMsgHdrView(Msg, &HdrView);
 
     /*
     ** Verify the command packet length
     */
-    if (ExpectedLength != ActualLength)
+    if (ExpectedLength != HdrView.TotalLength)
     {
-        CFE_SB_MsgId_t MessageID = CFE_SB_GetMsgId(Msg);
-        uint16 CommandCode = CFE_SB_GetCmdCode(Msg);
-
         CFE_EVS_SendEvent(CFE_SB_LEN_ERR_EID, CFE_EVS_EventType_ERROR,
                 "Invalid cmd length: ID = 0x%X, CC = %d, Exp Len = %d, Len = %d",
-                (unsigned int)CFE_SB_MsgIdToValue(MessageID), (int)CommandCode,
-                (int)ExpectedLength, (int)ActualLength);
+                (unsigned int)CFE_SB_MsgIdToValue(HdrView.MsgId), (int)HdrView.CmdCode,
+                (int)ExpectedLength, (int)HdrView.TotalLength);
         result = false;
         ++CFE_SB.HKTlmMsg.Payload.CommandErrorCounter;
     }
@@ -355,11 +354,11 @@ bool CFE_SB_VerifyCmdLength(CFE_SB_MsgPtr_t Msg, uint16 ExpectedLength)
 **    none
 */
 void CFE_SB_ProcessCmdPipePkt(void) {
-   CFE_SB_MsgId_t MessageID;
+   CFE_SB_MsgHdrView_t HdrView;
 
-   MessageID = CFE_SB_GetMsgId(CFE_SB.CmdPipePktPtr);
+   CFE_SB_GetMsgHdrView(CFE_SB.CmdPipePktPtr, &HdrView);
 
-   switch(CFE_SB_MsgIdToValue(MessageID)){
+   switch(CFE_SB_MsgIdToValue(HdrView.MsgId)){
 
       case CFE_SB_SEND_HK_MID:
          /* Note: Command counter not incremented for this command */
@@ -368,7 +367,7 @@ void CFE_SB_ProcessCmdPipePkt(void) {
 
       case CFE_SB_SUB_RPT_CTRL_MID:
          /* Note: Command counter not incremented for this command */
-         switch (CFE_SB_GetCmdCode(CFE_SB.CmdPipePktPtr)) {
+         switch (HdrView.CmdCode) {
             case CFE_SB_SEND_PREV_SUBS_CC:
                 if (CFE_SB_VerifyCmdLength(CFE_SB.CmdPipePktPtr, sizeof(CFE_SB_SendPrevSubs_t)))
                 {
@@ -393,14 +392,14 @@ void CFE_SB_ProcessCmdPipePkt(void) {
             default:
                CFE_EVS_SendEvent(CFE_SB_BAD_CMD_CODE_EID,CFE_EVS_EventType_ERROR,
                      "Invalid Cmd, Unexpected Command Code %d",
-                     (int)CFE_SB_GetCmdCode(CFE_SB.CmdPipePktPtr));
+                     (int)HdrView.CmdCode);
                CFE_SB.HKTlmMsg.Payload.CommandErrorCounter++;
                break;
          } /* end switch on cmd code */
          break;
 
       case CFE_SB_CMD_MID:
-         switch (CFE_SB_GetCmdCode(CFE_SB.CmdPipePktPtr)) {
+         switch (HdrView.CmdCode) {
             case CFE_SB_NOOP_CC:
                 if (CFE_SB_VerifyCmdLength(CFE_SB.CmdPipePktPtr, sizeof(CFE_SB_Noop_t)))
                 {
@@ -461,7 +460,7 @@ void CFE_SB_ProcessCmdPipePkt(void) {
             default:
                CFE_EVS_SendEvent(CFE_SB_BAD_CMD_CODE_EID,CFE_EVS_EventType_ERROR,
                      "Invalid Cmd, Unexpected Command Code %d",
-                     (int)CFE_SB_GetCmdCode(CFE_SB.CmdPipePktPtr));
+                     (int)HdrView.CmdCode);
                CFE_SB.HKTlmMsg.Payload.CommandErrorCounter++;
                break;
          } /* end switch on cmd code */
@@ -470,7 +469,7 @@ void CFE_SB_ProcessCmdPipePkt(void) {
          default:
             CFE_EVS_SendEvent(CFE_SB_BAD_MSGID_EID,CFE_EVS_EventType_ERROR,
                   "Invalid Cmd, Unexpected Msg Id: 0x%04x",
-                  (unsigned int)CFE_SB_MsgIdToValue(MessageID));
+                  (unsigned int)CFE_SB_MsgIdToValue(HdrView.MsgId));
             CFE_SB.HKTlmMsg.Payload.CommandErrorCounter++;
             break;
 
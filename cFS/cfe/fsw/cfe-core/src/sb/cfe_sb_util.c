@@ -35,11 +35,37 @@
 */
 
 #include "cfe_sb.h"
+#include "cfe_sb_priv.h"
 #include "ccsds.h"
 #include "osapi.h"
 #include "cfe_error.h"
 
 #include <string.h>
+#include <stddef.h>
+
+/*
+** The secondary headers immediately follow the space packet header, so their
+** offset is a compile time constant for the configured message format
+*/
+CompileTimeAssert(offsetof(CCSDS_CommandPacket_t, Sec) == CFE_SB_SEC_HDR_OFFSET, CmdSecHdrOffsetMismatch);
+CompileTimeAssert(offsetof(CCSDS_TelemetryPacket_t, Sec) == CFE_SB_SEC_HDR_OFFSET, TlmSecHdrOffsetMismatch);
+
+/*
+** Bits of the first primary header byte that determine the header layout:
+** the secondary header flag (0x08) and the packet type (0x10)
+*/
+#define CFE_SB_HDR_LAYOUT(phdr)     (((phdr).StreamId[0] >> 3) & 0x03)
+
+/*
+** Total header size for each value of CFE_SB_HDR_LAYOUT
+*/
+static const uint16 CFE_SB_HdrSizeByLayout[4] =
+{
+    CFE_SB_PRI_HDR_SIZE,    /* telemetry, no secondary header */
+    CFE_SB_TLM_HDR_SIZE,    /* telemetry secondary header */
+    CFE_SB_PRI_HDR_SIZE,    /* command, no secondary header */
+    CFE_SB_CMD_HDR_SIZE     /* command secondary header */
+};
 
 /*
  * Function: CFE_SB_InitMsg - See API and header file for details
@@ -97,27 +123,8 @@ void CFE_SB_InitMsg(void           *MsgPtr,
 uint16 CFE_SB_MsgHdrSize(const CFE_SB_Msg_t *MsgPtr)
 {
 
-    uint16 size;
-    const CCSDS_PriHdr_t  *HdrPtr;
-
-    HdrPtr = (const CCSDS_PriHdr_t *) MsgPtr;
-
-    /* if secondary hdr is not present... */
-    /* Since all cFE messages must have a secondary hdr this check is not needed */
-    if(CCSDS_RD_SHDR(*HdrPtr) == 0){
-        size = sizeof(CCSDS_PriHdr_t);
-
-    }else if(CCSDS_RD_TYPE(*HdrPtr) == CCSDS_CMD){
-
-        size = CFE_SB_CMD_HDR_SIZE;
-
-    }else{
-
-        size = CFE_SB_TLM_HDR_SIZE;
-  
-    }
-
-   return size;
+    /* The secondary header flag and packet type select one of the fixed layouts */
+    return CFE_SB_HdrSizeByLayout[CFE_SB_HDR_LAYOUT(MsgPtr->Hdr)];
 
 }/* end CFE_SB_MsgHdrSize */
 
@@ -188,10 +195,19 @@ void CFE_SB_SetTotalMsgLength(CFE_SB_MsgPtr_t MsgPtr,uint16 TotalLength)
 }/* end CFE_SB_SetTotalMsgLength */
 
 
-/*
- * Function: CFE_SB_GetMsgTime - See API and header file for details
- */
-CFE_TIME_SysTime_t CFE_SB_GetMsgTime(CFE_SB_MsgPtr_t MsgPtr)
+/******************************************************************************
+**  Function:  CFE_SB_DecodeMsgTime()
+**
+**  Purpose:
+**    Get the time from a message known to have a telemetry secondary header.
+**
+**  Arguments:
+**    *TlmHdrPtr - Pointer to the telemetry header of a SB message
+**
+**  Return:
+**     Packet time converted to CFE_TIME_SysTime_t format.
+*/
+static CFE_TIME_SysTime_t CFE_SB_DecodeMsgTime(const CFE_SB_TlmHdr_t *TlmHdrPtr)
 {
     CFE_TIME_SysTime_t TimeFromMsg;
     uint32 LocalSecs32 = 0;
@@ -201,36 +217,28 @@ CFE_TIME_SysTime_t CFE_SB_GetMsgTime(CFE_SB_MsgPtr_t MsgPtr)
     uint16 LocalSubs16;
     #endif
 
-    CFE_SB_TlmHdr_t *TlmHdrPtr;
-
-    /* if msg type is a command or msg has no secondary hdr, time = 0 */
-    if ((CCSDS_RD_TYPE(MsgPtr->Hdr) != CCSDS_CMD) && (CCSDS_RD_SHDR(MsgPtr->Hdr) != 0)) {
-
-        /* copy time data to/from packets to eliminate alignment issues */
-        TlmHdrPtr = (CFE_SB_TlmHdr_t *)MsgPtr;
-
-        #if (CFE_MISSION_SB_PACKET_TIME_FORMAT == CFE_MISSION_SB_TIME_32_16_SUBS)
+    /* copy time data to/from packets to eliminate alignment issues */
+    #if (CFE_MISSION_SB_PACKET_TIME_FORMAT == CFE_MISSION_SB_TIME_32_16_SUBS)
 
-        memcpy(&LocalSecs32, &TlmHdrPtr->Tlm.Sec.Time[0], 4);
-        memcpy(&LocalSubs16, &TlmHdrPtr->Tlm.Sec.Time[4], 2);
-        /* convert packet data into CFE_TIME_SysTime_t format */
-        LocalSubs32 = ((uint32) LocalSubs16) << 16;
+    memcpy(&LocalSecs32, &TlmHdrPtr->Tlm.Sec.Time[0], 4);
+    memcpy(&LocalSubs16, &TlmHdrPtr->Tlm.Sec.Time[4], 2);
+    /* convert packet data into CFE_TIME_SysTime_t format */
+    LocalSubs32 = ((uint32) LocalSubs16) << 16;
 
-        #elif (CFE_MISSION_SB_PACKET_TIME_FORMAT == CFE_MISSION_SB_TIME_32_32_SUBS)
+    #elif (CFE_MISSION_SB_PACKET_TIME_FORMAT == CFE_MISSION_SB_TIME_32_32_SUBS)
 
-        memcpy(&LocalSecs32, &TlmHdrPtr->Tlm.Sec.Time[0], 4);
-        memcpy(&LocalSubs32, &TlmHdrPtr->Tlm.Sec.Time[4], 4);
-        /* no conversion necessary -- packet format = CFE_TIME_SysTime_t format */
+    memcpy(&LocalSecs32, &TlmHdrPtr->Tlm.Sec.Time[0], 4);
+    memcpy(&LocalSubs32, &TlmHdrPtr->Tlm.Sec.Time[4], 4);
+    /* no conversion necessary -- packet format = CFE_TIME_SysTime_t format */
 
-        #elif (CFE_MISSION_SB_PACKET_TIME_FORMAT == CFE_MISSION_SB_TIME_32_32_M_20)
+    #elif (CFE_MISSION_SB_PACKET_TIME_FORMAT == CFE_MISSION_SB_TIME_32_32_M_20)
 
-        memcpy(&LocalSecs32, &TlmHdrPtr->Tlm.Sec.Time[0], 4);
-        memcpy(&LocalSubs32, &TlmHdrPtr->Tlm.Sec.Time[4], 4);
-        /* convert packet data into CFE_TIME_SysTime_t format */
-        LocalSubs32 = CFE_TIME_Micro2SubSecs((LocalSubs32 >> 12));
+    memcpy(&LocalSecs32, &TlmHdrPtr->Tlm.Sec.Time[0], 4);
+    memcpy(&LocalSubs32, &TlmHdrPtr->Tlm.Sec.Time[4], 4);
+    /* convert packet data into CFE_TIME_SysTime_t format */
+    LocalSubs32 = CFE_TIME_Micro2SubSecs((LocalSubs32 >> 12));
 
-        #endif
-    }
+    #endif
 
     /* return the packet time converted to CFE_TIME_SysTime_t format */
     TimeFromMsg.Seconds    = LocalSecs32;
@@ -238,9 +246,96 @@ CFE_TIME_SysTime_t CFE_SB_GetMsgTime(CFE_SB_MsgPtr_t MsgPtr)
 
     return TimeFromMsg;
 
+}/* end CFE_SB_DecodeMsgTime */
+
+
+/*
+ * Function: CFE_SB_GetMsgTime - See API and header file for details
+ */
+CFE_TIME_SysTime_t CFE_SB_GetMsgTime(CFE_SB_MsgPtr_t MsgPtr)
+{
+    CFE_TIME_SysTime_t TimeFromMsg = {0, 0};
+
+    /* if msg type is a command or msg has no secondary hdr, time = 0 */
+    if ((CCSDS_RD_TYPE(MsgPtr->Hdr) != CCSDS_CMD) && (CCSDS_RD_SHDR(MsgPtr->Hdr) != 0)) {
+
+        TimeFromMsg = CFE_SB_DecodeMsgTime((const CFE_SB_TlmHdr_t *)MsgPtr);
+
+    }
+
+    return TimeFromMsg;
+
 }/* end CFE_SB_GetMsgTime */
 
 
+/******************************************************************************
+**  Function:  CFE_SB_GetMsgRouteView()
+**
+**  Purpose:
+**    Decode the message ID and total length of a message.
+**
+**  Arguments:
+**    *MsgPtr  - Pointer to a SB message
+**    *ViewPtr - Pointer to the decoded fields
+**
+**  Return:
+**    None
+*/
+void CFE_SB_GetMsgRouteView(const CFE_SB_Msg_t *MsgPtr, CFE_SB_MsgRouteView_t *ViewPtr)
+{
+
+#ifndef MESSAGE_FORMAT_IS_CCSDS_VER_2
+    /* The message ID is simply the stream ID, which is already at hand */
+    ViewPtr->MsgId = CFE_SB_ValueToMsgId(CCSDS_RD_SID(MsgPtr->Hdr));
+#else
+    ViewPtr->MsgId = CFE_SB_GetMsgId(MsgPtr);
+#endif
+
+    ViewPtr->TotalLength = CCSDS_RD_LEN(MsgPtr->Hdr);
+
+}/* end CFE_SB_GetMsgRouteView */
+
+
+/*
+ * Function: CFE_SB_GetMsgHdrView - See API and header file for details
+ */
+void CFE_SB_GetMsgHdrView(const CFE_SB_Msg_t *MsgPtr, CFE_SB_MsgHdrView_t *ViewPtr)
+{
+    uint32 Layout = CFE_SB_HDR_LAYOUT(MsgPtr->Hdr);
+    CFE_SB_MsgRouteView_t RouteView;
+
+    CFE_SB_GetMsgRouteView(MsgPtr, &RouteView);
+
+    ViewPtr->MsgId       = RouteView.MsgId;
+    ViewPtr->TotalLength = RouteView.TotalLength;
+    ViewPtr->HdrSize     = CFE_SB_HdrSizeByLayout[Layout];
+    ViewPtr->HasSecHdr   = ((Layout & 0x01) != 0);
+    ViewPtr->CmdCode     = 0;
+    ViewPtr->Time.Seconds    = 0;
+    ViewPtr->Time.Subseconds = 0;
+
+    if ((Layout & 0x02) != 0)
+    {
+        ViewPtr->PktType = CFE_SB_PKTTYPE_CMD;
+
+        if (ViewPtr->HasSecHdr)
+        {
+            ViewPtr->CmdCode = CCSDS_RD_FC(((const CFE_SB_CmdHdr_t *)MsgPtr)->Cmd.Sec);
+        }
+    }
+    else
+    {
+        ViewPtr->PktType = CFE_SB_PKTTYPE_TLM;
+
+        if (ViewPtr->HasSecHdr)
+        {
+            ViewPtr->Time = CFE_SB_DecodeMsgTime((const CFE_SB_TlmHdr_t *)MsgPtr);
+        }
+    }
+
+}/* end CFE_SB_GetMsgHdrView */
+
+
 /*
  * Function: CFE_SB_SetMsgTime - See API and header file for details
  */
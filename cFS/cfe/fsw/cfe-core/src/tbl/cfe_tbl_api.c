@@ -100,6 +100,11 @@ int32 CFE_TBL_Register( CFE_TBL_Handle_t *TblHandlePtr,
 
                 CFE_ES_WriteToSysLog("CFE_TBL:Register-Table %s has size of zero\n", Name);
             }
+            else if ((TblOptionFlags & CFE_TBL_OPT_MAPPED_MSK) == CFE_TBL_OPT_MAPPED)
+            {
+                /* Mapped tables are not allocated from the Table Services memory pool */
+                /* so the pool based size limits do not apply to them                  */
+            }
             else if ((Size > CFE_PLATFORM_TBL_MAX_SNGL_TABLE_SIZE) &&
                      ((TblOptionFlags & CFE_TBL_OPT_BUFFER_MSK) == CFE_TBL_OPT_SNGL_BUFFER))
             {
@@ -131,6 +136,18 @@ int32 CFE_TBL_Register( CFE_TBL_Handle_t *TblHandlePtr,
                                          Name);
                 }
             }
+            else if ((TblOptionFlags & CFE_TBL_OPT_MAPPED_MSK) == CFE_TBL_OPT_MAPPED)
+            {
+                /* Mapped tables are always loaded from a file, so cannot be dump only, nor critical */
+                if (((TblOptionFlags & CFE_TBL_OPT_LD_DMP_MSK) == CFE_TBL_OPT_DUMP_ONLY) ||
+                    ((TblOptionFlags & CFE_TBL_OPT_CRITICAL_MSK) == CFE_TBL_OPT_CRITICAL))
+                {
+                    Status = CFE_TBL_ERR_INVALID_OPTIONS;
+                    
+                    CFE_ES_WriteToSysLog("CFE_TBL:Register-Mapped tbl '%s' cannot be dump only or critical\n",
+                                         Name);
+                }
+            }
             else if ((TblOptionFlags & CFE_TBL_OPT_LD_DMP_MSK) == CFE_TBL_OPT_DUMP_ONLY)
             {
                 /* Dump Only tables cannot be double buffered, nor critical */
@@ -248,7 +265,15 @@ int32 CFE_TBL_Register( CFE_TBL_Handle_t *TblHandlePtr,
                 /* Initialize Registry Record to default settings */
                 CFE_TBL_InitRegistryRecord(RegRecPtr);
 
-                if ((TblOptionFlags & CFE_TBL_OPT_USR_DEF_MSK) != (CFE_TBL_OPT_USR_DEF_ADDR & CFE_TBL_OPT_USR_DEF_MSK))
+                if ((TblOptionFlags & CFE_TBL_OPT_MAPPED_MSK) == CFE_TBL_OPT_MAPPED)
+                {
+                    /* Mapped tables have no buffers until a table image is loaded */
+                    RegRecPtr->Buffers[0].BufferPtr = NULL;
+                    RegRecPtr->Buffers[1].BufferPtr = NULL;
+                    RegRecPtr->UserDefAddr = false;
+                    RegRecPtr->MappedImage = true;
+                }
+                else if ((TblOptionFlags & CFE_TBL_OPT_USR_DEF_MSK) != (CFE_TBL_OPT_USR_DEF_ADDR & CFE_TBL_OPT_USR_DEF_MSK))
                 {
                     RegRecPtr->UserDefAddr = false;
                 
@@ -275,8 +300,15 @@ int32 CFE_TBL_Register( CFE_TBL_Handle_t *TblHandlePtr,
                     RegRecPtr->UserDefAddr = true;
                 }
 
-                if (((TblOptionFlags & CFE_TBL_OPT_DBL_BUFFER) == CFE_TBL_OPT_DBL_BUFFER) &&
-                    ((Status & CFE_SEVERITY_BITMASK) != CFE_SEVERITY_ERROR))
+                if (RegRecPtr->MappedImage)
+                {
+                    /* Each load of a mapped table produces a new mapping, so the */
+                    /* previous one remains intact as the "active" buffer         */
+                    RegRecPtr->ActiveBufferIndex = 0;
+                    RegRecPtr->DoubleBuffered = true;
+                }
+                else if (((TblOptionFlags & CFE_TBL_OPT_DBL_BUFFER) == CFE_TBL_OPT_DBL_BUFFER) &&
+                         ((Status & CFE_SEVERITY_BITMASK) != CFE_SEVERITY_ERROR))
                 {
                     /* Allocate memory for the dedicated secondary buffer */
                     Status = CFE_ES_GetPoolBuf((uint32 **)&RegRecPtr->Buffers[1].BufferPtr,
@@ -313,6 +345,7 @@ int32 CFE_TBL_Register( CFE_TBL_Handle_t *TblHandlePtr,
 
                     /* Save Table Name in Registry */
                     strncpy(RegRecPtr->Name, TblName, CFE_TBL_MAX_FULL_NAME_LEN);
+                    CFE_NameIndex_Insert(&CFE_TBL_TaskData.RegistryIndex, RegRecPtr->Name, RegIndx);
 
                     /* Set the "Dump Only" flag to value based upon selected option */
                     if ((TblOptionFlags & CFE_TBL_OPT_LD_DMP_MSK) == CFE_TBL_OPT_DUMP_ONLY)
@@ -405,10 +438,7 @@ int32 CFE_TBL_Register( CFE_TBL_Handle_t *TblHandlePtr,
                                     RegRecPtr->TableLoadedOnce = CritRegRecPtr->TableLoadedOnce;
                                     
                                     /* Compute the CRC on the specified table buffer */
-                                    WorkingBufferPtr->Crc = CFE_ES_CalculateCRC(WorkingBufferPtr->BufferPtr,
-                                                                                RegRecPtr->Size,
-                                                                                0,
-                                                                                CFE_MISSION_ES_DEFAULT_CRC);
+                                    CFE_TBL_ComputeCrc(WorkingBufferPtr, RegRecPtr->Size);
                                 
                                     /* Make sure everyone who sees the table knows that it has been updated */
                                     CFE_TBL_NotifyTblUsersOfUpdate(RegRecPtr);
@@ -624,6 +654,10 @@ int32 CFE_TBL_Unregister ( CFE_TBL_Handle_t TblHandle )
         /* Verify that the application unregistering the table owns the table */
         if (RegRecPtr->OwnerAppId == ThisAppId)
         {
+            /* Wait for a background validation to finish and stop any more */
+            CFE_TBL_HoldValidation(RegRecPtr);
+            RegRecPtr->ValidationDutyCycle = 0;
+
             /* Mark table as free, although, technically, it isn't free until the */
             /* linked list of Access Descriptors has no links in it.              */
             /* NOTE: Allocated memory is freed when all Access Links have been    */
@@ -632,7 +666,10 @@ int32 CFE_TBL_Unregister ( CFE_TBL_Handle_t TblHandle )
             RegRecPtr->OwnerAppId = (uint32)CFE_TBL_NOT_OWNED;
 
             /* Remove Table Name */
+            CFE_NameIndex_Remove(&CFE_TBL_TaskData.RegistryIndex, RegRecPtr->Name, AccessDescPtr->RegIndex);
             RegRecPtr->Name[0] = '\0';
+
+            CFE_TBL_ReleaseValidation(RegRecPtr);
         }
 
         /* Remove the Access Descriptor Link from linked list */
@@ -736,6 +773,9 @@ int32 CFE_TBL_Load( CFE_TBL_Handle_t TblHandle,
         return CFE_SUCCESS;
     }
 
+    /* Keep the validation workers away from the buffers until the load is complete */
+    CFE_TBL_HoldValidation(RegRecPtr);
+
     /* Loads by an Application are not allowed if a table load is already in progress */
     if (RegRecPtr->LoadInProgress != CFE_TBL_NO_LOAD_IN_PROGRESS)
     {
@@ -743,6 +783,7 @@ int32 CFE_TBL_Load( CFE_TBL_Handle_t TblHandle,
             CFE_TBL_TaskData.TableTaskAppId,
             "%s: Load already in progress for '%s'", AppName, RegRecPtr->Name);
 
+        CFE_TBL_ReleaseValidation(RegRecPtr);
         return CFE_TBL_ERR_LOAD_IN_PROGRESS;
     }
 
@@ -755,6 +796,7 @@ int32 CFE_TBL_Load( CFE_TBL_Handle_t TblHandle,
             CFE_TBL_TaskData.TableTaskAppId,
             "%s: Failed to get Working Buffer (Stat=%u)", AppName, (unsigned int)Status);
 
+        CFE_TBL_ReleaseValidation(RegRecPtr);
         return Status;
     }
 
@@ -780,6 +822,17 @@ int32 CFE_TBL_Load( CFE_TBL_Handle_t TblHandle,
 
             break;
         case CFE_TBL_SRC_ADDRESS:
+            /* Mapped tables have no buffer of their own to copy a block of memory into */
+            if (RegRecPtr->MappedImage)
+            {
+                CFE_EVS_SendEventWithAppID(CFE_TBL_LOAD_TYPE_ERR_EID, CFE_EVS_EventType_ERROR,
+                    CFE_TBL_TaskData.TableTaskAppId,
+                    "%s: Attempted to load from illegal source type=%d", AppName, (int)SrcType);
+
+                Status = CFE_TBL_ERR_ILLEGAL_SRC_TYPE;
+                break;
+            }
+
             /* When the source is a block of memory, it is assumed to be a complete load */
             memcpy(WorkingBufferPtr->BufferPtr,
                       (uint8 *)SrcDataPtr,
@@ -790,10 +843,7 @@ int32 CFE_TBL_Load( CFE_TBL_Handle_t TblHandle,
             WorkingBufferPtr->FileCreateTimeSubSecs = 0;
             
             /* Compute the CRC on the specified table buffer */
-            WorkingBufferPtr->Crc = CFE_ES_CalculateCRC(WorkingBufferPtr->BufferPtr,
-                                                        RegRecPtr->Size,
-                                                        0,
-                                                        CFE_MISSION_ES_DEFAULT_CRC);
+            CFE_TBL_ComputeCrc(WorkingBufferPtr, RegRecPtr->Size);
 
             break;
         default:
@@ -827,13 +877,22 @@ int32 CFE_TBL_Load( CFE_TBL_Handle_t TblHandle,
                 AppName, (unsigned int)Status, RegRecPtr->Name);
 
             /* Zero out the buffer to remove any bad data */
-            memset(WorkingBufferPtr->BufferPtr, 0, RegRecPtr->Size);
+            if (!RegRecPtr->MappedImage)
+            {
+                memset(WorkingBufferPtr->BufferPtr, 0, RegRecPtr->Size);
+            }
         }
     }
 
     /* Perform the table update to complete the load */
     if (Status < CFE_SUCCESS)
     {
+        /* A rejected mapped image is released rather than zeroed */
+        if (RegRecPtr->MappedImage)
+        {
+            CFE_TBL_UnmapBuffer(WorkingBufferPtr, RegRecPtr->Size);
+        }
+
         /* The load has had a problem, free the working buffer for another attempt */
         if ((!RegRecPtr->DoubleBuffered) && (RegRecPtr->TableLoadedOnce == true))
         {
@@ -844,6 +903,7 @@ int32 CFE_TBL_Load( CFE_TBL_Handle_t TblHandle,
         /* For double buffered tables, freeing buffer is simple */
         RegRecPtr->LoadInProgress = CFE_TBL_NO_LOAD_IN_PROGRESS;
 
+        CFE_TBL_ReleaseValidation(RegRecPtr);
         return Status;
     }
 
@@ -884,6 +944,8 @@ int32 CFE_TBL_Load( CFE_TBL_Handle_t TblHandle,
         Status = CFE_SUCCESS;
     }
 
+    CFE_TBL_ReleaseValidation(RegRecPtr);
+
     if (Status == CFE_SUCCESS)
     {
         /* The first time a table is loaded, the event message is DEBUG */
@@ -921,7 +983,9 @@ int32 CFE_TBL_Update( CFE_TBL_Handle_t TblHandle )
         AccessDescPtr = &CFE_TBL_TaskData.Handles[TblHandle];
         RegRecPtr = &CFE_TBL_TaskData.Registry[AccessDescPtr->RegIndex];
 
+        CFE_TBL_HoldValidation(RegRecPtr);
         Status = CFE_TBL_UpdateInternal(TblHandle, RegRecPtr, AccessDescPtr);
+        CFE_TBL_ReleaseValidation(RegRecPtr);
 
         if (Status != CFE_SUCCESS)
         {
@@ -1138,120 +1202,14 @@ int32 CFE_TBL_Validate( CFE_TBL_Handle_t TblHandle )
 
         CFE_ES_GetAppName(AppName, ThisAppId, OS_MAX_API_NAME);
 
-        /* Identify the image to be validated, starting with the Inactive Buffer */
-        if (RegRecPtr->ValidateInactiveIndex != CFE_TBL_NO_VALIDATION_PENDING)
-        {
-            /* Identify whether the Inactive Buffer is a shared buffer or a dedicated one */
-            if (RegRecPtr->DoubleBuffered)
-            {
-                /* Call the Application's Validation function for the Inactive Buffer */
-                Status = (RegRecPtr->ValidationFuncPtr)(RegRecPtr->Buffers[(1U-RegRecPtr->ActiveBufferIndex)].BufferPtr);
-                
-                /* Allow buffer to be activated after passing validation */
-                if (Status == CFE_SUCCESS)
-                {
-                    RegRecPtr->Buffers[(1U-RegRecPtr->ActiveBufferIndex)].Validated = true;       
-                }
-            }
-            else
-            {
-                /* Call the Application's Validation function for the appropriate shared buffer */
-                Status = (RegRecPtr->ValidationFuncPtr)
-                          (CFE_TBL_TaskData.LoadBuffs[RegRecPtr->LoadInProgress].BufferPtr);
-                
-                /* Allow buffer to be activated after passing validation */
-                if (Status == CFE_SUCCESS)
-                {
-                    CFE_TBL_TaskData.LoadBuffs[RegRecPtr->LoadInProgress].Validated = true;       
-                }
-            }
-
-            if (Status == CFE_SUCCESS)
-            {
-                CFE_EVS_SendEventWithAppID(CFE_TBL_VALIDATION_INF_EID,
-                                           CFE_EVS_EventType_INFORMATION,
-                                           CFE_TBL_TaskData.TableTaskAppId,
-                                           "%s validation successful for Inactive '%s'",
-                                           AppName, RegRecPtr->Name);
-            }
-            else
-            {
-                CFE_EVS_SendEventWithAppID(CFE_TBL_VALIDATION_ERR_EID,
-                                           CFE_EVS_EventType_ERROR,
-                                           CFE_TBL_TaskData.TableTaskAppId,
-                                           "%s validation failed for Inactive '%s', Status=0x%08X",
-                                           AppName, RegRecPtr->Name, (unsigned int)Status);
-                
-                if (Status > CFE_SUCCESS)
-                {
-                    CFE_ES_WriteToSysLog("CFE_TBL:Validate-App(%u) Validation func return code invalid (Stat=0x%08X) for '%s'\n",
-                            (unsigned int)CFE_TBL_TaskData.TableTaskAppId, (unsigned int)Status, RegRecPtr->Name);
-                }
-            }
-
-            /* Save the result of the Validation function for the Table Services Task */
-            CFE_TBL_TaskData.ValidationResults[RegRecPtr->ValidateInactiveIndex].Result = Status;
-
-            /* Once validation is complete, set flags to indicate response is ready */
-            CFE_TBL_TaskData.ValidationResults[RegRecPtr->ValidateInactiveIndex].State = CFE_TBL_VALIDATION_PERFORMED;
-            RegRecPtr->ValidateInactiveIndex = CFE_TBL_NO_VALIDATION_PENDING;
-
-            /* Since the validation was successfully performed (although maybe not a successful result) */
-            /* return a success status */
-            Status = CFE_SUCCESS;
-        }
-        else if (RegRecPtr->ValidateActiveIndex != CFE_TBL_NO_VALIDATION_PENDING)
+        /* Tables using background validation are validated by the Table Services validation workers */
+        if (RegRecPtr->ValidationDutyCycle != 0)
         {
-            /* Perform validation on the currently active table buffer */
-            /* Identify whether the Active Buffer is a shared buffer or a dedicated one */
-            if (RegRecPtr->DoubleBuffered)
-            {
-                /* Call the Application's Validation function for the Dedicated Active Buffer */
-                Status = (RegRecPtr->ValidationFuncPtr)(RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].BufferPtr);
-            }
-            else
-            {
-                /* Call the Application's Validation function for the static buffer */
-                Status = (RegRecPtr->ValidationFuncPtr)(RegRecPtr->Buffers[0].BufferPtr);
-            }
-
-            if (Status == CFE_SUCCESS)
-            {
-                CFE_EVS_SendEventWithAppID(CFE_TBL_VALIDATION_INF_EID,
-                                           CFE_EVS_EventType_INFORMATION,
-                                           CFE_TBL_TaskData.TableTaskAppId,
-                                           "%s validation successful for Active '%s'",
-                                           AppName, RegRecPtr->Name);
-            }
-            else
-            {
-                CFE_EVS_SendEventWithAppID(CFE_TBL_VALIDATION_ERR_EID,
-                                           CFE_EVS_EventType_ERROR,
-                                           CFE_TBL_TaskData.TableTaskAppId,
-                                           "%s validation failed for Active '%s', Status=0x%08X",
-                                           AppName, RegRecPtr->Name, (unsigned int)Status);
-                
-                if (Status > CFE_SUCCESS)
-                {
-                    CFE_ES_WriteToSysLog("CFE_TBL:Validate-App(%u) Validation func return code invalid (Stat=0x%08X) for '%s'\n",
-                            (unsigned int)CFE_TBL_TaskData.TableTaskAppId, (unsigned int)Status, RegRecPtr->Name);
-                }
-            }
-
-            /* Save the result of the Validation function for the Table Services Task */
-            CFE_TBL_TaskData.ValidationResults[RegRecPtr->ValidateActiveIndex].Result = Status;
-
-            /* Once validation is complete, reset the flags */
-            CFE_TBL_TaskData.ValidationResults[RegRecPtr->ValidateActiveIndex].State = CFE_TBL_VALIDATION_PERFORMED;
-            RegRecPtr->ValidateActiveIndex = CFE_TBL_NO_VALIDATION_PENDING;
-
-            /* Since the validation was successfully performed (although maybe not a successful result) */
-            /* return a success status */
-            Status = CFE_SUCCESS;
+            Status = CFE_TBL_INFO_NO_VALIDATION_PENDING;
         }
         else
         {
-            Status = CFE_TBL_INFO_NO_VALIDATION_PENDING;
+            Status = CFE_TBL_PerformValidation(AppName, RegRecPtr);
         }
     }
     else
@@ -1344,8 +1302,9 @@ int32 CFE_TBL_GetStatus( CFE_TBL_Handle_t TblHandle )
         {
             Status = CFE_TBL_INFO_UPDATE_PENDING;
         }
-        else if ((RegRecPtr->ValidateActiveIndex != CFE_TBL_NO_VALIDATION_PENDING) ||
-                 (RegRecPtr->ValidateInactiveIndex != CFE_TBL_NO_VALIDATION_PENDING))
+        else if (((RegRecPtr->ValidateActiveIndex != CFE_TBL_NO_VALIDATION_PENDING) ||
+                  (RegRecPtr->ValidateInactiveIndex != CFE_TBL_NO_VALIDATION_PENDING)) &&
+                 (RegRecPtr->ValidationDutyCycle == 0)) /* Background validations are not the owner's to perform */
         {
             Status = CFE_TBL_INFO_VALIDATION_PENDING;
         }
@@ -1489,11 +1448,7 @@ int32 CFE_TBL_Modified( CFE_TBL_Handle_t TblHandle )
         RegRecPtr->LastFileLoaded[OS_MAX_PATH_LEN-1] = '\0';
         
         /* Update CRC on contents of table */
-        RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].Crc = 
-            CFE_ES_CalculateCRC(RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].BufferPtr,
-                                RegRecPtr->Size,
-                                0,
-                                CFE_MISSION_ES_DEFAULT_CRC);
+        CFE_TBL_ComputeCrc(&RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex], RegRecPtr->Size);
 
         FilenameLen = strlen(RegRecPtr->LastFileLoaded);
         if (FilenameLen < (OS_MAX_PATH_LEN-4))
@@ -1566,6 +1521,57 @@ int32 CFE_TBL_NotifyByMessage(CFE_TBL_Handle_t TblHandle, CFE_SB_MsgId_t MsgId,
     return Status;
 }  /* End of CFE_TBL_NotifyByMessage() */
 
+
+/*
+ * Function: CFE_TBL_ValidateInBackground - See API and header file for details
+ */
+int32 CFE_TBL_ValidateInBackground(CFE_TBL_Handle_t TblHandle, uint32 DutyCyclePct)
+{
+    int32                       Status;
+    CFE_TBL_AccessDescriptor_t *AccessDescPtr = NULL;
+    CFE_TBL_RegistryRec_t      *RegRecPtr = NULL;
+    uint32                      ThisAppId;
+
+    /* Verify that this application has the right to perform operation */
+    Status = CFE_TBL_ValidateAccess(TblHandle, &ThisAppId);
+
+    if (Status == CFE_SUCCESS)
+    {
+        /* Get pointers to pertinent records in registry and handles */
+        AccessDescPtr = &CFE_TBL_TaskData.Handles[TblHandle];
+        RegRecPtr = &CFE_TBL_TaskData.Registry[AccessDescPtr->RegIndex];
+
+        /* Verify that the calling application is the table owner */
+        if (RegRecPtr->OwnerAppId != ThisAppId)
+        {
+            Status = CFE_TBL_ERR_NO_ACCESS;
+            CFE_ES_WriteToSysLog("CFE_TBL:ValidateInBkgnd-App(%d) does not own Tbl Handle=%d\n",
+                                 (int)ThisAppId, (int)TblHandle);
+        }
+        else if (DutyCyclePct > 100)
+        {
+            Status = CFE_TBL_ERR_INVALID_OPTIONS;
+            CFE_ES_WriteToSysLog("CFE_TBL:ValidateInBkgnd-Invalid duty cycle (%u%%) for Tbl Handle=%d\n",
+                                 (unsigned int)DutyCyclePct, (int)TblHandle);
+        }
+        else if ((DutyCyclePct != 0) && (CFE_TBL_TaskData.NumValidationWorkers == 0))
+        {
+            Status = CFE_TBL_NOT_IMPLEMENTED;
+            CFE_ES_WriteToSysLog("CFE_TBL:ValidateInBkgnd-No validation workers available for Tbl Handle=%d\n",
+                                 (int)TblHandle);
+        }
+        else
+        {
+            /* Releasing the table hands any validation that is already pending over to the workers */
+            CFE_TBL_HoldValidation(RegRecPtr);
+            RegRecPtr->ValidationDutyCycle = DutyCyclePct;
+            CFE_TBL_ReleaseValidation(RegRecPtr);
+        }
+    }
+
+    return Status;
+}  /* End of CFE_TBL_ValidateInBackground() */
+
 /************************/
 /*  End of File Comment */
 /************************/
@@ -77,6 +77,10 @@ int32 CFE_TBL_EarlyInit (void)
         CFE_TBL_InitRegistryRecord(&CFE_TBL_TaskData.Registry[i]);
     }
 
+    /* Initialize the index used to look up Table Registry Records by name */
+    CFE_NameIndex_Init(&CFE_TBL_TaskData.RegistryIndex, CFE_TBL_TaskData.RegistryIndexSlots,
+                       CFE_NAME_INDEX_SLOTS(CFE_PLATFORM_TBL_MAX_NUM_TABLES));
+
     /* Initialize the Table Access Descriptors */
     for (i=0; i<CFE_PLATFORM_TBL_MAX_NUM_HANDLES; i++)
     {
@@ -110,10 +114,14 @@ int32 CFE_TBL_EarlyInit (void)
         
         /* Prevent Shared Buffers from being used until successfully allocated */
         CFE_TBL_TaskData.LoadBuffs[i].Taken = true;
+        CFE_TBL_TaskData.LoadBuffs[i].RegionCrcValid = false;
     }
 
     CFE_TBL_TaskData.ValidationCounter = 0;
 
+    /* Prepare for combining the CRCs of individual table regions */
+    CFE_TBL_InitCrcRegionShift();
+
     CFE_TBL_TaskData.HkTlmTblRegIndex = CFE_TBL_NOT_FOUND;
     CFE_TBL_TaskData.LastTblUpdated = CFE_TBL_NOT_FOUND;
     
@@ -273,12 +281,14 @@ void CFE_TBL_InitRegistryRecord (CFE_TBL_RegistryRec_t *RegRecPtr)
     RegRecPtr->Buffers[0].FileCreateTimeSecs = 0;
     RegRecPtr->Buffers[0].FileCreateTimeSubSecs = 0;
     RegRecPtr->Buffers[0].Crc = 0;
+    RegRecPtr->Buffers[0].RegionCrcValid = false;
     RegRecPtr->Buffers[0].Taken = false;
     RegRecPtr->Buffers[0].DataSource[0] = '\0';
     RegRecPtr->Buffers[1].BufferPtr = NULL;
     RegRecPtr->Buffers[1].FileCreateTimeSecs = 0;
     RegRecPtr->Buffers[1].FileCreateTimeSubSecs = 0;
     RegRecPtr->Buffers[1].Crc = 0;
+    RegRecPtr->Buffers[1].RegionCrcValid = false;
     RegRecPtr->Buffers[1].Taken = false;
     RegRecPtr->Buffers[1].DataSource[0] = '\0';
     RegRecPtr->ValidationFuncPtr = NULL;
@@ -295,8 +305,11 @@ void CFE_TBL_InitRegistryRecord (CFE_TBL_RegistryRec_t *RegRecPtr)
     RegRecPtr->DumpOnly = false;
     RegRecPtr->DumpControlIndex = CFE_TBL_NO_DUMP_PENDING;
     RegRecPtr->UserDefAddr = false;
+    RegRecPtr->MappedImage = false;
     RegRecPtr->DoubleBuffered = false;
     RegRecPtr->NotifyByMsg = false;
+    RegRecPtr->ValidationDutyCycle = 0;
+    RegRecPtr->ValidationBusy = false;
     RegRecPtr->ActiveBufferIndex = 0;
     RegRecPtr->Name[0] = '\0';
     RegRecPtr->LastFileLoaded[0] = '\0';
@@ -456,7 +469,14 @@ int32 CFE_TBL_RemoveAccessLink(CFE_TBL_Handle_t TblHandle)
     if (RegRecPtr->HeadOfAccessList == CFE_TBL_END_OF_LIST)
     {
         /* Only free memory that we have allocated.  If the image is User Defined, then don't bother */
-        if (RegRecPtr->UserDefAddr == false)
+        if (RegRecPtr->MappedImage)
+        {
+            /* Release any table images that are still mapped */
+            Status = CFE_TBL_UnmapBuffer(&RegRecPtr->Buffers[0], RegRecPtr->Size);
+            CFE_TBL_UnmapBuffer(&RegRecPtr->Buffers[1], RegRecPtr->Size);
+            RegRecPtr->LoadInProgress = CFE_TBL_NO_LOAD_IN_PROGRESS;
+        }
+        else if (RegRecPtr->UserDefAddr == false)
         {
             /* Free memory allocated to buffers */
             Status = CFE_ES_PutPoolBuf(CFE_TBL_TaskData.Buf.PoolHdl, RegRecPtr->Buffers[0].BufferPtr);
@@ -610,27 +630,19 @@ int32 CFE_TBL_GetNextNotification(CFE_TBL_Handle_t TblHandle)
 
 int16 CFE_TBL_FindTableInRegistry(const char *TblName)
 {
-    int16 RegIndx = CFE_TBL_NOT_FOUND;
-    int16 i = -1;
+    int32 RegIndx;
 
-    do
-    {
-        /* Point to next record in the Table Registry */
-        i++;
+    /* The index performs the case sensitive name comparison */
+    RegIndx = CFE_NameIndex_Find(&CFE_TBL_TaskData.RegistryIndex, TblName);
 
-        /* Check to see if the record is currently being used */
-        if (CFE_TBL_TaskData.Registry[i].OwnerAppId != CFE_TBL_NOT_OWNED)
-        {
-            /* Perform a case sensitive name comparison */
-            if (strcmp(TblName, CFE_TBL_TaskData.Registry[i].Name) == 0)
-            {
-                /* If the names match, then return the index */
-                RegIndx = i;
-            }
-        }
-    } while ( (RegIndx == CFE_TBL_NOT_FOUND) && (i < (CFE_PLATFORM_TBL_MAX_NUM_TABLES-1)) );
+    /* Check to see if the record is currently being used */
+    if ((RegIndx == CFE_NAME_INDEX_NOT_FOUND) ||
+        (CFE_TBL_TaskData.Registry[RegIndx].OwnerAppId == CFE_TBL_NOT_OWNED))
+    {
+        return CFE_TBL_NOT_FOUND;
+    }
 
-    return RegIndx;
+    return (int16)RegIndx;
 }   /* End of CFE_TBL_FindTableInRegistry() */
 
 
@@ -886,13 +898,25 @@ int32 CFE_TBL_GetWorkingBuffer(CFE_TBL_LoadBuff_t **WorkingBufferPtr,
                 OS_MutSemGive(CFE_TBL_TaskData.WorkBufMutex);
             }
 
-            if ((*WorkingBufferPtr) != NULL &&
+            /* Mapped tables are always replaced by a complete image, so there is nothing to preserve */
+            if ((*WorkingBufferPtr) != NULL && (!RegRecPtr->MappedImage) &&
                     (*WorkingBufferPtr)->BufferPtr != RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].BufferPtr)
             {
                 /* In case the file contains a partial table load, get the active buffer contents first */
                 memcpy((*WorkingBufferPtr)->BufferPtr,
                           RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].BufferPtr,
                           RegRecPtr->Size);
+
+                /*
+                ** The region CRCs of the active buffer go with the copy, so that a partial load
+                ** only recomputes the regions it touches.  They are kept current by every load,
+                ** activation and CFE_TBL_Modified(), which an owner must call after writing to
+                ** its table.
+                */
+                memcpy((*WorkingBufferPtr)->RegionCrc,
+                          RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].RegionCrc,
+                          sizeof((*WorkingBufferPtr)->RegionCrc));
+                (*WorkingBufferPtr)->RegionCrcValid = RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].RegionCrcValid;
             }
         }
     }
@@ -968,7 +992,9 @@ int32 CFE_TBL_LoadFromFile(const char *AppName, CFE_TBL_LoadBuff_t *WorkingBuffe
         return CFE_TBL_ERR_FILE_FOR_WRONG_TABLE;
     }
 
-    if ((TblFileHeader.Offset + TblFileHeader.NumBytes) > RegRecPtr->Size)
+    /* The segments of a delta image are checked against the table size individually */
+    if ((TblFileHeader.NumSegments == 0) &&
+        ((TblFileHeader.Offset + TblFileHeader.NumBytes) > RegRecPtr->Size))
     {
         CFE_EVS_SendEventWithAppID(CFE_TBL_LOAD_EXCEEDS_SIZE_ERR_EID,
             CFE_EVS_EventType_ERROR, CFE_TBL_TaskData.TableTaskAppId,
@@ -981,47 +1007,76 @@ int32 CFE_TBL_LoadFromFile(const char *AppName, CFE_TBL_LoadBuff_t *WorkingBuffe
         return CFE_TBL_ERR_FILE_TOO_LARGE;
     }
 
-    /* Any Table load that starts beyond the first byte is a "partial load" */
-    /* But a file that starts with the first byte and ends before filling   */
-    /* the whole table is just considered "short".                          */
-    if (TblFileHeader.Offset > 0)
+    if (RegRecPtr->MappedImage)
     {
-        Status = CFE_TBL_WARN_PARTIAL_LOAD;
+        /* Map the table image in place of reading it into the working buffer */
+        Status = CFE_TBL_MapWorkingBuffer(AppName, FileDescriptor, WorkingBufferPtr, RegRecPtr, &TblFileHeader);
+
+        if (Status != CFE_SUCCESS)
+        {
+            /* CFE_TBL_MapWorkingBuffer() generates its own events */
+
+            OS_close(FileDescriptor);
+            return Status;
+        }
     }
-    else if (TblFileHeader.NumBytes < RegRecPtr->Size)
+    else if (TblFileHeader.NumSegments != 0)
     {
-        Status = CFE_TBL_WARN_SHORT_FILE;
-    }
+        /* Apply each segment of the delta image to the working buffer */
+        Status = CFE_TBL_LoadDeltaSegments(AppName, FileDescriptor, WorkingBufferPtr, RegRecPtr, &TblFileHeader);
 
-    NumBytes = OS_read(FileDescriptor,
-                       ((uint8*)WorkingBufferPtr->BufferPtr) + TblFileHeader.Offset,
-                       TblFileHeader.NumBytes);
+        if (Status < CFE_SUCCESS)
+        {
+            /* CFE_TBL_LoadDeltaSegments() generates its own events */
 
-    if (NumBytes != TblFileHeader.NumBytes)
+            OS_close(FileDescriptor);
+            return Status;
+        }
+    }
+    else
     {
-       CFE_EVS_SendEventWithAppID(CFE_TBL_FILE_INCOMPLETE_ERR_EID, CFE_EVS_EventType_ERROR,
-            CFE_TBL_TaskData.TableTaskAppId,
-            "%s: File load incomplete (exp=%lu, read=%lu)",
-            AppName, (long unsigned int)TblFileHeader.NumBytes,
-            (long unsigned int)NumBytes);
+        /* Any Table load that starts beyond the first byte is a "partial load" */
+        /* But a file that starts with the first byte and ends before filling   */
+        /* the whole table is just considered "short".                          */
+        if (TblFileHeader.Offset > 0)
+        {
+            Status = CFE_TBL_WARN_PARTIAL_LOAD;
+        }
+        else if (TblFileHeader.NumBytes < RegRecPtr->Size)
+        {
+            Status = CFE_TBL_WARN_SHORT_FILE;
+        }
 
-        OS_close(FileDescriptor);
-        return CFE_TBL_ERR_LOAD_INCOMPLETE;
-    }
+        NumBytes = OS_read(FileDescriptor,
+                           ((uint8*)WorkingBufferPtr->BufferPtr) + TblFileHeader.Offset,
+                           TblFileHeader.NumBytes);
+
+        if (NumBytes != TblFileHeader.NumBytes)
+        {
+           CFE_EVS_SendEventWithAppID(CFE_TBL_FILE_INCOMPLETE_ERR_EID, CFE_EVS_EventType_ERROR,
+                CFE_TBL_TaskData.TableTaskAppId,
+                "%s: File load incomplete (exp=%lu, read=%lu)",
+                AppName, (long unsigned int)TblFileHeader.NumBytes,
+                (long unsigned int)NumBytes);
+
+            OS_close(FileDescriptor);
+            return CFE_TBL_ERR_LOAD_INCOMPLETE;
+        }
     
-    /* Check to see if the file is too large (ie - more data than header claims) */
-    NumBytes = OS_read(FileDescriptor, &ExtraByte, 1);
+        /* Check to see if the file is too large (ie - more data than header claims) */
+        NumBytes = OS_read(FileDescriptor, &ExtraByte, 1);
     
-    /* If successfully read another byte, then file must have too much data */
-    if (NumBytes == 1)
-    {
-        CFE_EVS_SendEventWithAppID(CFE_TBL_FILE_TOO_BIG_ERR_EID, CFE_EVS_EventType_ERROR,
-            CFE_TBL_TaskData.TableTaskAppId,
-            "%s: File load too long (file length > %lu)",
-            AppName, (long unsigned int)TblFileHeader.NumBytes);
+        /* If successfully read another byte, then file must have too much data */
+        if (NumBytes == 1)
+        {
+            CFE_EVS_SendEventWithAppID(CFE_TBL_FILE_TOO_BIG_ERR_EID, CFE_EVS_EventType_ERROR,
+                CFE_TBL_TaskData.TableTaskAppId,
+                "%s: File load too long (file length > %lu)",
+                AppName, (long unsigned int)TblFileHeader.NumBytes);
 
-        OS_close(FileDescriptor);
-        return CFE_TBL_ERR_FILE_TOO_LARGE;
+            OS_close(FileDescriptor);
+            return CFE_TBL_ERR_FILE_TOO_LARGE;
+        }
     }
 
     memset(WorkingBufferPtr->DataSource, 0, OS_MAX_PATH_LEN);
@@ -1031,11 +1086,11 @@ int32 CFE_TBL_LoadFromFile(const char *AppName, CFE_TBL_LoadBuff_t *WorkingBuffe
     WorkingBufferPtr->FileCreateTimeSecs = StdFileHeader.TimeSeconds;
     WorkingBufferPtr->FileCreateTimeSubSecs = StdFileHeader.TimeSubSeconds;
     
-    /* Compute the CRC on the specified table buffer */
-    WorkingBufferPtr->Crc = CFE_ES_CalculateCRC(WorkingBufferPtr->BufferPtr,
-                                                RegRecPtr->Size,
-                                                0,
-                                                CFE_MISSION_ES_DEFAULT_CRC);
+    /* Compute the CRC on the specified table buffer, a delta image has already updated it */
+    if (TblFileHeader.NumSegments == 0)
+    {
+        CFE_TBL_ComputeCrc(WorkingBufferPtr, RegRecPtr->Size);
+    }
 
     OS_close(FileDescriptor);
 
@@ -1043,6 +1098,419 @@ int32 CFE_TBL_LoadFromFile(const char *AppName, CFE_TBL_LoadBuff_t *WorkingBuffe
 } /* End of CFE_TBL_LoadFromFile() */
 
 
+/*******************************************************************
+**
+** CFE_TBL_MapWorkingBuffer
+**
+** NOTE: For complete prolog information, see 'cfe_tbl_internal.h'
+********************************************************************/
+
+int32 CFE_TBL_MapWorkingBuffer(const char *AppName, int32 FileDescriptor,
+                               CFE_TBL_LoadBuff_t *WorkingBufferPtr,
+                               CFE_TBL_RegistryRec_t *RegRecPtr,
+                               const CFE_TBL_File_Hdr_t *TblFileHeaderPtr)
+{
+    int32  Status;
+    int32  DataOffset;
+    int32  FileSize;
+    uint32 ImageSize = 0;
+    void  *MappedPtr = NULL;
+
+    /* A mapped image replaces the whole table, so neither partial, short nor delta loads are possible */
+    if ((TblFileHeaderPtr->NumSegments != 0) || (TblFileHeaderPtr->Offset != 0) ||
+        (TblFileHeaderPtr->NumBytes != RegRecPtr->Size))
+    {
+        CFE_EVS_SendEventWithAppID(CFE_TBL_MAPPED_PARTIAL_ERR_EID, CFE_EVS_EventType_ERROR,
+            CFE_TBL_TaskData.TableTaskAppId,
+            "%s: Mapped tbl '%s' requires a complete image (offset=%lu, len=%lu, exp=%lu)",
+            AppName, RegRecPtr->Name, (long unsigned int)TblFileHeaderPtr->Offset,
+            (long unsigned int)TblFileHeaderPtr->NumBytes, (long unsigned int)RegRecPtr->Size);
+
+        return CFE_TBL_ERR_PARTIAL_LOAD;
+    }
+
+    /* The table image starts immediately after the headers and must extend to the end of the file */
+    DataOffset = OS_lseek(FileDescriptor, 0, OS_SEEK_CUR);
+    FileSize = OS_lseek(FileDescriptor, 0, OS_SEEK_END);
+
+    if ((DataOffset >= 0) && (FileSize > DataOffset))
+    {
+        ImageSize = FileSize - DataOffset;
+    }
+
+    if (ImageSize < TblFileHeaderPtr->NumBytes)
+    {
+        CFE_EVS_SendEventWithAppID(CFE_TBL_FILE_INCOMPLETE_ERR_EID, CFE_EVS_EventType_ERROR,
+            CFE_TBL_TaskData.TableTaskAppId,
+            "%s: File load incomplete (exp=%lu, read=%lu)",
+            AppName, (long unsigned int)TblFileHeaderPtr->NumBytes,
+            (long unsigned int)ImageSize);
+
+        return CFE_TBL_ERR_LOAD_INCOMPLETE;
+    }
+    else if (ImageSize > TblFileHeaderPtr->NumBytes)
+    {
+        CFE_EVS_SendEventWithAppID(CFE_TBL_FILE_TOO_BIG_ERR_EID, CFE_EVS_EventType_ERROR,
+            CFE_TBL_TaskData.TableTaskAppId,
+            "%s: File load too long (file length > %lu)",
+            AppName, (long unsigned int)TblFileHeaderPtr->NumBytes);
+
+        return CFE_TBL_ERR_FILE_TOO_LARGE;
+    }
+
+    /* Release any image left in this buffer by an earlier load */
+    CFE_TBL_UnmapBuffer(WorkingBufferPtr, RegRecPtr->Size);
+
+    Status = OS_FileMap(FileDescriptor, DataOffset, TblFileHeaderPtr->NumBytes, &MappedPtr);
+
+    if (Status != OS_SUCCESS)
+    {
+        CFE_EVS_SendEventWithAppID(CFE_TBL_FILE_MAP_ERR_EID, CFE_EVS_EventType_ERROR,
+            CFE_TBL_TaskData.TableTaskAppId,
+            "%s: Unable to map image for '%s' (Stat=%ld)",
+            AppName, RegRecPtr->Name, (long)Status);
+
+        return CFE_TBL_ERR_ACCESS;
+    }
+
+    WorkingBufferPtr->BufferPtr = MappedPtr;
+
+    return CFE_SUCCESS;
+} /* End of CFE_TBL_MapWorkingBuffer() */
+
+
+/*******************************************************************
+**
+** CFE_TBL_UnmapBuffer
+**
+** NOTE: For complete prolog information, see 'cfe_tbl_internal.h'
+********************************************************************/
+
+int32 CFE_TBL_UnmapBuffer(CFE_TBL_LoadBuff_t *LoadBuffPtr, uint32 Size)
+{
+    int32 Status = CFE_SUCCESS;
+
+    if (LoadBuffPtr->BufferPtr != NULL)
+    {
+        Status = OS_FileUnmap(LoadBuffPtr->BufferPtr, Size);
+
+        if (Status != OS_SUCCESS)
+        {
+            CFE_ES_WriteToSysLog("CFE_TBL:UnmapBuffer-OS_FileUnmap Fail Stat=0x%08X, Buf=0x%08lX\n",
+                    (unsigned int)Status, (unsigned long)LoadBuffPtr->BufferPtr);
+        }
+
+        /* An empty buffer must never be activated */
+        LoadBuffPtr->BufferPtr = NULL;
+        LoadBuffPtr->Validated = false;
+    }
+
+    return Status;
+} /* End of CFE_TBL_UnmapBuffer() */
+
+
+/*******************************************************************
+**
+** CFE_TBL_LoadDeltaSegments
+**
+** NOTE: For complete prolog information, see 'cfe_tbl_internal.h'
+********************************************************************/
+
+int32 CFE_TBL_LoadDeltaSegments(const char *AppName, int32 FileDescriptor,
+                                CFE_TBL_LoadBuff_t *WorkingBufferPtr,
+                                CFE_TBL_RegistryRec_t *RegRecPtr,
+                                const CFE_TBL_File_Hdr_t *TblFileHeaderPtr)
+{
+    CFE_TBL_File_SegHdr_t SegHdr;
+    uint32                RegionMask[CFE_TBL_CRC_REGION_MASK_WORDS];
+    uint32                BytesRemaining = TblFileHeaderPtr->NumBytes;
+    uint32                SegIndex;
+    int32                 NumBytes;
+    int32                 EndianCheck = 0x01020304;
+    uint8                 ExtraByte;
+
+    memset(RegionMask, 0, sizeof(RegionMask));
+
+    for (SegIndex = 0; SegIndex < TblFileHeaderPtr->NumSegments; SegIndex++)
+    {
+        NumBytes = OS_read(FileDescriptor, &SegHdr, sizeof(SegHdr));
+
+        if (NumBytes != sizeof(SegHdr))
+        {
+            CFE_EVS_SendEventWithAppID(CFE_TBL_FILE_INCOMPLETE_ERR_EID, CFE_EVS_EventType_ERROR,
+                CFE_TBL_TaskData.TableTaskAppId,
+                "%s: File load incomplete (exp=%lu, read=%lu)",
+                AppName, (long unsigned int)sizeof(SegHdr), (long unsigned int)NumBytes);
+
+            return CFE_TBL_ERR_LOAD_INCOMPLETE;
+        }
+
+        /* Segment headers are big endian, just like the table header */
+        if ((*(char *)&EndianCheck) == 0x04)
+        {
+            CFE_TBL_ByteSwapUint32(&SegHdr.Offset);
+            CFE_TBL_ByteSwapUint32(&SegHdr.NumBytes);
+        }
+
+        /* Each segment must fit within both the table and the amount of data the file header claims */
+        if ((SegHdr.NumBytes == 0) ||
+            (BytesRemaining < sizeof(SegHdr)) ||
+            (SegHdr.NumBytes > (BytesRemaining - sizeof(SegHdr))) ||
+            (SegHdr.Offset >= RegRecPtr->Size) ||
+            (SegHdr.NumBytes > (RegRecPtr->Size - SegHdr.Offset)))
+        {
+            CFE_EVS_SendEventWithAppID(CFE_TBL_DELTA_SEGMENT_ERR_EID, CFE_EVS_EventType_ERROR,
+                CFE_TBL_TaskData.TableTaskAppId,
+                "%s: Bad delta segment %lu for '%s' (offset=%lu, len=%lu)",
+                AppName, (long unsigned int)SegIndex, RegRecPtr->Name,
+                (long unsigned int)SegHdr.Offset, (long unsigned int)SegHdr.NumBytes);
+
+            return CFE_TBL_ERR_FILE_TOO_LARGE;
+        }
+
+        NumBytes = OS_read(FileDescriptor,
+                           ((uint8*)WorkingBufferPtr->BufferPtr) + SegHdr.Offset,
+                           SegHdr.NumBytes);
+
+        if (NumBytes != (int32)SegHdr.NumBytes)
+        {
+            CFE_EVS_SendEventWithAppID(CFE_TBL_FILE_INCOMPLETE_ERR_EID, CFE_EVS_EventType_ERROR,
+                CFE_TBL_TaskData.TableTaskAppId,
+                "%s: File load incomplete (exp=%lu, read=%lu)",
+                AppName, (long unsigned int)SegHdr.NumBytes, (long unsigned int)NumBytes);
+
+            return CFE_TBL_ERR_LOAD_INCOMPLETE;
+        }
+
+        BytesRemaining -= sizeof(SegHdr) + SegHdr.NumBytes;
+        CFE_TBL_MarkCrcRegions(RegionMask, RegRecPtr->Size, SegHdr.Offset, SegHdr.NumBytes);
+    }
+
+    /* The segments must account for all of the data, and the file must not contain more */
+    if ((BytesRemaining != 0) || (OS_read(FileDescriptor, &ExtraByte, 1) == 1))
+    {
+        CFE_EVS_SendEventWithAppID(CFE_TBL_FILE_TOO_BIG_ERR_EID, CFE_EVS_EventType_ERROR,
+            CFE_TBL_TaskData.TableTaskAppId,
+            "%s: File load too long (file length > %lu)",
+            AppName, (long unsigned int)(TblFileHeaderPtr->NumBytes - BytesRemaining));
+
+        return CFE_TBL_ERR_FILE_TOO_LARGE;
+    }
+
+    /* Regions the buffer has no CRC for, e.g. after being seeded from the active image, are computed as well */
+    CFE_TBL_UpdateCrc(WorkingBufferPtr, RegRecPtr->Size, RegionMask);
+
+    /* A delta load is, by definition, a partial load of the table */
+    return CFE_TBL_WARN_PARTIAL_LOAD;
+} /* End of CFE_TBL_LoadDeltaSegments() */
+
+
+/*******************************************************************
+**
+** CFE_TBL_FindDeltaSegment
+**
+** NOTE: For complete prolog information, see 'cfe_tbl_internal.h'
+********************************************************************/
+
+bool CFE_TBL_FindDeltaSegment(const void *DataAddr, const void *BaseAddr, uint32 Size,
+                              uint32 *OffsetPtr, uint32 *NumBytesPtr)
+{
+    uint32 Offset = *OffsetPtr;
+    uint32 Length;
+    bool   Found = false;
+
+    *NumBytesPtr = 0;
+
+    while (Offset < Size)
+    {
+        Length = Size - Offset;
+        if (Length > CFE_PLATFORM_TBL_CRC_REGION_SIZE)
+        {
+            Length = CFE_PLATFORM_TBL_CRC_REGION_SIZE;
+        }
+
+        if (memcmp(((const uint8 *)DataAddr) + Offset, ((const uint8 *)BaseAddr) + Offset, Length) != 0)
+        {
+            /* Start a new segment, or extend the current one */
+            if (!Found)
+            {
+                *OffsetPtr = Offset;
+                Found = true;
+            }
+
+            *NumBytesPtr += Length;
+        }
+        else if (Found)
+        {
+            /* The segment ends at the first region that matches */
+            break;
+        }
+
+        Offset += Length;
+    }
+
+    return Found;
+} /* End of CFE_TBL_FindDeltaSegment() */
+
+
+/*******************************************************************
+**
+** CFE_TBL_InitCrcRegionShift
+**
+** NOTE: For complete prolog information, see 'cfe_tbl_internal.h'
+********************************************************************/
+
+void CFE_TBL_InitCrcRegionShift(void)
+{
+    uint16 ByteShift[16];
+    uint16 Product[16];
+    uint32 Remaining = CFE_PLATFORM_TBL_CRC_REGION_SIZE;
+    uint32 Bit;
+    uint8  ZeroByte = 0;
+
+    /* Feeding a zero byte through the CRC is a linear function of the running CRC, */
+    /* so its effect is fully described by what it does to each individual bit     */
+    for (Bit = 0; Bit < 16; Bit++)
+    {
+        ByteShift[Bit] = (uint16)CFE_ES_CalculateCRC(&ZeroByte, 1, (1U << Bit), CFE_MISSION_ES_DEFAULT_CRC);
+        CFE_TBL_TaskData.CrcRegionShift[Bit] = (uint16)(1U << Bit);
+    }
+
+    /* Raise the single byte function to the size of a region by repeated squaring */
+    while (Remaining > 0)
+    {
+        if ((Remaining & 1) != 0)
+        {
+            for (Bit = 0; Bit < 16; Bit++)
+            {
+                Product[Bit] = CFE_TBL_ShiftCrc(ByteShift, CFE_TBL_TaskData.CrcRegionShift[Bit]);
+            }
+            memcpy(CFE_TBL_TaskData.CrcRegionShift, Product, sizeof(Product));
+        }
+
+        for (Bit = 0; Bit < 16; Bit++)
+        {
+            Product[Bit] = CFE_TBL_ShiftCrc(ByteShift, ByteShift[Bit]);
+        }
+        memcpy(ByteShift, Product, sizeof(Product));
+
+        Remaining >>= 1;
+    }
+} /* End of CFE_TBL_InitCrcRegionShift() */
+
+
+/*******************************************************************
+**
+** CFE_TBL_ShiftCrc
+**
+** NOTE: For complete prolog information, see 'cfe_tbl_internal.h'
+********************************************************************/
+
+uint16 CFE_TBL_ShiftCrc(const uint16 *ShiftPtr, uint16 Crc)
+{
+    uint16 Result = 0;
+    uint32 Bit;
+
+    for (Bit = 0; Bit < 16; Bit++)
+    {
+        if ((Crc & (1U << Bit)) != 0)
+        {
+            Result ^= ShiftPtr[Bit];
+        }
+    }
+
+    return Result;
+} /* End of CFE_TBL_ShiftCrc() */
+
+
+/*******************************************************************
+**
+** CFE_TBL_MarkCrcRegions
+**
+** NOTE: For complete prolog information, see 'cfe_tbl_internal.h'
+********************************************************************/
+
+void CFE_TBL_MarkCrcRegions(uint32 *RegionMask, uint32 Size, uint32 Offset, uint32 NumBytes)
+{
+    uint32 Pad = (CFE_TBL_NUM_CRC_REGIONS(Size) * CFE_PLATFORM_TBL_CRC_REGION_SIZE) - Size;
+    uint32 Region = (Offset + Pad) / CFE_PLATFORM_TBL_CRC_REGION_SIZE;
+    uint32 LastRegion = (Offset + NumBytes - 1 + Pad) / CFE_PLATFORM_TBL_CRC_REGION_SIZE;
+
+    /* Tables too large for region CRCs are always recomputed in full */
+    while ((Region <= LastRegion) && (Region < CFE_TBL_MAX_CRC_REGIONS))
+    {
+        RegionMask[Region / 32] |= (1U << (Region % 32));
+        Region++;
+    }
+} /* End of CFE_TBL_MarkCrcRegions() */
+
+
+/*******************************************************************
+**
+** CFE_TBL_ComputeCrc
+**
+** NOTE: For complete prolog information, see 'cfe_tbl_internal.h'
+********************************************************************/
+
+void CFE_TBL_ComputeCrc(CFE_TBL_LoadBuff_t *BuffPtr, uint32 Size)
+{
+    uint32 RegionMask[CFE_TBL_CRC_REGION_MASK_WORDS];
+
+    /* Recomputing every region is the same as a delta that touched the whole table */
+    memset(RegionMask, 0xFF, sizeof(RegionMask));
+
+    CFE_TBL_UpdateCrc(BuffPtr, Size, RegionMask);
+} /* End of CFE_TBL_ComputeCrc() */
+
+
+/*******************************************************************
+**
+** CFE_TBL_UpdateCrc
+**
+** NOTE: For complete prolog information, see 'cfe_tbl_internal.h'
+********************************************************************/
+
+void CFE_TBL_UpdateCrc(CFE_TBL_LoadBuff_t *BuffPtr, uint32 Size, const uint32 *RegionMask)
+{
+    uint32 NumRegions = CFE_TBL_NUM_CRC_REGIONS(Size);
+    uint32 Pad = (NumRegions * CFE_PLATFORM_TBL_CRC_REGION_SIZE) - Size;
+    uint32 Region;
+    uint32 Start;
+    uint16 Crc = 0;
+
+    if (NumRegions > CFE_TBL_MAX_CRC_REGIONS)
+    {
+        /* Too many regions to track, so simply compute the CRC of the whole table */
+        BuffPtr->RegionCrcValid = false;
+        BuffPtr->Crc = CFE_ES_CalculateCRC(BuffPtr->BufferPtr, Size, 0, CFE_MISSION_ES_DEFAULT_CRC);
+        return;
+    }
+
+    /* The first region holds whatever is left over, so that every region */
+    /* after it is full sized and can be combined with the same shift     */
+    for (Region = 0; Region < NumRegions; Region++)
+    {
+        if ((!BuffPtr->RegionCrcValid) || ((RegionMask[Region / 32] & (1U << (Region % 32))) != 0))
+        {
+            Start = (Region == 0) ? 0 : ((Region * CFE_PLATFORM_TBL_CRC_REGION_SIZE) - Pad);
+
+            BuffPtr->RegionCrc[Region] = (uint16)CFE_ES_CalculateCRC(((const uint8 *)BuffPtr->BufferPtr) + Start,
+                                                                     ((Region + 1) * CFE_PLATFORM_TBL_CRC_REGION_SIZE) - Pad - Start,
+                                                                     0,
+                                                                     CFE_MISSION_ES_DEFAULT_CRC);
+        }
+
+        Crc = CFE_TBL_ShiftCrc(CFE_TBL_TaskData.CrcRegionShift, Crc) ^ BuffPtr->RegionCrc[Region];
+    }
+
+    BuffPtr->RegionCrcValid = true;
+
+    /* Pass the combined value through once more so it is reported exactly as a */
+    /* CRC of the whole table computed in a single call would have been         */
+    BuffPtr->Crc = CFE_ES_CalculateCRC(BuffPtr->BufferPtr, 0, Crc, CFE_MISSION_ES_DEFAULT_CRC);
+} /* End of CFE_TBL_UpdateCrc() */
+
+
 /*******************************************************************
 **
 ** CFE_TBL_UpdateInternal
@@ -1132,6 +1600,10 @@ int32 CFE_TBL_UpdateInternal( CFE_TBL_Handle_t TblHandle,
                 
                 /* Save the previously computed CRC into the new buffer */
                 RegRecPtr->Buffers[0].Crc = CFE_TBL_TaskData.LoadBuffs[RegRecPtr->LoadInProgress].Crc;
+                RegRecPtr->Buffers[0].RegionCrcValid = CFE_TBL_TaskData.LoadBuffs[RegRecPtr->LoadInProgress].RegionCrcValid;
+                memcpy(RegRecPtr->Buffers[0].RegionCrc,
+                       CFE_TBL_TaskData.LoadBuffs[RegRecPtr->LoadInProgress].RegionCrc,
+                       sizeof(RegRecPtr->Buffers[0].RegionCrc));
 
                 /* Free the working buffer */
                 CFE_TBL_TaskData.LoadBuffs[RegRecPtr->LoadInProgress].Taken = false;
@@ -1345,7 +1817,7 @@ int32 CFE_TBL_ReadHeaders( int32 FileDescriptor,
 
 void CFE_TBL_ByteSwapTblHeader(CFE_TBL_File_Hdr_t *HdrPtr)
 {
-    CFE_TBL_ByteSwapUint32(&HdrPtr->Reserved);
+    CFE_TBL_ByteSwapUint32(&HdrPtr->NumSegments);
     CFE_TBL_ByteSwapUint32(&HdrPtr->Offset);
     CFE_TBL_ByteSwapUint32(&HdrPtr->NumBytes);
 } /* End of CFE_TBL_ByteSwapTblHeader() */
@@ -1412,6 +1884,10 @@ int32 CFE_TBL_CleanUpApp(uint32 AppId)
             /* Determine if the Application owned this particular table */
             if (RegRecPtr->OwnerAppId == AppId)
             {
+                /* Wait for a background validation to finish and stop any more */
+                CFE_TBL_HoldValidation(RegRecPtr);
+                RegRecPtr->ValidationDutyCycle = 0;
+
                 /* Mark table as free, although, technically, it isn't free until the */
                 /* linked list of Access Descriptors has no links in it.              */
                 /* NOTE: Allocated memory is freed when all Access Links have been    */
@@ -1420,7 +1896,10 @@ int32 CFE_TBL_CleanUpApp(uint32 AppId)
                 RegRecPtr->OwnerAppId = (uint32)CFE_TBL_NOT_OWNED;
 
                 /* Remove Table Name */
+                CFE_NameIndex_Remove(&CFE_TBL_TaskData.RegistryIndex, RegRecPtr->Name, AccessDescPtr->RegIndex);
                 RegRecPtr->Name[0] = '\0';
+
+                CFE_TBL_ReleaseValidation(RegRecPtr);
             }
             
             /* Remove the Access Descriptor Link from linked list */
@@ -1524,7 +2003,8 @@ void CFE_TBL_UpdateCriticalTblCDS(CFE_TBL_RegistryRec_t *RegRecPtr)
 
 int32 CFE_TBL_SendNotificationMsg(CFE_TBL_RegistryRec_t *RegRecPtr)
 {
-    int32 Status = CFE_SUCCESS;
+    int32               Status = CFE_SUCCESS;
+    CFE_TBL_NotifyCmd_t NotifyMsg;  /* Local, since validation workers send notifications too */
     
     /* First, determine if a message should be sent */
     if (RegRecPtr->NotifyByMsg)
@@ -1532,18 +2012,18 @@ int32 CFE_TBL_SendNotificationMsg(CFE_TBL_RegistryRec_t *RegRecPtr)
         /*
         ** Initialize notification message packet (clear user data area)...
         */
-        CFE_SB_InitMsg(&CFE_TBL_TaskData.NotifyMsg,
+        CFE_SB_InitMsg(&NotifyMsg,
                         RegRecPtr->NotificationMsgId,
                         sizeof(CFE_TBL_NotifyCmd_t), true);
         
         /* Set the command code */
-        CFE_SB_SetCmdCode((CFE_SB_MsgPtr_t) &CFE_TBL_TaskData.NotifyMsg, RegRecPtr->NotificationCC);
+        CFE_SB_SetCmdCode((CFE_SB_MsgPtr_t) &NotifyMsg, RegRecPtr->NotificationCC);
         
         /* Set the command parameter */
-        CFE_TBL_TaskData.NotifyMsg.Payload.Parameter = RegRecPtr->NotificationParam;
+        NotifyMsg.Payload.Parameter = RegRecPtr->NotificationParam;
     
-        CFE_SB_TimeStampMsg((CFE_SB_Msg_t *) &CFE_TBL_TaskData.NotifyMsg);
-        Status = CFE_SB_SendMsg((CFE_SB_Msg_t *) &CFE_TBL_TaskData.NotifyMsg);
+        CFE_SB_TimeStampMsg((CFE_SB_Msg_t *) &NotifyMsg);
+        Status = CFE_SB_SendMsg((CFE_SB_Msg_t *) &NotifyMsg);
     
         if (Status != CFE_SUCCESS)
         {
@@ -1557,6 +2037,278 @@ int32 CFE_TBL_SendNotificationMsg(CFE_TBL_RegistryRec_t *RegRecPtr)
     return Status;
 } /* End of CFE_TBL_SendNotificationMsg() */
 
+
+/*******************************************************************
+**
+** CFE_TBL_PerformValidation
+**
+** NOTE: For complete prolog information, see 'cfe_tbl_internal.h'
+********************************************************************/
+
+int32 CFE_TBL_PerformValidation(const char *AppName, CFE_TBL_RegistryRec_t *RegRecPtr)
+{
+    int32 Status;
+
+    /* Identify the image to be validated, starting with the Inactive Buffer */
+    if (RegRecPtr->ValidateInactiveIndex != CFE_TBL_NO_VALIDATION_PENDING)
+    {
+        /* Identify whether the Inactive Buffer is a shared buffer or a dedicated one */
+        if (RegRecPtr->DoubleBuffered)
+        {
+            /* Call the Application's Validation function for the Inactive Buffer */
+            Status = (RegRecPtr->ValidationFuncPtr)(RegRecPtr->Buffers[(1U-RegRecPtr->ActiveBufferIndex)].BufferPtr);
+            
+            /* Allow buffer to be activated after passing validation */
+            if (Status == CFE_SUCCESS)
+            {
+                RegRecPtr->Buffers[(1U-RegRecPtr->ActiveBufferIndex)].Validated = true;       
+            }
+        }
+        else
+        {
+            /* Call the Application's Validation function for the appropriate shared buffer */
+            Status = (RegRecPtr->ValidationFuncPtr)
+                      (CFE_TBL_TaskData.LoadBuffs[RegRecPtr->LoadInProgress].BufferPtr);
+            
+            /* Allow buffer to be activated after passing validation */
+            if (Status == CFE_SUCCESS)
+            {
+                CFE_TBL_TaskData.LoadBuffs[RegRecPtr->LoadInProgress].Validated = true;       
+            }
+        }
+
+        if (Status == CFE_SUCCESS)
+        {
+            CFE_EVS_SendEventWithAppID(CFE_TBL_VALIDATION_INF_EID,
+                                       CFE_EVS_EventType_INFORMATION,
+                                       CFE_TBL_TaskData.TableTaskAppId,
+                                       "%s validation successful for Inactive '%s'",
+                                       AppName, RegRecPtr->Name);
+        }
+        else
+        {
+            CFE_EVS_SendEventWithAppID(CFE_TBL_VALIDATION_ERR_EID,
+                                       CFE_EVS_EventType_ERROR,
+                                       CFE_TBL_TaskData.TableTaskAppId,
+                                       "%s validation failed for Inactive '%s', Status=0x%08X",
+                                       AppName, RegRecPtr->Name, (unsigned int)Status);
+            
+            if (Status > CFE_SUCCESS)
+            {
+                CFE_ES_WriteToSysLog("CFE_TBL:Validate-App(%u) Validation func return code invalid (Stat=0x%08X) for '%s'\n",
+                        (unsigned int)CFE_TBL_TaskData.TableTaskAppId, (unsigned int)Status, RegRecPtr->Name);
+            }
+        }
+
+        /* Save the result of the Validation function for the Table Services Task */
+        CFE_TBL_TaskData.ValidationResults[RegRecPtr->ValidateInactiveIndex].Result = Status;
+
+        /* Once validation is complete, set flags to indicate response is ready */
+        CFE_TBL_TaskData.ValidationResults[RegRecPtr->ValidateInactiveIndex].State = CFE_TBL_VALIDATION_PERFORMED;
+        RegRecPtr->ValidateInactiveIndex = CFE_TBL_NO_VALIDATION_PENDING;
+
+        /* Since the validation was successfully performed (although maybe not a successful result) */
+        /* return a success status */
+        Status = CFE_SUCCESS;
+    }
+    else if (RegRecPtr->ValidateActiveIndex != CFE_TBL_NO_VALIDATION_PENDING)
+    {
+        /* Perform validation on the currently active table buffer */
+        /* Identify whether the Active Buffer is a shared buffer or a dedicated one */
+        if (RegRecPtr->DoubleBuffered)
+        {
+            /* Call the Application's Validation function for the Dedicated Active Buffer */
+            Status = (RegRecPtr->ValidationFuncPtr)(RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].BufferPtr);
+        }
+        else
+        {
+            /* Call the Application's Validation function for the static buffer */
+            Status = (RegRecPtr->ValidationFuncPtr)(RegRecPtr->Buffers[0].BufferPtr);
+        }
+
+        if (Status == CFE_SUCCESS)
+        {
+            CFE_EVS_SendEventWithAppID(CFE_TBL_VALIDATION_INF_EID,
+                                       CFE_EVS_EventType_INFORMATION,
+                                       CFE_TBL_TaskData.TableTaskAppId,
+                                       "%s validation successful for Active '%s'",
+                                       AppName, RegRecPtr->Name);
+        }
+        else
+        {
+            CFE_EVS_SendEventWithAppID(CFE_TBL_VALIDATION_ERR_EID,
+                                       CFE_EVS_EventType_ERROR,
+                                       CFE_TBL_TaskData.TableTaskAppId,
+                                       "%s validation failed for Active '%s', Status=0x%08X",
+                                       AppName, RegRecPtr->Name, (unsigned int)Status);
+            
+            if (Status > CFE_SUCCESS)
+            {
+                CFE_ES_WriteToSysLog("CFE_TBL:Validate-App(%u) Validation func return code invalid (Stat=0x%08X) for '%s'\n",
+                        (unsigned int)CFE_TBL_TaskData.TableTaskAppId, (unsigned int)Status, RegRecPtr->Name);
+            }
+        }
+
+        /* Save the result of the Validation function for the Table Services Task */
+        CFE_TBL_TaskData.ValidationResults[RegRecPtr->ValidateActiveIndex].Result = Status;
+
+        /* Once validation is complete, reset the flags */
+        CFE_TBL_TaskData.ValidationResults[RegRecPtr->ValidateActiveIndex].State = CFE_TBL_VALIDATION_PERFORMED;
+        RegRecPtr->ValidateActiveIndex = CFE_TBL_NO_VALIDATION_PENDING;
+
+        /* Since the validation was successfully performed (although maybe not a successful result) */
+        /* return a success status */
+        Status = CFE_SUCCESS;
+    }
+    else
+    {
+        Status = CFE_TBL_INFO_NO_VALIDATION_PENDING;
+    }
+
+    return Status;
+} /* End of CFE_TBL_PerformValidation() */
+
+
+/*******************************************************************
+**
+** CFE_TBL_RunBackgroundValidation
+**
+** NOTE: For complete prolog information, see 'cfe_tbl_internal.h'
+********************************************************************/
+
+void CFE_TBL_RunBackgroundValidation(void)
+{
+    CFE_TBL_RegistryRec_t *RegRecPtr;
+    CFE_TBL_RegistryRec_t *ThisRegRecPtr;
+    OS_time_t              StartTime;
+    OS_time_t              EndTime;
+    char                   AppName[OS_MAX_API_NAME];
+    char                   TblName[CFE_TBL_MAX_FULL_NAME_LEN];
+    uint32                 OwnerAppId = 0;
+    uint32                 DutyCyclePct = 0;
+    uint32                 IdleMsec;
+    bool                   StillOwned;
+    int16                  RegIndex;
+
+    do
+    {
+        RegRecPtr = NULL;
+
+        /* Claim a table with a pending validation that no other worker is already processing */
+        CFE_TBL_LockRegistry();
+
+        for (RegIndex = 0; (RegIndex < CFE_PLATFORM_TBL_MAX_NUM_TABLES) && (RegRecPtr == NULL); RegIndex++)
+        {
+            ThisRegRecPtr = &CFE_TBL_TaskData.Registry[RegIndex];
+
+            if ((ThisRegRecPtr->ValidationDutyCycle != 0) && (!ThisRegRecPtr->ValidationBusy) &&
+                ((ThisRegRecPtr->ValidateInactiveIndex != CFE_TBL_NO_VALIDATION_PENDING) ||
+                 (ThisRegRecPtr->ValidateActiveIndex != CFE_TBL_NO_VALIDATION_PENDING)))
+            {
+                RegRecPtr = ThisRegRecPtr;
+                RegRecPtr->ValidationBusy = true;
+                DutyCyclePct = RegRecPtr->ValidationDutyCycle;
+                OwnerAppId = RegRecPtr->OwnerAppId;
+                strncpy(TblName, RegRecPtr->Name, sizeof(TblName) - 1);
+                TblName[sizeof(TblName) - 1] = '\0';
+            }
+        }
+
+        CFE_TBL_UnlockRegistry();
+
+        if (RegRecPtr != NULL)
+        {
+            CFE_ES_GetAppName(AppName, OwnerAppId, OS_MAX_API_NAME);
+
+            /* The table cannot be changed or unregistered while it is marked busy */
+            CFE_PSP_GetTime(&StartTime);
+            CFE_TBL_PerformValidation(AppName, RegRecPtr);
+            CFE_PSP_GetTime(&EndTime);
+
+            /* Make sure the table still belongs to the same application before notifying it */
+            CFE_TBL_LockRegistry();
+            StillOwned = ((RegRecPtr->OwnerAppId == OwnerAppId) &&
+                          (strncmp(RegRecPtr->Name, TblName, sizeof(TblName)) == 0));
+            CFE_TBL_UnlockRegistry();
+
+            if (StillOwned)
+            {
+                /* Let the owning application know that its table has been validated */
+                CFE_TBL_SendNotificationMsg(RegRecPtr);
+            }
+            else
+            {
+                CFE_ES_WriteToSysLog("CFE_TBL:Validation of '%s' finished after its owner released it\n", TblName);
+            }
+
+            CFE_TBL_ReleaseValidation(RegRecPtr);
+
+            /* Sit idle long enough to keep this worker within the owner's duty cycle */
+            IdleMsec = (1000000 * (EndTime.seconds - StartTime.seconds)) + EndTime.microsecs - StartTime.microsecs;
+            IdleMsec = ((IdleMsec / 1000) * (100 - DutyCyclePct)) / DutyCyclePct;
+
+            if (IdleMsec > 0)
+            {
+                OS_TaskDelay(IdleMsec);
+            }
+        }
+    } while (RegRecPtr != NULL);
+} /* End of CFE_TBL_RunBackgroundValidation() */
+
+
+/*******************************************************************
+**
+** CFE_TBL_HoldValidation
+**
+** NOTE: For complete prolog information, see 'cfe_tbl_internal.h'
+********************************************************************/
+
+void CFE_TBL_HoldValidation(CFE_TBL_RegistryRec_t *RegRecPtr)
+{
+    CFE_TBL_LockRegistry();
+
+    /* Wait for a validation worker to finish with the table's buffers */
+    while (RegRecPtr->ValidationBusy)
+    {
+        CFE_TBL_UnlockRegistry();
+        OS_TaskDelay(CFE_TBL_VALIDATION_HOLD_POLL_MSEC);
+        CFE_TBL_LockRegistry();
+    }
+
+    RegRecPtr->ValidationBusy = true;
+
+    CFE_TBL_UnlockRegistry();
+} /* End of CFE_TBL_HoldValidation() */
+
+
+/*******************************************************************
+**
+** CFE_TBL_ReleaseValidation
+**
+** NOTE: For complete prolog information, see 'cfe_tbl_internal.h'
+********************************************************************/
+
+void CFE_TBL_ReleaseValidation(CFE_TBL_RegistryRec_t *RegRecPtr)
+{
+    bool Pending;
+
+    CFE_TBL_LockRegistry();
+
+    RegRecPtr->ValidationBusy = false;
+
+    /* A worker woken while the table was held will have passed it over */
+    Pending = ((RegRecPtr->ValidationDutyCycle != 0) &&
+               ((RegRecPtr->ValidateInactiveIndex != CFE_TBL_NO_VALIDATION_PENDING) ||
+                (RegRecPtr->ValidateActiveIndex != CFE_TBL_NO_VALIDATION_PENDING)));
+
+    CFE_TBL_UnlockRegistry();
+
+    if (Pending)
+    {
+        OS_CountSemGive(CFE_TBL_TaskData.ValidationSem);
+    }
+} /* End of CFE_TBL_ReleaseValidation() */
+
 /************************/
 /*  End of File Comment */
 /************************/
@@ -398,6 +398,244 @@ int32   CFE_TBL_LoadFromFile(const char *AppName, CFE_TBL_LoadBuff_t *WorkingBuf
                              CFE_TBL_RegistryRec_t *RegRecPtr, const char *Filename);
 
 
+/*****************************************************************************/
+/**
+** \brief Maps the data portion of an open table image file into a working buffer
+**
+** \par Description
+**        Verifies that the open table image file contains exactly one complete
+**        table image following its headers and maps that image into memory
+**        as the contents of the specified working buffer.  Any image previously
+**        mapped into the working buffer is released first.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# This function assumes the file position immediately follows the
+**           table file header (ie - #CFE_TBL_ReadHeaders has been called).
+**        -# The mapping is private, so modifications made to the buffer are
+**           never written back to the file.
+**
+** \param[in]  AppName          The name of the application loading the table.
+**
+** \param[in]  FileDescriptor   File Descriptor of the open table image file
+**
+** \param[in]  WorkingBufferPtr Pointer to the working buffer that is to reference
+**                              the mapped table image
+**
+** \param[in]  RegRecPtr        Pointer to Table Registry record for the mapped table
+**
+** \param[in]  TblFileHeaderPtr Pointer to the table header read from the file
+**
+** \retval #CFE_SUCCESS                      \copydoc CFE_SUCCESS
+** \retval #CFE_TBL_ERR_PARTIAL_LOAD         \copydoc CFE_TBL_ERR_PARTIAL_LOAD
+** \retval #CFE_TBL_ERR_LOAD_INCOMPLETE      \copydoc CFE_TBL_ERR_LOAD_INCOMPLETE
+** \retval #CFE_TBL_ERR_FILE_TOO_LARGE       \copydoc CFE_TBL_ERR_FILE_TOO_LARGE
+** \retval #CFE_TBL_ERR_ACCESS               \copydoc CFE_TBL_ERR_ACCESS
+**                     
+******************************************************************************/
+int32   CFE_TBL_MapWorkingBuffer(const char *AppName, int32 FileDescriptor,
+                                 CFE_TBL_LoadBuff_t *WorkingBufferPtr,
+                                 CFE_TBL_RegistryRec_t *RegRecPtr,
+                                 const CFE_TBL_File_Hdr_t *TblFileHeaderPtr);
+
+
+/*****************************************************************************/
+/**
+** \brief Releases a table image mapped into a table buffer
+**
+** \par Description
+**        Unmaps the table image referenced by the specified buffer, if any,
+**        and clears the buffer pointer.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \param[in]  LoadBuffPtr      Pointer to the buffer whose mapping is to be released
+**
+** \param[in]  Size             Size, in bytes, of the mapped table image
+**
+** \retval #CFE_SUCCESS                      \copydoc CFE_SUCCESS
+** \retval #OS_ERROR                         \copydoc OS_ERROR
+**                     
+******************************************************************************/
+int32   CFE_TBL_UnmapBuffer(CFE_TBL_LoadBuff_t *LoadBuffPtr, uint32 Size);
+
+
+/*****************************************************************************/
+/**
+** \brief Applies the segments of a delta table image to a working buffer
+**
+** \par Description
+**        Reads each segment of a delta table image from the open table file
+**        into the specified working buffer and then recomputes the CRC of
+**        the regions of the buffer that were touched by the segments.  The
+**        other regions keep the CRCs carried over from the active image when
+**        the buffer was seeded, and are only recomputed if those are not
+**        known (ie - the table has never been loaded).
+**
+** \par Assumptions, External Events, and Notes:
+**        -# This function assumes the file position immediately follows the
+**           table file header (ie - #CFE_TBL_ReadHeaders has been called).
+**        -# The working buffer must already contain the image the delta is
+**           applied to.
+**
+** \param[in]  AppName          The name of the application loading the table.
+**
+** \param[in]  FileDescriptor   File Descriptor of the open table image file
+**
+** \param[in]  WorkingBufferPtr Pointer to the working buffer the segments are applied to
+**
+** \param[in]  RegRecPtr        Pointer to Table Registry record for the table being loaded
+**
+** \param[in]  TblFileHeaderPtr Pointer to the table header read from the file
+**
+** \retval #CFE_TBL_WARN_PARTIAL_LOAD        \copydoc CFE_TBL_WARN_PARTIAL_LOAD
+** \retval #CFE_TBL_ERR_LOAD_INCOMPLETE      \copydoc CFE_TBL_ERR_LOAD_INCOMPLETE
+** \retval #CFE_TBL_ERR_FILE_TOO_LARGE       \copydoc CFE_TBL_ERR_FILE_TOO_LARGE
+**                     
+******************************************************************************/
+int32   CFE_TBL_LoadDeltaSegments(const char *AppName, int32 FileDescriptor,
+                                  CFE_TBL_LoadBuff_t *WorkingBufferPtr,
+                                  CFE_TBL_RegistryRec_t *RegRecPtr,
+                                  const CFE_TBL_File_Hdr_t *TblFileHeaderPtr);
+
+
+/*****************************************************************************/
+/**
+** \brief Locates the next segment of a delta image
+**
+** \par Description
+**        Compares two images of a table, one CRC region at a time, starting at
+**        the specified offset and identifies the next run of consecutive regions
+**        in which the images differ.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \param[in]     DataAddr     Address of the image the delta leads to
+**
+** \param[in]     BaseAddr     Address of the image the delta is applied to
+**
+** \param[in]     Size         Size, in bytes, of both images
+**
+** \param[in,out] OffsetPtr    On input, the offset at which to begin the search.
+**                             On output, the offset of the segment found.
+**
+** \param[out]    NumBytesPtr  Number of bytes in the segment found
+**
+** \retval true  if a segment was found
+** \retval false if the images do not differ beyond the starting offset
+**                     
+******************************************************************************/
+bool    CFE_TBL_FindDeltaSegment(const void *DataAddr, const void *BaseAddr, uint32 Size,
+                                 uint32 *OffsetPtr, uint32 *NumBytesPtr);
+
+
+/*****************************************************************************/
+/**
+** \brief Prepares the shift used to combine the CRCs of table regions
+**
+** \par Description
+**        Determines the effect of feeding a full region of zeros through the
+**        CRC algorithm on each bit of the running CRC.  This allows the CRC of
+**        a whole table to be assembled from the CRCs of its regions.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# The default CRC algorithm is assumed to be linear with no final
+**           exclusive-or, which holds for #CFE_MISSION_ES_CRC_16.
+**
+******************************************************************************/
+void    CFE_TBL_InitCrcRegionShift(void);
+
+
+/*****************************************************************************/
+/**
+** \brief Applies a CRC shift to a running CRC
+**
+** \par Description
+**        Computes the running CRC that results from feeding the data described
+**        by the specified shift through the CRC algorithm.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \param[in]  ShiftPtr   Pointer to an array of 16 values giving the effect of
+**                        the data on each bit of the running CRC
+**
+** \param[in]  Crc        Running CRC to be shifted
+**
+** \returns
+**        The shifted CRC
+**
+******************************************************************************/
+uint16  CFE_TBL_ShiftCrc(const uint16 *ShiftPtr, uint16 Crc);
+
+
+/*****************************************************************************/
+/**
+** \brief Marks the CRC regions touched by a block of table data
+**
+** \par Description
+**        Sets the bit of each CRC region overlapped by the specified block
+**        of bytes in the specified region mask.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# The first region of a table holds any remainder, so that every
+**           other region is #CFE_PLATFORM_TBL_CRC_REGION_SIZE bytes.
+**
+** \param[in,out] RegionMask  Bit mask of regions to be updated
+**
+** \param[in]     Size        Size, in bytes, of the table
+**
+** \param[in]     Offset      Offset of the first byte of the block
+**
+** \param[in]     NumBytes    Number of bytes in the block, must be greater than zero
+**
+******************************************************************************/
+void    CFE_TBL_MarkCrcRegions(uint32 *RegionMask, uint32 Size, uint32 Offset, uint32 NumBytes);
+
+
+/*****************************************************************************/
+/**
+** \brief Computes the CRC of a table buffer
+**
+** \par Description
+**        Computes the CRC of each region of the specified buffer along
+**        with the CRC of the buffer's contents as a whole.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \param[in]  BuffPtr    Pointer to the table buffer
+**
+** \param[in]  Size       Size, in bytes, of the table
+**
+******************************************************************************/
+void    CFE_TBL_ComputeCrc(CFE_TBL_LoadBuff_t *BuffPtr, uint32 Size);
+
+
+/*****************************************************************************/
+/**
+** \brief Updates the CRC of a partially modified table buffer
+**
+** \par Description
+**        Recomputes the CRC of each marked region of the specified buffer
+**        and combines the region CRCs into the CRC of the whole buffer.
+**        The result is identical to computing the CRC of the buffer in full.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# If the buffer's region CRCs are not valid, or the table is too
+**           large for region CRCs, the whole buffer is recomputed.
+**
+** \param[in]  BuffPtr    Pointer to the table buffer
+**
+** \param[in]  Size       Size, in bytes, of the table
+**
+** \param[in]  RegionMask Bit mask of the regions that have been modified
+**
+******************************************************************************/
+void    CFE_TBL_UpdateCrc(CFE_TBL_LoadBuff_t *BuffPtr, uint32 Size, const uint32 *RegionMask);
+
+
 /*****************************************************************************/
 /**
 ** \brief Updates the active table buffer with contents of inactive buffer
@@ -582,6 +820,81 @@ void CFE_TBL_UpdateCriticalTblCDS(CFE_TBL_RegistryRec_t *RegRecPtr);
 ******************************************************************************/
 int32 CFE_TBL_SendNotificationMsg(CFE_TBL_RegistryRec_t *RegRecPtr);
 
+
+/*****************************************************************************/
+/**
+** \brief Calls a table owner's validation function for a pending validation request
+**
+** \par Description
+**        Calls the validation function of the specified table for the pending
+**        validation request of its inactive buffer or, if there is none, of its
+**        active buffer and records the result for the Table Services task.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# The table is assumed to have a validation function.
+**
+** \param[in]  AppName     Name of the application that owns the table.
+**
+** \param[in]  RegRecPtr   Pointer to Table Registry entry for table to be validated.
+**
+** \retval #CFE_SUCCESS                        \copydoc CFE_SUCCESS
+** \retval #CFE_TBL_INFO_NO_VALIDATION_PENDING \copydoc CFE_TBL_INFO_NO_VALIDATION_PENDING
+**
+******************************************************************************/
+int32 CFE_TBL_PerformValidation(const char *AppName, CFE_TBL_RegistryRec_t *RegRecPtr);
+
+
+/*****************************************************************************/
+/**
+** \brief Performs pending background table validations
+**
+** \par Description
+**        Called by a Table Services validation worker each time it is woken.
+**        Validates every table that has opted into background validation and has
+**        a validation pending which no other worker is processing, notifying each
+**        owning application as its table's validation completes.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# After each validation the worker stays idle long enough that the time
+**           spent validating does not exceed the owner's duty cycle.
+**        -# The owning application is only notified if the table still has the
+**           same owner and name as when its validation was started.
+**
+******************************************************************************/
+void CFE_TBL_RunBackgroundValidation(void);
+
+/*****************************************************************************/
+/**
+** \brief Keeps the validation workers away from a table
+**
+** \par Description
+**        Waits for any background validation of the specified table to finish
+**        and then marks the table busy so that no validation worker starts on
+**        it until #CFE_TBL_ReleaseValidation is called.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# Must be called before a table's buffers, ownership or name are
+**           changed and must not be called while the registry is locked.
+**        -# Calls must not be nested for the same table.
+**
+** \param[in]  RegRecPtr   Pointer to Table Registry entry for the table.
+**
+******************************************************************************/
+void CFE_TBL_HoldValidation(CFE_TBL_RegistryRec_t *RegRecPtr);
+
+/*****************************************************************************/
+/**
+** \brief Lets the validation workers return to a table
+**
+** \par Description
+**        Undoes #CFE_TBL_HoldValidation and wakes a validation worker if a
+**        background validation of the table was requested in the meantime.
+**
+** \param[in]  RegRecPtr   Pointer to Table Registry entry for the table.
+**
+******************************************************************************/
+void CFE_TBL_ReleaseValidation(CFE_TBL_RegistryRec_t *RegRecPtr);
+
 /*****************************************************************************/
 /**
 ** \brief Performs a byte swap on a uint32 integer
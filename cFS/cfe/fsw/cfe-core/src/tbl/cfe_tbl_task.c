@@ -42,6 +42,7 @@
 #include "cfe_tbl_verify.h"
 #include "cfe_msgids.h"
 #include <string.h>
+#include <stdio.h>
 
 
 /*
@@ -211,6 +212,11 @@ int32 CFE_TBL_TaskInit(void)
       return Status;
     }/* end if */
     
+    /*
+    ** Start the background validation workers
+    */
+    CFE_TBL_StartValidationWorkers();
+
     /*
     ** Task startup event message
     */
@@ -258,6 +264,74 @@ void CFE_TBL_InitData(void)
 } /* End of CFE_TBL_InitData() */
 
 
+/******************************************************************************/
+
+void CFE_TBL_StartValidationWorkers(void)
+{
+    char   WorkerName[OS_MAX_API_NAME];
+    uint32 WorkerTaskId;
+    uint32 i;
+    int32  Status;
+
+    CFE_TBL_TaskData.NumValidationWorkers = 0;
+
+    if (CFE_PLATFORM_TBL_NUM_VALIDATION_WORKERS > 0)
+    {
+        Status = OS_CountSemCreate(&CFE_TBL_TaskData.ValidationSem, "TBL_VAL_SEM", 0, 0);
+
+        if (Status != OS_SUCCESS)
+        {
+            CFE_ES_WriteToSysLog("TBL:Error creating validation semaphore:RC=0x%08X\n",(unsigned int)Status);
+            return;
+        }
+
+        for (i = 0; i < CFE_PLATFORM_TBL_NUM_VALIDATION_WORKERS; i++)
+        {
+            snprintf(WorkerName, sizeof(WorkerName), "TBL_VAL_%u", (unsigned int)i);
+
+            Status = CFE_ES_CreateChildTask(&WorkerTaskId, WorkerName, CFE_TBL_ValidationWorkerMain, NULL,
+                                            CFE_PLATFORM_TBL_VALIDATION_WORKER_STACK_SIZE,
+                                            CFE_PLATFORM_TBL_VALIDATION_WORKER_PRIORITY, 0);
+
+            if (Status != CFE_SUCCESS)
+            {
+                CFE_ES_WriteToSysLog("TBL:Error creating validation worker %u:RC=0x%08X\n",
+                                     (unsigned int)i, (unsigned int)Status);
+                break;
+            }
+
+            CFE_TBL_TaskData.NumValidationWorkers++;
+        }
+    }
+
+} /* End of CFE_TBL_StartValidationWorkers() */
+
+
+/******************************************************************************/
+
+void CFE_TBL_ValidationWorkerMain(void)
+{
+    int32 Status;
+
+    Status = CFE_ES_RegisterChildTask();
+
+    while (Status == CFE_SUCCESS)
+    {
+        Status = OS_CountSemTake(CFE_TBL_TaskData.ValidationSem);
+
+        if (Status == OS_SUCCESS)
+        {
+            CFE_TBL_RunBackgroundValidation();
+        }
+    }
+
+    CFE_ES_WriteToSysLog("TBL:Validation worker exiting:RC=0x%08X\n",(unsigned int)Status);
+
+    CFE_ES_ExitChildTask();
+
+} /* End of CFE_TBL_ValidationWorkerMain() */
+
+
 /******************************************************************************/
 
 void CFE_TBL_TaskPipe(CFE_SB_Msg_t *MessagePtr)
@@ -40,6 +40,7 @@
 ** Required header files
 */
 #include "private/cfe_private.h"
+#include "private/cfe_name_index.h"
 #include "cfe_tbl_events.h"
 #include "cfe_tbl_msg.h"
 
@@ -77,6 +78,9 @@
 */ 
 #define CFE_TBL_NO_VALIDATION_PENDING (-1) 
 
+/** \brief Milliseconds between checks for a validation worker to finish with a Table */
+#define CFE_TBL_VALIDATION_HOLD_POLL_MSEC 10
+
 /** \brief Value indicating when no Dump is Pending on a Dump-Only Table */
 /**
 **  This macro is used to indicate no Dump is Pending by assigning it to
@@ -84,6 +88,22 @@
 */ 
 #define CFE_TBL_NO_DUMP_PENDING (-1) 
 
+/** \brief Size of the largest table whose buffers are allocated by Table Services */
+#if (CFE_PLATFORM_TBL_MAX_SNGL_TABLE_SIZE > CFE_PLATFORM_TBL_MAX_DBL_TABLE_SIZE)
+#define CFE_TBL_MAX_TABLE_SIZE  CFE_PLATFORM_TBL_MAX_SNGL_TABLE_SIZE
+#else
+#define CFE_TBL_MAX_TABLE_SIZE  CFE_PLATFORM_TBL_MAX_DBL_TABLE_SIZE
+#endif
+
+/** \brief Number of CRC regions covering a table of the specified size */
+#define CFE_TBL_NUM_CRC_REGIONS(Size) (((Size) + CFE_PLATFORM_TBL_CRC_REGION_SIZE - 1) / CFE_PLATFORM_TBL_CRC_REGION_SIZE)
+
+/** \brief Number of CRC regions needed to cover the largest table */
+#define CFE_TBL_MAX_CRC_REGIONS CFE_TBL_NUM_CRC_REGIONS(CFE_TBL_MAX_TABLE_SIZE)
+
+/** \brief Number of words in a bit mask with one bit per CRC region */
+#define CFE_TBL_CRC_REGION_MASK_WORDS ((CFE_TBL_MAX_CRC_REGIONS + 31) / 32)
+
 /************************  Internal Structure Definitions  *****************************/
 
 /*******************************************************************************/
@@ -149,6 +169,8 @@ typedef struct
     uint32         FileCreateTimeSecs;          /**< \brief File creation time from last file loaded into table */
     uint32         FileCreateTimeSubSecs;       /**< \brief File creation time from last file loaded into table */
     uint32         Crc;                         /**< \brief Last calculated CRC for this buffer's contents */
+    uint16         RegionCrc[CFE_TBL_MAX_CRC_REGIONS]; /**< \brief Last calculated CRC of each region of this buffer's contents */
+    bool           RegionCrcValid;              /**< \brief Flag indicating whether RegionCrc matches the buffer's contents */
     bool           Taken;                       /**< \brief Flag indicating whether buffer is in use */
     bool           Validated;                   /**< \brief Flag indicating whether the buffer has been successfully validated */
     char           DataSource[OS_MAX_PATH_LEN]; /**< \brief Source of data put into buffer (filename or memory address) */
@@ -204,8 +226,12 @@ typedef struct
     bool                        DumpOnly;           /**< \brief Flag indicating Table is NOT to be loaded */
     bool                        DoubleBuffered;        /**< \brief Flag indicating Table has a dedicated inactive buffer */
     bool                        UserDefAddr;        /**< \brief Flag indicating Table address was defined by Owner Application */
+    bool                        MappedImage;        /**< \brief Flag indicating Table buffers are mapped from the loaded file */
     bool                        NotifyByMsg;        /**< \brief Flag indicating Table Services should notify owning App via message
                                                                 when table requires management */ 
+    bool                        ValidationBusy;     /**< \brief Flag indicating a validation worker is validating the Table */
+    uint32                      ValidationDutyCycle; /**< \brief Percentage of elapsed time a validation worker may spend validating the Table,
+                                                                zero if the owning App validates the Table itself */
     uint8                       ActiveBufferIndex;  /**< \brief Index identifying which buffer is the active buffer */
     char                        Name[CFE_TBL_MAX_FULL_NAME_LEN];   /**< \brief Processor specific table name */
     char                        LastFileLoaded[OS_MAX_PATH_LEN];   /**< \brief Filename of last file loaded into table */
@@ -303,7 +329,6 @@ typedef struct
   */
   CFE_TBL_HousekeepingTlm_t       HkPacket;               /**< \brief Housekeping Telemetry Packet */
   CFE_TBL_TableRegistryTlm_t      TblRegPacket;           /**< \brief Table Registry Entry Telemetry Packet */
-  CFE_TBL_NotifyCmd_t    NotifyMsg;                       /**< \brief Table management notification command message */
 
   /*
   ** Task operational data (not reported in housekeeping)...
@@ -328,12 +353,21 @@ typedef struct
   uint32                 WorkBufMutex;                    /**< \brief Mutex that controls assignment of Working Buffers */
   CFE_ES_CDSHandle_t     CritRegHandle;                   /**< \brief Handle to Critical Table Registry in CDS */
   CFE_TBL_LoadBuff_t     LoadBuffs[CFE_PLATFORM_TBL_MAX_SIMULTANEOUS_LOADS];  /**< \brief Working table buffers shared by single buffered tables */
+  uint16                 CrcRegionShift[16];              /**< \brief Effect of a full CRC region of zeros on each bit of a running CRC */
+
+  /*
+  ** Background Validation Workers
+  */
+  uint32                 ValidationSem;                   /**< \brief Counting semaphore that wakes the validation workers */
+  uint32                 NumValidationWorkers;            /**< \brief Number of validation workers successfully started */
 
   /*
   ** Registry Data
   */
   CFE_TBL_AccessDescriptor_t  Handles[CFE_PLATFORM_TBL_MAX_NUM_HANDLES];  /**< \brief Array of Access Descriptors */
   CFE_TBL_RegistryRec_t       Registry[CFE_PLATFORM_TBL_MAX_NUM_TABLES];  /**< \brief Array of Table Registry Records */
+  CFE_NameIndex_t             RegistryIndex;                     /**< \brief Hashed index of Table Registry Record names */
+  CFE_NameIndex_Slot_t        RegistryIndexSlots[CFE_NAME_INDEX_SLOTS(CFE_PLATFORM_TBL_MAX_NUM_TABLES)]; /**< \brief Storage for #RegistryIndex */
   CFE_TBL_CritRegRec_t        CritReg[CFE_PLATFORM_TBL_MAX_CRITICAL_TABLES]; /**< \brief Array of Critical Table Registry Records */
   CFE_TBL_BufParams_t         Buf;                               /**< \brief Parameters associated with Table Task's Memory Pool */
   CFE_TBL_ValidationResult_t  ValidationResults[CFE_PLATFORM_TBL_MAX_NUM_VALIDATIONS]; /**< \brief Array of Table Validation Requests */
@@ -420,6 +454,36 @@ void  CFE_TBL_TaskPipe(CFE_SB_Msg_t *MessagePtr);
 ******************************************************************************/
 void  CFE_TBL_InitData(void);
 
+/*****************************************************************************/
+/**
+** \brief Starts the background table validation workers
+**
+** \par Description
+**          Creates the semaphore used to wake the validation workers and
+**          then creates #CFE_PLATFORM_TBL_NUM_VALIDATION_WORKERS child tasks
+**          to perform validations for tables that have opted into them.
+**
+** \par Assumptions, External Events, and Notes:
+**          A failure is not fatal to Table Services; tables simply cannot
+**          opt into background validation when no workers are running.
+**
+******************************************************************************/
+void  CFE_TBL_StartValidationWorkers(void);
+
+/*****************************************************************************/
+/**
+** \brief Background table validation worker main function
+**
+** \par Description
+**          Waits for validation requests and performs them, until the
+**          validation worker semaphore can no longer be taken.
+**
+** \par Assumptions, External Events, and Notes:
+**          None
+**
+******************************************************************************/
+void  CFE_TBL_ValidationWorkerMain(void);
+
 
 #endif /* _cfe_tbl_task_ */
 
@@ -426,22 +426,55 @@ int32 CFE_TBL_LoadCmd(const CFE_TBL_Load_t *data)
                 {
                     /* Make sure of the following:                                               */
                     /*    1) If table has not been loaded previously, then make sure the current */
-                    /*       load starts with the first byte                                     */
+                    /*       load starts with the first byte and is not a delta image            */
                     /*    2) The number of bytes to load is greater than zero                    */
                     /*    3) The offset plus the number of bytes does not exceed the table size  */
-                    if (((RegRecPtr->TableLoadedOnce) || (TblFileHeader.Offset == 0)) &&
+                    /*       (the segments of a delta image are checked individually)            */
+                    if (((RegRecPtr->TableLoadedOnce) ||
+                         ((TblFileHeader.Offset == 0) && (TblFileHeader.NumSegments == 0))) &&
                         (TblFileHeader.NumBytes > 0) &&
-                        ((TblFileHeader.NumBytes + TblFileHeader.Offset) <= RegRecPtr->Size))
+                        ((TblFileHeader.NumSegments != 0) ||
+                         ((TblFileHeader.NumBytes + TblFileHeader.Offset) <= RegRecPtr->Size)))
                     {
+                        /* The working buffer may be one that a validation worker is reading */
+                        CFE_TBL_HoldValidation(RegRecPtr);
+
                         /* Get a working buffer, either a free one or one allocated with previous load command */
                         Status = CFE_TBL_GetWorkingBuffer(&WorkingBufferPtr, RegRecPtr, false);
 
                         if (Status == CFE_SUCCESS)
                         {
-                            /* Copy data from file into working buffer */
-                            Status = OS_read(FileDescriptor,
-                                             ((uint8*)WorkingBufferPtr->BufferPtr) + TblFileHeader.Offset,
-                                             TblFileHeader.NumBytes);
+                            if (RegRecPtr->MappedImage)
+                            {
+                                /* Map the table image from the file in place of the working buffer */
+                                Status = CFE_TBL_MapWorkingBuffer("CFE_TBL", FileDescriptor, WorkingBufferPtr,
+                                                                  RegRecPtr, &TblFileHeader);
+
+                                /* A successfully mapped image is exactly the size the header claims */
+                                if (Status == CFE_SUCCESS)
+                                {
+                                    Status = (int32)TblFileHeader.NumBytes;
+                                }
+                            }
+                            else if (TblFileHeader.NumSegments != 0)
+                            {
+                                /* Apply each segment of the delta image to the working buffer */
+                                Status = CFE_TBL_LoadDeltaSegments("CFE_TBL", FileDescriptor, WorkingBufferPtr,
+                                                                   RegRecPtr, &TblFileHeader);
+
+                                /* A successfully applied delta image accounts for all of the data */
+                                if (Status >= CFE_SUCCESS)
+                                {
+                                    Status = (int32)TblFileHeader.NumBytes;
+                                }
+                            }
+                            else
+                            {
+                                /* Copy data from file into working buffer */
+                                Status = OS_read(FileDescriptor,
+                                                 ((uint8*)WorkingBufferPtr->BufferPtr) + TblFileHeader.Offset,
+                                                 TblFileHeader.NumBytes);
+                            }
                                     
                             /* Make sure the appropriate number of bytes were read */
                             if (Status == (int32)TblFileHeader.NumBytes)
@@ -473,11 +506,11 @@ int32 CFE_TBL_LoadCmd(const CFE_TBL_Load_t *data)
                                     WorkingBufferPtr->FileCreateTimeSecs = StdFileHeader.TimeSeconds;
                                     WorkingBufferPtr->FileCreateTimeSubSecs = StdFileHeader.TimeSubSeconds;
                                     
-                                    /* Compute the CRC on the specified table buffer */
-                                    WorkingBufferPtr->Crc = CFE_ES_CalculateCRC(WorkingBufferPtr->BufferPtr,
-                                                                                RegRecPtr->Size,
-                                                                                0,
-                                                                                CFE_MISSION_ES_DEFAULT_CRC);
+                                    /* Compute the CRC on the specified table buffer, a delta image has already updated it */
+                                    if (TblFileHeader.NumSegments == 0)
+                                    {
+                                        CFE_TBL_ComputeCrc(WorkingBufferPtr, RegRecPtr->Size);
+                                    }
                                     
                                     /* Initialize validation flag with true if no Validation Function is required to be called */
                                     WorkingBufferPtr->Validated = (RegRecPtr->ValidationFuncPtr == NULL);
@@ -492,8 +525,9 @@ int32 CFE_TBL_LoadCmd(const CFE_TBL_Load_t *data)
                                     ReturnCode = CFE_TBL_INC_CMD_CTR;
                                 }
                             }
-                            else
+                            else if ((!RegRecPtr->MappedImage) && (TblFileHeader.NumSegments == 0))
                             {
+                                /* CFE_TBL_MapWorkingBuffer() and CFE_TBL_LoadDeltaSegments() generate their own events */
                                 /* A file whose header claims has 'x' amount of data but it only has 'y' */
                                 /* is considered a fatal error during a load process                     */
                                 CFE_EVS_SendEvent(CFE_TBL_FILE_INCOMPLETE_ERR_EID,
@@ -517,10 +551,13 @@ int32 CFE_TBL_LoadCmd(const CFE_TBL_Load_t *data)
                                               "Internal Error (Status=0x%08X)",
                                               (unsigned int)Status);
                         }
+
+                        CFE_TBL_ReleaseValidation(RegRecPtr);
                     }
                     else
                     {
-                        if ((TblFileHeader.NumBytes + TblFileHeader.Offset) > RegRecPtr->Size)
+                        if ((TblFileHeader.NumSegments == 0) &&
+                            ((TblFileHeader.NumBytes + TblFileHeader.Offset) > RegRecPtr->Size))
                         {
                             CFE_EVS_SendEvent(CFE_TBL_LOAD_EXCEEDS_SIZE_ERR_EID,
                                               CFE_EVS_EventType_ERROR,
@@ -606,7 +643,8 @@ int32 CFE_TBL_DumpCmd(const CFE_TBL_Dump_t *data)
         {
             DumpDataAddr = RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].BufferPtr;
         }
-        else if (CmdPtr->ActiveTableFlag == CFE_TBL_BufferSelect_INACTIVE)/* Dumping Inactive Buffer */
+        else if ((CmdPtr->ActiveTableFlag == CFE_TBL_BufferSelect_INACTIVE) || /* Dumping Inactive Buffer */
+                 ((CmdPtr->ActiveTableFlag == CFE_TBL_BufferSelect_DELTA) && (!RegRecPtr->DumpOnly)))
         {
             /* If this is a double buffered table, locating the inactive buffer is trivial */
             if (RegRecPtr->DoubleBuffered)
@@ -642,7 +680,14 @@ int32 CFE_TBL_DumpCmd(const CFE_TBL_Dump_t *data)
         if (DumpDataAddr != NULL)
         {
             /* If this is not a dump only table, then we can perform the dump immediately */
-            if (!RegRecPtr->DumpOnly)
+            if (CmdPtr->ActiveTableFlag == CFE_TBL_BufferSelect_DELTA)
+            {
+                /* Only the differences between the inactive and active buffers are dumped */
+                ReturnCode = CFE_TBL_DumpDeltaToFile(DumpFilename, TableName, DumpDataAddr,
+                                                     RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].BufferPtr,
+                                                     RegRecPtr->Size);
+            }
+            else if (!RegRecPtr->DumpOnly)
             {
                 ReturnCode = CFE_TBL_DumpToFile(DumpFilename, TableName, DumpDataAddr, RegRecPtr->Size);
             }
@@ -731,18 +776,61 @@ int32 CFE_TBL_DumpCmd(const CFE_TBL_Dump_t *data)
 ********************************************************************/
 
 CFE_TBL_CmdProcRet_t CFE_TBL_DumpToFile( const char *DumpFilename, const char *TableName, const void *DumpDataAddr, uint32 TblSizeInBytes)
+{
+    /* A complete image is simply a dump that is not relative to any other image */
+    return CFE_TBL_DumpDeltaToFile(DumpFilename, TableName, DumpDataAddr, NULL, TblSizeInBytes);
+} /* End of CFE_TBL_DumpToFile() */
+
+
+/*******************************************************************
+**
+** CFE_TBL_DumpDeltaToFile() -- Write table data differences to a file
+**
+** NOTE: For complete prolog information, see 'cfe_tbl_task_cmds.h'
+********************************************************************/
+
+CFE_TBL_CmdProcRet_t CFE_TBL_DumpDeltaToFile( const char *DumpFilename, const char *TableName, const void *DumpDataAddr,
+                                              const void *BaseDataAddr, uint32 TblSizeInBytes)
 {
     CFE_TBL_CmdProcRet_t        ReturnCode = CFE_TBL_INC_ERR_CTR;        /* Assume failure */
     bool                        FileExistedPrev = false;
     CFE_FS_Header_t             StdFileHeader;
     CFE_TBL_File_Hdr_t          TblFileHeader;
+    CFE_TBL_File_SegHdr_t       SegFileHeader;
     int32                       FileDescriptor;
     int32                       Status;
+    int32                       ExpectedStatus;
     int32                       EndianCheck = 0x01020304;
+    uint32                      NumSegments = 0;
+    uint32                      DeltaBytes = 0;
+    uint32                      SegOffset;
+    uint32                      SegBytes;
     
     /* Clear Header of any garbage before copying content */
     memset(&TblFileHeader, 0, sizeof(CFE_TBL_File_Hdr_t));
 
+    /* Size up the delta image before creating the file, since it may be empty */
+    if (BaseDataAddr != NULL)
+    {
+        SegOffset = 0;
+        while (CFE_TBL_FindDeltaSegment(DumpDataAddr, BaseDataAddr, TblSizeInBytes, &SegOffset, &SegBytes))
+        {
+            NumSegments++;
+            DeltaBytes += sizeof(CFE_TBL_File_SegHdr_t) + SegBytes;
+            SegOffset += SegBytes;
+        }
+
+        if (NumSegments == 0)
+        {
+            CFE_EVS_SendEvent(CFE_TBL_DELTA_DUMP_EMPTY_INF_EID,
+                              CFE_EVS_EventType_INFORMATION,
+                              "No differences between inactive and active buffers of '%s', no delta dump written",
+                              TableName);
+
+            return CFE_TBL_INC_CMD_CTR;
+        }
+    }
+
     /* Check to see if the dump file already exists */
     FileDescriptor = OS_open(DumpFilename, OS_READ_ONLY, 0);
 
@@ -770,8 +858,17 @@ CFE_TBL_CmdProcRet_t CFE_TBL_DumpToFile( const char *DumpFilename, const char *T
             strncpy(TblFileHeader.TableName, TableName, sizeof(TblFileHeader.TableName)-1);
             TblFileHeader.TableName[sizeof(TblFileHeader.TableName)-1] = 0;
             TblFileHeader.Offset = 0;
-            TblFileHeader.NumBytes = TblSizeInBytes;
-            TblFileHeader.Reserved = 0;
+
+            if (BaseDataAddr == NULL)
+            {
+                TblFileHeader.NumBytes = TblSizeInBytes;
+                TblFileHeader.NumSegments = 0;
+            }
+            else
+            {
+                TblFileHeader.NumBytes = DeltaBytes;
+                TblFileHeader.NumSegments = NumSegments;
+            }
             
             /* Determine if this is a little endian processor */
             if ((*(char *)&EndianCheck) == 0x04)
@@ -789,13 +886,55 @@ CFE_TBL_CmdProcRet_t CFE_TBL_DumpToFile( const char *DumpFilename, const char *T
             /* Make sure the header was output completely */
             if (Status == sizeof(CFE_TBL_File_Hdr_t))
             {
-                /* Output the requested data to the dump file */
-                /* Output the active table image data to the dump file */
-                Status = OS_write(FileDescriptor,
-                                  DumpDataAddr,
-                                  TblSizeInBytes);
+                if (BaseDataAddr == NULL)
+                {
+                    /* Output the requested data to the dump file */
+                    /* Output the active table image data to the dump file */
+                    Status = OS_write(FileDescriptor,
+                                      DumpDataAddr,
+                                      TblSizeInBytes);
+
+                    ExpectedStatus = (int32)TblSizeInBytes;
+                }
+                else
+                {
+                    /* Output each run of differing regions as a segment header followed by its data */
+                    Status = CFE_SUCCESS;
+                    SegOffset = 0;
+                    while ((Status == CFE_SUCCESS) &&
+                           CFE_TBL_FindDeltaSegment(DumpDataAddr, BaseDataAddr, TblSizeInBytes, &SegOffset, &SegBytes))
+                    {
+                        SegFileHeader.Offset = SegOffset;
+                        SegFileHeader.NumBytes = SegBytes;
+
+                        /* Segment headers are big endian, just like the table header */
+                        if ((*(char *)&EndianCheck) == 0x04)
+                        {
+                            CFE_TBL_ByteSwapUint32(&SegFileHeader.Offset);
+                            CFE_TBL_ByteSwapUint32(&SegFileHeader.NumBytes);
+                        }
+
+                        Status = OS_write(FileDescriptor, &SegFileHeader, sizeof(CFE_TBL_File_SegHdr_t));
+
+                        if (Status == sizeof(CFE_TBL_File_SegHdr_t))
+                        {
+                            Status = OS_write(FileDescriptor,
+                                              ((const uint8 *)DumpDataAddr) + SegOffset,
+                                              SegBytes);
+
+                            if (Status == (int32)SegBytes)
+                            {
+                                Status = CFE_SUCCESS;
+                            }
+                        }
+
+                        SegOffset += SegBytes;
+                    }
 
-                if (Status == (int32)TblSizeInBytes)
+                    ExpectedStatus = CFE_SUCCESS;
+                }
+
+                if (Status == ExpectedStatus)
                 {
                     if (FileExistedPrev)
                     {
@@ -856,7 +995,7 @@ CFE_TBL_CmdProcRet_t CFE_TBL_DumpToFile( const char *DumpFilename, const char *T
     }
     
     return ReturnCode;
-} /* End of CFE_TBL_DumpToFile() */
+} /* End of CFE_TBL_DumpDeltaToFile() */
 
 /*******************************************************************
 **
@@ -966,8 +1105,18 @@ int32 CFE_TBL_ValidateCmd(const CFE_TBL_Validate_t *data)
                         RegRecPtr->ValidateInactiveIndex = ValIndex;
                     }
                     
+                    if (RegRecPtr->ValidationDutyCycle != 0)
+                    {
+                        /* Wake a validation worker, which notifies the application once validation is complete */
+                        OS_CountSemGive(CFE_TBL_TaskData.ValidationSem);
+
+                        CFE_EVS_SendEvent(CFE_TBL_VAL_REQ_MADE_INF_EID,
+                                          CFE_EVS_EventType_DEBUG,
+                                          "Tbl Services issued validation request for '%s'",
+                                          TableName);
+                    }
                     /* If application requested notification by message, then do so */
-                    if (CFE_TBL_SendNotificationMsg(RegRecPtr) == CFE_SUCCESS)
+                    else if (CFE_TBL_SendNotificationMsg(RegRecPtr) == CFE_SUCCESS)
                     {
                         /* Notify ground that validation request has been made */
                         CFE_EVS_SendEvent(CFE_TBL_VAL_REQ_MADE_INF_EID,
@@ -1053,6 +1202,9 @@ int32 CFE_TBL_ActivateCmd(const CFE_TBL_Activate_t *data)
         }
         else if (RegRecPtr->LoadInProgress != CFE_TBL_NO_LOAD_IN_PROGRESS)
         {
+            /* Wait for a validation worker to finish with the inactive buffer */
+            CFE_TBL_HoldValidation(RegRecPtr);
+
             /* Determine if the inactive buffer has been successfully validated or not */
             if (RegRecPtr->DoubleBuffered)
             {
@@ -1086,6 +1238,8 @@ int32 CFE_TBL_ActivateCmd(const CFE_TBL_Activate_t *data)
                                   "Cannot activate table '%s'. Inactive image not Validated",
                                   TableName);
             }
+
+            CFE_TBL_ReleaseValidation(RegRecPtr);
         }
         else
         {
@@ -1506,6 +1660,9 @@ int32 CFE_TBL_AbortLoadCmd(const CFE_TBL_AbortLoad_t *data)
 
 void CFE_TBL_AbortLoad(CFE_TBL_RegistryRec_t *RegRecPtr)
 {
+    /* Wait for a validation worker to finish with the working buffer */
+    CFE_TBL_HoldValidation(RegRecPtr);
+
     /* The ground has aborted the load, free the working buffer for another attempt */
     if (!RegRecPtr->DoubleBuffered)
     {
@@ -1519,6 +1676,8 @@ void CFE_TBL_AbortLoad(CFE_TBL_RegistryRec_t *RegRecPtr)
     /* Make sure the load was not already pending */
     RegRecPtr->LoadPending = false;
 
+    CFE_TBL_ReleaseValidation(RegRecPtr);
+
     CFE_EVS_SendEvent(CFE_TBL_LOAD_ABORT_INF_EID,
                       CFE_EVS_EventType_INFORMATION,
                       "Table Load Aborted for '%s'",
@@ -331,6 +331,38 @@ int32 CFE_TBL_AbortLoadCmd(const CFE_TBL_AbortLoad_t *data);
 extern CFE_TBL_CmdProcRet_t CFE_TBL_DumpToFile( const char *DumpFilename, const char *TableName,
                                          const void *DumpDataAddr, uint32 TblSizeInBytes);
 
+/*****************************************************************************/
+/**
+** \brief Writes the differences between two table images to a file
+**
+** \par Description
+**        Writes a delta table image file, containing only those
+**        #CFE_PLATFORM_TBL_CRC_REGION_SIZE byte regions of the table that differ
+**        from the base image, which can later be loaded on top of the base image.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# If no base image is given, the complete image is written as
+**           by #CFE_TBL_DumpToFile.
+**        -# If the images do not differ, no file is written.
+**
+** \param[in] DumpFilename    Name of file to which the table image is to be written
+**
+** \param[in] TableName       Name of table being dumped to a file
+**
+** \param[in] DumpDataAddr    Address of data buffer whose contents are to be written
+**                            to the specified file
+**
+** \param[in] BaseDataAddr    Address of data buffer the delta is relative to, or NULL
+**
+** \param[in] TblSizeInBytes  Size of both blocks of data
+**
+** \retval #CFE_TBL_INC_ERR_CTR  \copydoc CFE_TBL_INC_ERR_CTR
+** \retval #CFE_TBL_INC_CMD_CTR  \copydoc CFE_TBL_INC_CMD_CTR
+******************************************************************************/
+extern CFE_TBL_CmdProcRet_t CFE_TBL_DumpDeltaToFile( const char *DumpFilename, const char *TableName,
+                                              const void *DumpDataAddr, const void *BaseDataAddr,
+                                              uint32 TblSizeInBytes);
+
 /*****************************************************************************/
 /**
 ** \brief Aborts load by freeing associated inactive buffers and sending event message
@@ -41,6 +41,18 @@
     #error Shared buffers and table of size CFE_PLATFORM_TBL_MAX_SNGL_TABLE_SIZE cannot be greater than memory pool size of CFE_PLATFORM_TBL_BUF_MEMORY_BYTES!
 #endif
 
+#if CFE_PLATFORM_TBL_CRC_REGION_SIZE < 1
+    #error CFE_PLATFORM_TBL_CRC_REGION_SIZE must be greater than zero!
+#endif
+
+#if CFE_PLATFORM_TBL_NUM_VALIDATION_WORKERS < 0
+    #error CFE_PLATFORM_TBL_NUM_VALIDATION_WORKERS cannot be negative!
+#endif
+
+#if CFE_PLATFORM_TBL_VALIDATION_WORKER_STACK_SIZE < 2048
+    #error CFE_PLATFORM_TBL_VALIDATION_WORKER_STACK_SIZE must be greater than or equal to 2048
+#endif
+
 #if CFE_PLATFORM_TBL_MAX_NUM_HANDLES < CFE_PLATFORM_TBL_MAX_NUM_TABLES
     #error CFE_PLATFORM_TBL_MAX_NUM_HANDLES cannot be set less than CFE_PLATFORM_TBL_MAX_NUM_TABLES!
 #endif
@@ -64,25 +64,10 @@ CFE_TIME_SysTime_t   CFE_TIME_GetTime(void)
  */
 CFE_TIME_SysTime_t   CFE_TIME_GetTAI(void)
 {
-    CFE_TIME_Reference_t Reference;
-    CFE_TIME_SysTime_t tai;
-
-    /* Zero out the Reference variable because we pass it into
-     * a function before using it
-     * */
-    memset(&Reference, 0 , sizeof(CFE_TIME_Reference_t));
-    
-    /*
-    ** Get reference time values (local time, time at tone, etc.)...
-    */
-    CFE_TIME_GetReference(&Reference);
-
     /*
-    ** Calculate current TAI...
+    ** Current TAI is the local clock plus an offset precomputed at the tone...
     */
-    tai = CFE_TIME_CalculateTAI(&Reference);
-
-    return(tai);
+    return CFE_TIME_CalculateCurrent(false);
 
 } /* End of CFE_TIME_GetTAI() */
 
@@ -92,24 +77,10 @@ CFE_TIME_SysTime_t   CFE_TIME_GetTAI(void)
  */
 CFE_TIME_SysTime_t   CFE_TIME_GetUTC(void)
 {
-    CFE_TIME_Reference_t Reference;
-    CFE_TIME_SysTime_t utc;
-
-    /* Zero out the Reference variable because we pass it into
-     * a function before using it
-     * */
-    memset(&Reference, 0 , sizeof(CFE_TIME_Reference_t));
-    /*
-    ** Get reference time values (local time, time at tone, etc.)...
-    */
-    CFE_TIME_GetReference(&Reference);
-
     /*
-    ** Calculate current UTC...
+    ** Current UTC is the local clock plus an offset precomputed at the tone...
     */
-    utc = CFE_TIME_CalculateUTC(&Reference);
-
-    return(utc);
+    return CFE_TIME_CalculateCurrent(true);
 
 } /* End of CFE_TIME_GetUTC() */
 
@@ -484,6 +455,85 @@ CFE_TIME_Compare_t  CFE_TIME_Compare(CFE_TIME_SysTime_t TimeA, CFE_TIME_SysTime_
 } /* End of CFE_TIME_Compare() */
 
 
+/*
+ * Function: CFE_TIME_AddArray - See API and header file for details
+ */
+void CFE_TIME_AddArray(CFE_TIME_SysTime_t *Result, const CFE_TIME_SysTime_t *TimeA,
+                       CFE_TIME_SysTime_t TimeB, uint32 Count)
+{
+    uint32 Subseconds;
+    uint32 i;
+
+    /*
+    ** Same arithmetic as CFE_TIME_Add, with the carry taken from the
+    **    comparison result rather than a branch so the loop vectorizes...
+    */
+    for (i = 0; i < Count; i++)
+    {
+        Subseconds = TimeA[i].Subseconds + TimeB.Subseconds;
+
+        Result[i].Seconds = TimeA[i].Seconds + TimeB.Seconds + (uint32)(Subseconds < TimeA[i].Subseconds);
+        Result[i].Subseconds = Subseconds;
+    }
+
+} /* End of CFE_TIME_AddArray() */
+
+
+/*
+ * Function: CFE_TIME_SubtractArray - See API and header file for details
+ */
+void CFE_TIME_SubtractArray(CFE_TIME_SysTime_t *Result, const CFE_TIME_SysTime_t *TimeA,
+                            CFE_TIME_SysTime_t TimeB, uint32 Count)
+{
+    uint32 Subseconds;
+    uint32 i;
+
+    for (i = 0; i < Count; i++)
+    {
+        Subseconds = TimeA[i].Subseconds - TimeB.Subseconds;
+
+        Result[i].Seconds = TimeA[i].Seconds - TimeB.Seconds - (uint32)(Subseconds > TimeA[i].Subseconds);
+        Result[i].Subseconds = Subseconds;
+    }
+
+} /* End of CFE_TIME_SubtractArray() */
+
+
+/*
+ * Function: CFE_TIME_CompareArray - See API and header file for details
+ */
+void CFE_TIME_CompareArray(CFE_TIME_Compare_t *Result, const CFE_TIME_SysTime_t *TimeA,
+                           CFE_TIME_SysTime_t TimeB, uint32 Count)
+{
+    uint32 Difference;
+    uint32 GreaterThan;
+    uint32 LessThan;
+    uint32 i;
+
+    /*
+    ** Same roll-over rule as CFE_TIME_Compare, expressed on the modulo 2^32
+    **    difference of the seconds: below CFE_TIME_NEGATIVE means A is later,
+    **    above means A is earlier, exactly CFE_TIME_NEGATIVE apart is decided
+    **    by the plain seconds comparison and zero by the subseconds.  The
+    **    cases are combined arithmetically so the loop has no branches...
+    */
+    for (i = 0; i < Count; i++)
+    {
+        Difference = TimeA[i].Seconds - TimeB.Seconds;
+
+        GreaterThan = ((Difference != 0) & (Difference < CFE_TIME_NEGATIVE)) |
+                      ((Difference == CFE_TIME_NEGATIVE) & (TimeA[i].Seconds > TimeB.Seconds)) |
+                      ((Difference == 0) & (TimeA[i].Subseconds > TimeB.Subseconds));
+        LessThan    = (Difference > CFE_TIME_NEGATIVE) |
+                      ((Difference == CFE_TIME_NEGATIVE) & (TimeA[i].Seconds < TimeB.Seconds)) |
+                      ((Difference == 0) & (TimeA[i].Subseconds < TimeB.Subseconds));
+
+        Result[i] = (CFE_TIME_Compare_t)((int32)GreaterThan - (int32)LessThan);
+    }
+
+} /* End of CFE_TIME_CompareArray() */
+
+
 /*
  * Function: CFE_TIME_Sub2MicroSecs - See API and header file for details
  */
@@ -600,6 +650,62 @@ uint32  CFE_TIME_Micro2SubSecs(uint32 MicroSeconds)
 
 } /* End of CFE_TIME_Micro2SubSecs() */
 
+
+/*
+ * Function: CFE_TIME_Sub2MicroSecsArray - See API and header file for details
+ */
+void CFE_TIME_Sub2MicroSecsArray(uint32 *MicroSeconds, const uint32 *SubSeconds, uint32 Count)
+{
+    uint32 Micros;
+    uint32 Subs;
+    uint32 i;
+
+    /*
+    ** Same conversion and rounding as CFE_TIME_Sub2MicroSecs, with each
+    **    adjustment applied as a 0/1 comparison result so the loop
+    **    vectorizes.  Values above 0xffffdf00 are converted too, then
+    **    replaced by the 999999 limit...
+    */
+    for (i = 0; i < Count; i++)
+    {
+        Subs = SubSeconds[i];
+
+        Micros = (((((Subs >> 7) * 125) >> 7) * 125) >> 12);
+        Micros += (uint32)((Subs & 0x3ffffff) != 0);
+        Micros -= (uint32)(Micros > 500000);
+
+        MicroSeconds[i] = (Subs > 0xffffdf00) ? 999999 : Micros;
+    }
+
+} /* End of CFE_TIME_Sub2MicroSecsArray() */
+
+
+/*
+ * Function: CFE_TIME_Micro2SubSecsArray - See API and header file for details
+ */
+void CFE_TIME_Micro2SubSecsArray(uint32 *SubSeconds, const uint32 *MicroSeconds, uint32 Count)
+{
+    uint32 Micros;
+    uint32 Subs;
+    uint32 i;
+
+    /*
+    ** Same conversion and half-way "bump" as CFE_TIME_Micro2SubSecs.  The
+    **    divisions are by constants, which the compiler turns into
+    **    multiplications, and out of range values are replaced afterwards...
+    */
+    for (i = 0; i < Count; i++)
+    {
+        Micros = MicroSeconds[i];
+
+        Subs = ( ( ( ( Micros << 11 ) / 5 ) << 3 ) / 3125 ) << 12;
+        Subs += (uint32)(Subs > 0x80001000) << 12;
+
+        SubSeconds[i] = (Micros > 999999) ? 0xFFFFFFFF : Subs;
+    }
+
+} /* End of CFE_TIME_Micro2SubSecsArray() */
+
 #ifndef CFE_OMIT_DEPRECATED_6_7
 /*
  * Function: CFE_TIME_CFE2FSSeconds - See API and header file for details
@@ -660,6 +766,19 @@ uint32 CFE_TIME_FS2CFESeconds(uint32 SecondsFS)
 } /* End of CFE_TIME_FS2CFESeconds() */
 #endif /* CFE_OMIT_DEPRECATED_6_7 */
 
+/*
+ * Function: CFE_TIME_DaysBeforeYear
+ *
+ * Number of days from the start of Gregorian year 0 to the start of the
+ * given year, counting year 0 and every later leap year before it.
+ */
+static inline uint32 CFE_TIME_DaysBeforeYear(uint32 Year)
+{
+    return (Year * 365) + ((Year + 3) / 4) - ((Year + 99) / 100) + ((Year + 399) / 400);
+
+} /* End of CFE_TIME_DaysBeforeYear() */
+
+
 /*
  * Function: CFE_TIME_Print - See API and header file for details
  */
@@ -671,9 +790,6 @@ void CFE_TIME_Print(char *PrintBuffer, CFE_TIME_SysTime_t TimeToPrint)
     uint32 NumberOfMinutes;
     uint32 NumberOfSeconds;
     uint32 NumberOfMicros;
-    uint32 DaysInThisYear;
-
-    bool StillCountingYears = true;
 
     /*
     ** Convert the cFE time (offset from epoch) into calendar time...
@@ -686,11 +802,8 @@ void CFE_TIME_Print(char *PrintBuffer, CFE_TIME_SysTime_t TimeToPrint)
     **    overflow problems when the input time value (seconds) is
     **    at, or near, 0xFFFFFFFF...
     */
-    while (NumberOfSeconds >= 60)
-    {
-        NumberOfMinutes++;
-        NumberOfSeconds -= 60;
-    }
+    NumberOfMinutes += (NumberOfSeconds / 60);
+    NumberOfSeconds  = (NumberOfSeconds % 60);
 
     /*
     ** Compute the years/days/hours/minutes...
@@ -704,50 +817,25 @@ void CFE_TIME_Print(char *PrintBuffer, CFE_TIME_SysTime_t TimeToPrint)
     NumberOfDays  = (NumberOfHours / 24) + (CFE_MISSION_TIME_EPOCH_DAY - 1);
     NumberOfHours = (NumberOfHours % 24);
 
-    NumberOfYears = CFE_MISSION_TIME_EPOCH_YEAR;
-
     /*
-    ** Convert total number of days into years and remainder days...
+    ** Convert total number of days into years and remainder days.  Counting
+    **    days from the start of year 0 of the Gregorian calendar, the year is
+    **    estimated from the average year length (146097 days every 400 years),
+    **    which is never off by more than one, then corrected...
     */
-    while (StillCountingYears)
-    {
-        /*
-        ** Set number of days in this year (leap year?)...
-        */
-        DaysInThisYear = 365;
-
-        if ((NumberOfYears % 4) == 0)
-        {
-            if ((NumberOfYears % 100) != 0)
-            {
-                DaysInThisYear = 366;
-            }
-            else if ((NumberOfYears % 400) == 0)
-            {
-                DaysInThisYear = 366;
-            }
-            else
-            {
-                /* Do Nothing. Non-leap year. */ 
-            }
-        }
+    NumberOfDays += CFE_TIME_DaysBeforeYear(CFE_MISSION_TIME_EPOCH_YEAR);
+    NumberOfYears = (NumberOfDays * 400) / 146097;
 
-        /*
-        ** When we have less than a years worth of days, we're done...
-        */
-        if (NumberOfDays < DaysInThisYear)
-        {
-            StillCountingYears = false;
-        }
-        else
-        {
-            /*
-            ** Add a year and remove the number of days in that year...
-            */
-            NumberOfYears++;
-            NumberOfDays -= DaysInThisYear;
-        }
+    if (CFE_TIME_DaysBeforeYear(NumberOfYears + 1) <= NumberOfDays)
+    {
+        NumberOfYears++;
     }
+    else if (CFE_TIME_DaysBeforeYear(NumberOfYears) > NumberOfDays)
+    {
+        NumberOfYears--;
+    }
+
+    NumberOfDays -= CFE_TIME_DaysBeforeYear(NumberOfYears);
 
     /*
     ** Unlike hours and minutes, days are displayed as Jan 1 = day 1...
@@ -870,6 +958,64 @@ int32  CFE_TIME_UnregisterSynchCallback(CFE_TIME_SynchCallbackPtr_t CallbackFunc
 } /* End of CFE_TIME_UnregisterSynchCallback() */
 
 
+/*
+ * Function: CFE_TIME_RegisterMinorFrameCallback - See API and header file for details
+ */
+int32  CFE_TIME_RegisterMinorFrameCallback(CFE_TIME_MinorFrameCallbackPtr_t CallbackFuncPtr)
+{
+    int32  Status;
+    uint32 AppId;
+
+    Status = CFE_ES_GetAppID(&AppId);
+    if (Status != CFE_SUCCESS)
+    {
+        /* Called from an invalid context */
+        return Status;
+    }
+
+    if (AppId >= (sizeof(CFE_TIME_TaskData.MinorFrameCallback) / sizeof(CFE_TIME_TaskData.MinorFrameCallback[0])) ||
+        CFE_TIME_TaskData.MinorFrameCallback[AppId].Ptr != NULL)
+    {
+        Status = CFE_TIME_TOO_MANY_SYNCH_CALLBACKS;
+    }
+    else
+    {
+        CFE_TIME_TaskData.MinorFrameCallback[AppId].Ptr = CallbackFuncPtr;
+    }
+
+    return Status;
+} /* End of CFE_TIME_RegisterMinorFrameCallback() */
+
+
+/*
+ * Function: CFE_TIME_UnregisterMinorFrameCallback - See API and header file for details
+ */
+int32  CFE_TIME_UnregisterMinorFrameCallback(CFE_TIME_MinorFrameCallbackPtr_t CallbackFuncPtr)
+{
+    int32  Status;
+    uint32 AppId;
+
+    Status = CFE_ES_GetAppID(&AppId);
+    if (Status != CFE_SUCCESS)
+    {
+        /* Called from an invalid context */
+        return Status;
+    }
+
+    if (AppId >= (sizeof(CFE_TIME_TaskData.MinorFrameCallback) / sizeof(CFE_TIME_TaskData.MinorFrameCallback[0])) ||
+            CFE_TIME_TaskData.MinorFrameCallback[AppId].Ptr != CallbackFuncPtr)
+    {
+        Status = CFE_TIME_CALLBACK_NOT_REGISTERED;
+    }
+    else
+    {
+        CFE_TIME_TaskData.MinorFrameCallback[AppId].Ptr = NULL;
+    }
+
+    return Status;
+} /* End of CFE_TIME_UnregisterMinorFrameCallback() */
+
+
 /*
  * Function: CFE_TIME_ExternalMET - See API and header file for details
  */
@@ -410,6 +410,11 @@ int32 CFE_TIME_TaskInit(void)
         }
     }
 
+    /*
+    ** Start the minor frame timebase, if configured...
+    */
+    CFE_TIME_MinorFrameInit();
+
 
     return CFE_SUCCESS;
 
@@ -854,6 +859,8 @@ int32 CFE_TIME_ResetCountersCmd(const CFE_TIME_ResetCounters_t *data)
     CFE_TIME_TaskData.LocalIntCounter   = 0;
     CFE_TIME_TaskData.LocalTaskCounter  = 0;
 
+    CFE_TIME_ResetMinorFrameStats();
+
     CFE_TIME_TaskData.InternalCount   = 0;
     CFE_TIME_TaskData.ExternalCount   = 0;
 
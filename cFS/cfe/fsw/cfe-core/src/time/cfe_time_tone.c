@@ -1137,6 +1137,11 @@ void CFE_TIME_Tone1HzISR(void)
         */
         CFE_TIME_TaskData.IsToneGood = true;
 
+        /*
+        ** Start a new major frame at the next minor frame...
+        */
+        CFE_TIME_TaskData.MinorFrameToneSeen = true;
+
         /*
         ** Maintain virtual MET as count of valid tone signal interrupts...
         **   (not set to zero by reset command)
@@ -1486,6 +1491,212 @@ void CFE_TIME_NotifyTimeSynchApps(void)
     return;
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CFE_TIME_MinorFrameInit() -- Start the minor frame timebase     */
+/*                                                                 */
+/* Minor frames are timed by a timebase of their own, rather than  */
+/* the PSP "cFS-Master" timebase, whose period is typically too    */
+/* long.  OSAL runs timebase callbacks at elevated priority.       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void CFE_TIME_MinorFrameInit(void)
+{
+#if (CFE_PLATFORM_TIME_CFG_MINOR_FRAMES > 0)
+    int32  Status;
+    uint32 Period = 1000000 / CFE_PLATFORM_TIME_CFG_MINOR_FRAMES;
+
+    Status = OS_TimeBaseCreate(&CFE_TIME_TaskData.MinorFrameTimeBaseId, CFE_TIME_MINOR_FRAME_NAME, NULL);
+    if (Status != OS_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("TIME:Minor frame OS_TimeBaseCreate failed:RC=0x%08X\n",(unsigned int)Status);
+        return;
+    }
+
+    Status = OS_TimerAdd(&CFE_TIME_TaskData.MinorFrameTimerId, CFE_TIME_MINOR_FRAME_NAME,
+                         CFE_TIME_TaskData.MinorFrameTimeBaseId, CFE_TIME_MinorFrameTimerCallback, NULL);
+    if (Status == OS_SUCCESS)
+    {
+        Status = OS_TimerSet(CFE_TIME_TaskData.MinorFrameTimerId, Period, Period);
+    }
+
+    if (Status != OS_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("TIME:Minor frame timer setup failed:RC=0x%08X\n",(unsigned int)Status);
+        return;
+    }
+
+    /*
+    ** Enable minor frame processing before the timebase starts ticking...
+    */
+    CFE_TIME_TaskData.MinorFramePeriod = Period;
+
+    Status = OS_TimeBaseSet(CFE_TIME_TaskData.MinorFrameTimeBaseId, Period, Period);
+    if (Status != OS_SUCCESS)
+    {
+        CFE_TIME_TaskData.MinorFramePeriod = 0;
+        CFE_ES_WriteToSysLog("TIME:Minor frame OS_TimeBaseSet failed:RC=0x%08X\n",(unsigned int)Status);
+    }
+#endif
+
+    return;
+
+} /* End of CFE_TIME_MinorFrameInit() */
+
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CFE_TIME_MinorFrameTimerCallback() -- Minor frame callback      */
+/*                                                                 */
+/* This is a wrapper around CFE_TIME_MinorFrameISR that conforms   */
+/* to the prototype of an OSAL Timer callback routine.             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void CFE_TIME_MinorFrameTimerCallback(uint32 TimerId, void *Arg)
+{
+    CFE_TIME_MinorFrameISR();
+}
+
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CFE_TIME_MinorFrameISR() -- Start of a minor frame              */
+/*                                                                 */
+/* Measures the time since the previous minor frame against the    */
+/* nominal period, advances the minor frame number, and calls the  */
+/* registered minor frame callbacks.  Minor frame zero is the      */
+/* first one after each valid tone.                                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void CFE_TIME_MinorFrameISR(void)
+{
+    CFE_TIME_SysTime_t Latch;
+    CFE_TIME_SysTime_t Elapsed;
+    CFE_TIME_MinorFrameCallbackPtr_t Func;
+    uint32 Period = CFE_TIME_TaskData.MinorFramePeriod;
+    uint32 ElapsedMicros;
+    uint32 Frames = 1;
+    int32  Jitter;
+    uint32 i;
+
+    if (Period == 0)
+    {
+        return;
+    }
+
+    Latch = CFE_TIME_LatchClock();
+
+    if (CFE_TIME_TaskData.MinorFrameLatchValid)
+    {
+        if (CFE_TIME_Compare(Latch, CFE_TIME_TaskData.MinorFrameLatch) == CFE_TIME_A_LT_B)
+        {
+            /*
+            ** Local clock has rolled over...
+            */
+            Elapsed = CFE_TIME_Subtract(CFE_TIME_TaskData.MaxLocalClock,
+                                        CFE_TIME_TaskData.MinorFrameLatch);
+            Elapsed = CFE_TIME_Add(Elapsed, Latch);
+        }
+        else
+        {
+            Elapsed = CFE_TIME_Subtract(Latch, CFE_TIME_TaskData.MinorFrameLatch);
+        }
+
+        /*
+        ** Ignore gaps too long to express in micro-seconds (clock was set).
+        **    Sub-seconds are rounded to the nearest micro-second, rather
+        **    than up as CFE_TIME_Sub2MicroSecs does, so that exact periods
+        **    show no jitter...
+        */
+        if (Elapsed.Seconds < 4000)
+        {
+            ElapsedMicros = (Elapsed.Seconds * 1000000) +
+                    (uint32)((((uint64)Elapsed.Subseconds * 1000000) + 0x80000000) >> 32);
+
+            /*
+            ** A late tick stands in for every minor frame it was late by...
+            */
+            Frames = (ElapsedMicros + (Period / 2)) / Period;
+            if (Frames == 0)
+            {
+                Frames = 1;
+            }
+
+            Jitter = (int32)(ElapsedMicros - (Frames * Period));
+
+            CFE_TIME_TaskData.MinorFrameSlipCounter += Frames - 1;
+            CFE_TIME_TaskData.MinorFrameJitterLast = Jitter;
+
+            /*
+            ** The first sample after a reset sets both limits...
+            */
+            if ((!CFE_TIME_TaskData.MinorFrameJitterValid) ||
+                (Jitter < CFE_TIME_TaskData.MinorFrameJitterMin))
+            {
+                CFE_TIME_TaskData.MinorFrameJitterMin = Jitter;
+            }
+
+            if ((!CFE_TIME_TaskData.MinorFrameJitterValid) ||
+                (Jitter > CFE_TIME_TaskData.MinorFrameJitterMax))
+            {
+                CFE_TIME_TaskData.MinorFrameJitterMax = Jitter;
+            }
+
+            CFE_TIME_TaskData.MinorFrameJitterValid = true;
+        }
+    }
+
+    CFE_TIME_TaskData.MinorFrameLatch = Latch;
+    CFE_TIME_TaskData.MinorFrameLatchValid = true;
+    CFE_TIME_TaskData.MinorFrameCounter++;
+
+    if (CFE_TIME_TaskData.MinorFrameToneSeen)
+    {
+        CFE_TIME_TaskData.MinorFrameToneSeen = false;
+        CFE_TIME_TaskData.MinorFrame = 0;
+    }
+    else
+    {
+        CFE_TIME_TaskData.MinorFrame = (CFE_TIME_TaskData.MinorFrame + Frames) % (1000000 / Period);
+    }
+
+    for (i=0; i < (sizeof(CFE_TIME_TaskData.MinorFrameCallback) / sizeof(CFE_TIME_TaskData.MinorFrameCallback[0])); ++i)
+    {
+        /* Read the global pointer only once, as for the synch callbacks */
+        Func = CFE_TIME_TaskData.MinorFrameCallback[i].Ptr;
+        if (Func != NULL)
+        {
+            Func(CFE_TIME_TaskData.MinorFrame);
+        }
+    }
+
+    return;
+
+} /* End of CFE_TIME_MinorFrameISR() */
+
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CFE_TIME_ResetMinorFrameStats() -- Clear minor frame statistics */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void CFE_TIME_ResetMinorFrameStats(void)
+{
+    CFE_TIME_TaskData.MinorFrameCounter     = 0;
+    CFE_TIME_TaskData.MinorFrameSlipCounter = 0;
+    CFE_TIME_TaskData.MinorFrameJitterLast  = 0;
+    CFE_TIME_TaskData.MinorFrameJitterMin   = 0;
+    CFE_TIME_TaskData.MinorFrameJitterMax   = 0;
+    CFE_TIME_TaskData.MinorFrameJitterValid = false;
+
+    return;
+
+} /* End of CFE_TIME_ResetMinorFrameStats() */
+
 /************************/
 /*  End of File Comment */
 /************************/
@@ -385,6 +385,20 @@ void CFE_TIME_InitData(void)
         CFE_TIME_TaskData.SynchCallback[i].Ptr = NULL;
     }
 
+    /*
+    ** Minor frames are enabled when (and if) the timebase is started...
+    */
+    CFE_TIME_TaskData.MinorFramePeriod = 0;
+    CFE_TIME_TaskData.MinorFrame = 0;
+    CFE_TIME_TaskData.MinorFrameLatchValid = false;
+    CFE_TIME_TaskData.MinorFrameToneSeen = false;
+    CFE_TIME_ResetMinorFrameStats();
+
+    for (i=0; i < (sizeof(CFE_TIME_TaskData.MinorFrameCallback) / sizeof(CFE_TIME_TaskData.MinorFrameCallback[0])); ++i)
+    {
+        CFE_TIME_TaskData.MinorFrameCallback[i].Ptr = NULL;
+    }
+
     /*
     ** Initialize housekeeping packet (clear user data area)...
     */
@@ -581,6 +595,11 @@ void CFE_TIME_GetDiagData(void)
             CFE_TIME_TaskData.LastVersionCounter - CFE_TIME_TaskData.ResetVersionCounter;
     CFE_TIME_TaskData.DiagPacket.Payload.LocalIntCounter   = CFE_TIME_TaskData.LocalIntCounter;
     CFE_TIME_TaskData.DiagPacket.Payload.LocalTaskCounter  = CFE_TIME_TaskData.LocalTaskCounter;
+    CFE_TIME_TaskData.DiagPacket.Payload.MinorFrameCounter     = CFE_TIME_TaskData.MinorFrameCounter;
+    CFE_TIME_TaskData.DiagPacket.Payload.MinorFrameSlipCounter = CFE_TIME_TaskData.MinorFrameSlipCounter;
+    CFE_TIME_TaskData.DiagPacket.Payload.MinorFrameJitterLast  = CFE_TIME_TaskData.MinorFrameJitterLast;
+    CFE_TIME_TaskData.DiagPacket.Payload.MinorFrameJitterMin   = CFE_TIME_TaskData.MinorFrameJitterMin;
+    CFE_TIME_TaskData.DiagPacket.Payload.MinorFrameJitterMax   = CFE_TIME_TaskData.MinorFrameJitterMax;
 
     /*
     ** Miscellaneous counters (not subject to reset command)...
@@ -765,6 +784,73 @@ CFE_TIME_SysTime_t CFE_TIME_CalculateUTC(const CFE_TIME_Reference_t *Reference)
 } /* End of CFE_TIME_CalculateUTC() */
 
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CFE_TIME_CalculateCurrent() -- current TAI or UTC (fast path)   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+CFE_TIME_SysTime_t CFE_TIME_CalculateCurrent(bool AsUTC)
+{
+    CFE_TIME_SysTime_t CurrentLatch;
+    CFE_TIME_SysTime_t AtToneLatch;
+    uint64 LatchToTime;
+    uint64 CurrentTime;
+    uint32 VersionCounter;
+    uint32 RetryCount = 4;
+    uint32 SecondsSinceTone;
+    bool   RolledOver;
+    volatile CFE_TIME_ReferenceState_t *RefState;
+
+    /*
+    ** Same version counter protocol as CFE_TIME_GetReference(), but only
+    ** the latch at the tone and the precomputed offset need to be read...
+    */
+    while (true)
+    {
+        VersionCounter = CFE_TIME_TaskData.LastVersionCounter;
+        RefState = &CFE_TIME_TaskData.ReferenceState[VersionCounter & CFE_TIME_REFERENCE_BUF_MASK];
+
+        CurrentLatch = CFE_TIME_LatchClock();
+
+        AtToneLatch = RefState->AtToneLatch;
+        LatchToTime = AsUTC ? RefState->LatchToUTC : RefState->LatchToTAI;
+
+        if (VersionCounter == RefState->StateVersion || RetryCount == 0)
+        {
+            break;
+        }
+
+        --RetryCount;
+    }
+
+    CurrentTime = CFE_TIME_SysTimeToFixed(CurrentLatch) + LatchToTime;
+
+    /*
+    ** Local clock has rolled over since last tone, by the same rule
+    ** CFE_TIME_Compare() applies...
+    */
+    SecondsSinceTone = CurrentLatch.Seconds - AtToneLatch.Seconds;
+    if (SecondsSinceTone == 0)
+    {
+        RolledOver = (CurrentLatch.Subseconds < AtToneLatch.Subseconds);
+    }
+    else
+    {
+        RolledOver = (SecondsSinceTone > CFE_TIME_NEGATIVE) ||
+                     (SecondsSinceTone == CFE_TIME_NEGATIVE && CurrentLatch.Seconds < AtToneLatch.Seconds);
+    }
+
+    if (RolledOver)
+    {
+        CurrentTime += CFE_TIME_SysTimeToFixed(CFE_TIME_TaskData.MaxLocalClock);
+    }
+
+    return CFE_TIME_FixedToSysTime(CurrentTime);
+
+} /* End of CFE_TIME_CalculateCurrent() */
+
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                         */
 /* CFE_TIME_CalculateState() -- determine current time state (per API)     */
@@ -1143,6 +1229,7 @@ int32 CFE_TIME_CleanUpApp(uint32 AppId)
     if (AppId < (sizeof(CFE_TIME_TaskData.SynchCallback) / sizeof(CFE_TIME_TaskData.SynchCallback[0])))
     {
         CFE_TIME_TaskData.SynchCallback[AppId].Ptr = NULL;
+        CFE_TIME_TaskData.MinorFrameCallback[AppId].Ptr = NULL;
         Status = CFE_SUCCESS;
     }
     else
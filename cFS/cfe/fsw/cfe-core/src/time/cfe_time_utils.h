@@ -73,6 +73,11 @@
 #define CFE_TIME_SEM_VALUE       0
 #define CFE_TIME_SEM_OPTIONS     0
 
+/*
+** Minor frame timebase definitions...
+*/
+#define CFE_TIME_MINOR_FRAME_NAME   "cFS-MinorFrame"
+
 /*
 ** Main Task Pipe definitions...
 */
@@ -138,6 +143,14 @@ typedef struct
   volatile CFE_TIME_SynchCallbackPtr_t    Ptr;  /**< \brief Pointer to Callback function */
 } CFE_TIME_SynchCallbackRegEntry_t;
 
+/*
+** Time Minor Frame Callback Registry Information
+*/
+typedef struct
+{
+  volatile CFE_TIME_MinorFrameCallbackPtr_t Ptr;  /**< \brief Pointer to Callback function */
+} CFE_TIME_MinorFrameCallbackRegEntry_t;
+
 /*
 ** Data values used to compute time (in reference to "tone")...
 **
@@ -159,6 +172,15 @@ typedef struct
     CFE_TIME_SysTime_t    AtToneDelay;
     CFE_TIME_SysTime_t    AtToneLatch;
 
+    /*
+    ** Derived from the values above when the update is published (see
+    ** CFE_TIME_FinishReferenceUpdate), so the current time is just the
+    ** local clock latch plus a constant.  Both are 32.32 fixed point,
+    ** seconds in the upper word...
+    */
+    uint64                LatchToTAI;
+    uint64                LatchToUTC;
+
 } CFE_TIME_ReferenceState_t;
 
 /*************************************************************************/
@@ -331,6 +353,30 @@ typedef struct
   */
   CFE_TIME_SynchCallbackRegEntry_t SynchCallback[CFE_PLATFORM_ES_MAX_APPLICATIONS];
 
+  /*
+  ** Minor frame scheduling...
+  **   (MinorFramePeriod is zero if minor frames are not configured)
+  */
+  uint32                MinorFrameTimeBaseId;
+  uint32                MinorFrameTimerId;
+  uint32                MinorFramePeriod;       /* Nominal minor frame length in micro-seconds */
+  uint32                MinorFrame;             /* Current minor frame within the second */
+  uint32                MinorFrameCounter;
+  uint32                MinorFrameSlipCounter;
+  int32                 MinorFrameJitterLast;
+  int32                 MinorFrameJitterMin;
+  int32                 MinorFrameJitterMax;
+  bool                  MinorFrameJitterValid;  /* Min and max hold at least one sample */
+  CFE_TIME_SysTime_t    MinorFrameLatch;        /* Local clock at the previous minor frame */
+  bool                  MinorFrameLatchValid;
+  volatile bool         MinorFrameToneSeen;     /* Valid tone since the previous minor frame */
+
+  /*
+  ** Minor Frame Callback Registry
+  ** One callback per app is allowed
+  */
+  CFE_TIME_MinorFrameCallbackRegEntry_t MinorFrameCallback[CFE_PLATFORM_ES_MAX_APPLICATIONS];
+
 } CFE_TIME_TaskData_t;
 
 /*
@@ -366,6 +412,7 @@ void CFE_TIME_GetReference(CFE_TIME_Reference_t *Reference);
 */
 CFE_TIME_SysTime_t CFE_TIME_CalculateTAI(const CFE_TIME_Reference_t *Reference);
 CFE_TIME_SysTime_t CFE_TIME_CalculateUTC(const CFE_TIME_Reference_t *Reference);
+CFE_TIME_SysTime_t CFE_TIME_CalculateCurrent(bool AsUTC);
 
 int16 CFE_TIME_CalculateState(const CFE_TIME_Reference_t *Reference);
 
@@ -422,12 +469,57 @@ int32 CFE_TIME_ToneSendTime(CFE_TIME_SysTime_t NewTime);
  */
 volatile CFE_TIME_ReferenceState_t *CFE_TIME_StartReferenceUpdate(void);
 
+/*
+ * Helpers for the 32.32 fixed point form of a time value, in which
+ * CFE_TIME_Add() and CFE_TIME_Subtract() are plain integer arithmetic
+ */
+static inline uint64 CFE_TIME_SysTimeToFixed(CFE_TIME_SysTime_t Time)
+{
+    return ((uint64)Time.Seconds << 32) | Time.Subseconds;
+}
+
+static inline CFE_TIME_SysTime_t CFE_TIME_FixedToSysTime(uint64 Fixed)
+{
+    CFE_TIME_SysTime_t Time;
+
+    Time.Seconds    = (uint32)(Fixed >> 32);
+    Time.Subseconds = (uint32)Fixed;
+
+    return Time;
+}
+
 /*
  * Helper function for updating the "Reference" value
  * This is the local replacement for "OS_IntUnlock()"
  */
 static inline void CFE_TIME_FinishReferenceUpdate(volatile CFE_TIME_ReferenceState_t *NextState)
 {
+    uint64 LatchToTAI;
+
+    /*
+    ** TAI = (Latch - AtToneLatch) + AtToneMET [+/- AtToneDelay] + AtToneSTCF.
+    ** The CFE_TIME_Add/Subtract arithmetic this replaces is modulo 2^64 on
+    ** the combined seconds:subseconds value, so folding every term except
+    ** the latch into one constant gives bit identical results...
+    */
+    LatchToTAI = CFE_TIME_SysTimeToFixed(NextState->AtToneMET) +
+                 CFE_TIME_SysTimeToFixed(NextState->AtToneSTCF) -
+                 CFE_TIME_SysTimeToFixed(NextState->AtToneLatch);
+
+    #if (CFE_PLATFORM_TIME_CFG_CLIENT == true)
+    if (NextState->DelayDirection == CFE_TIME_AdjustDirection_ADD)
+    {
+        LatchToTAI += CFE_TIME_SysTimeToFixed(NextState->AtToneDelay);
+    }
+    else
+    {
+        LatchToTAI -= CFE_TIME_SysTimeToFixed(NextState->AtToneDelay);
+    }
+    #endif
+
+    NextState->LatchToTAI = LatchToTAI;
+    NextState->LatchToUTC = LatchToTAI - ((uint64)(uint32)(int32)NextState->AtToneLeapSeconds << 32);
+
     CFE_TIME_TaskData.LastVersionCounter = NextState->StateVersion;
 }
 
@@ -464,6 +556,14 @@ void CFE_TIME_Local1HzTask(void);
 void CFE_TIME_Local1HzStateMachine(void);
 void CFE_TIME_Local1HzTimerCallback(uint32 TimerId, void *Arg);
 
+/*
+** Function prototypes (minor frame timebase)...
+*/
+void CFE_TIME_MinorFrameInit(void);
+void CFE_TIME_MinorFrameTimerCallback(uint32 TimerId, void *Arg);
+void CFE_TIME_MinorFrameISR(void);
+void CFE_TIME_ResetMinorFrameStats(void);
+
 
 #endif /* _cfe_time_utils_ */
 
@@ -150,6 +150,17 @@
   #endif
 #endif
 
+/*
+** Validate minor frame scheduling...
+*/
+#if CFE_PLATFORM_TIME_CFG_MINOR_FRAMES < 0
+    #error CFE_PLATFORM_TIME_CFG_MINOR_FRAMES must be greater than or equal to zero
+#elif CFE_PLATFORM_TIME_CFG_MINOR_FRAMES > 0
+  #if (1000000 % CFE_PLATFORM_TIME_CFG_MINOR_FRAMES) != 0
+    #error CFE_PLATFORM_TIME_CFG_MINOR_FRAMES must divide 1000000 evenly
+  #endif
+#endif
+
 /*
 ** Validate task priorities...
 */
@@ -185,11 +185,16 @@ static const UT_TaskPipeDispatchId_t  UT_TPID_CFE_ES_CMD_DUMP_CDS_REGISTRY_CC =
         .MsgId = CFE_SB_MSGID_WRAP_VALUE(CFE_ES_CMD_MID),
         .CommandCode = CFE_ES_DUMP_CDS_REGISTRY_CC
 };
+static const UT_TaskPipeDispatchId_t  UT_TPID_CFE_ES_CMD_SET_TASK_UTIL_PERIOD_CC =
+{
+        .MsgId = CFE_SB_MSGID_WRAP_VALUE(CFE_ES_CMD_MID),
+        .CommandCode = CFE_ES_SET_TASK_UTIL_PERIOD_CC
+};
 
 static const UT_TaskPipeDispatchId_t  UT_TPID_CFE_ES_CMD_INVALID_CC =
 {
         .MsgId = CFE_SB_MSGID_WRAP_VALUE(CFE_ES_CMD_MID),
-        .CommandCode = CFE_ES_DUMP_CDS_REGISTRY_CC + 2
+        .CommandCode = CFE_ES_SET_TASK_UTIL_PERIOD_CC + 2
 };
 
 static const UT_TaskPipeDispatchId_t  UT_TPID_CFE_ES_SEND_HK =
@@ -931,7 +936,8 @@ void TestApps(void)
                               "AppName",
                               170,
                               4096,
-                              1);
+                              1,
+                              0);
     UT_Report(__FILE__, __LINE__,
               Return == CFE_ES_ERR_APP_CREATE &&
               UT_PrintfIsInHistory(UT_OSP_MESSAGES[UT_OSP_APP_CREATE]),
@@ -946,7 +952,8 @@ void TestApps(void)
                               "AppName",
                               170,
                               4096,
-                              1);
+                              1,
+                              0);
     UT_Report(__FILE__, __LINE__,
               Return == CFE_ES_ERR_APP_CREATE,
               "CFE_ES_AppCreate",
@@ -960,7 +967,8 @@ void TestApps(void)
                               "AppName",
                               170,
                               8192,
-                              1);
+                              1,
+                              0);
     UT_Report(__FILE__, __LINE__,
               Return == CFE_SUCCESS,
               "CFE_ES_AppCreate",
@@ -975,7 +983,8 @@ void TestApps(void)
                               "AppName",
                               170,
                               8192,
-                              1);
+                              1,
+                              0);
     UT_Report(__FILE__, __LINE__,
               Return == CFE_ES_ERR_APP_CREATE &&
                 UT_PrintfIsInHistory(UT_OSP_MESSAGES[UT_OSP_EXTRACT_FILENAME_UT55]),
@@ -996,7 +1005,8 @@ void TestApps(void)
                               "AppName",
                               170,
                               8192,
-                              1);
+                              1,
+                              0);
     UT_Report(__FILE__, __LINE__,
               Return == CFE_ES_ERR_APP_CREATE &&
                 UT_PrintfIsInHistory(UT_OSP_MESSAGES[UT_OSP_NO_FREE_APP_SLOTS]),
@@ -1014,7 +1024,8 @@ void TestApps(void)
                               "AppName",
                               170,
                               8192,
-                              1);
+                              1,
+                              0);
     UT_Report(__FILE__, __LINE__,
               Return == CFE_ES_ERR_APP_CREATE &&
               UT_PrintfIsInHistory(UT_OSP_MESSAGES[UT_OSP_CANNOT_FIND_SYMBOL]),
@@ -1034,7 +1045,8 @@ void TestApps(void)
                               "AppName",
                               170,
                               8192,
-                              1);
+                              1,
+                              0);
     UT_Report(__FILE__, __LINE__,
               Return == CFE_ES_ERR_APP_CREATE &&
               UT_PrintfIsInHistory(UT_OSP_MESSAGES[UT_OSP_CANNOT_FIND_SYMBOL]) &&
@@ -1796,6 +1808,30 @@ void TestApps(void)
                   "CFE application; restart application on exception");
     }
 
+    /* Test parsing the startup script for a cFE application with the
+     * optional CPU affinity column
+     */
+    ES_ResetUnitTest();
+    {
+        const char *TokenList[] =
+        {
+                "CFE_APP",
+                "/cf/apps/tst_lib.bundle",
+                "TST_LIB_Init",
+                "TST_LIB",
+                "0",
+                "0",
+                "0x0",
+                "0",
+                "0x6"
+        };
+        UT_Report(__FILE__, __LINE__,
+                  CFE_ES_ParseFileEntry(TokenList, 9) == CFE_SUCCESS &&
+                  CFE_ES_Global.AppTable[0].StartParams.CpuAffinity == 0x6,
+                  "CFE_ES_ParseFileEntry",
+                  "CFE application; CPU affinity");
+    }
+
     /* Test scanning and acting on the application table where the timer
      * expires for a waiting application
      */
@@ -1940,6 +1976,55 @@ void TestApps(void)
               CFE_ES_CleanupTaskResources(TestObjId) == CFE_SUCCESS,
               "CFE_ES_CleanupTaskResources",
               "Get OS information failures");
+
+    /* Test that task utilization sampling stays idle while the period is zero */
+    ES_ResetUnitTest();
+    memset(&CFE_ES_TaskData.BackgroundTaskUtilState, 0, sizeof(CFE_ES_TaskData.BackgroundTaskUtilState));
+    UT_Report(__FILE__, __LINE__,
+              !CFE_ES_RunTaskUtilSample(1000, &CFE_ES_TaskData.BackgroundTaskUtilState) &&
+              UT_GetStubCount(UT_KEY(OS_TaskGetInfo)) == 0 &&
+              UT_GetStubCount(UT_KEY(CFE_SB_SendMsg)) == 0,
+              "CFE_ES_RunTaskUtilSample",
+              "Sampling disabled");
+
+    /* Test that the first sample only records the starting counters */
+    ES_ResetUnitTest();
+    OS_TaskCreate(&TestObjId, "UT", NULL, NULL, 0, 0, 0);
+    Id = ES_UT_OSALID_TO_ARRAYIDX(TestObjId);
+    CFE_ES_Global.TaskTable[Id].RecordUsed = true;
+    CFE_ES_Global.TaskTable[Id].TaskId = TestObjId;
+    CFE_ES_Global.TaskTable[Id].AppId = 1;
+    CFE_ES_TaskData.BackgroundTaskUtilState.SamplePeriod = 1000;
+    CFE_ES_TaskData.BackgroundTaskUtilState.NeedBaseline = true;
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_RunTaskUtilSample(0, &CFE_ES_TaskData.BackgroundTaskUtilState) &&
+              !CFE_ES_TaskData.BackgroundTaskUtilState.NeedBaseline &&
+              CFE_ES_TaskData.BackgroundTaskUtilState.SampleTimer == 1000 &&
+              CFE_ES_TaskData.BackgroundTaskUtilState.LastSample[Id].TaskId == TestObjId &&
+              UT_GetStubCount(UT_KEY(CFE_SB_SendMsg)) == 0,
+              "CFE_ES_RunTaskUtilSample",
+              "Baseline sample");
+
+    /* Test that no sample is taken before the period has elapsed */
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_RunTaskUtilSample(250, &CFE_ES_TaskData.BackgroundTaskUtilState) &&
+              CFE_ES_TaskData.BackgroundTaskUtilState.SampleTimer == 750 &&
+              UT_GetStubCount(UT_KEY(CFE_SB_SendMsg)) == 0,
+              "CFE_ES_RunTaskUtilSample",
+              "Sample not due");
+
+    /* Test sending the task utilization packet once the period has elapsed */
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_RunTaskUtilSample(750, &CFE_ES_TaskData.BackgroundTaskUtilState) &&
+              CFE_ES_TaskData.BackgroundTaskUtilState.SampleTimer == 1000 &&
+              CFE_ES_TaskData.TaskUtilPacket.Payload.NumTasks == 1 &&
+              CFE_ES_TaskData.TaskUtilPacket.Payload.Task[0].TaskId == TestObjId &&
+              CFE_ES_TaskData.TaskUtilPacket.Payload.Task[0].AppId == 1 &&
+              UT_GetStubCount(UT_KEY(CFE_SB_SendMsg)) == 1,
+              "CFE_ES_RunTaskUtilSample",
+              "Sample sent");
+    CFE_ES_Global.TaskTable[Id].RecordUsed = false;
+    CFE_ES_TaskData.BackgroundTaskUtilState.SamplePeriod = 0;
 }
 
 void TestERLog(void)
@@ -2011,6 +2096,7 @@ void TestTask(void)
         CFE_ES_SendMemPoolStats_t TlmPoolStatsCmd;
         CFE_ES_DumpCDSRegistry_t DumpCDSRegCmd;
         CFE_ES_QueryAllTasks_t   QueryAllTasksCmd;
+        CFE_ES_SetTaskUtilPeriod_t SetTaskUtilPeriodCmd;
     } CmdBuf;
     Pool_t                      UT_TestPool;
 
@@ -2956,6 +3042,35 @@ void TestTask(void)
               "CFE_ES_SetMaxPRCountCmd",
               "Set maximum processor reset count");
 
+    /* Test setting the task utilization sample period */
+    ES_ResetUnitTest();
+    memset(&CmdBuf, 0, sizeof(CmdBuf));
+    CFE_ES_TaskData.BackgroundTaskUtilState.SampleTimer = 500;
+    CFE_ES_TaskData.BackgroundTaskUtilState.NeedBaseline = false;
+    CmdBuf.SetTaskUtilPeriodCmd.Payload.SamplePeriod = 1000;
+    UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CFE_ES_SetTaskUtilPeriod_t),
+            UT_TPID_CFE_ES_CMD_SET_TASK_UTIL_PERIOD_CC);
+    UT_Report(__FILE__, __LINE__,
+              UT_EventIsInHistory(CFE_ES_TASK_UTIL_PERIOD_EID) &&
+              CFE_ES_TaskData.BackgroundTaskUtilState.SamplePeriod == 1000 &&
+              CFE_ES_TaskData.BackgroundTaskUtilState.SampleTimer == 0 &&
+              CFE_ES_TaskData.BackgroundTaskUtilState.NeedBaseline,
+              "CFE_ES_SetTaskUtilPeriodCmd",
+              "Set task utilization sample period");
+
+    /* Test setting a task utilization sample period that is too long */
+    ES_ResetUnitTest();
+    memset(&CmdBuf, 0, sizeof(CmdBuf));
+    CmdBuf.SetTaskUtilPeriodCmd.Payload.SamplePeriod = CFE_ES_TASK_UTIL_MAX_PERIOD + 1;
+    UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CFE_ES_SetTaskUtilPeriod_t),
+            UT_TPID_CFE_ES_CMD_SET_TASK_UTIL_PERIOD_CC);
+    UT_Report(__FILE__, __LINE__,
+              UT_EventIsInHistory(CFE_ES_TASK_UTIL_PERIOD_ERR_EID) &&
+              CFE_ES_TaskData.BackgroundTaskUtilState.SamplePeriod == 1000,
+              "CFE_ES_SetTaskUtilPeriodCmd",
+              "Task utilization sample period too long");
+    CFE_ES_TaskData.BackgroundTaskUtilState.SamplePeriod = 0;
+
     /* Test failed deletion of specified CDS */
     ES_ResetUnitTest();
     memset(&CmdBuf, 0, sizeof(CmdBuf));
@@ -2967,6 +3082,7 @@ void TestTask(void)
             sizeof(CFE_ES_Global.CDSVars.Registry[0].Name));
     CFE_ES_Global.CDSVars.Registry[0].Name[OS_MAX_API_NAME - 1] = '\0';
     CFE_ES_Global.CDSVars.Registry[0].Taken = true;
+    CFE_ES_InitCDSRegistryIndex();
     UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CFE_ES_DeleteCDS_t),
             UT_TPID_CFE_ES_CMD_DELETE_CDS_CC);
     UT_Report(__FILE__, __LINE__,
@@ -3017,6 +3133,7 @@ void TestTask(void)
     CFE_ES_Global.AppTable[0].StartParams.Name[OS_MAX_API_NAME - 1] = '\0';
     CFE_ES_Global.CDSVars.Registry[0].Table = false;
     CFE_ES_Global.CDSVars.Registry[0].Taken = true;
+    CFE_ES_InitCDSRegistryIndex();
     CFE_ES_Global.AppTable[0].AppState = CFE_ES_AppState_RUNNING;
     UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CFE_ES_DeleteCDS_t),
             UT_TPID_CFE_ES_CMD_DELETE_CDS_CC);
@@ -5299,6 +5416,7 @@ void TestCDS()
     strncpy(CFE_ES_Global.CDSVars.Registry[0].Name,
             "NO_APP.CDS_NAME", OS_MAX_API_NAME);
     CFE_ES_Global.CDSVars.Registry[0].Name[OS_MAX_API_NAME - 1] = '\0';
+    CFE_ES_InitCDSRegistryIndex();
     UT_SetDeferredRetcode(UT_KEY(CFE_PSP_WriteToCDS), 2, OS_ERROR);
     UT_Report(__FILE__, __LINE__,
               CFE_ES_DeleteCDS("NO_APP.CDS_NAME", true) == -1,
@@ -5315,6 +5433,7 @@ void TestCDS()
     strncpy(CFE_ES_Global.CDSVars.Registry[0].Name,
             "CFE_ES.CDS_NAME", OS_MAX_API_NAME);
     CFE_ES_Global.CDSVars.Registry[0].Name[OS_MAX_API_NAME - 1] = '\0';
+    CFE_ES_InitCDSRegistryIndex();
     strncpy((char *) CFE_ES_Global.AppTable[0].StartParams.Name, "CFE_ES",
             OS_MAX_API_NAME);
     CFE_ES_Global.AppTable[0].StartParams.Name[OS_MAX_API_NAME - 1] = '\0';
@@ -5373,6 +5492,7 @@ void TestCDS()
     CFE_ES_Global.CDSVars.Registry[0].Table = true;
     memset(CFE_ES_Global.CDSVars.Registry[0].Name, 'a', CFE_ES_CDS_MAX_FULL_NAME_LEN - 1);
     CFE_ES_Global.CDSVars.Registry[0].Name[CFE_ES_CDS_MAX_FULL_NAME_LEN - 1] = '\0';
+    CFE_ES_InitCDSRegistryIndex();
     UT_Report(__FILE__, __LINE__,
               CFE_ES_DeleteCDS(CFE_ES_Global.CDSVars.Registry[0].Name,
                                true) == CFE_ES_ERR_MEM_HANDLE,
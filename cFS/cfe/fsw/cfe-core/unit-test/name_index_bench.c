@@ -0,0 +1,229 @@
+/*
+**  GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**  Copyright (c) 2006-2019 United States Government as represented by
+**  the Administrator of the National Aeronautics and Space Administration.
+**  All Rights Reserved.
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**    http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+*/
+
+/*
+** File:
+**    name_index_bench.c
+**
+** Purpose:
+**    Registry name lookup benchmark
+**
+**    Compares the linear registry scan that the core registries used to
+**    perform against the hashed name index, for a registry much larger
+**    than any default platform configuration.  Every lookup result is
+**    checked against the linear scan, so this also serves as a test of
+**    the index under heavy insertion and removal.
+**
+** Notes:
+**    1. This is unit test code only, not for use in flight
+**
+*/
+
+#define _POSIX_C_SOURCE 200112L
+
+/*
+** Includes
+*/
+#include <stdio.h>
+#include <time.h>
+#include "common_types.h"
+#include "cfe_mission_cfg.h"
+#include "private/cfe_name_index.h"
+#include "utassert.h"
+#include "uttest.h"
+#include "utbsp.h"
+
+/*
+** Number of registry records, and number of passes over all names when timing
+*/
+#define NAME_BENCH_NUM_ENTRIES      1024
+#define NAME_BENCH_NUM_PASSES       20
+
+typedef struct
+{
+    bool    InUse;
+    char    Name[CFE_MISSION_TBL_MAX_FULL_NAME_LEN];
+} NameBench_RegRec_t;
+
+NameBench_RegRec_t      NameBench_Registry[NAME_BENCH_NUM_ENTRIES];
+CFE_NameIndex_t         NameBench_Index;
+CFE_NameIndex_Slot_t    NameBench_Slots[CFE_NAME_INDEX_SLOTS(NAME_BENCH_NUM_ENTRIES)];
+char                    NameBench_Missing[NAME_BENCH_NUM_ENTRIES][CFE_MISSION_TBL_MAX_FULL_NAME_LEN];
+
+/*
+** The lookup the registries performed before the name index
+*/
+int32 NameBench_LinearFind(const char *Name)
+{
+    int32 i;
+
+    for (i = 0; i < NAME_BENCH_NUM_ENTRIES; i++)
+    {
+        if (NameBench_Registry[i].InUse && strcmp(Name, NameBench_Registry[i].Name) == 0)
+        {
+            return i;
+        }
+    }
+
+    return CFE_NAME_INDEX_NOT_FOUND;
+}
+
+int32 NameBench_IndexFind(const char *Name)
+{
+    int32 i = CFE_NameIndex_Find(&NameBench_Index, Name);
+
+    if (i != CFE_NAME_INDEX_NOT_FOUND && !NameBench_Registry[i].InUse)
+    {
+        return CFE_NAME_INDEX_NOT_FOUND;
+    }
+
+    return i;
+}
+
+double NameBench_Now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((double)ts.tv_sec * 1e9) + (double)ts.tv_nsec;
+}
+
+/*
+** Times NAME_BENCH_NUM_PASSES lookups of every name in a list, returning ns per lookup
+*/
+double NameBench_Time(int32 (*FindFunc)(const char *), const char *Names, uint32 Stride)
+{
+    double  Start;
+    uint32  Pass;
+    uint32  i;
+
+    Start = NameBench_Now();
+
+    for (Pass = 0; Pass < NAME_BENCH_NUM_PASSES; Pass++)
+    {
+        for (i = 0; i < NAME_BENCH_NUM_ENTRIES; i++)
+        {
+            FindFunc(&Names[i * Stride]);
+        }
+    }
+
+    return (NameBench_Now() - Start) / (NAME_BENCH_NUM_PASSES * NAME_BENCH_NUM_ENTRIES);
+}
+
+/*
+** Counts the names in a list for which the index and the linear scan disagree
+*/
+uint32 NameBench_Verify(const char *Names, uint32 Stride)
+{
+    uint32  Mismatches = 0;
+    uint32  i;
+
+    for (i = 0; i < NAME_BENCH_NUM_ENTRIES; i++)
+    {
+        if (NameBench_IndexFind(&Names[i * Stride]) != NameBench_LinearFind(&Names[i * Stride]))
+        {
+            ++Mismatches;
+        }
+    }
+
+    return Mismatches;
+}
+
+void NameBench_Setup(void)
+{
+    uint32 i;
+
+    CFE_NameIndex_Init(&NameBench_Index, NameBench_Slots, CFE_NAME_INDEX_SLOTS(NAME_BENCH_NUM_ENTRIES));
+
+    /* Names share long prefixes, as real "App.Table" names do */
+    for (i = 0; i < NAME_BENCH_NUM_ENTRIES; i++)
+    {
+        snprintf(NameBench_Registry[i].Name, sizeof(NameBench_Registry[i].Name),
+                 "BENCH_APP%02u.Table%04u", (unsigned int)(i % 32), (unsigned int)i);
+        snprintf(NameBench_Missing[i], sizeof(NameBench_Missing[i]),
+                 "BENCH_APP%02u.Missing%04u", (unsigned int)(i % 32), (unsigned int)i);
+        NameBench_Registry[i].InUse = true;
+        CFE_NameIndex_Insert(&NameBench_Index, NameBench_Registry[i].Name, i);
+    }
+}
+
+void NameBench_Run(void)
+{
+    uint32 Mismatches = 0;
+    uint32 i;
+    double LinearHit;
+    double IndexHit;
+    double LinearMiss;
+    double IndexMiss;
+
+    /* Measure the time it takes the linear scan and the index to find names that are,
+     * and are not, registered */
+    LinearHit  = NameBench_Time(NameBench_LinearFind, NameBench_Registry[0].Name, sizeof(NameBench_Registry[0]));
+    IndexHit   = NameBench_Time(NameBench_IndexFind, NameBench_Registry[0].Name, sizeof(NameBench_Registry[0]));
+    LinearMiss = NameBench_Time(NameBench_LinearFind, NameBench_Missing[0], sizeof(NameBench_Missing[0]));
+    IndexMiss  = NameBench_Time(NameBench_IndexFind, NameBench_Missing[0], sizeof(NameBench_Missing[0]));
+
+    UtPrintf("Registered name:   linear %8.1f ns, index %8.1f ns\n", LinearHit, IndexHit);
+    UtPrintf("Unregistered name: linear %8.1f ns, index %8.1f ns\n", LinearMiss, IndexMiss);
+
+    Mismatches = NameBench_Verify(NameBench_Registry[0].Name, sizeof(NameBench_Registry[0])) +
+                 NameBench_Verify(NameBench_Missing[0], sizeof(NameBench_Missing[0]));
+
+    UtAssert_True(Mismatches == 0, "Lookups with %u registered names match linear scan (%u mismatches)",
+                  (unsigned int)NAME_BENCH_NUM_ENTRIES, (unsigned int)Mismatches);
+
+    /* Unregister every third record, as apps would be deleted, and check that the
+     * backward shifting deletion left every other name reachable */
+    for (i = 0; i < NAME_BENCH_NUM_ENTRIES; i += 3)
+    {
+        CFE_NameIndex_Remove(&NameBench_Index, NameBench_Registry[i].Name, i);
+        NameBench_Registry[i].InUse = false;
+    }
+
+    Mismatches = NameBench_Verify(NameBench_Registry[0].Name, sizeof(NameBench_Registry[0]));
+
+    UtAssert_True(Mismatches == 0, "Lookups after removing a third of the names match linear scan (%u mismatches)",
+                  (unsigned int)Mismatches);
+
+    /* Re-register the removed names, as restarted apps would */
+    for (i = 0; i < NAME_BENCH_NUM_ENTRIES; i += 3)
+    {
+        NameBench_Registry[i].InUse = true;
+        CFE_NameIndex_Insert(&NameBench_Index, NameBench_Registry[i].Name, i);
+    }
+
+    Mismatches = 0;
+    for (i = 0; i < NAME_BENCH_NUM_ENTRIES; i++)
+    {
+        if (NameBench_IndexFind(NameBench_Registry[i].Name) != (int32)i)
+        {
+            ++Mismatches;
+        }
+    }
+
+    UtAssert_True(Mismatches == 0, "Lookups after re-registering names find their records (%u mismatches)",
+                  (unsigned int)Mismatches);
+}
+
+void UtTest_Setup(void)
+{
+    UtTest_Add(NameBench_Run, NameBench_Setup, NULL, "Name index benchmark");
+}
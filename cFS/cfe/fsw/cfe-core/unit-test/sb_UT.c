@@ -129,6 +129,7 @@ void UtTest_Setup(void)
     Test_PipeOpts_API();
     Test_GetPipeName_API();
     Test_GetPipeIdByName_API();
+    Test_GetPipeQueueId_API();
     Test_Subscribe_API();
     Test_Unsubscribe_API();
     Test_SendMsg_API();
@@ -1831,6 +1832,7 @@ void Test_GetPipeIdByName_API(void)
     SB_UT_ADD_SUBTEST(Test_GetPipeIdByName_NullPtrs);
     SB_UT_ADD_SUBTEST(Test_GetPipeIdByName_InvalidName);
     SB_UT_ADD_SUBTEST(Test_GetPipeIdByName);
+    SB_UT_ADD_SUBTEST(Test_GetPipeIdByName_Deleted);
 } /* end Test_GetPipeIdByName_API */
 
 /*
@@ -1872,20 +1874,91 @@ void Test_GetPipeIdByName(void)
 
     SETUP(CFE_SB_CreatePipe(&PipeId, 4, "TestPipe1"));
 
-    UT_SetDataBuffer(
-        UT_KEY(OS_QueueGetIdByName),
-        &(CFE_SB.PipeTbl[0].SysQueueId),
-        sizeof(CFE_SB.PipeTbl[0].SysQueueId),
-        false);
-
     ASSERT(CFE_SB_GetPipeIdByName(&PipeIdOut, "TestPipe1"));
 
+    ASSERT_EQ(PipeIdOut, PipeId);
+
     EVTSENT(CFE_SB_GETPIPEIDBYNAME_EID);
 
     TEARDOWN(CFE_SB_DeletePipe(PipeId));
 
 } /* end Test_GetPipeIdByName */
 
+/*
+** Call to GetPipeIdByName for pipes that have been deleted and recreated
+*/
+void Test_GetPipeIdByName_Deleted(void)
+{
+    CFE_SB_PipeId_t PipeId1 = 0, PipeId2 = 0, PipeIdOut = 0;
+
+    SETUP(CFE_SB_CreatePipe(&PipeId1, 4, "TestPipe1"));
+    SETUP(CFE_SB_CreatePipe(&PipeId2, 4, "TestPipe2"));
+    SETUP(CFE_SB_DeletePipe(PipeId1));
+
+    ASSERT_EQ(CFE_SB_GetPipeIdByName(&PipeIdOut, "TestPipe1"), CFE_SB_BAD_ARGUMENT);
+
+    EVTSENT(CFE_SB_GETPIPEIDBYNAME_NAME_ERR_EID);
+
+    ASSERT(CFE_SB_GetPipeIdByName(&PipeIdOut, "TestPipe2"));
+
+    ASSERT_EQ(PipeIdOut, PipeId2);
+
+    SETUP(CFE_SB_CreatePipe(&PipeId1, 4, "TestPipe1"));
+
+    ASSERT(CFE_SB_GetPipeIdByName(&PipeIdOut, "TestPipe1"));
+
+    ASSERT_EQ(PipeIdOut, PipeId1);
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId1));
+    TEARDOWN(CFE_SB_DeletePipe(PipeId2));
+
+} /* end Test_GetPipeIdByName_Deleted */
+
+/*
+** Function for calling SB get pipe queue id API test functions
+*/
+void Test_GetPipeQueueId_API(void)
+{
+    SB_UT_ADD_SUBTEST(Test_GetPipeQueueId_BadArgs);
+    SB_UT_ADD_SUBTEST(Test_GetPipeQueueId);
+} /* end Test_GetPipeQueueId_API */
+
+/*
+** Call GetPipeQueueId with a null pointer and an invalid pipe id
+*/
+void Test_GetPipeQueueId_BadArgs(void)
+{
+    CFE_SB_PipeId_t PipeId = 0;
+    uint32          QueueId = 0;
+
+    SETUP(CFE_SB_CreatePipe(&PipeId, 4, "TestPipe1"));
+
+    ASSERT_EQ(CFE_SB_GetPipeQueueId(PipeId, NULL), CFE_SB_BAD_ARGUMENT);
+    ASSERT_EQ(CFE_SB_GetPipeQueueId(PipeId + 1, &QueueId), CFE_SB_BAD_ARGUMENT);
+    ASSERT_EQ(CFE_SB_GetPipeQueueId(CFE_PLATFORM_SB_MAX_PIPES, &QueueId), CFE_SB_BAD_ARGUMENT);
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_GetPipeQueueId_BadArgs */
+
+/*
+** Successful call to GetPipeQueueId
+*/
+void Test_GetPipeQueueId(void)
+{
+    CFE_SB_PipeId_t PipeId = 0;
+    uint32          QueueId = 0;
+
+    SETUP(CFE_SB_CreatePipe(&PipeId, 4, "TestPipe1"));
+
+    ASSERT(CFE_SB_GetPipeQueueId(PipeId, &QueueId));
+
+    ASSERT_EQ(QueueId, CFE_SB.PipeTbl[PipeId].SysQueueId);
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_GetPipeQueueId */
+
 /*
 ** Try setting pipe options on an invalid pipe ID
 */
@@ -3676,6 +3749,9 @@ void Test_SB_Utils(void)
     SB_UT_ADD_SUBTEST(Test_CFE_SB_TimeStampMsg);
     SB_UT_ADD_SUBTEST(Test_CFE_SB_SetGetCmdCode_Cmd);
     SB_UT_ADD_SUBTEST(Test_CFE_SB_SetGetCmdCode_NonCmd);
+    SB_UT_ADD_SUBTEST(Test_CFE_SB_GetMsgHdrView_Cmd);
+    SB_UT_ADD_SUBTEST(Test_CFE_SB_GetMsgHdrView_Tlm);
+    SB_UT_ADD_SUBTEST(Test_CFE_SB_GetMsgRouteView);
     SB_UT_ADD_SUBTEST(Test_CFE_SB_ChecksumUtils_Cmd);
     SB_UT_ADD_SUBTEST(Test_CFE_SB_ChecksumUtils_CmdNoSecHdr);
     SB_UT_ADD_SUBTEST(Test_CFE_SB_ChecksumUtils_Tlm);
@@ -3804,6 +3880,111 @@ void Test_CFE_SB_MsgHdrSize_Tlm(void)
 
 } /* end Test_CFE_SB_MsgHdrSize_Tlm */
 
+/*
+** Test that the decoded header view of a command matches the single field accessors
+*/
+void Test_CFE_SB_GetMsgHdrView_Cmd(void)
+{
+    CCSDS_PriHdr_t      *PktPtr;
+    SB_UT_Test_Cmd_t    testCmd;
+    CFE_SB_MsgPtr_t     MsgPtr;
+    CFE_SB_MsgHdrView_t HdrView;
+
+    MsgPtr = (CFE_SB_MsgPtr_t)&testCmd;
+    PktPtr = (CCSDS_PriHdr_t*)MsgPtr;
+
+    CFE_SB_InitMsg(MsgPtr, SB_UT_CMD_MID, sizeof(testCmd), true);
+    CFE_SB_SetCmdCode(MsgPtr, 0x5A);
+
+    CFE_SB_GetMsgHdrView(MsgPtr, &HdrView);
+
+    ASSERT_TRUE(CFE_SB_MsgId_Equal(HdrView.MsgId, SB_UT_CMD_MID));
+    ASSERT_EQ(HdrView.TotalLength, sizeof(testCmd));
+    ASSERT_EQ(HdrView.HdrSize, CFE_SB_MsgHdrSize(MsgPtr));
+    ASSERT_EQ(HdrView.HdrSize, CFE_SB_CMD_HDR_SIZE);
+    ASSERT_EQ(HdrView.CmdCode, 0x5A);
+    ASSERT_EQ(HdrView.PktType, CFE_SB_PKTTYPE_CMD);
+    ASSERT_TRUE(HdrView.HasSecHdr);
+    ASSERT_EQ(HdrView.Time.Seconds, 0);
+    ASSERT_EQ(HdrView.Time.Subseconds, 0);
+
+    /* Without a secondary header there is no command code */
+    CCSDS_WR_SHDR(*PktPtr, 0);
+
+    CFE_SB_GetMsgHdrView(MsgPtr, &HdrView);
+
+    ASSERT_EQ(HdrView.HdrSize, CFE_SB_PRI_HDR_SIZE);
+    ASSERT_EQ(HdrView.CmdCode, CFE_SB_GetCmdCode(MsgPtr));
+    ASSERT_EQ(HdrView.PktType, CFE_SB_PKTTYPE_CMD);
+    ASSERT_TRUE(!HdrView.HasSecHdr);
+
+} /* end Test_CFE_SB_GetMsgHdrView_Cmd */
+
+/*
+** Test that the decoded header view of a telemetry packet matches the single field accessors
+*/
+void Test_CFE_SB_GetMsgHdrView_Tlm(void)
+{
+    CCSDS_PriHdr_t      *PktPtr;
+    SB_UT_Test_Tlm_t    testTlm;
+    CFE_SB_MsgPtr_t     MsgPtr;
+    CFE_SB_MsgHdrView_t HdrView;
+    CFE_TIME_SysTime_t  SetTime;
+    CFE_TIME_SysTime_t  GetTime;
+
+    MsgPtr = (CFE_SB_MsgPtr_t)&testTlm;
+    PktPtr = (CCSDS_PriHdr_t*)MsgPtr;
+
+    CFE_SB_InitMsg(MsgPtr, SB_UT_TLM_MID, sizeof(testTlm), true);
+    SetTime.Seconds = 0x12345678;
+    SetTime.Subseconds = 0x9ABCDEF0;
+    CFE_SB_SetMsgTime(MsgPtr, SetTime);
+
+    CFE_SB_GetMsgHdrView(MsgPtr, &HdrView);
+    GetTime = CFE_SB_GetMsgTime(MsgPtr);
+
+    ASSERT_TRUE(CFE_SB_MsgId_Equal(HdrView.MsgId, SB_UT_TLM_MID));
+    ASSERT_EQ(HdrView.TotalLength, sizeof(testTlm));
+    ASSERT_EQ(HdrView.HdrSize, CFE_SB_TLM_HDR_SIZE);
+    ASSERT_EQ(HdrView.CmdCode, 0);
+    ASSERT_EQ(HdrView.PktType, CFE_SB_PKTTYPE_TLM);
+    ASSERT_TRUE(HdrView.HasSecHdr);
+    ASSERT_EQ(HdrView.Time.Seconds, GetTime.Seconds);
+    ASSERT_EQ(HdrView.Time.Subseconds, GetTime.Subseconds);
+
+    /* Without a secondary header there is no time */
+    CCSDS_WR_SHDR(*PktPtr, 0);
+
+    CFE_SB_GetMsgHdrView(MsgPtr, &HdrView);
+
+    ASSERT_EQ(HdrView.HdrSize, CFE_SB_PRI_HDR_SIZE);
+    ASSERT_EQ(HdrView.PktType, CFE_SB_PKTTYPE_TLM);
+    ASSERT_TRUE(!HdrView.HasSecHdr);
+    ASSERT_EQ(HdrView.Time.Seconds, 0);
+    ASSERT_EQ(HdrView.Time.Subseconds, 0);
+
+} /* end Test_CFE_SB_GetMsgHdrView_Tlm */
+
+/*
+** Test that the routing view of a message matches the single field accessors
+*/
+void Test_CFE_SB_GetMsgRouteView(void)
+{
+    SB_UT_Test_Tlm_t      testTlm;
+    CFE_SB_MsgPtr_t       MsgPtr;
+    CFE_SB_MsgRouteView_t RouteView;
+
+    MsgPtr = (CFE_SB_MsgPtr_t)&testTlm;
+
+    CFE_SB_InitMsg(MsgPtr, SB_UT_TLM_MID, sizeof(testTlm), true);
+
+    CFE_SB_GetMsgRouteView(MsgPtr, &RouteView);
+
+    ASSERT_TRUE(CFE_SB_MsgId_Equal(RouteView.MsgId, CFE_SB_GetMsgId(MsgPtr)));
+    ASSERT_EQ(RouteView.TotalLength, CFE_SB_GetTotalMsgLength(MsgPtr));
+
+} /* end Test_CFE_SB_GetMsgRouteView */
+
 /*
 ** Test getting a pointer to the user data portion of a message
 */
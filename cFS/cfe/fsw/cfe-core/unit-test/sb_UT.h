@@ -827,6 +827,85 @@ void Test_GetPipeIdByName_InvalidName(void);
 ******************************************************************************/
 void Test_GetPipeIdByName(void);
 
+/*****************************************************************************/
+/**
+** \brief Test getting pipe id by name after pipes are deleted.
+**
+** \par Description
+**        This function tests the get pipe id by name command with the
+**        name of a deleted pipe, the name of a pipe still in use, and
+**        a name that has been reused by a new pipe.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #UT_Text, #SB_ResetUnitTest, #CFE_SB_CreatePipe,
+** \sa #CFE_SB_DeletePipe, #CFE_SB_GetPipeIdByName,
+** \sa #UT_EventIsInHistory, #UT_Report
+**
+******************************************************************************/
+void Test_GetPipeIdByName_Deleted(void);
+
+/*****************************************************************************/
+/**
+** \brief Function for calling SB get pipe queue id API test functions
+**
+** \par Description
+**        Function for calling SB get pipe queue id API test functions.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #Test_GetPipeQueueId_BadArgs, #Test_GetPipeQueueId
+**
+******************************************************************************/
+void Test_GetPipeQueueId_API(void);
+
+/*****************************************************************************/
+/**
+** \brief Test get pipe queue id response to bad arguments
+**
+** \par Description
+**        This function tests getting the queue id of a pipe with a null
+**        output pointer, and with pipe ids that are not in use or out of
+**        range.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #CFE_SB_CreatePipe, #CFE_SB_GetPipeQueueId, #CFE_SB_DeletePipe
+**
+******************************************************************************/
+void Test_GetPipeQueueId_BadArgs(void);
+
+/*****************************************************************************/
+/**
+** \brief Test getting the queue id of a pipe with a valid id
+**
+** \par Description
+**        This function tests that getting the queue id of a pipe returns
+**        the queue that was created for the pipe.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #CFE_SB_CreatePipe, #CFE_SB_GetPipeQueueId, #CFE_SB_DeletePipe
+**
+******************************************************************************/
+void Test_GetPipeQueueId(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test send routing information command with a file header
@@ -3224,6 +3303,66 @@ void Test_CFE_SB_MsgHdrSize_Cmd(void);
 ******************************************************************************/
 void Test_CFE_SB_MsgHdrSize_Tlm(void);
 
+/*****************************************************************************/
+/**
+** \brief Test decoding the header of a command message
+**
+** \par Description
+**        This function tests that each field of the decoded header view of
+**        a command message, with and without a secondary header, matches
+**        the value returned by the corresponding single field accessor.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #UT_Text, #SB_ResetUnitTest, #CFE_SB_GetMsgHdrView, #UT_Report
+**
+******************************************************************************/
+void Test_CFE_SB_GetMsgHdrView_Cmd(void);
+
+/*****************************************************************************/
+/**
+** \brief Test decoding the header of a telemetry message
+**
+** \par Description
+**        This function tests that each field of the decoded header view of
+**        a telemetry message, with and without a secondary header, matches
+**        the value returned by the corresponding single field accessor.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #UT_Text, #SB_ResetUnitTest, #CFE_SB_GetMsgHdrView, #UT_Report
+**
+******************************************************************************/
+void Test_CFE_SB_GetMsgHdrView_Tlm(void);
+
+/*****************************************************************************/
+/**
+** \brief Test the header fields decoded for routing a message
+**
+** \par Description
+**        This function tests that the message ID and total length in the
+**        routing view of a message match the values returned by the
+**        corresponding single field accessors.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #UT_Text, #SB_ResetUnitTest, #CFE_SB_GetMsgRouteView, #UT_Report
+**
+******************************************************************************/
+void Test_CFE_SB_GetMsgRouteView(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test getting a pointer to the user data portion of a message
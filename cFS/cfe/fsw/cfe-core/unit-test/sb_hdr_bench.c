@@ -0,0 +1,224 @@
+/*
+**  GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**  Copyright (c) 2006-2019 United States Government as represented by
+**  the Administrator of the National Aeronautics and Space Administration.
+**  All Rights Reserved.
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**    http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+*/
+
+/*
+** File:
+**    sb_hdr_bench.c
+**
+** Purpose:
+**    Software bus message header accessor benchmark
+**
+**    Times each of the single field header accessors, and compares the
+**    cost of calling them one after the other, as a command dispatcher or
+**    telemetry forwarder would, with decoding the whole header at once
+**    using CFE_SB_GetMsgHdrView.  The view of every message is also
+**    checked against the single field accessors.
+**
+** Notes:
+**    1. This is unit test code only, not for use in flight
+**
+*/
+
+#define _POSIX_C_SOURCE 200112L
+
+/*
+** Includes
+*/
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "cfe.h"
+#include "cfe_sb_priv.h"
+#include "utassert.h"
+#include "uttest.h"
+#include "utbsp.h"
+
+/*
+** Number of distinct messages, and number of passes over all of them when timing
+*/
+#define HDR_BENCH_NUM_MSGS          64
+#define HDR_BENCH_NUM_PASSES        20000
+
+typedef union
+{
+    CFE_SB_Msg_t    Msg;
+    uint8           Bytes[64];
+} HdrBench_Buffer_t;
+
+HdrBench_Buffer_t   HdrBench_Msgs[HDR_BENCH_NUM_MSGS];
+
+/* Accumulates results so the timed calls are not optimized away */
+volatile uint32     HdrBench_Sink;
+
+double HdrBench_Now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((double)ts.tv_sec * 1e9) + (double)ts.tv_nsec;
+}
+
+/*
+** One function per way of reading the header, each returning a value derived from what it read
+*/
+uint32 HdrBench_GetMsgId(CFE_SB_MsgPtr_t MsgPtr)
+{
+    return CFE_SB_MsgIdToValue(CFE_SB_GetMsgId(MsgPtr));
+}
+
+uint32 HdrBench_GetTotalMsgLength(CFE_SB_MsgPtr_t MsgPtr)
+{
+    return CFE_SB_GetTotalMsgLength(MsgPtr);
+}
+
+uint32 HdrBench_GetCmdCode(CFE_SB_MsgPtr_t MsgPtr)
+{
+    return CFE_SB_GetCmdCode(MsgPtr);
+}
+
+uint32 HdrBench_GetMsgTime(CFE_SB_MsgPtr_t MsgPtr)
+{
+    return CFE_SB_GetMsgTime(MsgPtr).Subseconds;
+}
+
+uint32 HdrBench_MsgHdrSize(CFE_SB_MsgPtr_t MsgPtr)
+{
+    return CFE_SB_MsgHdrSize(MsgPtr);
+}
+
+uint32 HdrBench_AllAccessors(CFE_SB_MsgPtr_t MsgPtr)
+{
+    return CFE_SB_MsgIdToValue(CFE_SB_GetMsgId(MsgPtr)) + CFE_SB_GetTotalMsgLength(MsgPtr) +
+           CFE_SB_GetCmdCode(MsgPtr) + CFE_SB_GetMsgTime(MsgPtr).Subseconds + CFE_SB_MsgHdrSize(MsgPtr);
+}
+
+uint32 HdrBench_HdrView(CFE_SB_MsgPtr_t MsgPtr)
+{
+    CFE_SB_MsgHdrView_t HdrView;
+
+    CFE_SB_GetMsgHdrView(MsgPtr, &HdrView);
+
+    return CFE_SB_MsgIdToValue(HdrView.MsgId) + HdrView.TotalLength +
+           HdrView.CmdCode + HdrView.Time.Subseconds + HdrView.HdrSize;
+}
+
+/*
+** Times HDR_BENCH_NUM_PASSES calls on every message, returning ns per call
+*/
+double HdrBench_Time(uint32 (*ReadFunc)(CFE_SB_MsgPtr_t))
+{
+    double  Start;
+    uint32  Pass;
+    uint32  i;
+    uint32  Sum = 0;
+
+    Start = HdrBench_Now();
+
+    for (Pass = 0; Pass < HDR_BENCH_NUM_PASSES; Pass++)
+    {
+        for (i = 0; i < HDR_BENCH_NUM_MSGS; i++)
+        {
+            Sum += ReadFunc(&HdrBench_Msgs[i].Msg);
+        }
+    }
+
+    HdrBench_Sink = Sum;
+
+    return (HdrBench_Now() - Start) / (HDR_BENCH_NUM_PASSES * HDR_BENCH_NUM_MSGS);
+}
+
+void HdrBench_Setup(void)
+{
+    CFE_TIME_SysTime_t  Time;
+    uint32              i;
+
+    /* Alternate commands and telemetry, a few without secondary headers, as a mixed pipe would see */
+    for (i = 0; i < HDR_BENCH_NUM_MSGS; i++)
+    {
+        memset(&HdrBench_Msgs[i], 0, sizeof(HdrBench_Msgs[i]));
+
+        if ((i % 2) == 0)
+        {
+            CFE_SB_InitMsg(&HdrBench_Msgs[i], CFE_SB_ValueToMsgId(0x1800 + i), CFE_SB_CMD_HDR_SIZE + (i % 16), true);
+            CFE_SB_SetCmdCode(&HdrBench_Msgs[i].Msg, (uint16)(i % 128));
+        }
+        else
+        {
+            CFE_SB_InitMsg(&HdrBench_Msgs[i], CFE_SB_ValueToMsgId(0x0800 + i), CFE_SB_TLM_HDR_SIZE + (i % 16), true);
+            Time.Seconds = 1000 + i;
+            Time.Subseconds = i << 24;
+            CFE_SB_SetMsgTime(&HdrBench_Msgs[i].Msg, Time);
+        }
+
+        if ((i % 8) == 7)
+        {
+            CCSDS_WR_SHDR(HdrBench_Msgs[i].Msg.Hdr, 0);
+        }
+    }
+}
+
+void HdrBench_Run(void)
+{
+    CFE_SB_MsgHdrView_t HdrView;
+    CFE_TIME_SysTime_t  Time;
+    CFE_SB_MsgPtr_t     MsgPtr;
+    uint32              Mismatches = 0;
+    uint32              i;
+    double              AllAccessors;
+    double              View;
+
+    UtPrintf("CFE_SB_GetMsgId:          %6.1f ns\n", HdrBench_Time(HdrBench_GetMsgId));
+    UtPrintf("CFE_SB_GetTotalMsgLength: %6.1f ns\n", HdrBench_Time(HdrBench_GetTotalMsgLength));
+    UtPrintf("CFE_SB_GetCmdCode:        %6.1f ns\n", HdrBench_Time(HdrBench_GetCmdCode));
+    UtPrintf("CFE_SB_GetMsgTime:        %6.1f ns\n", HdrBench_Time(HdrBench_GetMsgTime));
+    UtPrintf("CFE_SB_MsgHdrSize:        %6.1f ns\n", HdrBench_Time(HdrBench_MsgHdrSize));
+
+    AllAccessors = HdrBench_Time(HdrBench_AllAccessors);
+    View         = HdrBench_Time(HdrBench_HdrView);
+
+    UtPrintf("All fields: accessors %6.1f ns, header view %6.1f ns\n", AllAccessors, View);
+
+    for (i = 0; i < HDR_BENCH_NUM_MSGS; i++)
+    {
+        MsgPtr = &HdrBench_Msgs[i].Msg;
+        Time = CFE_SB_GetMsgTime(MsgPtr);
+
+        CFE_SB_GetMsgHdrView(MsgPtr, &HdrView);
+
+        if (!CFE_SB_MsgId_Equal(HdrView.MsgId, CFE_SB_GetMsgId(MsgPtr)) ||
+            HdrView.TotalLength != CFE_SB_GetTotalMsgLength(MsgPtr) ||
+            HdrView.CmdCode != CFE_SB_GetCmdCode(MsgPtr) ||
+            HdrView.HdrSize != CFE_SB_MsgHdrSize(MsgPtr) ||
+            HdrView.Time.Seconds != Time.Seconds ||
+            HdrView.Time.Subseconds != Time.Subseconds)
+        {
+            ++Mismatches;
+        }
+    }
+
+    UtAssert_True(Mismatches == 0, "Header view of %u messages matches the single field accessors (%u mismatches)",
+                  (unsigned int)HDR_BENCH_NUM_MSGS, (unsigned int)Mismatches);
+}
+
+void UtTest_Setup(void)
+{
+    UtTest_Add(HdrBench_Run, HdrBench_Setup, NULL, "SB header accessor benchmark");
+}
@@ -122,6 +122,10 @@ void UtTest_Setup(void)
     UT_ADD_TEST(Test_CFE_TBL_Share);
     UT_ADD_TEST(Test_CFE_TBL_Unregister);
     UT_ADD_TEST(Test_CFE_TBL_NotifyByMessage);
+    UT_ADD_TEST(Test_CFE_TBL_MappedLoad);
+    UT_ADD_TEST(Test_CFE_TBL_DeltaLoad);
+    UT_ADD_TEST(Test_CFE_TBL_BackgroundValidation);
+    UT_ADD_TEST(Test_CFE_TBL_RegistryIndex);
     UT_ADD_TEST(Test_CFE_TBL_Load);
     UT_ADD_TEST(Test_CFE_TBL_GetAddress);
     UT_ADD_TEST(Test_CFE_TBL_ReleaseAddress);
@@ -145,11 +149,17 @@ void UT_InitializeTableRegistryNames()
 {
     int i;
 
+    CFE_NameIndex_Init(&CFE_TBL_TaskData.RegistryIndex,
+                       CFE_TBL_TaskData.RegistryIndexSlots,
+                       CFE_NAME_INDEX_SLOTS(CFE_PLATFORM_TBL_MAX_NUM_TABLES));
+
     for (i = 0; i < CFE_PLATFORM_TBL_MAX_NUM_TABLES; i++)
     {
         snprintf(CFE_TBL_TaskData.Registry[i].Name,
                  CFE_TBL_MAX_FULL_NAME_LEN, "%d", i);
         CFE_TBL_TaskData.Registry[i].OwnerAppId = 0;
+        CFE_NameIndex_Insert(&CFE_TBL_TaskData.RegistryIndex,
+                             CFE_TBL_TaskData.Registry[i].Name, i);
     }
 }
 
@@ -165,6 +175,10 @@ void UT_ResetTableRegistry(void)
         CFE_TBL_InitRegistryRecord(&CFE_TBL_TaskData.Registry[i]);
     }
 
+    CFE_NameIndex_Init(&CFE_TBL_TaskData.RegistryIndex,
+                       CFE_TBL_TaskData.RegistryIndexSlots,
+                       CFE_NAME_INDEX_SLOTS(CFE_PLATFORM_TBL_MAX_NUM_TABLES));
+
     /* Initialize the table access descriptors */
     for (i = 0; i < CFE_PLATFORM_TBL_MAX_NUM_HANDLES; i++)
     {
@@ -803,6 +817,35 @@ void Test_CFE_TBL_DumpToFile(void)
                                  TblSizeInBytes) == CFE_TBL_INC_CMD_CTR,
               "CFE_TBL_DumpToFile",
               "File existed previously => data overwritten");
+
+    /* Test delta dump of identical images */
+    UT_InitData();
+    UT_Report(__FILE__, __LINE__,
+              CFE_TBL_DumpDeltaToFile("filename" ,"tablename" ,"dumpaddress",
+                                      "dumpaddress", TblSizeInBytes) == CFE_TBL_INC_CMD_CTR &&
+              UT_EventIsInHistory(CFE_TBL_DELTA_DUMP_EMPTY_INF_EID) == true &&
+              UT_GetStubCount(UT_KEY(OS_creat)) == 0,
+              "CFE_TBL_DumpDeltaToFile",
+              "Identical images => no file written");
+
+    /* Test with an error writing a delta segment */
+    UT_InitData();
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 2, sizeof(CFE_TBL_File_SegHdr_t) - 1);
+    UT_Report(__FILE__, __LINE__,
+              CFE_TBL_DumpDeltaToFile("filename" ,"tablename" ,"dumpaddress",
+                                      "dump_address", TblSizeInBytes) == CFE_TBL_INC_ERR_CTR &&
+              UT_EventIsInHistory(CFE_TBL_WRITE_TBL_IMG_ERR_EID) == true,
+              "CFE_TBL_DumpDeltaToFile",
+              "Error writing delta segment header");
+
+    /* Test successful delta dump of differing images */
+    UT_InitData();
+    UT_Report(__FILE__, __LINE__,
+              CFE_TBL_DumpDeltaToFile("filename" ,"tablename" ,"dumpaddress",
+                                      "dump_address", TblSizeInBytes) == CFE_TBL_INC_CMD_CTR &&
+              UT_GetStubCount(UT_KEY(OS_write)) == 3,
+              "CFE_TBL_DumpDeltaToFile",
+              "Differing images => delta image dumped");
 }
 
 /*
@@ -1259,6 +1302,8 @@ void Test_CFE_TBL_DumpCmd(void)
             CFE_TBL_MAX_FULL_NAME_LEN);
     CFE_TBL_TaskData.Registry[2].Name[CFE_TBL_MAX_FULL_NAME_LEN - 1] = '\0';
     CFE_TBL_TaskData.Registry[2].OwnerAppId = 0;
+    CFE_NameIndex_Insert(&CFE_TBL_TaskData.RegistryIndex,
+                         CFE_TBL_TaskData.Registry[2].Name, 2);
     strncpy(DumpCmd.Payload.TableName, CFE_TBL_TaskData.Registry[2].Name,
             sizeof(DumpCmd.Payload.TableName));
     DumpCmd.Payload.ActiveTableFlag = CFE_TBL_BufferSelect_ACTIVE;
@@ -1438,6 +1483,7 @@ void Test_CFE_TBL_LoadCmd(void)
         CFE_TBL_TaskData.Registry[i].LoadPending = false;
     }
 
+    memset(&TblFileHeader, 0, sizeof(TblFileHeader));
     strncpy((char *)TblFileHeader.TableName, CFE_TBL_TaskData.Registry[0].Name,
             sizeof(TblFileHeader.TableName));
     strncpy(StdFileHeader.Description, "FS header description",
@@ -2591,6 +2637,7 @@ void Test_CFE_TBL_Share(void)
             sizeof(StdFileHeader.Description));
     StdFileHeader.ContentType = CFE_FS_FILE_CONTENT_ID;
     StdFileHeader.SubType = CFE_FS_SubType_TBL_IMG;
+    memset(&TblFileHeader, 0, sizeof(TblFileHeader));
     strncpy((char *)TblFileHeader.TableName, "ut_cfe_tbl.UT_Table4",
             sizeof(TblFileHeader.TableName));
     TblFileHeader.NumBytes = sizeof(UT_Table1_t);
@@ -2785,6 +2832,7 @@ void Test_CFE_TBL_Load(void)
             sizeof(StdFileHeader.Description));
     StdFileHeader.ContentType = CFE_FS_FILE_CONTENT_ID;
     StdFileHeader.SubType = CFE_FS_SubType_TBL_IMG;
+    memset(&TblFileHeader, 0, sizeof(TblFileHeader));
     strncpy((char *)TblFileHeader.TableName, "ut_cfe_tbl.UT_Table1",
             sizeof(TblFileHeader.TableName));
     TblFileHeader.NumBytes = sizeof(UT_Table1_t) - 1;
@@ -3083,6 +3131,749 @@ void Test_CFE_TBL_Load(void)
               "Attempt to load locked shared table (cleanup)");
 }
 
+/*
+** Function to test loading tables registered with the mapped image option
+*/
+void Test_CFE_TBL_MappedLoad(void)
+{
+    UT_Table1_t                MappedImage1;
+    UT_Table1_t                MappedImage2;
+    void                       *MapPtr;
+    int32                      RtnCode;
+    bool                    EventsCorrect;
+    CFE_FS_Header_t            StdFileHeader;
+    CFE_TBL_File_Hdr_t         TblFileHeader;
+    CFE_TBL_RegistryRec_t      *RegRecPtr;
+    CFE_TBL_AccessDescriptor_t *AccessDescPtr;
+
+#ifdef UT_VERBOSE
+    UT_Text("Begin Test Mapped Load\n");
+#endif
+
+    memset(&StdFileHeader, 0, sizeof(StdFileHeader));
+    StdFileHeader.SpacecraftID = CFE_PLATFORM_TBL_VALID_SCID_1;
+    StdFileHeader.ProcessorID = CFE_PLATFORM_TBL_VALID_PRID_1;
+    strncpy(StdFileHeader.Description,"Test description",
+            sizeof(StdFileHeader.Description));
+    StdFileHeader.ContentType = CFE_FS_FILE_CONTENT_ID;
+    StdFileHeader.SubType = CFE_FS_SubType_TBL_IMG;
+
+    /* Test that a mapped table cannot also be critical */
+    UT_InitData();
+    UT_SetAppID(1);
+    UT_ResetTableRegistry();
+    RtnCode = CFE_TBL_Register(&App1TblHandle1, "UT_Table1",
+                               sizeof(UT_Table1_t),
+                               CFE_TBL_OPT_MAPPED | CFE_TBL_OPT_CRITICAL,
+                               NULL);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_TBL_ERR_INVALID_OPTIONS,
+              "CFE_TBL_Register",
+              "Mapped table cannot be critical");
+
+    /* Test successful registration of a mapped table */
+    UT_InitData();
+    RtnCode = CFE_TBL_Register(&App1TblHandle1, "UT_Table1",
+                               sizeof(UT_Table1_t),
+                               CFE_TBL_OPT_MAPPED,
+                               NULL);
+    AccessDescPtr = &CFE_TBL_TaskData.Handles[App1TblHandle1];
+    RegRecPtr = &CFE_TBL_TaskData.Registry[AccessDescPtr->RegIndex];
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_SUCCESS && RegRecPtr->MappedImage &&
+              RegRecPtr->DoubleBuffered &&
+              RegRecPtr->Buffers[0].BufferPtr == NULL &&
+              RegRecPtr->Buffers[1].BufferPtr == NULL,
+              "CFE_TBL_Register",
+              "Mapped table registered without allocating buffers");
+
+    /* Test attempt to load a mapped table from a short file */
+    UT_InitData();
+    memset(&TblFileHeader, 0, sizeof(TblFileHeader));
+    strncpy((char *)TblFileHeader.TableName, "ut_cfe_tbl.UT_Table1",
+            sizeof(TblFileHeader.TableName));
+    TblFileHeader.NumBytes = sizeof(UT_Table1_t) - 1;
+    TblFileHeader.Offset = 0;
+
+    if (UT_Endianess == UT_LITTLE_ENDIAN)
+    {
+        CFE_TBL_ByteSwapUint32(&TblFileHeader.NumBytes);
+        CFE_TBL_ByteSwapUint32(&TblFileHeader.Offset);
+    }
+
+    UT_SetReadBuffer(&TblFileHeader, sizeof(TblFileHeader));
+    UT_SetReadHeader(&StdFileHeader, sizeof(StdFileHeader));
+    RtnCode = CFE_TBL_Load(App1TblHandle1,
+                           CFE_TBL_SRC_FILE,
+                           "TblSrcFileName.dat");
+    EventsCorrect = (UT_EventIsInHistory(CFE_TBL_MAPPED_PARTIAL_ERR_EID) == true &&
+                     UT_GetNumEventsSent() == 1);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_TBL_ERR_PARTIAL_LOAD && EventsCorrect &&
+              UT_GetStubCount(UT_KEY(OS_FileMap)) == 0,
+              "CFE_TBL_Load",
+              "Mapped table requires a complete image");
+
+    /* Test attempt to load a mapped table from a file missing data */
+    UT_InitData();
+    TblFileHeader.NumBytes = sizeof(UT_Table1_t);
+
+    if (UT_Endianess == UT_LITTLE_ENDIAN)
+    {
+        CFE_TBL_ByteSwapUint32(&TblFileHeader.NumBytes);
+    }
+
+    UT_SetReadBuffer(&TblFileHeader, sizeof(TblFileHeader));
+    UT_SetReadHeader(&StdFileHeader, sizeof(StdFileHeader));
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, 100);
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, 100 + sizeof(UT_Table1_t) - 1);
+    RtnCode = CFE_TBL_Load(App1TblHandle1,
+                           CFE_TBL_SRC_FILE,
+                           "TblSrcFileName.dat");
+    EventsCorrect = (UT_EventIsInHistory(CFE_TBL_FILE_INCOMPLETE_ERR_EID) == true &&
+                     UT_GetNumEventsSent() == 1);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_TBL_ERR_LOAD_INCOMPLETE && EventsCorrect,
+              "CFE_TBL_Load",
+              "Mapped table image shorter than header claims");
+
+    /* Test attempt to load a mapped table from a file with extra data */
+    UT_InitData();
+    UT_SetReadBuffer(&TblFileHeader, sizeof(TblFileHeader));
+    UT_SetReadHeader(&StdFileHeader, sizeof(StdFileHeader));
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, 100);
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, 100 + sizeof(UT_Table1_t) + 1);
+    RtnCode = CFE_TBL_Load(App1TblHandle1,
+                           CFE_TBL_SRC_FILE,
+                           "TblSrcFileName.dat");
+    EventsCorrect = (UT_EventIsInHistory(CFE_TBL_FILE_TOO_BIG_ERR_EID) == true &&
+                     UT_GetNumEventsSent() == 1);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_TBL_ERR_FILE_TOO_LARGE && EventsCorrect,
+              "CFE_TBL_Load",
+              "Mapped table image longer than header claims");
+
+    /* Test failure to map the table image */
+    UT_InitData();
+    UT_SetReadBuffer(&TblFileHeader, sizeof(TblFileHeader));
+    UT_SetReadHeader(&StdFileHeader, sizeof(StdFileHeader));
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, 100);
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, 100 + sizeof(UT_Table1_t));
+    UT_SetForceFail(UT_KEY(OS_FileMap), OS_ERR_NOT_IMPLEMENTED);
+    RtnCode = CFE_TBL_Load(App1TblHandle1,
+                           CFE_TBL_SRC_FILE,
+                           "TblSrcFileName.dat");
+    EventsCorrect = (UT_EventIsInHistory(CFE_TBL_FILE_MAP_ERR_EID) == true &&
+                     UT_GetNumEventsSent() == 1);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_TBL_ERR_ACCESS && EventsCorrect &&
+              RegRecPtr->LoadInProgress == CFE_TBL_NO_LOAD_IN_PROGRESS,
+              "CFE_TBL_Load",
+              "Failure to map table image");
+
+    /* Test attempt to load a mapped table from memory */
+    UT_InitData();
+    RtnCode = CFE_TBL_Load(App1TblHandle1,
+                           CFE_TBL_SRC_ADDRESS,
+                           &MappedImage1);
+    EventsCorrect = (UT_EventIsInHistory(CFE_TBL_LOAD_TYPE_ERR_EID) == true &&
+                     UT_GetNumEventsSent() == 1);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_TBL_ERR_ILLEGAL_SRC_TYPE && EventsCorrect,
+              "CFE_TBL_Load",
+              "Mapped table cannot be loaded from memory");
+
+    /* Test successful initial load of a mapped table */
+    UT_InitData();
+    UT_SetReadBuffer(&TblFileHeader, sizeof(TblFileHeader));
+    UT_SetReadHeader(&StdFileHeader, sizeof(StdFileHeader));
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, 100);
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, 100 + sizeof(UT_Table1_t));
+    MapPtr = &MappedImage1;
+    UT_SetDataBuffer(UT_KEY(OS_FileMap), &MapPtr, sizeof(MapPtr), false);
+    RtnCode = CFE_TBL_Load(App1TblHandle1,
+                           CFE_TBL_SRC_FILE,
+                           "TblSrcFileName.dat");
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_SUCCESS &&
+              UT_EventIsInHistory(CFE_TBL_LOAD_SUCCESS_INF_EID) == true &&
+              RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].BufferPtr == &MappedImage1,
+              "CFE_TBL_Load",
+              "Initial load of mapped table");
+
+    /* Test reload of a mapped table into the inactive buffer */
+    UT_InitData();
+    UT_SetReadBuffer(&TblFileHeader, sizeof(TblFileHeader));
+    UT_SetReadHeader(&StdFileHeader, sizeof(StdFileHeader));
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, 100);
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, 100 + sizeof(UT_Table1_t));
+    MapPtr = &MappedImage2;
+    UT_SetDataBuffer(UT_KEY(OS_FileMap), &MapPtr, sizeof(MapPtr), false);
+    RtnCode = CFE_TBL_Load(App1TblHandle1,
+                           CFE_TBL_SRC_FILE,
+                           "TblSrcFileName.dat");
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_SUCCESS &&
+              RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].BufferPtr == &MappedImage2 &&
+              RegRecPtr->Buffers[1 - RegRecPtr->ActiveBufferIndex].BufferPtr == &MappedImage1,
+              "CFE_TBL_Load",
+              "Reload of mapped table");
+
+    /* Test that unregistering a mapped table releases both images */
+    UT_InitData();
+    RtnCode = CFE_TBL_Unregister(App1TblHandle1);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_SUCCESS &&
+              UT_GetStubCount(UT_KEY(OS_FileUnmap)) == 2 &&
+              RegRecPtr->Buffers[0].BufferPtr == NULL &&
+              RegRecPtr->Buffers[1].BufferPtr == NULL,
+              "CFE_TBL_Unregister",
+              "Unregister mapped table");
+}
+
+/*
+** Function to test loading delta table images
+*/
+void Test_CFE_TBL_DeltaLoad(void)
+{
+    UT_Table1_t                InitialData;
+    UT_DeltaFile_t             File;
+    int32                      RtnCode;
+    bool                    EventsCorrect;
+    CFE_FS_Header_t            StdFileHeader;
+    CFE_TBL_RegistryRec_t      *RegRecPtr;
+    CFE_TBL_AccessDescriptor_t *AccessDescPtr;
+    UT_Table1_t                *TblDataPtr;
+    static uint8               LargeData[4 * CFE_PLATFORM_TBL_CRC_REGION_SIZE];
+    uint8                      *LargePtr;
+
+#ifdef UT_VERBOSE
+    UT_Text("Begin Test Delta Load\n");
+#endif
+
+    memset(&StdFileHeader, 0, sizeof(StdFileHeader));
+    StdFileHeader.SpacecraftID = CFE_PLATFORM_TBL_VALID_SCID_1;
+    StdFileHeader.ProcessorID = CFE_PLATFORM_TBL_VALID_PRID_1;
+    strncpy(StdFileHeader.Description,"Test description",
+            sizeof(StdFileHeader.Description));
+    StdFileHeader.ContentType = CFE_FS_FILE_CONTENT_ID;
+    StdFileHeader.SubType = CFE_FS_SubType_TBL_IMG;
+
+    /* Set up a delta image that replaces the second element of the table */
+    memset(&File, 0, sizeof(File));
+    strncpy((char *)File.TblHeader.TableName, "ut_cfe_tbl.UT_Table1",
+            sizeof(File.TblHeader.TableName));
+    File.TblHeader.NumBytes = sizeof(File.SegHeader) + sizeof(File.SegData);
+    File.TblHeader.Offset = 0;
+    File.TblHeader.NumSegments = 1;
+    File.SegHeader.Offset = sizeof(File.SegData);
+    File.SegHeader.NumBytes = sizeof(File.SegData);
+    File.SegData = 0x5A5A5A5A;
+
+    if (UT_Endianess == UT_LITTLE_ENDIAN)
+    {
+        CFE_TBL_ByteSwapTblHeader(&File.TblHeader);
+        CFE_TBL_ByteSwapUint32(&File.SegHeader.Offset);
+        CFE_TBL_ByteSwapUint32(&File.SegHeader.NumBytes);
+    }
+
+    UT_InitData();
+    UT_SetAppID(1);
+    UT_ResetTableRegistry();
+    RtnCode = CFE_TBL_Register(&App1TblHandle1, "UT_Table1",
+                               sizeof(UT_Table1_t),
+                               CFE_TBL_OPT_DEFAULT,
+                               NULL);
+    AccessDescPtr = &CFE_TBL_TaskData.Handles[App1TblHandle1];
+    RegRecPtr = &CFE_TBL_TaskData.Registry[AccessDescPtr->RegIndex];
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_SUCCESS,
+              "CFE_TBL_Register",
+              "Register table for delta loads (setup)");
+
+    /* Test attempt to load a delta image into a table never loaded */
+    UT_InitData();
+    UT_SetReadBuffer(&File, sizeof(File));
+    UT_SetReadHeader(&StdFileHeader, sizeof(StdFileHeader));
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 4, 0);
+    RtnCode = CFE_TBL_Load(App1TblHandle1,
+                           CFE_TBL_SRC_FILE,
+                           "TblSrcFileName.dat");
+    EventsCorrect = (UT_EventIsInHistory(CFE_TBL_PARTIAL_LOAD_ERR_EID) == true &&
+                     UT_GetNumEventsSent() == 1);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_TBL_ERR_PARTIAL_LOAD && EventsCorrect,
+              "CFE_TBL_Load",
+              "Delta image cannot initialize a table");
+
+    /* Initialize the table contents */
+    UT_InitData();
+    InitialData.TblElement1 = 0x01020304;
+    InitialData.TblElement2 = 0x05060708;
+    RtnCode = CFE_TBL_Load(App1TblHandle1,
+                           CFE_TBL_SRC_ADDRESS,
+                           &InitialData);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_SUCCESS && RegRecPtr->TableLoadedOnce &&
+              RegRecPtr->Buffers[0].RegionCrcValid,
+              "CFE_TBL_Load",
+              "Initial load computes region CRCs (setup)");
+
+    /* Test successful load of a delta image */
+    UT_InitData();
+    UT_SetReadBuffer(&File, sizeof(File));
+    UT_SetReadHeader(&StdFileHeader, sizeof(StdFileHeader));
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 4, 0);
+    RtnCode = CFE_TBL_Load(App1TblHandle1,
+                           CFE_TBL_SRC_FILE,
+                           "TblSrcFileName.dat");
+    TblDataPtr = (UT_Table1_t *)RegRecPtr->Buffers[0].BufferPtr;
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_SUCCESS &&
+              UT_EventIsInHistory(CFE_TBL_LOAD_SUCCESS_INF_EID) == true &&
+              TblDataPtr->TblElement1 == 0x01020304 &&
+              TblDataPtr->TblElement2 == 0x5A5A5A5A &&
+              UT_GetStubCount(UT_KEY(CFE_ES_CalculateCRC)) == 2,
+              "CFE_TBL_Load",
+              "Delta image applied and region CRCs recomputed from the buffer");
+
+    /* Test attempt to load a delta image with a segment beyond the table */
+    UT_InitData();
+    File.SegHeader.Offset = sizeof(UT_Table1_t);
+
+    if (UT_Endianess == UT_LITTLE_ENDIAN)
+    {
+        CFE_TBL_ByteSwapUint32(&File.SegHeader.Offset);
+    }
+
+    UT_SetReadBuffer(&File, sizeof(File));
+    UT_SetReadHeader(&StdFileHeader, sizeof(StdFileHeader));
+    RtnCode = CFE_TBL_Load(App1TblHandle1,
+                           CFE_TBL_SRC_FILE,
+                           "TblSrcFileName.dat");
+    EventsCorrect = (UT_EventIsInHistory(CFE_TBL_DELTA_SEGMENT_ERR_EID) == true &&
+                     UT_GetNumEventsSent() == 1);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_TBL_ERR_FILE_TOO_LARGE && EventsCorrect,
+              "CFE_TBL_Load",
+              "Delta segment beyond end of table");
+
+    /* Test attempt to load a delta image whose segments do not account for all data */
+    UT_InitData();
+    File.SegHeader.Offset = 0;
+    File.SegHeader.NumBytes = sizeof(File.SegData) - 1;
+
+    if (UT_Endianess == UT_LITTLE_ENDIAN)
+    {
+        CFE_TBL_ByteSwapUint32(&File.SegHeader.NumBytes);
+    }
+
+    UT_SetReadBuffer(&File, sizeof(File));
+    UT_SetReadHeader(&StdFileHeader, sizeof(StdFileHeader));
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 4, 0);
+    RtnCode = CFE_TBL_Load(App1TblHandle1,
+                           CFE_TBL_SRC_FILE,
+                           "TblSrcFileName.dat");
+    EventsCorrect = (UT_EventIsInHistory(CFE_TBL_FILE_TOO_BIG_ERR_EID) == true &&
+                     UT_GetNumEventsSent() == 1);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_TBL_ERR_FILE_TOO_LARGE && EventsCorrect,
+              "CFE_TBL_Load",
+              "Delta segments shorter than header claims");
+
+    /* Test attempt to load a truncated delta image */
+    UT_InitData();
+    UT_SetReadBuffer(&File, sizeof(File));
+    UT_SetReadHeader(&StdFileHeader, sizeof(StdFileHeader));
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 2, 0);
+    RtnCode = CFE_TBL_Load(App1TblHandle1,
+                           CFE_TBL_SRC_FILE,
+                           "TblSrcFileName.dat");
+    EventsCorrect = (UT_EventIsInHistory(CFE_TBL_FILE_INCOMPLETE_ERR_EID) == true &&
+                     UT_GetNumEventsSent() == 1);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_TBL_ERR_LOAD_INCOMPLETE && EventsCorrect,
+              "CFE_TBL_Load",
+              "Delta image missing segment header");
+
+    /* Set up a table that spans several CRC regions */
+    UT_InitData();
+    UT_ResetTableRegistry();
+    RtnCode = CFE_TBL_Register(&App1TblHandle2, "UT_Table3",
+                               sizeof(LargeData),
+                               CFE_TBL_OPT_DBL_BUFFER,
+                               NULL);
+    AccessDescPtr = &CFE_TBL_TaskData.Handles[App1TblHandle2];
+    RegRecPtr = &CFE_TBL_TaskData.Registry[AccessDescPtr->RegIndex];
+    memset(LargeData, 0xA5, sizeof(LargeData));
+    RtnCode = (RtnCode == CFE_SUCCESS) ?
+              CFE_TBL_Load(App1TblHandle2, CFE_TBL_SRC_ADDRESS, LargeData) : RtnCode;
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_SUCCESS &&
+              RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].RegionCrcValid,
+              "CFE_TBL_Load",
+              "Initial load of a multi-region table (setup)");
+
+    /* Test that a delta image applied to a seeded buffer only recomputes the regions it touches */
+    memset(&File, 0, sizeof(File));
+    strncpy((char *)File.TblHeader.TableName, "ut_cfe_tbl.UT_Table3",
+            sizeof(File.TblHeader.TableName));
+    File.TblHeader.NumBytes = sizeof(File.SegHeader) + sizeof(File.SegData);
+    File.TblHeader.Offset = 0;
+    File.TblHeader.NumSegments = 1;
+    File.SegHeader.Offset = sizeof(File.SegData);
+    File.SegHeader.NumBytes = sizeof(File.SegData);
+    File.SegData = 0x5A5A5A5A;
+
+    if (UT_Endianess == UT_LITTLE_ENDIAN)
+    {
+        CFE_TBL_ByteSwapTblHeader(&File.TblHeader);
+        CFE_TBL_ByteSwapUint32(&File.SegHeader.Offset);
+        CFE_TBL_ByteSwapUint32(&File.SegHeader.NumBytes);
+    }
+
+    UT_InitData();
+    UT_SetReadBuffer(&File, sizeof(File));
+    UT_SetReadHeader(&StdFileHeader, sizeof(StdFileHeader));
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 4, 0);
+    RtnCode = CFE_TBL_Load(App1TblHandle2,
+                           CFE_TBL_SRC_FILE,
+                           "TblSrcFileName.dat");
+    LargePtr = (uint8 *)RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].BufferPtr;
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_SUCCESS &&
+              LargePtr[sizeof(File.SegData)] == 0x5A &&
+              LargePtr[sizeof(LargeData) - 1] == 0xA5 &&
+              RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].RegionCrcValid &&
+              UT_GetStubCount(UT_KEY(CFE_ES_CalculateCRC)) == 2,
+              "CFE_TBL_Load",
+              "Delta image on a seeded buffer only recomputes the touched region");
+}
+
+/*
+** Hook that gives a table to another application while it is being validated
+*/
+static int32 UT_TBL_ChangeOwnerHook(void *UserObj, int32 StubRetcode,
+                                    uint32 CallCount,
+                                    const UT_StubContext_t *Context)
+{
+    CFE_TBL_RegistryRec_t *RegRecPtr = UserObj;
+
+    RegRecPtr->OwnerAppId = 2;
+
+    return StubRetcode;
+}
+
+/*
+** Function to test background table validation
+*/
+void Test_CFE_TBL_BackgroundValidation(void)
+{
+    int32                      RtnCode;
+    int32                      i;
+    CFE_TBL_Validate_t         ValidateCmd;
+    CFE_TBL_RegistryRec_t      *RegRecPtr;
+    CFE_TBL_AccessDescriptor_t *AccessDescPtr;
+
+#ifdef UT_VERBOSE
+    UT_Text("Begin Test Background Validation\n");
+#endif
+
+    /* Test starting the validation workers */
+    UT_InitData();
+    CFE_TBL_StartValidationWorkers();
+    UT_Report(__FILE__, __LINE__,
+              CFE_TBL_TaskData.NumValidationWorkers == CFE_PLATFORM_TBL_NUM_VALIDATION_WORKERS &&
+              UT_GetStubCount(UT_KEY(CFE_ES_CreateChildTask)) == CFE_PLATFORM_TBL_NUM_VALIDATION_WORKERS,
+              "CFE_TBL_StartValidationWorkers",
+              "Validation workers started");
+
+    /* Test failure to create a validation worker */
+    UT_InitData();
+    UT_SetForceFail(UT_KEY(CFE_ES_CreateChildTask), CFE_ES_ERR_CHILD_TASK_CREATE);
+    CFE_TBL_StartValidationWorkers();
+    UT_Report(__FILE__, __LINE__,
+              CFE_TBL_TaskData.NumValidationWorkers == 0,
+              "CFE_TBL_StartValidationWorkers",
+              "Validation worker creation failure");
+
+    /* Test failure to create the validation worker semaphore */
+    UT_InitData();
+    UT_SetForceFail(UT_KEY(OS_CountSemCreate), OS_ERROR);
+    CFE_TBL_StartValidationWorkers();
+    UT_Report(__FILE__, __LINE__,
+              CFE_TBL_TaskData.NumValidationWorkers == 0 &&
+              UT_GetStubCount(UT_KEY(CFE_ES_CreateChildTask)) == 0,
+              "CFE_TBL_StartValidationWorkers",
+              "Validation semaphore creation failure");
+
+    /* Set up a double buffered table with a validation function */
+    UT_InitData();
+    UT_SetAppID(1);
+    UT_ResetTableRegistry();
+
+    for (i = 0; i < CFE_PLATFORM_TBL_MAX_NUM_VALIDATIONS; i++)
+    {
+        CFE_TBL_TaskData.ValidationResults[i].State = CFE_TBL_VALIDATION_FREE;
+    }
+
+    RtnCode = CFE_TBL_Register(&App1TblHandle1, "UT_Table1",
+                               sizeof(UT_Table1_t),
+                               CFE_TBL_OPT_DBL_BUFFER,
+                               Test_CFE_TBL_ValidationFunc);
+    AccessDescPtr = &CFE_TBL_TaskData.Handles[App1TblHandle1];
+    RegRecPtr = &CFE_TBL_TaskData.Registry[AccessDescPtr->RegIndex];
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_SUCCESS && RegRecPtr->ValidationDutyCycle == 0,
+              "CFE_TBL_Register",
+              "Background validation (setup)");
+
+    /* Test opting into background validation with no workers running */
+    UT_InitData();
+    RtnCode = CFE_TBL_ValidateInBackground(App1TblHandle1, 50);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_TBL_NOT_IMPLEMENTED && RegRecPtr->ValidationDutyCycle == 0,
+              "CFE_TBL_ValidateInBackground",
+              "No validation workers");
+
+    /* Test opting into background validation with an invalid CPU budget */
+    UT_InitData();
+    CFE_TBL_TaskData.NumValidationWorkers = 1;
+    RtnCode = CFE_TBL_ValidateInBackground(App1TblHandle1, 101);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_TBL_ERR_INVALID_OPTIONS && RegRecPtr->ValidationDutyCycle == 0,
+              "CFE_TBL_ValidateInBackground",
+              "Invalid CPU budget");
+
+    /* Test opting into background validation by an application that doesn't own the table */
+    UT_InitData();
+    RegRecPtr->OwnerAppId = CFE_TBL_NOT_OWNED;
+    RtnCode = CFE_TBL_ValidateInBackground(App1TblHandle1, 50);
+    RegRecPtr->OwnerAppId = 1;
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_TBL_ERR_NO_ACCESS && RegRecPtr->ValidationDutyCycle == 0,
+              "CFE_TBL_ValidateInBackground",
+              "Table not owned by caller");
+
+    /* Test successfully opting into background validation */
+    UT_InitData();
+    RtnCode = CFE_TBL_ValidateInBackground(App1TblHandle1, 50);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_SUCCESS && RegRecPtr->ValidationDutyCycle == 50 &&
+              UT_GetStubCount(UT_KEY(OS_CountSemGive)) == 0,
+              "CFE_TBL_ValidateInBackground",
+              "Background validation enabled");
+
+    /* Test that a validation request wakes a worker instead of notifying the owner */
+    UT_InitData();
+    CFE_TBL_NotifyByMessage(App1TblHandle1, CFE_SB_ValueToMsgId(1), 1, 1);
+    strncpy((char *)ValidateCmd.Payload.TableName, RegRecPtr->Name,
+            sizeof(ValidateCmd.Payload.TableName));
+    ValidateCmd.Payload.ActiveTableFlag = CFE_TBL_BufferSelect_INACTIVE;
+    UT_Report(__FILE__, __LINE__,
+              CFE_TBL_ValidateCmd(&ValidateCmd) == CFE_TBL_INC_CMD_CTR &&
+              RegRecPtr->ValidateInactiveIndex != CFE_TBL_NO_VALIDATION_PENDING &&
+              UT_GetStubCount(UT_KEY(OS_CountSemGive)) == 1 &&
+              UT_GetStubCount(UT_KEY(CFE_SB_SendMsg)) == 0,
+              "CFE_TBL_ValidateCmd",
+              "Validation request handed to workers");
+
+    /* Test that the owner is neither asked nor able to perform the validation itself */
+    UT_InitData();
+    UT_Report(__FILE__, __LINE__,
+              CFE_TBL_GetStatus(App1TblHandle1) == CFE_SUCCESS &&
+              CFE_TBL_Validate(App1TblHandle1) == CFE_TBL_INFO_NO_VALIDATION_PENDING &&
+              CFE_TBL_Manage(App1TblHandle1) == CFE_SUCCESS &&
+              UT_GetStubCount(UT_KEY(Test_CFE_TBL_ValidationFunc)) == 0,
+              "CFE_TBL_Manage",
+              "Background validation not performed by owner");
+
+    /* Test a worker performing the validation and notifying the owner */
+    UT_InitData();
+    i = RegRecPtr->ValidateInactiveIndex;
+    CFE_TBL_RunBackgroundValidation();
+    UT_Report(__FILE__, __LINE__,
+              UT_GetStubCount(UT_KEY(Test_CFE_TBL_ValidationFunc)) == 1 &&
+              CFE_TBL_TaskData.ValidationResults[i].State == CFE_TBL_VALIDATION_PERFORMED &&
+              RegRecPtr->Buffers[1 - RegRecPtr->ActiveBufferIndex].Validated &&
+              RegRecPtr->ValidateInactiveIndex == CFE_TBL_NO_VALIDATION_PENDING &&
+              !RegRecPtr->ValidationBusy &&
+              UT_GetStubCount(UT_KEY(CFE_SB_SendMsg)) == 1,
+              "CFE_TBL_RunBackgroundValidation",
+              "Validation performed and owner notified");
+
+    /* Test that a worker does not notify an application that no longer owns the table */
+    UT_InitData();
+    CFE_TBL_TaskData.ValidationResults[i].State = CFE_TBL_VALIDATION_PENDING;
+    RegRecPtr->ValidateActiveIndex = i;
+    UT_SetHookFunction(UT_KEY(Test_CFE_TBL_ValidationFunc), UT_TBL_ChangeOwnerHook, RegRecPtr);
+    CFE_TBL_RunBackgroundValidation();
+    UT_Report(__FILE__, __LINE__,
+              UT_GetStubCount(UT_KEY(Test_CFE_TBL_ValidationFunc)) == 1 &&
+              RegRecPtr->ValidateActiveIndex == CFE_TBL_NO_VALIDATION_PENDING &&
+              !RegRecPtr->ValidationBusy &&
+              UT_GetStubCount(UT_KEY(CFE_SB_SendMsg)) == 0,
+              "CFE_TBL_RunBackgroundValidation",
+              "Owner changed during validation");
+    RegRecPtr->OwnerAppId = 1;
+
+    /* Test that releasing a held table hands its pending validation to the workers */
+    UT_InitData();
+    RegRecPtr->ValidateActiveIndex = i;
+    CFE_TBL_HoldValidation(RegRecPtr);
+    CFE_TBL_RunBackgroundValidation();
+    UT_Report(__FILE__, __LINE__,
+              UT_GetStubCount(UT_KEY(Test_CFE_TBL_ValidationFunc)) == 0 &&
+              RegRecPtr->ValidationBusy,
+              "CFE_TBL_HoldValidation",
+              "Workers kept away from held table");
+    CFE_TBL_ReleaseValidation(RegRecPtr);
+    UT_Report(__FILE__, __LINE__,
+              !RegRecPtr->ValidationBusy &&
+              UT_GetStubCount(UT_KEY(OS_CountSemGive)) == 1,
+              "CFE_TBL_ReleaseValidation",
+              "Pending validation handed to workers");
+
+    /* Test that a worker skips a table another worker is already validating */
+    UT_InitData();
+    CFE_TBL_TaskData.ValidationResults[i].State = CFE_TBL_VALIDATION_PENDING;
+    RegRecPtr->ValidateActiveIndex = i;
+    RegRecPtr->ValidationBusy = true;
+    CFE_TBL_RunBackgroundValidation();
+    UT_Report(__FILE__, __LINE__,
+              UT_GetStubCount(UT_KEY(Test_CFE_TBL_ValidationFunc)) == 0 &&
+              RegRecPtr->ValidateActiveIndex == i,
+              "CFE_TBL_RunBackgroundValidation",
+              "Table already being validated");
+
+    /* Test the worker main loop performing the validation before exiting */
+    UT_InitData();
+    RegRecPtr->ValidationBusy = false;
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemTake), 2, OS_ERROR);
+    CFE_TBL_ValidationWorkerMain();
+    UT_Report(__FILE__, __LINE__,
+              UT_GetStubCount(UT_KEY(Test_CFE_TBL_ValidationFunc)) == 1 &&
+              RegRecPtr->ValidateActiveIndex == CFE_TBL_NO_VALIDATION_PENDING &&
+              UT_GetStubCount(UT_KEY(CFE_ES_ExitChildTask)) == 1,
+              "CFE_TBL_ValidationWorkerMain",
+              "Worker validates, then exits when semaphore fails");
+
+    /* Test that returning to owner validation hands pending validations back */
+    UT_InitData();
+    CFE_TBL_TaskData.ValidationResults[i].State = CFE_TBL_VALIDATION_PENDING;
+    RegRecPtr->ValidateActiveIndex = i;
+    RtnCode = CFE_TBL_ValidateInBackground(App1TblHandle1, 0);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_SUCCESS && RegRecPtr->ValidationDutyCycle == 0 &&
+              CFE_TBL_GetStatus(App1TblHandle1) == CFE_TBL_INFO_VALIDATION_PENDING,
+              "CFE_TBL_ValidateInBackground",
+              "Background validation disabled");
+
+    CFE_TBL_TaskData.ValidationResults[i].State = CFE_TBL_VALIDATION_FREE;
+    CFE_TBL_TaskData.NumValidationWorkers = 0;
+}
+
+/*
+** Function to test looking up tables by name in a full registry
+*/
+void Test_CFE_TBL_RegistryIndex(void)
+{
+    int32            i;
+    int32            NumBad;
+    int32            RtnCode;
+    char             TblName[CFE_MISSION_TBL_MAX_NAME_LENGTH];
+    char             FullName[CFE_TBL_MAX_FULL_NAME_LEN];
+    CFE_TBL_Handle_t Handles[CFE_PLATFORM_TBL_MAX_NUM_TABLES];
+
+#ifdef UT_VERBOSE
+    UT_Text("Begin Test Registry Index\n");
+#endif
+
+    /* Test that every table in a full registry is found by name */
+    UT_InitData();
+    UT_SetAppID(1);
+    UT_ResetTableRegistry();
+    NumBad = 0;
+
+    for (i = 0; i < CFE_PLATFORM_TBL_MAX_NUM_TABLES; i++)
+    {
+        snprintf(TblName, sizeof(TblName), "UT_Idx%d", (int)i);
+        RtnCode = CFE_TBL_Register(&Handles[i], TblName, sizeof(UT_Table1_t),
+                                   CFE_TBL_OPT_DEFAULT, NULL);
+        snprintf(FullName, sizeof(FullName), "ut_cfe_tbl.UT_Idx%d", (int)i);
+
+        if (RtnCode != CFE_SUCCESS ||
+            CFE_TBL_FindTableInRegistry(FullName) != CFE_TBL_TaskData.Handles[Handles[i]].RegIndex)
+        {
+            NumBad++;
+        }
+    }
+
+    UT_Report(__FILE__, __LINE__,
+              NumBad == 0 &&
+              CFE_TBL_FindTableInRegistry("ut_cfe_tbl.UT_Idx") == CFE_TBL_NOT_FOUND,
+              "CFE_TBL_FindTableInRegistry",
+              "All tables in a full registry found by name");
+
+    /* Test that unregistered tables are no longer found while the rest still are */
+    UT_InitData();
+    NumBad = 0;
+
+    for (i = 0; i < CFE_PLATFORM_TBL_MAX_NUM_TABLES; i += 2)
+    {
+        CFE_TBL_Unregister(Handles[i]);
+    }
+
+    for (i = 0; i < CFE_PLATFORM_TBL_MAX_NUM_TABLES; i++)
+    {
+        snprintf(FullName, sizeof(FullName), "ut_cfe_tbl.UT_Idx%d", (int)i);
+        RtnCode = CFE_TBL_FindTableInRegistry(FullName);
+
+        if ((i % 2) == 0 ? (RtnCode != CFE_TBL_NOT_FOUND) :
+                           (RtnCode != CFE_TBL_TaskData.Handles[Handles[i]].RegIndex))
+        {
+            NumBad++;
+        }
+    }
+
+    UT_Report(__FILE__, __LINE__,
+              NumBad == 0,
+              "CFE_TBL_FindTableInRegistry",
+              "Unregistered tables no longer found by name");
+
+    /* Test that tables registered again are found by name */
+    UT_InitData();
+    NumBad = 0;
+
+    for (i = 0; i < CFE_PLATFORM_TBL_MAX_NUM_TABLES; i += 2)
+    {
+        snprintf(TblName, sizeof(TblName), "UT_Idx%d", (int)i);
+        RtnCode = CFE_TBL_Register(&Handles[i], TblName, sizeof(UT_Table1_t),
+                                   CFE_TBL_OPT_DEFAULT, NULL);
+        snprintf(FullName, sizeof(FullName), "ut_cfe_tbl.UT_Idx%d", (int)i);
+
+        if (RtnCode != CFE_SUCCESS ||
+            CFE_TBL_FindTableInRegistry(FullName) != CFE_TBL_TaskData.Handles[Handles[i]].RegIndex)
+        {
+            NumBad++;
+        }
+    }
+
+    UT_Report(__FILE__, __LINE__,
+              NumBad == 0,
+              "CFE_TBL_FindTableInRegistry",
+              "Tables registered again found by name");
+
+    /* Test that a duplicate registration is still detected through the index */
+    UT_InitData();
+    RtnCode = CFE_TBL_Register(&Handles[0], "UT_Idx1", sizeof(UT_Table1_t),
+                               CFE_TBL_OPT_DEFAULT, NULL);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_TBL_WARN_DUPLICATE,
+              "CFE_TBL_Register",
+              "Duplicate registration found by name");
+}
+
 /*
 ** Function to test obtaining the current address of the contents
 ** of the specified table
@@ -3921,6 +4712,7 @@ void Test_CFE_TBL_TblMod(void)
     FileHeader.SubType = CFE_FS_SubType_TBL_IMG;
     FileHeader.TimeSeconds = 1704;
     FileHeader.TimeSubSeconds = 104;
+    memset(&File, 0, sizeof(File));
     strncpy((char *)File.TblHeader.TableName, "ut_cfe_tbl.UT_Table1",
             sizeof(File.TblHeader.TableName));
     File.TblHeader.NumBytes = sizeof(UT_Table1_t);
@@ -4160,6 +4952,7 @@ void Test_CFE_TBL_Internal(void)
     StdFileHeader.Description[CFE_FS_HDR_DESC_MAX_LEN - 1] = '\0';
     StdFileHeader.ContentType = CFE_FS_FILE_CONTENT_ID;
     StdFileHeader.SubType = CFE_FS_SubType_TBL_IMG;
+    memset(&TblFileHeader, 0, sizeof(TblFileHeader));
     strncpy((char *)TblFileHeader.TableName, "ut_cfe_tbl.UT_Table2",
             sizeof(TblFileHeader.TableName));
     TblFileHeader.NumBytes = sizeof(UT_Table1_t);
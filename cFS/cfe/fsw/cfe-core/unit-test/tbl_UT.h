@@ -69,6 +69,13 @@ typedef struct
     UT_Table1_t        TblData;
 } UT_TempFile_t;
 
+typedef struct
+{
+    CFE_TBL_File_Hdr_t    TblHeader;
+    CFE_TBL_File_SegHdr_t SegHeader;
+    uint32                SegData;
+} UT_DeltaFile_t;
+
 
 /* TBL unit test functions */
 
@@ -573,6 +580,90 @@ void Test_CFE_TBL_NotifyByMessage(void);
 ******************************************************************************/
 void Test_CFE_TBL_Load(void);
 
+/*****************************************************************************/
+/**
+** \brief Test loading tables registered with the mapped image option
+**
+** \par Description
+**        This function tests registering, loading, reloading and unregistering
+**        a table whose buffers are mapped from the table image file.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #UT_Text, #UT_InitData, #UT_SetAppID, #UT_ResetTableRegistry,
+** \sa #CFE_TBL_Register, #UT_EventIsInHistory, #UT_GetNumEventsSent,
+** \sa #UT_Report, #CFE_TBL_ByteSwapUint32, #UT_SetReadBuffer,
+** \sa #UT_SetReadHeader, #CFE_TBL_Load, #CFE_TBL_Unregister
+**
+******************************************************************************/
+void Test_CFE_TBL_MappedLoad(void);
+
+/*****************************************************************************/
+/**
+** \brief Function to test loading delta table images
+**
+** \par Description
+**        This function tests loading tables from files containing only
+**        the segments of the table that have changed.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #UT_InitData, #UT_SetAppID, #UT_ResetTableRegistry, #CFE_TBL_Register,
+** \sa #UT_Report, #UT_SetReadBuffer, #UT_SetReadHeader, #CFE_TBL_Load
+**
+******************************************************************************/
+void Test_CFE_TBL_DeltaLoad(void);
+
+/*****************************************************************************/
+/**
+** \brief Function to test background table validation
+**
+** \par Description
+**        This function tests opting tables into validation by the Table
+**        Services validation workers, and the workers themselves.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #UT_InitData, #UT_SetAppID, #UT_ResetTableRegistry, #CFE_TBL_Register,
+** \sa #CFE_TBL_ValidateInBackground, #CFE_TBL_RunBackgroundValidation,
+** \sa #CFE_TBL_StartValidationWorkers, #CFE_TBL_ValidationWorkerMain, #UT_Report
+**
+******************************************************************************/
+void Test_CFE_TBL_BackgroundValidation(void);
+
+/*****************************************************************************/
+/**
+** \brief Function to test looking up tables by name in a full registry
+**
+** \par Description
+**        This function tests that the table registry name index stays
+**        consistent as tables are registered, unregistered and registered
+**        again.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #UT_InitData, #UT_SetAppID, #UT_ResetTableRegistry, #CFE_TBL_Register,
+** \sa #CFE_TBL_Unregister, #CFE_TBL_FindTableInRegistry, #UT_Report
+**
+******************************************************************************/
+void Test_CFE_TBL_RegistryIndex(void);
+
 /*****************************************************************************/
 /**
 ** \brief Function to test obtaining the current address of the contents
@@ -211,6 +211,7 @@ void UtTest_Setup(void)
     UT_ADD_TEST(Test_TimeOp);
     UT_ADD_TEST(Test_ConvertTime);
     UT_ADD_TEST(Test_Print);
+    UT_ADD_TEST(Test_TimeArrayOps);
     UT_ADD_TEST(Test_RegisterSyncCallbackTrue);
     UT_ADD_TEST(Test_ExternalTone);
     UT_ADD_TEST(Test_External);
@@ -218,9 +219,11 @@ void UtTest_Setup(void)
     UT_ADD_TEST(Test_ResetArea);
     UT_ADD_TEST(Test_State);
     UT_ADD_TEST(Test_GetReference);
+    UT_ADD_TEST(Test_CalculateCurrent);
     UT_ADD_TEST(Test_Tone);
     UT_ADD_TEST(Test_1Hz);
     UT_ADD_TEST(Test_UnregisterSynchCallback);
+    UT_ADD_TEST(Test_MinorFrame);
     UT_ADD_TEST(Test_CleanUpApp);
 }
 
@@ -1216,6 +1219,193 @@ void Test_Print(void)
               result,
               "CFE_TIME_Print",
               testDesc);
+
+    /* Test the last day of a leap year */
+    UT_InitData();
+    time.Subseconds = 0;
+    time.Seconds = 662688000;
+    CFE_TIME_Print(testDesc, time);
+    result = !strcmp(testDesc, "2000-366-00:00:00.00000");
+    strncat(testDesc," Last day of a leap year",
+            UT_MAX_MESSAGE_LENGTH - strlen(testDesc));
+    UT_Report(__FILE__, __LINE__,
+              result,
+              "CFE_TIME_Print",
+              testDesc);
+
+    /* Test the first day of the year after a leap year */
+    UT_InitData();
+    time.Subseconds = 0;
+    time.Seconds = 31622400;
+    CFE_TIME_Print(testDesc, time);
+    result = !strcmp(testDesc, "1981-001-00:00:00.00000");
+    strncat(testDesc," First day after a leap year",
+            UT_MAX_MESSAGE_LENGTH - strlen(testDesc));
+    UT_Report(__FILE__, __LINE__,
+              result,
+              "CFE_TIME_Print",
+              testDesc);
+
+    /* Test a century year that is not a leap year (2100-03-01) */
+    UT_InitData();
+    time.Subseconds = 0;
+    time.Seconds = 3792009600;
+    CFE_TIME_Print(testDesc, time);
+    result = !strcmp(testDesc, "2100-060-00:00:00.00000");
+    strncat(testDesc," Century year is not a leap year",
+            UT_MAX_MESSAGE_LENGTH - strlen(testDesc));
+    UT_Report(__FILE__, __LINE__,
+              result,
+              "CFE_TIME_Print",
+              testDesc);
+}
+
+/*
+** Rollover, carry and rounding edge values for the array operation tests
+*/
+static const uint32 UT_TimeEdgeValues[] =
+{
+    0, 1, 0xffff, 0x3ffffff, 0x4000000, 0x7fffffff, 0x80000000,
+    0x80001000, 0x80001001, 0x80002000, 0xffffdf00, 0xffffdf01,
+    0xffffe000, 0xfffff000, 0xffffffff, 999998, 999999, 1000000,
+    500000, 500001, 12345, 0x12345678, 0xdeadbeef
+};
+
+#define UT_TIME_NUM_EDGE_VALUES (sizeof(UT_TimeEdgeValues) / sizeof(UT_TimeEdgeValues[0]))
+
+/*
+** Test the array time operations and conversions against the single value
+** functions
+*/
+void Test_TimeArrayOps(void)
+{
+    CFE_TIME_SysTime_t TimeA[UT_TIME_NUM_EDGE_VALUES * UT_TIME_NUM_EDGE_VALUES];
+    CFE_TIME_SysTime_t TimeB;
+    CFE_TIME_SysTime_t Result[UT_TIME_NUM_EDGE_VALUES * UT_TIME_NUM_EDGE_VALUES];
+    CFE_TIME_Compare_t CompareResult[UT_TIME_NUM_EDGE_VALUES * UT_TIME_NUM_EDGE_VALUES];
+    uint32 Converted[UT_TIME_NUM_EDGE_VALUES];
+    uint32 AddErrors = 0;
+    uint32 SubtractErrors = 0;
+    uint32 CompareErrors = 0;
+    uint32 ConvertErrors = 0;
+    uint32 i;
+    uint32 j;
+    uint32 k;
+
+#ifdef UT_VERBOSE
+    UT_Text("Begin Test Time Array Operations\n");
+#endif
+
+    UT_InitData();
+
+    /* Every pairing of the edge values as seconds and subseconds */
+    for (i = 0; i < UT_TIME_NUM_EDGE_VALUES; i++)
+    {
+        for (j = 0; j < UT_TIME_NUM_EDGE_VALUES; j++)
+        {
+            TimeA[(i * UT_TIME_NUM_EDGE_VALUES) + j].Seconds = UT_TimeEdgeValues[i];
+            TimeA[(i * UT_TIME_NUM_EDGE_VALUES) + j].Subseconds = UT_TimeEdgeValues[j];
+        }
+    }
+
+    for (k = 0; k < UT_TIME_NUM_EDGE_VALUES * UT_TIME_NUM_EDGE_VALUES; k++)
+    {
+        TimeB = TimeA[(k * 7) % (UT_TIME_NUM_EDGE_VALUES * UT_TIME_NUM_EDGE_VALUES)];
+
+        CFE_TIME_AddArray(Result, TimeA, TimeB, UT_TIME_NUM_EDGE_VALUES * UT_TIME_NUM_EDGE_VALUES);
+        for (i = 0; i < UT_TIME_NUM_EDGE_VALUES * UT_TIME_NUM_EDGE_VALUES; i++)
+        {
+            if (Result[i].Seconds != CFE_TIME_Add(TimeA[i], TimeB).Seconds ||
+                Result[i].Subseconds != CFE_TIME_Add(TimeA[i], TimeB).Subseconds)
+            {
+                ++AddErrors;
+            }
+        }
+
+        CFE_TIME_SubtractArray(Result, TimeA, TimeB, UT_TIME_NUM_EDGE_VALUES * UT_TIME_NUM_EDGE_VALUES);
+        for (i = 0; i < UT_TIME_NUM_EDGE_VALUES * UT_TIME_NUM_EDGE_VALUES; i++)
+        {
+            if (Result[i].Seconds != CFE_TIME_Subtract(TimeA[i], TimeB).Seconds ||
+                Result[i].Subseconds != CFE_TIME_Subtract(TimeA[i], TimeB).Subseconds)
+            {
+                ++SubtractErrors;
+            }
+        }
+
+        CFE_TIME_CompareArray(CompareResult, TimeA, TimeB, UT_TIME_NUM_EDGE_VALUES * UT_TIME_NUM_EDGE_VALUES);
+        for (i = 0; i < UT_TIME_NUM_EDGE_VALUES * UT_TIME_NUM_EDGE_VALUES; i++)
+        {
+            if (CompareResult[i] != CFE_TIME_Compare(TimeA[i], TimeB))
+            {
+                ++CompareErrors;
+            }
+        }
+    }
+
+    UT_Report(__FILE__, __LINE__,
+              AddErrors == 0,
+              "CFE_TIME_AddArray",
+              "Array sums match CFE_TIME_Add");
+
+    UT_Report(__FILE__, __LINE__,
+              SubtractErrors == 0,
+              "CFE_TIME_SubtractArray",
+              "Array differences match CFE_TIME_Subtract");
+
+    UT_Report(__FILE__, __LINE__,
+              CompareErrors == 0,
+              "CFE_TIME_CompareArray",
+              "Array comparisons match CFE_TIME_Compare");
+
+    /* Conversions, including the in place form */
+    CFE_TIME_Sub2MicroSecsArray(Converted, UT_TimeEdgeValues, UT_TIME_NUM_EDGE_VALUES);
+    for (i = 0; i < UT_TIME_NUM_EDGE_VALUES; i++)
+    {
+        if (Converted[i] != CFE_TIME_Sub2MicroSecs(UT_TimeEdgeValues[i]))
+        {
+            ++ConvertErrors;
+        }
+    }
+
+    memcpy(Converted, UT_TimeEdgeValues, sizeof(Converted));
+    CFE_TIME_Sub2MicroSecsArray(Converted, Converted, UT_TIME_NUM_EDGE_VALUES);
+    for (i = 0; i < UT_TIME_NUM_EDGE_VALUES; i++)
+    {
+        if (Converted[i] != CFE_TIME_Sub2MicroSecs(UT_TimeEdgeValues[i]))
+        {
+            ++ConvertErrors;
+        }
+    }
+
+    UT_Report(__FILE__, __LINE__,
+              ConvertErrors == 0,
+              "CFE_TIME_Sub2MicroSecsArray",
+              "Array conversions match CFE_TIME_Sub2MicroSecs");
+
+    ConvertErrors = 0;
+    CFE_TIME_Micro2SubSecsArray(Converted, UT_TimeEdgeValues, UT_TIME_NUM_EDGE_VALUES);
+    for (i = 0; i < UT_TIME_NUM_EDGE_VALUES; i++)
+    {
+        if (Converted[i] != CFE_TIME_Micro2SubSecs(UT_TimeEdgeValues[i]))
+        {
+            ++ConvertErrors;
+        }
+    }
+
+    memcpy(Converted, UT_TimeEdgeValues, sizeof(Converted));
+    CFE_TIME_Micro2SubSecsArray(Converted, Converted, UT_TIME_NUM_EDGE_VALUES);
+    for (i = 0; i < UT_TIME_NUM_EDGE_VALUES; i++)
+    {
+        if (Converted[i] != CFE_TIME_Micro2SubSecs(UT_TimeEdgeValues[i]))
+        {
+            ++ConvertErrors;
+        }
+    }
+
+    UT_Report(__FILE__, __LINE__,
+              ConvertErrors == 0,
+              "CFE_TIME_Micro2SubSecsArray",
+              "Array conversions match CFE_TIME_Micro2SubSecs");
 }
 
 /*
@@ -2660,6 +2850,97 @@ void Test_GetReference(void)
               "Local clock > latch at tone time");
 }
 
+/*
+** Test that the precomputed current time matches the time calculated
+** from the full reference data
+*/
+void Test_CalculateCurrent(void)
+{
+    CFE_TIME_Reference_t Reference;
+    CFE_TIME_SysTime_t Expected;
+    CFE_TIME_SysTime_t Actual;
+    volatile CFE_TIME_ReferenceState_t *RefState;
+    uint32 Mismatches = 0;
+    uint32 Case;
+    uint32 Clock;
+
+    /* AtToneMET, AtToneSTCF, AtToneDelay, AtToneLatch, leap seconds, delay direction */
+    static const struct
+    {
+        uint32 METSecs, METSubs, STCFSecs, STCFSubs, DelaySecs, DelaySubs, LatchSecs, LatchSubs;
+        int16  Leaps;
+        int16  Direction;
+    } Cases[] =
+    {
+        { 20, 0, 3600, 0, 0, 0, 10, 0, 32, CFE_TIME_AdjustDirection_ADD },
+        { 1000, 0xF0000000, 0, 0x20000000, 0, 0x30000000, 999, 0xFFFFF000, 37, CFE_TIME_AdjustDirection_SUBTRACT },
+        { 0xFFFFFFF0, 0x80000000, 0x20, 0x90000000, 1, 0x7FFFFFFF, 500, 0x12345678, -5, CFE_TIME_AdjustDirection_ADD },
+        { 0, 0, 0xFFFFFFFF, 0xFFFFFFFF, 0, 0x10, 0, 0, 0, CFE_TIME_AdjustDirection_SUBTRACT },
+        { 123456, 0xABCDEF00, 0x40000000, 1, 0, 0, 0x80000010, 0x80000000, 18, CFE_TIME_AdjustDirection_ADD }
+    };
+
+    /* Local clock values (seconds, microseconds) at which each case is read */
+    static const uint32 Clocks[][2] =
+    {
+        { 0, 0 }, { 9, 999999 }, { 10, 0 }, { 15, 500000 }, { 999, 999999 },
+        { 501, 1 }, { 0x80000010, 0 }, { 0x80000011, 250000 }, { 0xFFFFFFFF, 999999 }
+    };
+
+#ifdef UT_VERBOSE
+    UT_Text("Begin Test Calculate Current\n");
+#endif
+
+    UT_InitData();
+    CFE_TIME_TaskData.MaxLocalClock.Seconds = 1000;
+    CFE_TIME_TaskData.MaxLocalClock.Subseconds = 0;
+
+    for (Case = 0; Case < sizeof(Cases) / sizeof(Cases[0]); Case++)
+    {
+        RefState = CFE_TIME_StartReferenceUpdate();
+        RefState->AtToneMET.Seconds = Cases[Case].METSecs;
+        RefState->AtToneMET.Subseconds = Cases[Case].METSubs;
+        RefState->AtToneSTCF.Seconds = Cases[Case].STCFSecs;
+        RefState->AtToneSTCF.Subseconds = Cases[Case].STCFSubs;
+        RefState->AtToneDelay.Seconds = Cases[Case].DelaySecs;
+        RefState->AtToneDelay.Subseconds = Cases[Case].DelaySubs;
+        RefState->AtToneLatch.Seconds = Cases[Case].LatchSecs;
+        RefState->AtToneLatch.Subseconds = Cases[Case].LatchSubs;
+        RefState->AtToneLeapSeconds = Cases[Case].Leaps;
+        RefState->DelayDirection = Cases[Case].Direction;
+        CFE_TIME_FinishReferenceUpdate(RefState);
+
+        for (Clock = 0; Clock < sizeof(Clocks) / sizeof(Clocks[0]); Clock++)
+        {
+            UT_SetBSP_Time(Clocks[Clock][0], Clocks[Clock][1]);
+            CFE_TIME_GetReference(&Reference);
+            Expected = CFE_TIME_CalculateTAI(&Reference);
+            UT_SetBSP_Time(Clocks[Clock][0], Clocks[Clock][1]);
+            Actual = CFE_TIME_GetTAI();
+
+            if (Expected.Seconds != Actual.Seconds || Expected.Subseconds != Actual.Subseconds)
+            {
+                ++Mismatches;
+            }
+
+            UT_SetBSP_Time(Clocks[Clock][0], Clocks[Clock][1]);
+            CFE_TIME_GetReference(&Reference);
+            Expected = CFE_TIME_CalculateUTC(&Reference);
+            UT_SetBSP_Time(Clocks[Clock][0], Clocks[Clock][1]);
+            Actual = CFE_TIME_GetUTC();
+
+            if (Expected.Seconds != Actual.Seconds || Expected.Subseconds != Actual.Subseconds)
+            {
+                ++Mismatches;
+            }
+        }
+    }
+
+    UT_Report(__FILE__, __LINE__,
+              Mismatches == 0,
+              "CFE_TIME_CalculateCurrent",
+              "TAI and UTC match full reference calculation");
+}
+
 /*
 ** Test send tone, and validate tone and data packet functions
 */
@@ -3289,6 +3570,238 @@ void Test_UnregisterSynchCallback(void)
               "Invalid time synch application");
 }
 
+/*
+** Minor frame callback; records the minor frame numbers it is called with
+*/
+uint32 ut_time_MinorFrames[8];
+uint32 ut_time_MinorFrameCalls;
+
+int32 ut_time_MyMinorFrameFunc(uint32 MinorFrame)
+{
+    if (ut_time_MinorFrameCalls < (sizeof(ut_time_MinorFrames) / sizeof(ut_time_MinorFrames[0])))
+    {
+        ut_time_MinorFrames[ut_time_MinorFrameCalls] = MinorFrame;
+    }
+
+    ut_time_MinorFrameCalls++;
+    return CFE_SUCCESS;
+}
+
+/*
+** Test minor frame callback registration, minor frame numbering and
+** jitter statistics
+*/
+void Test_MinorFrame(void)
+{
+    int32  Result;
+    uint32 i;
+    union
+    {
+        CFE_SB_Msg_t message;
+        CFE_TIME_NoArgsCmd_t cmd;
+    } CmdBuf;
+
+#ifdef UT_VERBOSE
+    UT_Text("Begin Test Minor Frame\n");
+#endif
+
+    /* Test registering with a bad application ID */
+    UT_InitData();
+    CFE_TIME_InitData();
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppID), 1, -1);
+    Result = CFE_TIME_RegisterMinorFrameCallback(&ut_time_MyMinorFrameFunc);
+    UT_Report(__FILE__, __LINE__,
+              Result == -1,
+              "CFE_TIME_RegisterMinorFrameCallback",
+              "Bad application ID");
+
+    /* Test registering twice from the same application */
+    UT_InitData();
+    UT_SetAppID(2);
+    Result = CFE_TIME_RegisterMinorFrameCallback(&ut_time_MyMinorFrameFunc);
+    UT_Report(__FILE__, __LINE__,
+              Result == CFE_SUCCESS,
+              "CFE_TIME_RegisterMinorFrameCallback",
+              "Successfully register callback");
+
+    Result = CFE_TIME_RegisterMinorFrameCallback(&ut_time_MyMinorFrameFunc);
+    UT_Report(__FILE__, __LINE__,
+              Result == CFE_TIME_TOO_MANY_SYNCH_CALLBACKS,
+              "CFE_TIME_RegisterMinorFrameCallback",
+              "Second callback for the same application");
+
+    /* Test that nothing runs while minor frames are not configured */
+    UT_InitData();
+    ut_time_MinorFrameCalls = 0;
+    CFE_TIME_MinorFrameISR();
+    UT_Report(__FILE__, __LINE__,
+              ut_time_MinorFrameCalls == 0 && CFE_TIME_TaskData.MinorFrameCounter == 0,
+              "CFE_TIME_MinorFrameISR",
+              "Minor frames not configured");
+
+    /* Run 100Hz minor frames: the first after a tone is minor frame zero,
+     * then one 200us late, one 100us early, and one that is three periods
+     * (less 100us) after its predecessor, so skips two minor frames
+     */
+    UT_InitData();
+    CFE_TIME_TaskData.MinorFramePeriod = 10000;
+    CFE_TIME_TaskData.MinorFrameToneSeen = true;
+
+    UT_SetBSP_Time(100, 0);
+    CFE_TIME_MinorFrameTimerCallback(0, NULL);
+    UT_SetBSP_Time(100, 10200);
+    CFE_TIME_MinorFrameISR();
+    UT_SetBSP_Time(100, 20100);
+    CFE_TIME_MinorFrameISR();
+    UT_SetBSP_Time(100, 50000);
+    CFE_TIME_MinorFrameISR();
+
+    UT_Report(__FILE__, __LINE__,
+              ut_time_MinorFrameCalls == 4 &&
+              ut_time_MinorFrames[0] == 0 && ut_time_MinorFrames[1] == 1 &&
+              ut_time_MinorFrames[2] == 2 && ut_time_MinorFrames[3] == 5,
+              "CFE_TIME_MinorFrameISR",
+              "Minor frame numbering");
+
+    UT_Report(__FILE__, __LINE__,
+              CFE_TIME_TaskData.MinorFrameCounter == 4 &&
+              CFE_TIME_TaskData.MinorFrameSlipCounter == 2,
+              "CFE_TIME_MinorFrameISR",
+              "Minor frame and slip counts");
+
+    UT_Report(__FILE__, __LINE__,
+              CFE_TIME_TaskData.MinorFrameJitterMax == 200 &&
+              CFE_TIME_TaskData.MinorFrameJitterMin == -100 &&
+              CFE_TIME_TaskData.MinorFrameJitterLast == -100,
+              "CFE_TIME_MinorFrameISR",
+              "Minor frame jitter statistics");
+
+    /* Test wrapping at the end of the second, then restarting after a tone */
+    UT_InitData();
+    ut_time_MinorFrameCalls = 0;
+    CFE_TIME_TaskData.MinorFrame = 99;
+    UT_SetBSP_Time(100, 60000);
+    CFE_TIME_MinorFrameISR();
+    CFE_TIME_TaskData.MinorFrameToneSeen = true;
+    UT_SetBSP_Time(100, 70000);
+    CFE_TIME_MinorFrameISR();
+    UT_Report(__FILE__, __LINE__,
+              ut_time_MinorFrameCalls == 2 &&
+              ut_time_MinorFrames[0] == 0 && ut_time_MinorFrames[1] == 0,
+              "CFE_TIME_MinorFrameISR",
+              "Minor frame wraps, restarts after tone");
+
+    /* Test a tick that comes far less than a period after the previous one */
+    UT_InitData();
+    ut_time_MinorFrameCalls = 0;
+    UT_SetBSP_Time(100, 72000);
+    CFE_TIME_MinorFrameISR();
+    UT_Report(__FILE__, __LINE__,
+              ut_time_MinorFrames[0] == 1 &&
+              CFE_TIME_TaskData.MinorFrameJitterLast == -8000 &&
+              CFE_TIME_TaskData.MinorFrameJitterMin == -8000,
+              "CFE_TIME_MinorFrameISR",
+              "Early minor frame");
+
+    /* Test local clock rollover between minor frames */
+    UT_InitData();
+    CFE_TIME_TaskData.MaxLocalClock.Seconds = 100;
+    CFE_TIME_TaskData.MaxLocalClock.Subseconds = CFE_TIME_Micro2SubSecs(76000);
+    UT_SetBSP_Time(0, 6000);
+    CFE_TIME_MinorFrameISR();
+    UT_Report(__FILE__, __LINE__,
+              CFE_TIME_TaskData.MinorFrameJitterLast >= -1 &&
+              CFE_TIME_TaskData.MinorFrameJitterLast <= 1,
+              "CFE_TIME_MinorFrameISR",
+              "Local clock rollover");
+
+    /* Test that a gap too long to measure is not counted */
+    UT_InitData();
+    CFE_TIME_TaskData.MaxLocalClock.Seconds = CFE_PLATFORM_TIME_MAX_LOCAL_SECS;
+    CFE_TIME_TaskData.MaxLocalClock.Subseconds = CFE_PLATFORM_TIME_MAX_LOCAL_SUBS;
+    i = CFE_TIME_TaskData.MinorFrameSlipCounter;
+    CFE_TIME_TaskData.MinorFrameJitterLast = 0;
+    UT_SetBSP_Time(5000, 6000);
+    CFE_TIME_MinorFrameISR();
+    UT_Report(__FILE__, __LINE__,
+              CFE_TIME_TaskData.MinorFrameSlipCounter == i &&
+              CFE_TIME_TaskData.MinorFrameJitterLast == 0,
+              "CFE_TIME_MinorFrameISR",
+              "Unmeasurable gap");
+
+    /* Test that a valid tone restarts the minor frames */
+    UT_InitData();
+    CFE_TIME_TaskData.MinorFrameToneSeen = false;
+    CFE_TIME_TaskData.ToneSignalLatch.Seconds = 4999;
+    CFE_TIME_TaskData.ToneSignalLatch.Subseconds = 0;
+    UT_SetBSP_Time(5000, 0);
+    CFE_TIME_Tone1HzISR();
+    UT_Report(__FILE__, __LINE__,
+              CFE_TIME_TaskData.MinorFrameToneSeen == true,
+              "CFE_TIME_Tone1HzISR",
+              "Valid tone restarts minor frames");
+
+    /* Test the reset counters command clears the statistics */
+    UT_InitData();
+    memset(&CmdBuf, 0, sizeof(CmdBuf));
+    UT_CallTaskPipe(CFE_TIME_TaskPipe, &CmdBuf.message, sizeof(CmdBuf.cmd),
+            UT_TPID_CFE_TIME_CMD_RESET_COUNTERS_CC);
+    UT_Report(__FILE__, __LINE__,
+              CFE_TIME_TaskData.MinorFrameCounter == 0 &&
+              CFE_TIME_TaskData.MinorFrameSlipCounter == 0 &&
+              CFE_TIME_TaskData.MinorFrameJitterMin == 0 &&
+              CFE_TIME_TaskData.MinorFrameJitterMax == 0,
+              "CFE_TIME_ResetCountersCmd",
+              "Minor frame statistics reset");
+
+    /* Test that the first sample after a reset sets both jitter limits */
+    UT_InitData();
+    UT_SetBSP_Time(5000, 16300);
+    CFE_TIME_MinorFrameISR();
+    UT_Report(__FILE__, __LINE__,
+              CFE_TIME_TaskData.MinorFrameJitterLast == 300 &&
+              CFE_TIME_TaskData.MinorFrameJitterMin == 300 &&
+              CFE_TIME_TaskData.MinorFrameJitterMax == 300,
+              "CFE_TIME_MinorFrameISR",
+              "First jitter sample after reset");
+
+    /* Test unregistering, from the wrong and the right application */
+    UT_InitData();
+    UT_SetAppID(3);
+    Result = CFE_TIME_UnregisterMinorFrameCallback(&ut_time_MyMinorFrameFunc);
+    UT_Report(__FILE__, __LINE__,
+              Result == CFE_TIME_CALLBACK_NOT_REGISTERED,
+              "CFE_TIME_UnregisterMinorFrameCallback",
+              "Unregister with no callback");
+
+    UT_SetAppID(2);
+    Result = CFE_TIME_UnregisterMinorFrameCallback(&ut_time_MyMinorFrameFunc);
+    UT_Report(__FILE__, __LINE__,
+              Result == CFE_SUCCESS,
+              "CFE_TIME_UnregisterMinorFrameCallback",
+              "Successfully unregister callback");
+
+    UT_InitData();
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppID), 1, -1);
+    Result = CFE_TIME_UnregisterMinorFrameCallback(&ut_time_MyMinorFrameFunc);
+    UT_Report(__FILE__, __LINE__,
+              Result == -1,
+              "CFE_TIME_UnregisterMinorFrameCallback",
+              "Bad application ID");
+
+    /* Test that unregistered callbacks are not called */
+    UT_InitData();
+    ut_time_MinorFrameCalls = 0;
+    UT_SetBSP_Time(5000, 10000);
+    CFE_TIME_MinorFrameISR();
+    UT_Report(__FILE__, __LINE__,
+              ut_time_MinorFrameCalls == 0,
+              "CFE_TIME_MinorFrameISR",
+              "No callback after unregister");
+
+    CFE_TIME_TaskData.MinorFramePeriod = 0;
+}
+
 /*
 ** Test function to free resources associated with an application
 */
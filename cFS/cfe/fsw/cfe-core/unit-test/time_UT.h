@@ -173,6 +173,29 @@ void Test_ConvertTime(void);
 ******************************************************************************/
 void Test_Print(void);
 
+/*****************************************************************************/
+/**
+** \brief Test the array time operation and conversion functions
+**
+** \par Description
+**        This function tests that the array forms of the time add, subtract,
+**        compare and subseconds/microseconds conversion functions give the
+**        same results as the single value functions for combinations of
+**        rollover, carry and rounding edge values.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #UT_Text, #UT_InitData, #CFE_TIME_AddArray, #CFE_TIME_SubtractArray,
+** \sa #CFE_TIME_CompareArray, #CFE_TIME_Sub2MicroSecsArray,
+** \sa #CFE_TIME_Micro2SubSecsArray, #UT_Report
+**
+******************************************************************************/
+void Test_TimeArrayOps(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test function for use with register and unregister synch callback
@@ -348,6 +371,28 @@ void Test_State(void);
 ******************************************************************************/
 void Test_GetReference(void);
 
+/*****************************************************************************/
+/**
+** \brief Test the precomputed current time against the reference data
+**
+** \par Description
+**        This function tests that the current TAI and UTC computed from the
+**        offsets precomputed at each reference update match the values
+**        calculated from the full reference data, for a range of reference
+**        states and local clock values, including local clock rollover.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #UT_Text, #UT_InitData, #UT_SetBSP_Time, #CFE_TIME_GetReference,
+** \sa #CFE_TIME_CalculateCurrent, #UT_Report
+**
+******************************************************************************/
+void Test_CalculateCurrent(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test send tone, and validate tone and data packet functions
@@ -408,6 +453,28 @@ void Test_1Hz(void);
 ******************************************************************************/
 void Test_UnregisterSynchCallback(void);
 
+/*****************************************************************************/
+/**
+** \brief Test the minor frame scheduling functions
+**
+** \par Description
+**        This function tests minor frame callback registration, the minor
+**        frame numbering within a second and its restart at the tone, and
+**        the minor frame slip and jitter statistics.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #UT_Text, #UT_InitData, #UT_SetAppID, #UT_SetBSP_Time,
+** \sa #CFE_TIME_RegisterMinorFrameCallback, #CFE_TIME_MinorFrameISR,
+** \sa #CFE_TIME_UnregisterMinorFrameCallback, #UT_Report
+**
+******************************************************************************/
+void Test_MinorFrame(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test function to free resources associated with an application
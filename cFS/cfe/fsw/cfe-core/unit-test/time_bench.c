@@ -0,0 +1,448 @@
+/*
+**  GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**  Copyright (c) 2006-2019 United States Government as represented by
+**  the Administrator of the National Aeronautics and Space Administration.
+**  All Rights Reserved.
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**    http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+*/
+
+/*
+** File:
+**    time_bench.c
+**
+** Purpose:
+**    Current time query benchmark
+**
+**    Compares computing the current TAI from a full copy of the reference
+**    data (CFE_TIME_GetReference and CFE_TIME_CalculateTAI), as
+**    CFE_TIME_GetTAI used to, against the offsets precomputed at each
+**    reference update.  The TIME module is built with its local clock
+**    redirected from the PSP stub to TimeBench_GetLocalTime, which reads
+**    the host clock as the pc-linux PSP does.  The time to latch it is
+**    reported separately; it is the same for both methods.
+**
+**    Also compares the throughput of the single value time arithmetic and
+**    subseconds conversions with their array forms, and of CFE_TIME_Print
+**    with the year counting loop it used to have, whose output is checked
+**    against the current implementation across the whole seconds range.
+**
+** Notes:
+**    1. This is unit test code only, not for use in flight
+**
+*/
+
+#define _POSIX_C_SOURCE 200112L
+
+/*
+** Includes
+*/
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "cfe_time_utils.h"
+#include "utassert.h"
+#include "uttest.h"
+#include "utbsp.h"
+
+/*
+** Number of time queries to time for each method
+*/
+#define TIME_BENCH_NUM_CALLS        200000
+
+/*
+** Number of values in each conversion array, number of passes over them,
+** and spacing of the seconds values printed
+*/
+#define TIME_BENCH_NUM_VALUES       4096
+#define TIME_BENCH_NUM_PASSES       200
+#define TIME_BENCH_PRINT_STEP       9973
+#define TIME_BENCH_PRINT_SIZE       32
+
+CFE_TIME_SysTime_t  TimeBench_Times[TIME_BENCH_NUM_VALUES];
+CFE_TIME_SysTime_t  TimeBench_TimeResults[TIME_BENCH_NUM_VALUES];
+CFE_TIME_Compare_t  TimeBench_CompareResults[TIME_BENCH_NUM_VALUES];
+uint32              TimeBench_Values[TIME_BENCH_NUM_VALUES];
+uint32              TimeBench_MicroValues[TIME_BENCH_NUM_VALUES];
+uint32              TimeBench_Results[TIME_BENCH_NUM_VALUES];
+
+/* Accumulates results so the timed calls are not optimized away */
+volatile uint32     TimeBench_Sink;
+
+/*
+** Local clock used by the TIME module in place of CFE_PSP_GetTime
+*/
+void TimeBench_GetLocalTime(OS_time_t *LocalTime)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_REALTIME, &ts);
+
+    LocalTime->seconds = ts.tv_sec;
+    LocalTime->microsecs = ts.tv_nsec / 1000;
+}
+
+double TimeBench_Now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((double)ts.tv_sec * 1e9) + (double)ts.tv_nsec;
+}
+
+/*
+** One function per way of getting the time
+*/
+CFE_TIME_SysTime_t TimeBench_Reference(void)
+{
+    CFE_TIME_Reference_t Reference;
+
+    CFE_TIME_GetReference(&Reference);
+
+    return CFE_TIME_CalculateTAI(&Reference);
+}
+
+CFE_TIME_SysTime_t TimeBench_GetTAI(void)
+{
+    return CFE_TIME_GetTAI();
+}
+
+CFE_TIME_SysTime_t TimeBench_LatchClock(void)
+{
+    return CFE_TIME_LatchClock();
+}
+
+/*
+** Times TIME_BENCH_NUM_CALLS calls, returning ns per call
+*/
+double TimeBench_Time(CFE_TIME_SysTime_t (*TimeFunc)(void))
+{
+    double  Start;
+    uint32  i;
+    uint32  Sum = 0;
+
+    Start = TimeBench_Now();
+
+    for (i = 0; i < TIME_BENCH_NUM_CALLS; i++)
+    {
+        Sum += TimeFunc().Subseconds;
+    }
+
+    TimeBench_Sink = Sum;
+
+    return (TimeBench_Now() - Start) / TIME_BENCH_NUM_CALLS;
+}
+
+void TimeBench_Setup(void)
+{
+    volatile CFE_TIME_ReferenceState_t *RefState;
+
+    memset(&CFE_TIME_TaskData, 0, sizeof(CFE_TIME_TaskData));
+
+    CFE_TIME_TaskData.MaxLocalClock.Seconds = CFE_PLATFORM_TIME_MAX_LOCAL_SECS;
+    CFE_TIME_TaskData.MaxLocalClock.Subseconds = CFE_PLATFORM_TIME_MAX_LOCAL_SUBS;
+
+    RefState = CFE_TIME_StartReferenceUpdate();
+    RefState->AtToneMET.Seconds = 1000;
+    RefState->AtToneMET.Subseconds = 0x40000000;
+    RefState->AtToneSTCF.Seconds = 1041472984;
+    RefState->AtToneSTCF.Subseconds = 0x80000000;
+    RefState->AtToneLatch.Seconds = 90;
+    RefState->AtToneLatch.Subseconds = 0xC0000000;
+    RefState->AtToneLeapSeconds = 37;
+    RefState->ClockSetState = CFE_TIME_SetState_WAS_SET;
+    RefState->ClockFlyState = CFE_TIME_FlywheelState_NO_FLY;
+    CFE_TIME_FinishReferenceUpdate(RefState);
+}
+
+void TimeBench_Run(void)
+{
+    CFE_TIME_SysTime_t  Expected;
+    CFE_TIME_SysTime_t  Actual;
+    double              Latch;
+    double              Reference;
+    double              Precomputed;
+
+    Latch       = TimeBench_Time(TimeBench_LatchClock);
+    Reference   = TimeBench_Time(TimeBench_Reference);
+    Precomputed = TimeBench_Time(TimeBench_GetTAI);
+
+    UtPrintf("Latch local clock:                   %6.1f ns\n", Latch);
+    UtPrintf("TAI from full reference data:        %6.1f ns (%6.1f ns after latch)\n", Reference, Reference - Latch);
+    UtPrintf("TAI from precomputed offset:         %6.1f ns (%6.1f ns after latch)\n", Precomputed, Precomputed - Latch);
+
+    /* The clock moves between the two queries, but by far less than a second */
+    Expected = TimeBench_Reference();
+    Actual = TimeBench_GetTAI();
+    Actual = CFE_TIME_Subtract(Actual, Expected);
+
+    UtAssert_True(Actual.Seconds == 0,
+                  "Precomputed TAI follows reference TAI by %lu us",
+                  (unsigned long)CFE_TIME_Sub2MicroSecs(Actual.Subseconds));
+}
+
+/*
+** CFE_TIME_Print as it was before the year was computed directly
+*/
+void TimeBench_LegacyPrint(char *PrintBuffer, CFE_TIME_SysTime_t TimeToPrint)
+{
+    uint32 NumberOfYears;
+    uint32 NumberOfDays;
+    uint32 NumberOfHours;
+    uint32 NumberOfMinutes;
+    uint32 NumberOfSeconds;
+    uint32 NumberOfMicros;
+    uint32 DaysInThisYear;
+
+    NumberOfMinutes = (TimeToPrint.Seconds / 60) + CFE_MISSION_TIME_EPOCH_MINUTE;
+    NumberOfSeconds = (TimeToPrint.Seconds % 60) + CFE_MISSION_TIME_EPOCH_SECOND;
+
+    while (NumberOfSeconds >= 60)
+    {
+        NumberOfMinutes++;
+        NumberOfSeconds -= 60;
+    }
+
+    NumberOfHours   = (NumberOfMinutes / 60) + CFE_MISSION_TIME_EPOCH_HOUR;
+    NumberOfMinutes = (NumberOfMinutes % 60);
+
+    NumberOfDays  = (NumberOfHours / 24) + (CFE_MISSION_TIME_EPOCH_DAY - 1);
+    NumberOfHours = (NumberOfHours % 24);
+
+    NumberOfYears = CFE_MISSION_TIME_EPOCH_YEAR;
+
+    while (true)
+    {
+        DaysInThisYear = 365;
+
+        if ((NumberOfYears % 4) == 0 && ((NumberOfYears % 100) != 0 || (NumberOfYears % 400) == 0))
+        {
+            DaysInThisYear = 366;
+        }
+
+        if (NumberOfDays < DaysInThisYear)
+        {
+            break;
+        }
+
+        NumberOfYears++;
+        NumberOfDays -= DaysInThisYear;
+    }
+
+    NumberOfDays++;
+
+    NumberOfMicros = CFE_TIME_Sub2MicroSecs(TimeToPrint.Subseconds) / 10;
+
+    snprintf(PrintBuffer, TIME_BENCH_PRINT_SIZE, "%04u-%03u-%02u:%02u:%02u.%05u",
+            (unsigned int)NumberOfYears, (unsigned int)NumberOfDays, (unsigned int)NumberOfHours,
+            (unsigned int)NumberOfMinutes, (unsigned int)NumberOfSeconds, (unsigned int)NumberOfMicros);
+}
+
+/*
+** One function per way of processing the value arrays, single value functions first
+*/
+void TimeBench_AddEach(void)
+{
+    uint32 i;
+
+    for (i = 0; i < TIME_BENCH_NUM_VALUES; i++)
+    {
+        TimeBench_TimeResults[i] = CFE_TIME_Add(TimeBench_Times[i], TimeBench_Times[0]);
+    }
+}
+
+void TimeBench_AddArray(void)
+{
+    CFE_TIME_AddArray(TimeBench_TimeResults, TimeBench_Times, TimeBench_Times[0], TIME_BENCH_NUM_VALUES);
+}
+
+void TimeBench_SubtractEach(void)
+{
+    uint32 i;
+
+    for (i = 0; i < TIME_BENCH_NUM_VALUES; i++)
+    {
+        TimeBench_TimeResults[i] = CFE_TIME_Subtract(TimeBench_Times[i], TimeBench_Times[0]);
+    }
+}
+
+void TimeBench_SubtractArray(void)
+{
+    CFE_TIME_SubtractArray(TimeBench_TimeResults, TimeBench_Times, TimeBench_Times[0], TIME_BENCH_NUM_VALUES);
+}
+
+void TimeBench_CompareEach(void)
+{
+    uint32 i;
+
+    for (i = 0; i < TIME_BENCH_NUM_VALUES; i++)
+    {
+        TimeBench_CompareResults[i] = CFE_TIME_Compare(TimeBench_Times[i], TimeBench_Times[0]);
+    }
+}
+
+void TimeBench_CompareArray(void)
+{
+    CFE_TIME_CompareArray(TimeBench_CompareResults, TimeBench_Times, TimeBench_Times[0], TIME_BENCH_NUM_VALUES);
+}
+
+void TimeBench_Sub2MicroSecsEach(void)
+{
+    uint32 i;
+
+    for (i = 0; i < TIME_BENCH_NUM_VALUES; i++)
+    {
+        TimeBench_Results[i] = CFE_TIME_Sub2MicroSecs(TimeBench_Values[i]);
+    }
+}
+
+void TimeBench_Sub2MicroSecsArray(void)
+{
+    CFE_TIME_Sub2MicroSecsArray(TimeBench_Results, TimeBench_Values, TIME_BENCH_NUM_VALUES);
+}
+
+void TimeBench_Micro2SubSecsEach(void)
+{
+    uint32 i;
+
+    for (i = 0; i < TIME_BENCH_NUM_VALUES; i++)
+    {
+        TimeBench_Results[i] = CFE_TIME_Micro2SubSecs(TimeBench_MicroValues[i]);
+    }
+}
+
+void TimeBench_Micro2SubSecsArray(void)
+{
+    CFE_TIME_Micro2SubSecsArray(TimeBench_Results, TimeBench_MicroValues, TIME_BENCH_NUM_VALUES);
+}
+
+void TimeBench_PrintEach(void)
+{
+    char    Buffer[TIME_BENCH_PRINT_SIZE];
+    uint32  i;
+
+    for (i = 0; i < TIME_BENCH_NUM_VALUES; i++)
+    {
+        CFE_TIME_Print(Buffer, TimeBench_Times[i]);
+        TimeBench_Sink = Buffer[3];
+    }
+}
+
+void TimeBench_LegacyPrintEach(void)
+{
+    char    Buffer[TIME_BENCH_PRINT_SIZE];
+    uint32  i;
+
+    for (i = 0; i < TIME_BENCH_NUM_VALUES; i++)
+    {
+        TimeBench_LegacyPrint(Buffer, TimeBench_Times[i]);
+        TimeBench_Sink = Buffer[3];
+    }
+}
+
+/*
+** Times TIME_BENCH_NUM_PASSES passes over the value arrays, returning ns per value
+*/
+double TimeBench_TimeArray(void (*ArrayFunc)(void))
+{
+    double  Start;
+    uint32  Pass;
+
+    Start = TimeBench_Now();
+
+    for (Pass = 0; Pass < TIME_BENCH_NUM_PASSES; Pass++)
+    {
+        ArrayFunc();
+    }
+
+    TimeBench_Sink = TimeBench_Results[TIME_BENCH_NUM_VALUES - 1] + TimeBench_TimeResults[TIME_BENCH_NUM_VALUES - 1].Seconds;
+
+    return (TimeBench_Now() - Start) / ((double)TIME_BENCH_NUM_PASSES * TIME_BENCH_NUM_VALUES);
+}
+
+void TimeBench_ConvertSetup(void)
+{
+    uint32 Seed = 12345;
+    uint32 i;
+
+    /* Pseudo random values, so the branches of the single value functions are unpredictable */
+    for (i = 0; i < TIME_BENCH_NUM_VALUES; i++)
+    {
+        Seed = (Seed * 1103515245) + 12345;
+        TimeBench_Times[i].Seconds = Seed;
+        Seed = (Seed * 1103515245) + 12345;
+        TimeBench_Times[i].Subseconds = Seed;
+        TimeBench_Values[i] = Seed ^ (Seed >> 16);
+        TimeBench_MicroValues[i] = TimeBench_Values[i] % 1000000;
+    }
+}
+
+void TimeBench_ConvertRun(void)
+{
+    CFE_TIME_SysTime_t  Time;
+    char                Expected[TIME_BENCH_PRINT_SIZE];
+    char                Actual[TIME_BENCH_PRINT_SIZE];
+    uint32              Mismatches = 0;
+    uint32              Count = 0;
+    uint64              Seconds;
+
+    UtPrintf("CFE_TIME_Add:            each %6.2f ns, array %6.2f ns\n",
+             TimeBench_TimeArray(TimeBench_AddEach), TimeBench_TimeArray(TimeBench_AddArray));
+    UtPrintf("CFE_TIME_Subtract:       each %6.2f ns, array %6.2f ns\n",
+             TimeBench_TimeArray(TimeBench_SubtractEach), TimeBench_TimeArray(TimeBench_SubtractArray));
+    UtPrintf("CFE_TIME_Compare:        each %6.2f ns, array %6.2f ns\n",
+             TimeBench_TimeArray(TimeBench_CompareEach), TimeBench_TimeArray(TimeBench_CompareArray));
+    UtPrintf("CFE_TIME_Sub2MicroSecs:  each %6.2f ns, array %6.2f ns\n",
+             TimeBench_TimeArray(TimeBench_Sub2MicroSecsEach), TimeBench_TimeArray(TimeBench_Sub2MicroSecsArray));
+    UtPrintf("CFE_TIME_Micro2SubSecs:  each %6.2f ns, array %6.2f ns\n",
+             TimeBench_TimeArray(TimeBench_Micro2SubSecsEach), TimeBench_TimeArray(TimeBench_Micro2SubSecsArray));
+    UtPrintf("CFE_TIME_Print:          year loop %6.1f ns, direct %6.1f ns\n",
+             TimeBench_TimeArray(TimeBench_LegacyPrintEach), TimeBench_TimeArray(TimeBench_PrintEach));
+
+    /* Every day boundary region of the seconds range, with varying subseconds */
+    for (Seconds = 0; Seconds <= 0xFFFFFFFF; Seconds += TIME_BENCH_PRINT_STEP)
+    {
+        Time.Seconds = (uint32)Seconds;
+        Time.Subseconds = (uint32)(Seconds * 2654435761U);
+
+        TimeBench_LegacyPrint(Expected, Time);
+        CFE_TIME_Print(Actual, Time);
+
+        if (strcmp(Expected, Actual) != 0)
+        {
+            ++Mismatches;
+        }
+
+        ++Count;
+    }
+
+    Time.Seconds = 0xFFFFFFFF;
+    Time.Subseconds = 0xFFFFFFFF;
+    TimeBench_LegacyPrint(Expected, Time);
+    CFE_TIME_Print(Actual, Time);
+    if (strcmp(Expected, Actual) != 0)
+    {
+        ++Mismatches;
+    }
+
+    UtAssert_True(Mismatches == 0, "CFE_TIME_Print matches the year loop for %lu times (%lu mismatches)",
+                  (unsigned long)Count + 1, (unsigned long)Mismatches);
+}
+
+void UtTest_Setup(void)
+{
+    UtTest_Add(TimeBench_Run, TimeBench_Setup, NULL, "Current time benchmark");
+    UtTest_Add(TimeBench_ConvertRun, TimeBench_ConvertSetup, NULL, "Time conversion benchmark");
+}
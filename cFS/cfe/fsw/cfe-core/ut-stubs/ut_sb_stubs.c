@@ -295,6 +295,40 @@ int32 CFE_SB_GetPipeIdByName(CFE_SB_PipeId_t *PipeIdPtr, const char *PipeName)
 
     return status;
 }
+/*****************************************************************************/
+/**
+** \brief CFE_SB_GetPipeQueueId stub function
+**
+** \par Description
+**        This function is used to mimic the response of the cFE SB function
+**        CFE_SB_GetPipeQueueId.  The queue ID is taken from the data buffer
+**        set for this function, or is the pipe ID if none was set.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns CFE_SUCCESS, or the status set for this function.
+**
+******************************************************************************/
+int32 CFE_SB_GetPipeQueueId(CFE_SB_PipeId_t PipeId, uint32 *QueueIdPtr)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_GetPipeQueueId), PipeId);
+    UT_Stub_RegisterContext(UT_KEY(CFE_SB_GetPipeQueueId), QueueIdPtr);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(CFE_SB_GetPipeQueueId);
+
+    if (status >= 0 &&
+        UT_Stub_CopyToLocal(UT_KEY(CFE_SB_GetPipeQueueId), (uint8*)QueueIdPtr, sizeof(*QueueIdPtr)) < sizeof(*QueueIdPtr))
+    {
+        *QueueIdPtr = PipeId;
+    }
+
+    return status;
+}
+
 /*****************************************************************************/
 /**
 ** \brief CFE_SB_GetCmdCode stub function
@@ -904,6 +938,41 @@ CFE_TIME_SysTime_t CFE_SB_GetMsgTime(CFE_SB_MsgPtr_t MsgPtr)
 
 }/* end CFE_SB_GetMsgTime */
 
+/*****************************************************************************/
+/**
+** \brief CFE_SB_GetMsgHdrView stub function
+**
+** \par Description
+**        This function is used to mimic the response of the cFE SB function
+**        CFE_SB_GetMsgHdrView.
+**
+** \par Assumptions, External Events, and Notes:
+**        The view is assembled from the single field accessor stubs, so
+**        tests that configure those stubs also control the view.
+**
+** \returns
+**        This function does not return a value.
+**
+******************************************************************************/
+void CFE_SB_GetMsgHdrView(const CFE_SB_Msg_t *MsgPtr, CFE_SB_MsgHdrView_t *ViewPtr)
+{
+    UT_Stub_RegisterContext(UT_KEY(CFE_SB_GetMsgHdrView), MsgPtr);
+    UT_Stub_RegisterContext(UT_KEY(CFE_SB_GetMsgHdrView), ViewPtr);
+
+    UT_DEFAULT_IMPL(CFE_SB_GetMsgHdrView);
+
+    if (UT_Stub_CopyToLocal(UT_KEY(CFE_SB_GetMsgHdrView), ViewPtr, sizeof(*ViewPtr)) < sizeof(*ViewPtr))
+    {
+        ViewPtr->MsgId       = CFE_SB_GetMsgId(MsgPtr);
+        ViewPtr->TotalLength = CFE_SB_GetTotalMsgLength(MsgPtr);
+        ViewPtr->CmdCode     = CFE_SB_GetCmdCode((CFE_SB_MsgPtr_t)MsgPtr);
+        ViewPtr->Time        = CFE_SB_GetMsgTime((CFE_SB_MsgPtr_t)MsgPtr);
+        ViewPtr->PktType     = CFE_SB_GetPktType(ViewPtr->MsgId);
+        ViewPtr->HasSecHdr   = true;
+        ViewPtr->HdrSize     = (ViewPtr->PktType == CFE_SB_PKTTYPE_CMD) ? CFE_SB_CMD_HDR_SIZE : CFE_SB_TLM_HDR_SIZE;
+    }
+}
+
 bool CFE_SB_ValidateChecksum(CFE_SB_MsgPtr_t MsgPtr)
 {
     UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_ValidateChecksum), MsgPtr);
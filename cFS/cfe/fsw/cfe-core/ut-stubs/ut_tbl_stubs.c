@@ -211,6 +211,18 @@ int32 CFE_TBL_NotifyByMessage(CFE_TBL_Handle_t TblHandle, CFE_SB_MsgId_t MsgId,
     return status;
 }
 
+int32 CFE_TBL_ValidateInBackground(CFE_TBL_Handle_t TblHandle, uint32 DutyCyclePct)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_TBL_ValidateInBackground), TblHandle);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_TBL_ValidateInBackground), DutyCyclePct);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(CFE_TBL_ValidateInBackground);
+
+    return status;
+}
+
 int32 CFE_TBL_Modified( CFE_TBL_Handle_t TblHandle )
 {
     UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_TBL_Modified), TblHandle);
@@ -238,6 +238,28 @@ int32 CFE_TIME_UnregisterSynchCallback(CFE_TIME_SynchCallbackPtr_t CallbackFuncP
     return status;
 }
 
+int32 CFE_TIME_RegisterMinorFrameCallback(CFE_TIME_MinorFrameCallbackPtr_t CallbackFuncPtr)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_TIME_RegisterMinorFrameCallback), CallbackFuncPtr);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(CFE_TIME_RegisterMinorFrameCallback);
+
+    return status;
+}
+
+int32 CFE_TIME_UnregisterMinorFrameCallback(CFE_TIME_MinorFrameCallbackPtr_t CallbackFuncPtr)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_TIME_UnregisterMinorFrameCallback), CallbackFuncPtr);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(CFE_TIME_UnregisterMinorFrameCallback);
+
+    return status;
+}
+
 void CFE_TIME_ExternalGPS(CFE_TIME_SysTime_t NewTime, int16 NewLeaps)
 {
     UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_TIME_ExternalGPS), NewTime);
@@ -421,3 +443,60 @@ CFE_TIME_SysTime_t CFE_TIME_Subtract(CFE_TIME_SysTime_t Time1, CFE_TIME_SysTime_
     return Result;
 }
 
+
+/*
+ * The array variants are handed on element by element to the stubs of the
+ * single value functions, so existing test setups for those apply to both.
+ */
+void CFE_TIME_AddArray(CFE_TIME_SysTime_t *Result, const CFE_TIME_SysTime_t *TimeA,
+                       CFE_TIME_SysTime_t TimeB, uint32 Count)
+{
+    uint32 i;
+
+    for (i = 0; i < Count; i++)
+    {
+        Result[i] = CFE_TIME_Add(TimeA[i], TimeB);
+    }
+}
+
+void CFE_TIME_SubtractArray(CFE_TIME_SysTime_t *Result, const CFE_TIME_SysTime_t *TimeA,
+                            CFE_TIME_SysTime_t TimeB, uint32 Count)
+{
+    uint32 i;
+
+    for (i = 0; i < Count; i++)
+    {
+        Result[i] = CFE_TIME_Subtract(TimeA[i], TimeB);
+    }
+}
+
+void CFE_TIME_CompareArray(CFE_TIME_Compare_t *Result, const CFE_TIME_SysTime_t *TimeA,
+                           CFE_TIME_SysTime_t TimeB, uint32 Count)
+{
+    uint32 i;
+
+    for (i = 0; i < Count; i++)
+    {
+        Result[i] = CFE_TIME_Compare(TimeA[i], TimeB);
+    }
+}
+
+void CFE_TIME_Sub2MicroSecsArray(uint32 *MicroSeconds, const uint32 *SubSeconds, uint32 Count)
+{
+    uint32 i;
+
+    for (i = 0; i < Count; i++)
+    {
+        MicroSeconds[i] = CFE_TIME_Sub2MicroSecs(SubSeconds[i]);
+    }
+}
+
+void CFE_TIME_Micro2SubSecsArray(uint32 *SubSeconds, const uint32 *MicroSeconds, uint32 Count)
+{
+    uint32 i;
+
+    for (i = 0; i < Count; i++)
+    {
+        SubSeconds[i] = CFE_TIME_Micro2SubSecs(MicroSeconds[i]);
+    }
+}
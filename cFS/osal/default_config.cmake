@@ -133,6 +133,38 @@ set(OSAL_CONFIG_DEBUG_PRINTF                    FALSE
     CACHE BOOL "Controls inclusion of OS_DEBUG statements in the code"
 )
 
+#
+# OSAL_CONFIG_POSIX_TIMERFD_TIMEBASE
+# ----------------------------------
+#
+# Selects how the POSIX implementation simulates the tick of a time base
+# that has no external sync function.
+#
+# If set FALSE, each time base uses a POSIX timer that delivers a realtime
+# signal to its servicing thread.  Every such time base needs a distinct
+# realtime signal, so the number of them is limited by SIGRTMAX - SIGRTMIN.
+#
+# If set TRUE, each time base uses a Linux timerfd armed at absolute
+# CLOCK_MONOTONIC deadlines, so no signals are used and deadlines do not
+# drift.  This is only available on Linux.
+#
+set(OSAL_CONFIG_POSIX_TIMERFD_TIMEBASE          FALSE
+    CACHE BOOL "Use timerfd rather than realtime signals for POSIX time bases"
+)
+
+#
+# OSAL_CONFIG_POSIX_TIMEBASE_SPIN_USEC
+# ----------------------------------
+#
+# When OSAL_CONFIG_POSIX_TIMERFD_TIMEBASE is enabled, the servicing thread
+# wakes this many microseconds before each deadline and busy-waits for the
+# remainder, trading CPU time for lower wakeup jitter.  Zero disables the
+# busy-wait.  Only useful with a realtime scheduling policy and a dedicated CPU.
+#
+set(OSAL_CONFIG_POSIX_TIMEBASE_SPIN_USEC        0
+    CACHE STRING "Busy-wait window before each POSIX time base deadline, in microseconds"
+)
+
 
 #############################################
 # Resource Limits for the OS API
@@ -29,6 +29,7 @@
 #include <unistd.h>
 #include <sys/types.h>
 #include <sys/wait.h>
+#include <sys/uio.h>
 
 #include "generic_linux_bsp_internal.h"
 #include "bsp-impl.h"
@@ -90,6 +91,64 @@ void OS_BSP_ConsoleOutput_Impl(const char *Str, uint32 DataLen)
     }
 }
 
+/*----------------------------------------------------------------
+   OS_BSP_ConsoleOutputVec_Impl
+   See full description in header
+ ------------------------------------------------------------------*/
+void OS_BSP_ConsoleOutputVec_Impl(const OS_BSP_ConsoleVec_t *Vec, uint32 NumVec)
+{
+    struct iovec iov[16];
+    uint32 i;
+    uint32 Count;
+    size_t TotalLen;
+    ssize_t WriteLen;
+
+    while (NumVec > 0)
+    {
+        Count = NumVec;
+        if (Count > (sizeof(iov) / sizeof(iov[0])))
+        {
+            Count = sizeof(iov) / sizeof(iov[0]);
+        }
+
+        TotalLen = 0;
+        for (i = 0; i < Count; ++i)
+        {
+            iov[i].iov_base = (void *)Vec[i].Str;
+            iov[i].iov_len = Vec[i].DataLen;
+            TotalLen += Vec[i].DataLen;
+        }
+
+        /* writes all pieces directly to STDOUT_FILENO (unbuffered) in one call */
+        WriteLen = writev(STDOUT_FILENO, iov, Count);
+        if (WriteLen < 0)
+        {
+            /* no recourse if this fails, just stop. */
+            break;
+        }
+
+        if ((size_t)WriteLen < TotalLen)
+        {
+            /* short write; finish the remaining pieces one at a time */
+            for (i = 0; i < Count; ++i)
+            {
+                if ((size_t)WriteLen >= Vec[i].DataLen)
+                {
+                    WriteLen -= Vec[i].DataLen;
+                }
+                else
+                {
+                    OS_BSP_ConsoleOutput_Impl(Vec[i].Str + WriteLen, Vec[i].DataLen - WriteLen);
+                    WriteLen = 0;
+                }
+            }
+        }
+
+        Vec += Count;
+        NumVec -= Count;
+    }
+}
+
 /*----------------------------------------------------------------
    OS_BSP_ConsoleSetMode_Impl() definition
    See full description in header
@@ -50,6 +50,20 @@ void OS_BSP_ConsoleOutput_Impl(const char *Str, uint32 DataLen)
     }
 }
 
+/*----------------------------------------------------------------
+   OS_BSP_ConsoleOutputVec_Impl
+   See full description in header
+ ------------------------------------------------------------------*/
+void OS_BSP_ConsoleOutputVec_Impl(const OS_BSP_ConsoleVec_t *Vec, uint32 NumVec)
+{
+    while (NumVec > 0)
+    {
+        OS_BSP_ConsoleOutput_Impl(Vec->Str, Vec->DataLen);
+        ++Vec;
+        --NumVec;
+    }
+}
+
 /*----------------------------------------------------------------
    OS_BSP_ConsoleSetMode_Impl() definition
    See full description in header
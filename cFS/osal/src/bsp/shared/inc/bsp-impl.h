@@ -96,6 +96,15 @@ typedef struct
     uint32 MaxQueueDepth;   /* Queue depth limit supported by BSP (0=no limit) */
 } OS_BSP_GlobalData_t;
 
+/*
+** One piece of a vectored console write
+*/
+typedef struct
+{
+    const char *Str;
+    uint32      DataLen;
+} OS_BSP_ConsoleVec_t;
+
 /*
  * Common/Abstracted BSP state data
  */
@@ -128,6 +137,17 @@ extern OS_VolumeInfo_t OS_VolumeTable[OS_MAX_FILE_SYSTEMS];
  ------------------------------------------------------------------*/
 void OS_BSP_ConsoleOutput_Impl(const char *Str, uint32 DataLen);
 
+/*----------------------------------------------------------------
+   Function: OS_BSP_ConsoleOutputVec_Impl
+
+    Purpose: Low level raw console data output of several pieces at
+             once.  Writes each piece in order, exactly as
+             OS_BSP_ConsoleOutput_Impl() would, but lets the BSP hand
+             all of them to the device in a single operation where
+             that is supported.
+ ------------------------------------------------------------------*/
+void OS_BSP_ConsoleOutputVec_Impl(const OS_BSP_ConsoleVec_t *Vec, uint32 NumVec);
+
 /*----------------------------------------------------------------
    Function: OS_BSP_ConsoleSetMode_Impl
 
@@ -75,6 +75,12 @@
 /** @brief Floating point enabled state for a task */
 #define OS_FP_ENABLED 1
 
+/** @brief CPU affinity mask that allows a task to run on any CPU */
+#define OS_TASK_CPU_AFFINITY_ANY    0
+
+/** @brief Value of OS_task_prop_t::current_cpu when the CPU is not known */
+#define OS_TASK_CPU_UNKNOWN         0xFFFFFFFF
+
 /** @brief Error string name length
  *
  * The sizes of strings in OSAL functions are built with this limit in mind.
@@ -84,6 +90,13 @@
 
 /*  Object property structures */
 
+/** @brief OSAL time */
+typedef struct 
+{ 
+    uint32 seconds; 
+    uint32 microsecs;
+}OS_time_t; 
+
 /** @brief OSAL task properties */
 typedef struct
 {
@@ -91,6 +104,12 @@ typedef struct
     uint32 creator;
     uint32 stack_size;
     uint32 priority;
+    uint32 cpu_affinity;    /**< CPUs the task may run on, bit N for CPU N, or #OS_TASK_CPU_AFFINITY_ANY */
+    uint32 current_cpu;     /**< CPU the task last ran on, or #OS_TASK_CPU_UNKNOWN */
+    uint32 migrations;      /**< Number of times the task moved between CPUs, if known */
+    OS_time_t cpu_time;     /**< CPU time the task has consumed, if known */
+    uint32 voluntary_switches;   /**< Number of times the task gave up the CPU, if known */
+    uint32 involuntary_switches; /**< Number of times the task was preempted, if known */
 #ifndef OSAL_OMIT_DEPRECATED
     uint32 OStask_id;   /**< @deprecated */
 #endif
@@ -127,13 +146,6 @@ typedef struct
 }OS_mut_sem_prop_t;
 
 
-/** @brief OSAL time */
-typedef struct 
-{ 
-    uint32 seconds; 
-    uint32 microsecs;
-}OS_time_t; 
-
 /** @brief OSAL heap properties
  *
  * @sa OS_HeapGetInfo()
@@ -145,6 +157,19 @@ typedef struct
     uint32 largest_free_block;
 }OS_heap_prop_t;
 
+/** @brief OSAL printf console statistics
+ *
+ * @sa OS_printf_GetStats()
+ */
+typedef struct
+{
+    uint32 lines_written;       /**< Lines put into the console buffer */
+    uint32 lines_dropped;       /**< Lines dropped because the console buffer was full */
+    uint32 output_batches;      /**< Number of writes to the console device */
+    uint32 max_batch;           /**< Most lines written to the console device at once */
+    uint32 ring_depth;          /**< Number of lines the console buffer holds */
+}OS_printf_stats_t;
+
 /**
  * @brief An abstract structure capable of holding several OSAL IDs
  *
@@ -156,6 +181,7 @@ typedef struct
 typedef struct
 {
    uint8 object_ids[(OS_MAX_NUM_OPEN_FILES + 7) / 8];
+   uint8 queue_ids[(OS_MAX_QUEUES + 7) / 8];
 } OS_FdSet;
 
 /**
@@ -413,6 +439,44 @@ int32 OS_TaskCreate            (uint32 *task_id, const char *task_name,
                                 uint32 stack_size,
                                 uint32 priority, uint32 flags);
 
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Creates a task restricted to a set of CPUs and starts running it.
+ *
+ * As OS_TaskCreate(), but the task only runs on the CPUs selected by cpu_affinity,
+ * where bit N selects CPU N.  This keeps latency sensitive tasks from migrating
+ * between CPUs and losing their cache contents.
+ *
+ * A cpu_affinity of #OS_TASK_CPU_AFFINITY_ANY places no restriction on the task,
+ * exactly as OS_TaskCreate() does.  On implementations that do not support CPU
+ * affinity the mask is recorded and reported by OS_TaskGetInfo() but otherwise ignored.
+ *
+ * @param[out]  task_id will be set to the non-zero ID of the newly-created resource
+ * @param[in]   task_name the name of the new resource to create
+ * @param[in]   function_pointer the entry point of the new task
+ * @param[in]   stack_pointer pointer to the stack for the task, or NULL
+ *              to allocate a stack from the system memory heap
+ * @param[in]   stack_size the size of the stack, or 0 to use a default stack size.
+ * @param[in]   priority initial priority of the new task
+ * @param[in]   flags initial options for the new task
+ * @param[in]   cpu_affinity mask of the CPUs the new task may run on
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_INVALID_POINTER if any of the necessary pointers are NULL
+ * @retval #OS_ERR_NAME_TOO_LONG name length including null terminator greater than #OS_MAX_API_NAME
+ * @retval #OS_ERR_INVALID_PRIORITY if the priority is bad
+ * @retval #OS_ERR_NO_FREE_IDS if there can be no more tasks created
+ * @retval #OS_ERR_NAME_TAKEN if the name specified is already used by a task
+ * @retval #OS_ERROR if an unspecified/other error occurs, including a mask with no usable CPUs
+ */
+int32 OS_TaskCreateWithAffinity(uint32 *task_id, const char *task_name,
+                                osal_task_entry function_pointer,
+                                uint32 *stack_pointer,
+                                uint32 stack_size,
+                                uint32 priority, uint32 flags,
+                                uint32 cpu_affinity);
+
 /*-------------------------------------------------------------------------------------*/
 /**
  * @brief Deletes the specified Task
@@ -1510,6 +1574,13 @@ int32 OS_GetErrorName      (int32 error_num, os_err_name_t* err_name);
  * If the timeout occurs this returns an error code and all output sets
  * should be empty.
  *
+ * The sets may also hold queue IDs, so that a task can wait for a message
+ * on a queue and for activity on its streams at the same time.  A queue
+ * is readable when it holds at least one message, and writable when it
+ * has room for one.  On implementations that cannot wait on queues this
+ * way, queue IDs are ignored and never reported as ready, so a caller
+ * should still poll its queues with a timeout.
+ *
  * @note This does not lock or otherwise protect the file handles in the
  * given sets.  If a filehandle supplied via one of the FdSet arguments
  * is closed or modified by another while this function is in progress,
@@ -1559,7 +1630,8 @@ int32 OS_SelectFdZero(OS_FdSet *Set);
 /**
  * @brief Add an ID to an FdSet structure
  *
- * After this call the set will contain the given OSAL ID
+ * After this call the set will contain the given OSAL ID, which
+ * may be a stream (file or socket) ID or a queue ID
  *
  * @return Execution status, see @ref OSReturnCodes
  */
@@ -1624,6 +1696,24 @@ void OS_printf_disable(void);
  *
  */
 void OS_printf_enable(void);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Obtain the statistics of the OS_printf console buffer
+ *
+ * Reports how many lines have been buffered and dropped since startup,
+ * and how the output has been batched to the console device.  A growing
+ * lines_dropped count means that OS_printf output is produced faster
+ * than the console device can take it.
+ *
+ * @param[out] stats Buffer to store the statistics
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_INVALID_POINTER if the stats pointer is NULL
+ * @retval #OS_ERR_INVALID_ID if the console has not been initialized
+ */
+int32 OS_printf_GetStats(OS_printf_stats_t *stats);
 /**@}*/
 
 
@@ -475,6 +475,53 @@ int32           OS_stat   (const char *path, os_fstat_t  *filestats);
 int32           OS_lseek  (uint32  filedes, int32 offset, uint32 whence);
 
 
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Maps a region of an open file into memory
+ *
+ * Maps "length" bytes of the file starting at "offset" into the address space
+ * of the caller and returns the address of the first byte in "addr".  The mapping
+ * is private to the caller: the underlying file is never modified, and any write
+ * to the mapped region creates a private copy of the affected page(s).  The file
+ * contents are otherwise accessed in place without any intermediate copy.
+ *
+ * The offset does not need to be aligned to any particular boundary; the
+ * implementation takes care of any page alignment requirements.
+ *
+ * The mapping remains valid after the file is closed, and must be released
+ * using OS_FileUnmap() with the same address and length.
+ *
+ * @param[in]  filedes   The handle ID to operate on
+ * @param[in]  offset    The file offset of the first byte to map
+ * @param[in]  length    The number of bytes to map
+ * @param[out] addr      Set to the address of the first mapped byte
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_INVALID_POINTER if addr is NULL
+ * @retval #OS_ERR_INVALID_ID if the file descriptor passed in is invalid
+ * @retval #OS_ERR_NOT_IMPLEMENTED if file mapping is not supported on this platform
+ * @retval #OS_ERROR if the length is zero or the OS call failed
+ */
+int32           OS_FileMap (uint32 filedes, uint32 offset, uint32 length, void **addr);
+
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Releases a memory mapping created by OS_FileMap()
+ *
+ * @param[in]  addr      The address returned by OS_FileMap()
+ * @param[in]  length    The length that was passed to OS_FileMap()
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_INVALID_POINTER if addr is NULL
+ * @retval #OS_ERR_NOT_IMPLEMENTED if file mapping is not supported on this platform
+ * @retval #OS_ERROR if the OS call failed
+ */
+int32           OS_FileUnmap (void *addr, uint32 length);
+
+
 /*-------------------------------------------------------------------------------------*/
 /**
  * @brief Removes a file from the file system
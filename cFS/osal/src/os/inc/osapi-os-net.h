@@ -107,6 +107,30 @@ typedef struct
    OS_SockAddrData_t AddrData;          /**< @brief Abstract Address data */
 } OS_SockAddr_t;
 
+/**
+ * @brief One datagram in a multiple message send
+ *
+ * @sa OS_SocketSendToMulti()
+ */
+typedef struct
+{
+   const void *buffer;                  /**< @brief Pointer to message data to send */
+   uint32 buflen;                       /**< @brief Length of the message data */
+} OS_SockSendMsg_t;
+
+/**
+ * @brief One datagram in a multiple message receive
+ *
+ * @sa OS_SocketRecvFromMulti()
+ */
+typedef struct
+{
+   void *buffer;                        /**< @brief Pointer to message data receive buffer */
+   uint32 buflen;                       /**< @brief The maximum length of the message data to receive */
+   uint32 msglen;                       /**< @brief Set to the length of the message data received */
+   OS_SockAddr_t *RemoteAddr;           /**< @brief Buffer to store the remote network address (may be NULL) */
+} OS_SockRecvMsg_t;
+
 /**
  * @brief Encapsulates socket properties
  *
@@ -321,6 +345,27 @@ int32 OS_SocketAccept(uint32 sock_id, uint32 *connsock_id, OS_SockAddr_t *Addr,
  */
 int32 OS_SocketRecvFrom(uint32 sock_id, void *buffer, uint32 buflen, OS_SockAddr_t *RemoteAddr, int32 timeout);
 
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Reads several messages from a message-oriented (datagram) socket
+ *
+ * This waits up to the given timeout for the first message, as OS_SocketRecvFrom()
+ * does, and then also reads any further messages that are already available,
+ * without waiting, until all of the message buffers are used.  The messages are
+ * read with as few system calls as the OS allows.
+ *
+ * The length of each message received is stored in its msglen member, and the
+ * remote address in its RemoteAddr buffer, if one is given.
+ *
+ * @param[in]   sock_id      The socket ID, previously bound using OS_SocketBind()
+ * @param[in,out] msgs       The message buffers to receive into
+ * @param[in]   count        The number of message buffers
+ * @param[in]   timeout      The maximum amount of time to wait, or OS_PEND to wait forever
+ *
+ * @return Count of messages received or error status, see @ref OSReturnCodes
+ */
+int32 OS_SocketRecvFromMulti(uint32 sock_id, OS_SockRecvMsg_t *msgs, uint32 count, int32 timeout);
+
 /*-------------------------------------------------------------------------------------*/
 /**
  * @brief Sends data to a message-oriented (datagram) socket
@@ -338,6 +383,28 @@ int32 OS_SocketRecvFrom(uint32 sock_id, void *buffer, uint32 buflen, OS_SockAddr
  */
 int32 OS_SocketSendTo(uint32 sock_id, const void *buffer, uint32 buflen, const OS_SockAddr_t *RemoteAddr);
 
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Sends several datagrams from a message-oriented (datagram) socket
+ *
+ * This is equivalent to calling OS_SocketSendTo() for each message in turn, all
+ * to the same remote address, but the socket is looked up once and the messages
+ * are passed to the network stack in as few system calls as the OS allows.
+ *
+ * As with OS_SocketSendTo(), this does not block.  If the socket is not able to
+ * queue all of the messages, the messages that were queued are always the first
+ * ones in the list, and the count returned indicates where to resume.
+ *
+ * @param[in]   sock_id      The socket ID, which must be of the datagram type
+ * @param[in]   msgs         The messages to send
+ * @param[in]   count        The number of messages to send
+ * @param[in]   RemoteAddr   Buffer containing the remote network address to send to
+ *
+ * @return Count of messages sent or error status, see @ref OSReturnCodes
+ * @retval #OS_ERROR if no message could be sent
+ */
+int32 OS_SocketSendToMulti(uint32 sock_id, const OS_SockSendMsg_t *msgs, uint32 count, const OS_SockAddr_t *RemoteAddr);
+
 /*-------------------------------------------------------------------------------------*/
 /**
  * @brief Gets an OSAL ID from a given name
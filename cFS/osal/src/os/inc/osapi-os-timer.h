@@ -47,6 +47,15 @@ typedef struct
 
 } OS_timer_prop_t;
 
+/**
+ * @brief Number of buckets in a time base jitter histogram
+ *
+ * Bucket 0 counts ticks that were serviced less than 1 microsecond after their
+ * deadline, and bucket N counts ticks that were between 2^(N-1) and 2^N - 1
+ * microseconds late.  The last bucket also counts all ticks later than that.
+ */
+#define OS_TIMEBASE_JITTER_BUCKETS          16
+
 /** @brief Time base properties */
 typedef struct
 {
@@ -55,6 +64,11 @@ typedef struct
     uint32              nominal_interval_time;
     uint32              freerun_time;
     uint32              accuracy;
+    uint32              callback_count;         /**< Number of timer callbacks issued */
+    uint32              overrun_count;          /**< Number of times a timer fell more than one interval behind */
+    uint32              max_callback_latency;   /**< Largest delay between a timer expiry and its callback, in time base units */
+    uint32              max_jitter;             /**< Largest measured lateness of a simulated tick, in microseconds */
+    uint32              jitter_histogram[OS_TIMEBASE_JITTER_BUCKETS]; /**< Measured lateness of simulated ticks, see #OS_TIMEBASE_JITTER_BUCKETS */
 } OS_timebase_prop_t;
 
 /** @defgroup OSAPITimer OSAL Timer APIs
@@ -45,6 +45,7 @@
 #include <osapi.h>
 #include "os-impl-select.h"
 #include "os-shared-select.h"
+#include "os-shared-idmap.h"
 
 /****************************************************************************************
                                      DEFINES
@@ -149,6 +150,74 @@ static void OS_FdSet_ConvertOut_Impl(fd_set *output, OS_FdSet *Input)
    }
 } /* end OS_FdSet_ConvertOut_Impl */
 
+#ifdef OS_IMPL_QUEUE_SELECT_FD
+
+/*----------------------------------------------------------------
+ * Function: OS_FdSet_ConvertQueuesIn_Impl
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *
+ *          Add the descriptors of the queues in an OS_FdSet (OSAL)
+ *          structure to an fd_set (POSIX), on implementations where
+ *          a queue can be waited on with select().
+ *
+ * returns: Highest numbered file descriptor added to the fd_set
+ *-----------------------------------------------------------------*/
+static int OS_FdSet_ConvertQueuesIn_Impl(fd_set *os_set, OS_FdSet *OSAL_set)
+{
+   uint32 id;
+   int osfd;
+   int maxfd;
+
+   maxfd = -1;
+   for (id = 0; id < OS_MAX_QUEUES; ++id)
+   {
+      if (((OSAL_set->queue_ids[id >> 3] >> (id & 0x7)) & 0x1) != 0 &&
+            OS_global_queue_table[id].active_id != 0)
+      {
+         osfd = OS_IMPL_QUEUE_SELECT_FD(id);
+         if (osfd >= 0)
+         {
+            FD_SET(osfd, os_set);
+            if (osfd > maxfd)
+            {
+               maxfd = osfd;
+            }
+         }
+      }
+   }
+
+   return maxfd;
+} /* end OS_FdSet_ConvertQueuesIn_Impl */
+
+/*----------------------------------------------------------------
+ * Function: OS_FdSet_ConvertQueuesOut_Impl
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *
+ *          Un-sets any queue bits in the OSAL set whose descriptor
+ *          is not also set in the POSIX fd_set.
+ *-----------------------------------------------------------------*/
+static void OS_FdSet_ConvertQueuesOut_Impl(fd_set *output, OS_FdSet *Input)
+{
+   uint32 id;
+   int osfd;
+
+   for (id = 0; id < OS_MAX_QUEUES; ++id)
+   {
+      if ((Input->queue_ids[id >> 3] >> (id & 0x7)) & 0x1)
+      {
+         osfd = OS_IMPL_QUEUE_SELECT_FD(id);
+         if (OS_global_queue_table[id].active_id == 0 || osfd < 0 || !FD_ISSET(osfd, output))
+         {
+            Input->queue_ids[id >> 3] &= ~(1 << (id & 0x7));
+         }
+      }
+   }
+} /* end OS_FdSet_ConvertQueuesOut_Impl */
+
+#endif /* OS_IMPL_QUEUE_SELECT_FD */
+
 /*----------------------------------------------------------------
  * Function: OS_DoSelect
  *
@@ -340,6 +409,13 @@ int32 OS_SelectMultiple_Impl(OS_FdSet *ReadSet, OS_FdSet *WriteSet, int32 msecs)
       {
          maxfd = osfd;
       }
+#ifdef OS_IMPL_QUEUE_SELECT_FD
+      osfd = OS_FdSet_ConvertQueuesIn_Impl(&rd_set, ReadSet);
+      if (osfd > maxfd)
+      {
+         maxfd = osfd;
+      }
+#endif
    }
    if (WriteSet != NULL)
    {
@@ -348,6 +424,13 @@ int32 OS_SelectMultiple_Impl(OS_FdSet *ReadSet, OS_FdSet *WriteSet, int32 msecs)
       {
          maxfd = osfd;
       }
+#ifdef OS_IMPL_QUEUE_SELECT_FD
+      osfd = OS_FdSet_ConvertQueuesIn_Impl(&wr_set, WriteSet);
+      if (osfd > maxfd)
+      {
+         maxfd = osfd;
+      }
+#endif
    }
 
    if (maxfd >= 0)
@@ -360,10 +443,20 @@ int32 OS_SelectMultiple_Impl(OS_FdSet *ReadSet, OS_FdSet *WriteSet, int32 msecs)
       if (ReadSet != NULL)
       {
          OS_FdSet_ConvertOut_Impl(&rd_set, ReadSet);
+#ifdef OS_IMPL_QUEUE_SELECT_FD
+         OS_FdSet_ConvertQueuesOut_Impl(&rd_set, ReadSet);
+#else
+         memset(ReadSet->queue_ids, 0, sizeof(ReadSet->queue_ids));
+#endif
       }
       if (WriteSet != NULL)
       {
          OS_FdSet_ConvertOut_Impl(&wr_set, WriteSet);
+#ifdef OS_IMPL_QUEUE_SELECT_FD
+         OS_FdSet_ConvertQueuesOut_Impl(&wr_set, WriteSet);
+#else
+         memset(WriteSet->queue_ids, 0, sizeof(WriteSet->queue_ids));
+#endif
       }
    }
 
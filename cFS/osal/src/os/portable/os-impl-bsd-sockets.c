@@ -26,6 +26,11 @@
  *      systems which implement the BSD-style socket API.
  */
 
+/*
+ * sendmmsg() and recvmmsg() are GNU extensions, on the systems that provide them
+ */
+#define _GNU_SOURCE
+
 /****************************************************************************************
                                     INCLUDE FILES
  ***************************************************************************************/
@@ -45,6 +50,7 @@
  *  connect()
  *  recvfrom()
  *  sendto()
+ *  sendmmsg()/recvmmsg() (only if OS_NETWORK_SUPPORTS_MMSG is defined)
  *  inet_pton()
  *  ntohl()/ntohs()
  *
@@ -72,6 +78,14 @@ typedef union
 #endif
 } OS_SockAddr_Accessor_t;
 
+/*
+ * Number of datagrams passed to or from the network stack per system
+ * call by OS_SocketSendToMulti_Impl() and OS_SocketRecvFromMulti_Impl().
+ * The message headers are on the stack, so this bounds the stack use
+ * of these calls.
+ */
+#define OS_SOCKET_MMSG_BATCH    32
+
 
 /****************************************************************************************
                                     Sockets API
@@ -460,19 +474,170 @@ int32 OS_SocketRecvFrom_Impl(uint32 sock_id, void *buffer, uint32 buflen, OS_Soc
 
 /*----------------------------------------------------------------
  *
- * Function: OS_SocketSendTo_Impl
+ * Function: OS_SocketRecvFromMulti_Impl
  *
  *  Purpose: Implemented per internal OSAL API
  *           See prototype for argument/return detail
  *
  *-----------------------------------------------------------------*/
-int32 OS_SocketSendTo_Impl(uint32 sock_id, const void *buffer, uint32 buflen, const OS_SockAddr_t *RemoteAddr)
+int32 OS_SocketRecvFromMulti_Impl(uint32 sock_id, OS_SockRecvMsg_t *msgs, uint32 count, int32 timeout)
 {
+   int32 return_code;
    int os_result;
+   int waitflags;
+   uint32 operation;
+   uint32 received;
+#ifdef OS_NETWORK_SUPPORTS_MMSG
+   struct mmsghdr msgvec[OS_SOCKET_MMSG_BATCH];
+   struct iovec iov[OS_SOCKET_MMSG_BATCH];
+   uint32 batch;
+   uint32 i;
+#else
    socklen_t addrlen;
+#endif
+
+   operation = OS_STREAM_STATE_READABLE;
+   /*
+    * If "O_NONBLOCK" flag is set then use select()
+    * Note this is the only way to get a correct timeout
+    */
+   if (OS_impl_filehandle_table[sock_id].selectable)
+   {
+       waitflags = MSG_DONTWAIT;
+       return_code = OS_SelectSingle_Impl(sock_id, &operation, timeout);
+   }
+   else
+   {
+       if (timeout == 0)
+       {
+           waitflags = MSG_DONTWAIT;
+       }
+       else
+       {
+           /* note timeout will not be honored if >0 */
+           waitflags = 0;
+       }
+       return_code = OS_SUCCESS;
+   }
+
+   if (return_code != OS_SUCCESS)
+   {
+      return return_code;
+   }
+
+   if ((operation & OS_STREAM_STATE_READABLE) == 0)
+   {
+      return OS_ERROR_TIMEOUT;
+   }
+
+   received = 0;
+   while (received < count)
+   {
+#ifdef OS_NETWORK_SUPPORTS_MMSG
+      batch = count - received;
+      if (batch > OS_SOCKET_MMSG_BATCH)
+      {
+         batch = OS_SOCKET_MMSG_BATCH;
+      }
+
+      memset(msgvec, 0, sizeof(msgvec[0]) * batch);
+      for (i = 0; i < batch; ++i)
+      {
+         iov[i].iov_base = msgs[received + i].buffer;
+         iov[i].iov_len = msgs[received + i].buflen;
+         if (msgs[received + i].RemoteAddr != NULL)
+         {
+            msgvec[i].msg_hdr.msg_name = &msgs[received + i].RemoteAddr->AddrData;
+            msgvec[i].msg_hdr.msg_namelen = OS_SOCKADDR_MAX_LEN;
+         }
+         msgvec[i].msg_hdr.msg_iov = &iov[i];
+         msgvec[i].msg_hdr.msg_iovlen = 1;
+      }
+
+      /* a blocking read only waits for the first message */
+      if (waitflags == 0)
+      {
+         os_result = recvmmsg(OS_impl_filehandle_table[sock_id].fd, msgvec, batch, MSG_WAITFORONE, NULL);
+      }
+      else
+      {
+         os_result = recvmmsg(OS_impl_filehandle_table[sock_id].fd, msgvec, batch, waitflags, NULL);
+      }
+
+      for (i = 0; os_result > 0 && i < os_result; ++i)
+      {
+         msgs[received + i].msglen = msgvec[i].msg_len;
+         if (msgs[received + i].RemoteAddr != NULL)
+         {
+            msgs[received + i].RemoteAddr->ActualLength = msgvec[i].msg_hdr.msg_namelen;
+         }
+      }
+#else
+      if (msgs[received].RemoteAddr != NULL)
+      {
+         addrlen = OS_SOCKADDR_MAX_LEN;
+         os_result = recvfrom(OS_impl_filehandle_table[sock_id].fd, msgs[received].buffer, msgs[received].buflen,
+               waitflags, (struct sockaddr *)&msgs[received].RemoteAddr->AddrData, &addrlen);
+         msgs[received].RemoteAddr->ActualLength = addrlen;
+      }
+      else
+      {
+         os_result = recvfrom(OS_impl_filehandle_table[sock_id].fd, msgs[received].buffer, msgs[received].buflen,
+               waitflags, NULL, NULL);
+      }
+
+      if (os_result >= 0)
+      {
+         msgs[received].msglen = os_result;
+         os_result = 1;
+      }
+#endif
+      if (os_result <= 0)
+      {
+         if (received != 0)
+         {
+            break;
+         }
+         if (errno == EAGAIN || errno == EWOULDBLOCK)
+         {
+            return OS_QUEUE_EMPTY;
+         }
+         OS_DEBUG("recv: %s\n",strerror(errno));
+         return OS_ERROR;
+      }
+
+      received += os_result;
+
+      /* only the first read may wait */
+      waitflags = MSG_DONTWAIT;
+
+#ifdef OS_NETWORK_SUPPORTS_MMSG
+      if (os_result < batch)
+      {
+         break;
+      }
+#endif
+   }
+
+   return received;
+} /* end OS_SocketRecvFromMulti_Impl */
+
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_SocketAddrLen
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Returns the length of the system address type held in
+ *           the address, or zero if the address is not valid.
+ *
+ *-----------------------------------------------------------------*/
+static socklen_t OS_SocketAddrLen(const OS_SockAddr_t *Addr)
+{
    const struct sockaddr *sa;
+   socklen_t addrlen;
 
-   sa = (const struct sockaddr *)&RemoteAddr->AddrData;
+   sa = (const struct sockaddr *)&Addr->AddrData;
    switch(sa->sa_family)
    {
    case AF_INET:
@@ -488,7 +653,31 @@ int32 OS_SocketSendTo_Impl(uint32 sock_id, const void *buffer, uint32 buflen, co
       break;
    }
 
-   if (addrlen != RemoteAddr->ActualLength)
+   if (addrlen != Addr->ActualLength)
+   {
+      addrlen = 0;
+   }
+
+   return addrlen;
+} /* end OS_SocketAddrLen */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_SocketSendTo_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SocketSendTo_Impl(uint32 sock_id, const void *buffer, uint32 buflen, const OS_SockAddr_t *RemoteAddr)
+{
+   int os_result;
+   socklen_t addrlen;
+   const struct sockaddr *sa;
+
+   sa = (const struct sockaddr *)&RemoteAddr->AddrData;
+   addrlen = OS_SocketAddrLen(RemoteAddr);
+   if (addrlen == 0)
    {
       return OS_ERR_BAD_ADDRESS;
    }
@@ -504,6 +693,89 @@ int32 OS_SocketSendTo_Impl(uint32 sock_id, const void *buffer, uint32 buflen, co
 } /* end OS_SocketSendTo_Impl */
 
 
+/*----------------------------------------------------------------
+ *
+ * Function: OS_SocketSendToMulti_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SocketSendToMulti_Impl(uint32 sock_id, const OS_SockSendMsg_t *msgs, uint32 count, const OS_SockAddr_t *RemoteAddr)
+{
+   int os_result;
+   socklen_t addrlen;
+   const struct sockaddr *sa;
+   uint32 sent;
+#ifdef OS_NETWORK_SUPPORTS_MMSG
+   struct mmsghdr msgvec[OS_SOCKET_MMSG_BATCH];
+   struct iovec iov[OS_SOCKET_MMSG_BATCH];
+   uint32 batch;
+   uint32 i;
+#endif
+
+   sa = (const struct sockaddr *)&RemoteAddr->AddrData;
+   addrlen = OS_SocketAddrLen(RemoteAddr);
+   if (addrlen == 0)
+   {
+      return OS_ERR_BAD_ADDRESS;
+   }
+
+   sent = 0;
+   while (sent < count)
+   {
+#ifdef OS_NETWORK_SUPPORTS_MMSG
+      batch = count - sent;
+      if (batch > OS_SOCKET_MMSG_BATCH)
+      {
+         batch = OS_SOCKET_MMSG_BATCH;
+      }
+
+      memset(msgvec, 0, sizeof(msgvec[0]) * batch);
+      for (i = 0; i < batch; ++i)
+      {
+         iov[i].iov_base = (void *)msgs[sent + i].buffer;
+         iov[i].iov_len = msgs[sent + i].buflen;
+         msgvec[i].msg_hdr.msg_name = (void *)sa;
+         msgvec[i].msg_hdr.msg_namelen = addrlen;
+         msgvec[i].msg_hdr.msg_iov = &iov[i];
+         msgvec[i].msg_hdr.msg_iovlen = 1;
+      }
+
+      os_result = sendmmsg(OS_impl_filehandle_table[sock_id].fd, msgvec, batch, MSG_DONTWAIT);
+#else
+      os_result = sendto(OS_impl_filehandle_table[sock_id].fd, msgs[sent].buffer, msgs[sent].buflen,
+            MSG_DONTWAIT, sa, addrlen);
+      if (os_result >= 0)
+      {
+         os_result = 1;
+      }
+#endif
+      if (os_result <= 0)
+      {
+         if (sent == 0)
+         {
+            OS_DEBUG("send: %s\n",strerror(errno));
+            return OS_ERROR;
+         }
+         break;
+      }
+
+      sent += os_result;
+
+#ifdef OS_NETWORK_SUPPORTS_MMSG
+      /* the socket buffer is full, the remainder would not fit either */
+      if (os_result < batch)
+      {
+         break;
+      }
+#endif
+   }
+
+   return sent;
+} /* end OS_SocketSendToMulti_Impl */
+
+
 
 /*----------------------------------------------------------------
  *
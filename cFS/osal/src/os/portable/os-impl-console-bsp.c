@@ -55,39 +55,93 @@
  *-----------------------------------------------------------------*/
 void  OS_ConsoleOutput_Impl(uint32 local_id)
 {
-    uint32 StartPos;
-    uint32 EndPos;
-    long WriteSize;
+    OS_BSP_ConsoleVec_t Vec[OS_CONSOLE_MAX_BATCH];
     OS_console_internal_record_t *console;
+    OS_console_line_t *line;
+    uint32 StartPos;
+    uint32 ReadPos;
+    uint32 NumLines;
+    uint32 Slot;
+    uint32 Busy;
 
     console = &OS_console_table[local_id];
-    StartPos = console->ReadPos;
-    EndPos = console->WritePos;
-    while (StartPos != EndPos)
+
+    do
     {
-        if (StartPos > EndPos)
+        /*
+         * Only one reader may own ReadPos.  A writer of a synchronous
+         * console that finds it owned leaves its line to the owner,
+         * which checks for a notification again once it lets go.  The
+         * fences order the ReaderBusy and WakeupPending accesses on
+         * both sides, so either the writer claims the reader or the
+         * owner sees the writer's notification.
+         */
+        Busy = 0;
+        OS_CONSOLE_ATOMIC_FENCE();
+        if (!OS_CONSOLE_ATOMIC_CAS(&console->ReaderBusy, &Busy, 1))
         {
-            /* handle wrap */
-            WriteSize = console->BufSize - StartPos;
-        }
-        else
-        {
-            WriteSize = EndPos - StartPos;
+            break;
         }
 
-        OS_BSP_ConsoleOutput_Impl(&console->BufBase[StartPos],
-                WriteSize);
+        /*
+         * Clear the notification before reading the ring, so that any
+         * line published after this point causes another wakeup.
+         */
+        OS_CONSOLE_ATOMIC_EXCHANGE(&console->WakeupPending, 0);
 
-        StartPos += WriteSize;
-        if (StartPos >= console->BufSize)
+        ReadPos = console->ReadPos;
+        while (true)
         {
-            /* handle wrap */
-            StartPos = 0;
+            /*
+             * Gather the published lines, in order, up to the first
+             * slot that is still free or still being written.
+             */
+            StartPos = ReadPos;
+            NumLines = 0;
+            while (NumLines < OS_CONSOLE_MAX_BATCH)
+            {
+                Slot = ReadPos % console->LineCount;
+                line = &console->Lines[Slot];
+                if (OS_CONSOLE_ATOMIC_LOAD(&line->Seq) != OS_CONSOLE_SEQ_ADD(console, ReadPos, 1))
+                {
+                    break;
+                }
+
+                Vec[NumLines].Str = &console->BufBase[Slot * console->LineSize];
+                Vec[NumLines].DataLen = line->Length;
+                ++NumLines;
+                ReadPos = OS_CONSOLE_SEQ_ADD(console, ReadPos, 1);
+            }
+
+            if (NumLines == 0)
+            {
+                break;
+            }
+
+            OS_BSP_ConsoleOutputVec_Impl(Vec, NumLines);
+
+            ++console->OutputBatches;
+            if (NumLines > console->MaxBatch)
+            {
+                console->MaxBatch = NumLines;
+            }
+
+            /* Hand the slots back to the writers, for their next lap around the ring */
+            while (StartPos != ReadPos)
+            {
+                line = &console->Lines[StartPos % console->LineCount];
+                OS_CONSOLE_ATOMIC_STORE(&line->Seq, OS_CONSOLE_SEQ_ADD(console, StartPos, console->LineCount));
+                StartPos = OS_CONSOLE_SEQ_ADD(console, StartPos, 1);
+            }
+
+            /* Update the global with the new read location */
+            console->ReadPos = ReadPos;
         }
-    }
 
-    /* Update the global with the new read location */
-    console->ReadPos = StartPos;
+        OS_CONSOLE_ATOMIC_STORE(&console->ReaderBusy, 0);
+        OS_CONSOLE_ATOMIC_FENCE();
+    }
+    while (OS_CONSOLE_ATOMIC_LOAD(&console->WakeupPending) != 0);
 } /* end OS_ConsoleOutput_Impl */
 
 
@@ -115,6 +115,20 @@ int32 OS_SocketRecvFrom_Impl(uint32 sock_id, void *buffer, uint32 buflen, OS_Soc
 } /* end OS_SocketRecvFrom_Impl */
 
 
+/*----------------------------------------------------------------
+ *
+ * Function: OS_SocketRecvFromMulti_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SocketRecvFromMulti_Impl(uint32 sock_id, OS_SockRecvMsg_t *msgs, uint32 count, int32 timeout)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+} /* end OS_SocketRecvFromMulti_Impl */
+
+
 /*----------------------------------------------------------------
  *
  * Function: OS_SocketSendTo_Impl
@@ -129,6 +143,20 @@ int32 OS_SocketSendTo_Impl(uint32 sock_id, const void *buffer, uint32 buflen, co
 } /* end OS_SocketSendTo_Impl */
 
 
+/*----------------------------------------------------------------
+ *
+ * Function: OS_SocketSendToMulti_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SocketSendToMulti_Impl(uint32 sock_id, const OS_SockSendMsg_t *msgs, uint32 count, const OS_SockAddr_t *RemoteAddr)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+} /* end OS_SocketSendToMulti_Impl */
+
+
 
 /*----------------------------------------------------------------
  *
@@ -33,6 +33,16 @@
 #include <sys/select.h>
 #include <sys/time.h>
 
+#include "os-impl-queues.h"
+
+/*
+ * On Linux a message queue descriptor is also a file descriptor, so
+ * queues can be included in select() along with the streams.
+ */
+#ifdef __linux__
+#define OS_IMPL_QUEUE_SELECT_FD(local_id)   ((int)OS_impl_queue_table[local_id].id)
+#endif
+
 
 #endif  /* INCLUDE_OS_IMPL_SELECT_H_ */
 
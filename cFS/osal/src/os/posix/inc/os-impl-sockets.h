@@ -34,10 +34,19 @@
 #include <netinet/in.h>
 #include <arpa/inet.h>
 #include <sys/types.h>
+#include <sys/socket.h>
 
 
 #define OS_NETWORK_SUPPORTS_IPV6
 
+/*
+ * Linux can pass several datagrams to or from a socket in one
+ * system call, using sendmmsg() and recvmmsg()
+ */
+#ifdef __linux__
+#define OS_NETWORK_SUPPORTS_MMSG
+#endif
+
 /*
  * A full POSIX-compliant I/O layer should support using
  * nonblocking I/O calls in combination with select().
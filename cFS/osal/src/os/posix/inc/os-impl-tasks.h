@@ -30,11 +30,13 @@
 
 #include <osconfig.h>
 #include <pthread.h>
+#include <sys/types.h>
 
 /*tasks */
 typedef struct
 {
     pthread_t id;
+    pid_t     host_tid;     /**< kernel thread ID, set once the task is running */
 } OS_impl_task_internal_record_t;
 
 
@@ -28,7 +28,7 @@
 #ifndef INCLUDE_OS_IMPL_TIMEBASE_H_
 #define INCLUDE_OS_IMPL_TIMEBASE_H_
 
-#include <osconfig.h>
+#include <osapi.h>
 #include <pthread.h>
 #include <signal.h>
 
@@ -43,6 +43,16 @@ typedef struct
     sig_atomic_t        reset_flag;
     struct timespec     softsleep;
 
+    /*
+     * Schedule of the simulated tick, for measuring jitter.
+     * The deadline is in OS_PREFERRED_CLOCK time and is only valid when armed.
+     */
+    int                 timer_fd;
+    bool                deadline_armed;
+    struct timespec     next_deadline;
+    uint32              max_jitter_usec;
+    uint32              jitter_histogram[OS_TIMEBASE_JITTER_BUCKETS];
+
 } OS_impl_timebase_internal_record_t;
 
 /****************************************************************************************
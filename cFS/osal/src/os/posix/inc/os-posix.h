@@ -110,7 +110,8 @@ int32 OS_Posix_FileSysAPI_Impl_Init(void);
 
 int32 OS_Posix_TableMutex_Init(uint32 idtype);
 
-int32 OS_Posix_InternalTaskCreate_Impl (pthread_t *pthr, uint32 priority, size_t stacksz, PthreadFuncPtr_t entry, void *entry_arg);
+int32 OS_Posix_InternalTaskCreate_Impl (pthread_t *pthr, uint32 priority, size_t stacksz, uint32 cpu_affinity,
+        PthreadFuncPtr_t entry, void *entry_arg);
 void  OS_Posix_CompAbsDelayTime( uint32 msecs , struct timespec * tm);
 
 
@@ -130,7 +130,7 @@ int32 OS_ConsoleCreate_Impl(uint32 local_id)
             {
                 local_arg.value = local_id;
                 return_code = OS_Posix_InternalTaskCreate_Impl(&consoletask, OS_CONSOLE_TASK_PRIORITY, 0,
-                    OS_ConsoleTask_Entry, local_arg.opaque_arg);
+                    OS_TASK_CPU_AFFINITY_ANY, OS_ConsoleTask_Entry, local_arg.opaque_arg);
 
                 if (return_code != OS_SUCCESS)
                 {
@@ -34,6 +34,7 @@
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <sys/wait.h>
+#include <sys/mman.h>
 
 #include "os-posix.h"
 #include "os-impl-files.h"
@@ -104,3 +105,79 @@ int32 OS_Posix_StreamAPI_Impl_Init(void)
     return OS_SUCCESS;
 } /* end OS_Posix_StreamAPI_Impl_Init */
 
+
+/****************************************************************************************
+                                 FILE MAPPING API
+ ***************************************************************************************/
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_FileMap_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_FileMap_Impl(uint32 local_id, uint32 offset, uint32 length, void **addr)
+{
+    long   page_size;
+    off_t  page_offset;
+    size_t page_delta;
+    void  *map_base;
+
+    /*
+     * mmap() requires the file offset to be a multiple of the page size,
+     * so map from the start of the containing page and return an address
+     * that is adjusted to the requested offset.
+     */
+    page_size = sysconf(_SC_PAGESIZE);
+    if (page_size <= 0)
+    {
+        return OS_ERROR;
+    }
+
+    page_delta = offset % (unsigned long)page_size;
+    page_offset = (off_t)offset - (off_t)page_delta;
+
+    map_base = mmap(NULL, page_delta + length, PROT_READ | PROT_WRITE, MAP_PRIVATE,
+            OS_impl_filehandle_table[local_id].fd, page_offset);
+    if (map_base == MAP_FAILED)
+    {
+        OS_DEBUG("mmap: %s\n",strerror(errno));
+        return OS_ERROR;
+    }
+
+    *addr = (uint8*)map_base + page_delta;
+
+    return OS_SUCCESS;
+} /* end OS_FileMap_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_FileUnmap_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_FileUnmap_Impl(void *addr, uint32 length)
+{
+    long   page_size;
+    size_t page_delta;
+
+    page_size = sysconf(_SC_PAGESIZE);
+    if (page_size <= 0)
+    {
+        return OS_ERROR;
+    }
+
+    page_delta = (cpuaddr)addr % (unsigned long)page_size;
+
+    if (munmap((uint8*)addr - page_delta, page_delta + length) < 0)
+    {
+        OS_DEBUG("munmap: %s\n",strerror(errno));
+        return OS_ERROR;
+    }
+
+    return OS_SUCCESS;
+} /* end OS_FileUnmap_Impl */
@@ -25,6 +25,12 @@
  *
  */
 
+/*
+ * The CPU affinity calls (pthread_attr_setaffinity_np and the cpu_set_t macros)
+ * and the thread ID used to locate per-thread statistics are GNU extensions.
+ */
+#define _GNU_SOURCE
+
 /****************************************************************************************
                                     INCLUDE FILES
  ***************************************************************************************/
@@ -32,6 +38,7 @@
 #include "os-posix.h"
 #include "bsp-impl.h"
 #include <sched.h>
+#include <sys/syscall.h>
 
 #include "os-impl-tasks.h"
 
@@ -123,8 +130,16 @@ static void  OS_NoopSigHandler (int signal)
 static void *OS_PthreadTaskEntry(void *arg)
 {
    OS_U32ValueWrapper_t local_arg;
+   uint32 local_id;
 
    local_arg.opaque_arg = arg;
+
+   /* record the kernel thread ID, which names this task's entry under /proc */
+   if (OS_ObjectIdToArrayIndex(OS_OBJECT_TYPE_OS_TASK, local_arg.value, &local_id) == OS_SUCCESS)
+   {
+      OS_impl_task_table[local_id].host_tid = (pid_t)syscall(SYS_gettid);
+   }
+
    OS_TaskEntryPoint(local_arg.value); /* Never returns */
 
    return NULL;
@@ -436,11 +451,14 @@ int32 OS_Posix_TaskAPI_Impl_Init(void)
  *  Purpose: Local helper routine, not part of OSAL API.
  *
  *-----------------------------------------------------------------*/
-int32 OS_Posix_InternalTaskCreate_Impl(pthread_t *pthr, uint32 priority, size_t stacksz, PthreadFuncPtr_t entry, void *entry_arg)
+int32 OS_Posix_InternalTaskCreate_Impl(pthread_t *pthr, uint32 priority, size_t stacksz, uint32 cpu_affinity,
+        PthreadFuncPtr_t entry, void *entry_arg)
 {
     int                return_code = 0;
     pthread_attr_t     custom_attr;
     struct sched_param priority_holder;
+    cpu_set_t          cpu_set;
+    uint32             cpu;
 
 
     /*
@@ -533,6 +551,29 @@ int32 OS_Posix_InternalTaskCreate_Impl(pthread_t *pthr, uint32 priority, size_t
 
     } /* End if user is root */
 
+    /*
+    ** Restrict the task to the requested CPUs.  With no mask the thread
+    ** keeps the affinity of its creator, as it always has.
+    */
+    if (cpu_affinity != OS_TASK_CPU_AFFINITY_ANY)
+    {
+       CPU_ZERO(&cpu_set);
+       for (cpu = 0; cpu < 32 && cpu < CPU_SETSIZE; ++cpu)
+       {
+          if ((cpu_affinity >> cpu) & 1)
+          {
+             CPU_SET(cpu, &cpu_set);
+          }
+       }
+
+       return_code = pthread_attr_setaffinity_np(&custom_attr, sizeof(cpu_set), &cpu_set);
+       if (return_code != 0)
+       {
+          OS_DEBUG("pthread_attr_setaffinity_np error in OS_TaskCreate: %s\n",strerror(return_code));
+          return(OS_ERROR);
+       }
+    }
+
     /*
      ** Create thread
      */
@@ -580,11 +621,13 @@ int32 OS_TaskCreate_Impl (uint32 task_id, uint32 flags)
 
     arg.opaque_arg = NULL;
     arg.value = OS_global_task_table[task_id].active_id;
+    OS_impl_task_table[task_id].host_tid = 0;
 
     return_code = OS_Posix_InternalTaskCreate_Impl(
            &OS_impl_task_table[task_id].id,
            OS_task_table[task_id].priority,
            OS_task_table[task_id].stack_size,
+           OS_task_table[task_id].cpu_affinity,
            OS_PthreadTaskEntry,
            arg.opaque_arg);
 
@@ -771,6 +814,150 @@ uint32 OS_TaskGetId_Impl (void)
 } /* end OS_TaskGetId_Impl */
 
 
+/*----------------------------------------------------------------
+ *
+ * Function: OS_Posix_ProcField
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Reads the value of a "name : value" line of a /proc file,
+ *           returning false if the line is for a different name.
+ *
+ *-----------------------------------------------------------------*/
+static bool OS_Posix_ProcField(const char *line, const char *name, unsigned long *value)
+{
+    size_t len = strlen(name);
+
+    if (strncmp(line, name, len) != 0)
+    {
+        return false;
+    }
+
+    line += len;
+    while (*line == ' ' || *line == '\t')
+    {
+        ++line;
+    }
+
+    return (*line == ':' && sscanf(line + 1, "%lu", value) == 1);
+} /* end OS_Posix_ProcField */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TaskGetStatsRef_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *           The reference is the kernel thread ID, as the statistics
+ *           come from the Linux /proc entries of the thread.
+ *
+ *-----------------------------------------------------------------*/
+uint32 OS_TaskGetStatsRef_Impl (uint32 task_id)
+{
+    return (uint32)OS_impl_task_table[task_id].host_tid;
+} /* end OS_TaskGetStatsRef_Impl */
+
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TaskGetStats_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void OS_TaskGetStats_Impl (uint32 stats_ref, OS_task_prop_t *task_prop)
+{
+    pid_t    tid = (pid_t)stats_ref;
+    char     path[64];
+    char     line[512];
+    char    *field;
+    char    *saveptr;
+    uint32   count;
+    unsigned long value;
+    FILE    *fp;
+
+    if (tid == 0)
+    {
+        return;
+    }
+
+    /*
+     * The stat line is "pid (comm) state ...", and the comm may contain spaces,
+     * so count fields from the last ')'.  The processor is field 39 of the
+     * line, which is the 37th after the comm.
+     */
+    snprintf(path, sizeof(path), "/proc/self/task/%d/stat", (int)tid);
+    fp = fopen(path, "r");
+    if (fp != NULL)
+    {
+        if (fgets(line, sizeof(line), fp) != NULL)
+        {
+            field = strrchr(line, ')');
+            if (field != NULL)
+            {
+                field = strtok_r(field + 1, " ", &saveptr);
+                for (count = 0; field != NULL && count < 36; ++count)
+                {
+                    field = strtok_r(NULL, " ", &saveptr);
+                }
+                if (field != NULL)
+                {
+                    task_prop->current_cpu = strtoul(field, NULL, 10);
+                }
+            }
+        }
+        fclose(fp);
+    }
+
+    /*
+     * The migration count is only in the scheduler debug statistics, which also
+     * have the context switch counts.  Without them, the switch counts are still
+     * in the thread status.
+     */
+    snprintf(path, sizeof(path), "/proc/self/task/%d/sched", (int)tid);
+    fp = fopen(path, "r");
+    if (fp != NULL)
+    {
+        while (fgets(line, sizeof(line), fp) != NULL)
+        {
+            if (OS_Posix_ProcField(line, "se.nr_migrations", &value))
+            {
+                task_prop->migrations = value;
+            }
+            else if (OS_Posix_ProcField(line, "nr_voluntary_switches", &value))
+            {
+                task_prop->voluntary_switches = value;
+            }
+            else if (OS_Posix_ProcField(line, "nr_involuntary_switches", &value))
+            {
+                task_prop->involuntary_switches = value;
+            }
+        }
+        fclose(fp);
+        return;
+    }
+
+    snprintf(path, sizeof(path), "/proc/self/task/%d/status", (int)tid);
+    fp = fopen(path, "r");
+    if (fp != NULL)
+    {
+        while (fgets(line, sizeof(line), fp) != NULL)
+        {
+            if (OS_Posix_ProcField(line, "voluntary_ctxt_switches", &value))
+            {
+                task_prop->voluntary_switches = value;
+            }
+            else if (OS_Posix_ProcField(line, "nonvoluntary_ctxt_switches", &value))
+            {
+                task_prop->involuntary_switches = value;
+            }
+        }
+        fclose(fp);
+    }
+} /* end OS_TaskGetStats_Impl */
+
+
 /*----------------------------------------------------------------
  *
  * Function: OS_TaskGetInfo_Impl
@@ -781,6 +968,8 @@ uint32 OS_TaskGetId_Impl (void)
  *-----------------------------------------------------------------*/
 int32 OS_TaskGetInfo_Impl (uint32 task_id, OS_task_prop_t *task_prop)
 {
+    clockid_t cpu_clock;
+    struct timespec cpu_time;
 #ifndef OSAL_OMIT_DEPRECATED
     size_t copy_sz;
 
@@ -806,6 +995,13 @@ int32 OS_TaskGetInfo_Impl (uint32 task_id, OS_task_prop_t *task_prop)
    memcpy(&task_prop->OStask_id, &OS_impl_task_table[task_id].id, copy_sz);
 #endif
 
+   if (pthread_getcpuclockid(OS_impl_task_table[task_id].id, &cpu_clock) == 0 &&
+           clock_gettime(cpu_clock, &cpu_time) == 0)
+   {
+       task_prop->cpu_time.seconds = cpu_time.tv_sec;
+       task_prop->cpu_time.microsecs = cpu_time.tv_nsec / 1000;
+   }
+
    return OS_SUCCESS;
 } /* end OS_TaskGetInfo_Impl */
 
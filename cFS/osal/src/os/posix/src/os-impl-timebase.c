@@ -37,6 +37,10 @@
 #include "os-posix.h"
 #include "os-impl-timebase.h"
 
+#ifdef OSAL_CONFIG_POSIX_TIMERFD_TIMEBASE
+#include <sys/timerfd.h>
+#endif
+
 #include "os-shared-timebase.h"
 #include "os-shared-idmap.h"
 #include "os-shared-common.h"
@@ -51,6 +55,8 @@
  ***************************************************************************************/
 
 static void  OS_UsecToTimespec(uint32 usecs, struct timespec *time_spec);
+static void  OS_TimeBase_ArmDeadline(uint32 timer_id, uint32 start_time);
+static uint32 OS_TimeBase_AdvanceDeadline(uint32 timer_id, const struct timespec *now);
 
 /****************************************************************************************
                                      DEFINES
@@ -102,6 +108,120 @@ static void OS_UsecToTimespec(uint32 usecs, struct timespec *time_spec)
    }
 } /* end OS_UsecToTimespec */
 
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TimeBase_ArmDeadline
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Sets the first deadline of the simulated tick, start_time
+ *           microseconds from now.  A zero start time disarms the tick,
+ *           as it does for timer_settime().
+ *
+ *-----------------------------------------------------------------*/
+static void OS_TimeBase_ArmDeadline(uint32 timer_id, uint32 start_time)
+{
+    OS_impl_timebase_internal_record_t *local;
+    struct timespec start;
+
+    local = &OS_impl_timebase_table[timer_id];
+
+    local->deadline_armed = (start_time != 0);
+    if (local->deadline_armed)
+    {
+        clock_gettime(OS_PREFERRED_CLOCK, &local->next_deadline);
+        OS_UsecToTimespec(start_time, &start);
+        local->next_deadline.tv_sec += start.tv_sec;
+        local->next_deadline.tv_nsec += start.tv_nsec;
+        if (local->next_deadline.tv_nsec >= 1000000000)
+        {
+            local->next_deadline.tv_nsec -= 1000000000;
+            ++local->next_deadline.tv_sec;
+        }
+    }
+} /* end OS_TimeBase_ArmDeadline */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TimeBase_AdvanceDeadline
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Records how late a simulated tick was serviced, relative to
+ *           its deadline, then moves the deadline to the first one after
+ *           the current time.
+ *
+ *           Returns the number of intervals that the deadline moved by,
+ *           which is more than one if ticks were missed.
+ *
+ *-----------------------------------------------------------------*/
+static uint32 OS_TimeBase_AdvanceDeadline(uint32 timer_id, const struct timespec *now)
+{
+    OS_impl_timebase_internal_record_t *local;
+    int64  late_nsec;
+    int64  interval_nsec;
+    uint32 late_usec;
+    uint32 bucket;
+    uint32 count;
+
+    local = &OS_impl_timebase_table[timer_id];
+
+    if (!local->deadline_armed)
+    {
+        return 0;
+    }
+
+    late_nsec = ((int64)(now->tv_sec - local->next_deadline.tv_sec) * 1000000000) +
+            (now->tv_nsec - local->next_deadline.tv_nsec);
+    if (late_nsec < 0)
+    {
+        late_nsec = 0;
+    }
+
+    if (late_nsec >= ((int64)UINT32_MAX * 1000))
+    {
+        late_usec = UINT32_MAX;
+    }
+    else
+    {
+        late_usec = (uint32)(late_nsec / 1000);
+    }
+
+    if (late_usec > local->max_jitter_usec)
+    {
+        local->max_jitter_usec = late_usec;
+    }
+
+    /* bucket N holds values whose highest set bit is bit N-1 */
+    bucket = 0;
+    while (late_usec != 0 && bucket < (OS_TIMEBASE_JITTER_BUCKETS - 1))
+    {
+        late_usec >>= 1;
+        ++bucket;
+    }
+    ++local->jitter_histogram[bucket];
+
+    interval_nsec = (int64)OS_timebase_table[timer_id].nominal_interval_time * 1000;
+    if (interval_nsec <= 0)
+    {
+        /* one-shot tick */
+        local->deadline_armed = false;
+        return 1;
+    }
+
+    /* the deadline that was just serviced, plus any that were missed */
+    count = 1 + (uint32)(late_nsec / interval_nsec);
+    late_nsec = interval_nsec * count;
+
+    local->next_deadline.tv_sec += late_nsec / 1000000000;
+    local->next_deadline.tv_nsec += late_nsec % 1000000000;
+    if (local->next_deadline.tv_nsec >= 1000000000)
+    {
+        local->next_deadline.tv_nsec -= 1000000000;
+        ++local->next_deadline.tv_sec;
+    }
+
+    return count;
+} /* end OS_TimeBase_AdvanceDeadline */
+
 /*----------------------------------------------------------------
  *
  * Function: OS_TimeBaseLock_Impl
@@ -142,11 +262,20 @@ static uint32 OS_TimeBase_SigWaitImpl(uint32 timer_id)
     OS_impl_timebase_internal_record_t *local;
     uint32 interval_time;
     int sig;
+    struct timespec now;
 
     local = &OS_impl_timebase_table[timer_id];
 
     ret = sigwait(&local->sigset, &sig);
 
+    if (ret == 0)
+    {
+        clock_gettime(OS_PREFERRED_CLOCK, &now);
+        pthread_mutex_lock(&local->handler_mutex);
+        OS_TimeBase_AdvanceDeadline(timer_id, &now);
+        pthread_mutex_unlock(&local->handler_mutex);
+    }
+
     if (ret != 0)
     {
         /*
@@ -177,6 +306,128 @@ static uint32 OS_TimeBase_SigWaitImpl(uint32 timer_id)
     return interval_time;
 } /* end OS_TimeBase_SoftWaitImpl */
 
+#ifdef OSAL_CONFIG_POSIX_TIMERFD_TIMEBASE
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TimeBase_FdArm
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Programs the timerfd to expire at the next deadline, less the
+ *           busy-wait window, or disarms it if there is no deadline.
+ *
+ *-----------------------------------------------------------------*/
+static int OS_TimeBase_FdArm(uint32 timer_id)
+{
+    OS_impl_timebase_internal_record_t *local;
+    struct itimerspec timeout;
+
+    local = &OS_impl_timebase_table[timer_id];
+
+    memset(&timeout, 0, sizeof(timeout));
+    if (local->deadline_armed)
+    {
+        timeout.it_value = local->next_deadline;
+        timeout.it_value.tv_nsec -= (long)OSAL_CONFIG_POSIX_TIMEBASE_SPIN_USEC * 1000;
+        while (timeout.it_value.tv_nsec < 0)
+        {
+            timeout.it_value.tv_nsec += 1000000000;
+            --timeout.it_value.tv_sec;
+        }
+    }
+
+    return timerfd_settime(local->timer_fd, TFD_TIMER_ABSTIME, &timeout, NULL);
+} /* end OS_TimeBase_FdArm */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TimeBase_FdWaitImpl
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Waits for the next deadline of the simulated tick using the
+ *           timerfd, which is armed at the absolute deadline less the
+ *           busy-wait window, then busy-waits for the remainder.
+ *
+ *           The timerfd is re-armed at every deadline rather than left
+ *           to repeat on its own, so OS_TimeBaseSet_Impl() can move the
+ *           schedule at any time and a blocked read() simply waits for the
+ *           new deadline.
+ *
+ *-----------------------------------------------------------------*/
+static uint32 OS_TimeBase_FdWaitImpl(uint32 timer_id)
+{
+    OS_impl_timebase_internal_record_t *local;
+    struct timespec now;
+    uint64 expirations;
+    uint32 interval_time;
+    uint32 count;
+    ssize_t ret;
+
+    local = &OS_impl_timebase_table[timer_id];
+
+    ret = read(local->timer_fd, &expirations, sizeof(expirations));
+    if (ret != (ssize_t)sizeof(expirations))
+    {
+        /*
+         * the read call failed, e.g. EINTR.
+         * returning 0 will cause the process to repeat.
+         */
+        return 0;
+    }
+
+    pthread_mutex_lock(&local->handler_mutex);
+
+    /*
+     * The schedule may have been changed after the timerfd expired but before
+     * the lock was taken, in which case the timerfd is already armed for the
+     * new deadline and this wakeup is stale.
+     */
+    clock_gettime(OS_PREFERRED_CLOCK, &now);
+    if (!local->deadline_armed ||
+            (((int64)(local->next_deadline.tv_sec - now.tv_sec) * 1000000000) +
+            (local->next_deadline.tv_nsec - now.tv_nsec)) > ((int64)OSAL_CONFIG_POSIX_TIMEBASE_SPIN_USEC * 1000))
+    {
+        pthread_mutex_unlock(&local->handler_mutex);
+        return 0;
+    }
+
+#if OSAL_CONFIG_POSIX_TIMEBASE_SPIN_USEC > 0
+    while (now.tv_sec < local->next_deadline.tv_sec ||
+            (now.tv_sec == local->next_deadline.tv_sec && now.tv_nsec < local->next_deadline.tv_nsec))
+    {
+        clock_gettime(OS_PREFERRED_CLOCK, &now);
+    }
+#endif
+
+    count = OS_TimeBase_AdvanceDeadline(timer_id, &now);
+
+    if (local->reset_flag == 0)
+    {
+        interval_time = OS_timebase_table[timer_id].nominal_interval_time * count;
+    }
+    else
+    {
+        /*
+         * The first deadline after OS_TimeBaseSet_Impl() is the start time,
+         * any further deadlines that were missed are intervals.
+         */
+        interval_time = OS_timebase_table[timer_id].nominal_start_time +
+                (OS_timebase_table[timer_id].nominal_interval_time * (count - 1));
+        local->reset_flag = 0;
+    }
+
+    if (local->deadline_armed)
+    {
+        OS_TimeBase_FdArm(timer_id);
+    }
+
+    pthread_mutex_unlock(&local->handler_mutex);
+
+    return interval_time;
+} /* end OS_TimeBase_FdWaitImpl */
+
+#endif /* OSAL_CONFIG_POSIX_TIMERFD_TIMEBASE */
+
 
 /****************************************************************************************
                                 INITIALIZATION FUNCTION
@@ -264,6 +515,8 @@ int32 OS_Posix_TimeBaseAPI_Impl_Init(void)
            ** This gives a mechanism to synchronize updates to the timer chain with the
            ** expiration of the timer and processing the chain.
            */
+           OS_impl_timebase_table[i].timer_fd = -1;
+
            status = pthread_mutex_init(&OS_impl_timebase_table[i].handler_mutex, &mutex_attr);
            if ( status != 0 )
            {
@@ -348,13 +601,19 @@ int32 OS_TimeBaseCreate_Impl(uint32 timer_id)
      */
     arg.opaque_arg = NULL;
     arg.value = global->active_id;
-    return_code = OS_Posix_InternalTaskCreate_Impl(&local->handler_thread, 0, 0, OS_TimeBasePthreadEntry, arg.opaque_arg);
+    /* no affinity of its own: the handler thread stays on the CPUs of the task creating the time base */
+    return_code = OS_Posix_InternalTaskCreate_Impl(&local->handler_thread, 0, 0, OS_TASK_CPU_AFFINITY_ANY,
+            OS_TimeBasePthreadEntry, arg.opaque_arg);
     if (return_code != OS_SUCCESS)
     {
         return return_code;
     }
 
     local->assigned_signal = 0;
+    local->timer_fd = -1;
+    local->deadline_armed = false;
+    local->max_jitter_usec = 0;
+    memset(local->jitter_histogram, 0, sizeof(local->jitter_histogram));
     clock_gettime(OS_PREFERRED_CLOCK, &local->softsleep);
 
     /*
@@ -366,6 +625,28 @@ int32 OS_TimeBaseCreate_Impl(uint32 timer_id)
      * If no external sync function is provided then this will set up a POSIX
      * timer to locally simulate the timer tick using the CPU clock.
      */
+#ifdef OSAL_CONFIG_POSIX_TIMERFD_TIMEBASE
+    if (OS_timebase_table[timer_id].external_sync == NULL)
+    {
+        /*
+         * Use a timerfd to simulate the tick.  This needs no signal, so the
+         * number of simulated time bases is not limited by SIGRTMIN..SIGRTMAX.
+         * The timerfd is not armed until OS_TimeBaseSet_Impl() is called.
+         *
+         * If the timerfd cannot be created, fall back to a signal below.
+         */
+        local->timer_fd = timerfd_create(OS_PREFERRED_CLOCK, TFD_CLOEXEC);
+        if (local->timer_fd < 0)
+        {
+            OS_DEBUG("Error in timerfd_create: %s\n",strerror(errno));
+        }
+        else
+        {
+            OS_timebase_table[timer_id].external_sync = OS_TimeBase_FdWaitImpl;
+        }
+    }
+#endif
+
     if (OS_timebase_table[timer_id].external_sync == NULL)
     {
         sigemptyset(&local->sigset);
@@ -477,6 +758,11 @@ int32 OS_TimeBaseCreate_Impl(uint32 timer_id)
          */
         pthread_cancel(local->handler_thread);
         local->assigned_signal = 0;
+        if (local->timer_fd >= 0)
+        {
+            close(local->timer_fd);
+            local->timer_fd = -1;
+        }
     }
 
     return return_code;
@@ -501,7 +787,7 @@ int32 OS_TimeBaseSet_Impl(uint32 timer_id, int32 start_time, int32 interval_time
     return_code = OS_SUCCESS;
 
     /* There is only something to do here if we are generating a simulated tick */
-    if (local->assigned_signal != 0)
+    if (local->assigned_signal != 0 || local->timer_fd >= 0)
     {
         /*
         ** Convert from Microseconds to timespec structures
@@ -511,12 +797,31 @@ int32 OS_TimeBaseSet_Impl(uint32 timer_id, int32 start_time, int32 interval_time
         OS_UsecToTimespec(interval_time, &timeout.it_interval);
 
         /*
-        ** Program the real timer
-        */
-        status = timer_settime(local->host_timerid,
-                0,              /* Flags field can be zero */
-                &timeout,       /* struct itimerspec */
-                NULL);         /* Oldvalue */
+         * The caller holds the time base lock, so the servicing thread
+         * cannot be using the deadline.
+         */
+        OS_TimeBase_ArmDeadline(timer_id, start_time);
+
+#ifdef OSAL_CONFIG_POSIX_TIMERFD_TIMEBASE
+        if (local->timer_fd >= 0)
+        {
+            /*
+            ** Program the timerfd for the first deadline.
+            ** The servicing thread programs each following deadline.
+            */
+            status = OS_TimeBase_FdArm(timer_id);
+        }
+        else
+#endif
+        {
+            /*
+            ** Program the real timer
+            */
+            status = timer_settime(local->host_timerid,
+                    0,              /* Flags field can be zero */
+                    &timeout,       /* struct itimerspec */
+                    NULL);         /* Oldvalue */
+        }
 
         if (status < 0)
         {
@@ -571,6 +876,14 @@ int32 OS_TimeBaseDelete_Impl(uint32 timer_id)
         local->assigned_signal = 0;
     }
 
+    if (local->timer_fd >= 0)
+    {
+        close(local->timer_fd);
+        local->timer_fd = -1;
+    }
+
+    local->deadline_armed = false;
+
     return OS_SUCCESS;
 } /* end OS_TimeBaseDelete_Impl */
 
@@ -585,6 +898,13 @@ int32 OS_TimeBaseDelete_Impl(uint32 timer_id)
  *-----------------------------------------------------------------*/
 int32 OS_TimeBaseGetInfo_Impl (uint32 timer_id, OS_timebase_prop_t *timer_prop)
 {
+    OS_impl_timebase_internal_record_t *local;
+
+    local = &OS_impl_timebase_table[timer_id];
+
+    timer_prop->max_jitter = local->max_jitter_usec;
+    memcpy(timer_prop->jitter_histogram, local->jitter_histogram, sizeof(timer_prop->jitter_histogram));
+
     return OS_SUCCESS;
 
 } /* end OS_TimeBaseGetInfo_Impl */
@@ -80,3 +80,33 @@ int32 OS_Rtems_StreamAPI_Impl_Init(void)
     return OS_SUCCESS;
 } /* end OS_Rtems_StreamAPI_Impl_Init */
 
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_FileMap_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *           File mapping is not supported on this platform.
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_FileMap_Impl(uint32 local_id, uint32 offset, uint32 length, void **addr)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+} /* end OS_FileMap_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_FileUnmap_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *           File mapping is not supported on this platform.
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_FileUnmap_Impl(void *addr, uint32 length)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+} /* end OS_FileUnmap_Impl */
@@ -137,6 +137,26 @@ int32 OS_GenericClose_Impl(uint32 local_id);
  ------------------------------------------------------------------*/
 int32 OS_FileOpen_Impl(uint32 local_id, const char *local_path, int32 flags, int32 access);
 
+/*----------------------------------------------------------------
+   Function: OS_FileMap_Impl
+
+    Purpose: Maps "length" bytes of an open file starting at "offset"
+             into memory as a private (copy-on-write) mapping.
+             The offset does not need to be page aligned.
+
+    Returns: OS_SUCCESS on success, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_FileMap_Impl(uint32 local_id, uint32 offset, uint32 length, void **addr);
+
+/*----------------------------------------------------------------
+   Function: OS_FileUnmap_Impl
+
+    Purpose: Releases a mapping previously created by OS_FileMap_Impl
+
+    Returns: OS_SUCCESS on success, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_FileUnmap_Impl(void *addr, uint32 length);
+
 /*----------------------------------------------------------------
    Function: OS_ShellOutputToFile_Impl
 
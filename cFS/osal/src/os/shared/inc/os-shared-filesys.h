@@ -120,6 +120,49 @@ typedef struct
  */
 extern OS_filesys_internal_record_t        OS_filesys_table[OS_MAX_FILE_SYSTEMS];
 
+/*
+ * The mount table is a copy of the virtual mount points of all mounted
+ * file systems, ordered from the longest mount point to the shortest,
+ * which OS_TranslatePath() searches without taking the file system
+ * table lock.
+ *
+ * It is rebuilt from the file system table, under the table lock,
+ * every time a file system is mounted, unmounted, or removed.  The
+ * sequence number is odd while a rebuild is in progress, and a reader
+ * that sees it change retries its lookup.
+ *
+ * If the compiler does not provide the atomic builtins, readers take
+ * the table lock instead.
+ */
+#ifdef __ATOMIC_SEQ_CST
+#define OS_FILESYS_LOCKFREE_MOUNT_TABLE
+#define OS_FILESYS_SEQ_LOAD(ptr)        __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+#define OS_FILESYS_SEQ_STORE(ptr,val)   __atomic_store_n((ptr), (val), __ATOMIC_RELEASE)
+#define OS_FILESYS_SEQ_FENCE()          __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#else
+#define OS_FILESYS_SEQ_LOAD(ptr)        (*(ptr))
+#define OS_FILESYS_SEQ_STORE(ptr,val)   (*(ptr) = (val))
+#define OS_FILESYS_SEQ_FENCE()
+#endif
+
+typedef struct
+{
+    uint32 virtual_len;                             /**< Length of virtual_mountpt */
+    uint32 system_len;                              /**< Length of system_mountpt */
+    bool   is_mounted_system;                       /**< Whether system_mountpt is valid */
+    char   virtual_mountpt[OS_MAX_PATH_LEN];
+    char   system_mountpt[OS_MAX_LOCAL_PATH_LEN];
+} OS_filesys_mount_entry_t;
+
+typedef struct
+{
+    volatile uint32 seq;                            /**< Odd while the table is being rebuilt */
+    uint32 num_entries;
+    OS_filesys_mount_entry_t entry[OS_MAX_FILE_SYSTEMS];
+} OS_filesys_mount_table_t;
+
+extern OS_filesys_mount_table_t            OS_filesys_mount_table;
+
 
 /*
  * File system abstraction layer
@@ -207,6 +250,8 @@ int32 OS_FileSysUnmountVolume_Impl (uint32 filesys_id);
  */
 
 bool OS_FileSys_FindVirtMountPoint(void *ref, uint32 local_id, const OS_common_record_t *obj);
+void OS_FileSys_RebuildMountTable(void);
+int32 OS_FileSys_MapMountPoint(const char *VirtualPath, size_t VirtPathLen, char *LocalPath);
 int32 OS_FileSys_SetupInitialParamsForDevice(const char *devname, OS_filesys_internal_record_t *local);
 int32 OS_FileSys_Initialize(char *address, const char *fsdevname, const char * fsvolname, uint32 blocksize,
                uint32 numblocks, bool should_format);
@@ -33,6 +33,31 @@
 
 #define OS_OBJECT_EXCL_REQ_FLAG     0x0001
 
+/*
+ * Access to the record fields that are read without holding the global table lock.
+ *
+ * The active_id of a record acts as a generation tag: every allocation of a
+ * record issues a new serial number, so a stale ID never matches a reused
+ * record and a single load is enough to validate an ID.  The refcount may also
+ * be incremented without the table lock (see OS_ObjectIdRefcountIncr), so every
+ * update of it must be atomic as well.
+ *
+ * If the compiler does not provide the atomic builtins, plain accesses are
+ * used instead and OS_LOCK_MODE_REFCOUNT lookups always take the table lock.
+ */
+#ifdef __ATOMIC_SEQ_CST
+#define OS_IDMAP_LOCKFREE_REFCOUNT
+#define OS_IDMAP_ATOMIC_LOAD(ptr)           __atomic_load_n((ptr), __ATOMIC_SEQ_CST)
+#define OS_IDMAP_ATOMIC_STORE(ptr,val)      __atomic_store_n((ptr), (val), __ATOMIC_SEQ_CST)
+#define OS_IDMAP_ATOMIC_INCR(ptr)           __atomic_add_fetch((ptr), 1, __ATOMIC_SEQ_CST)
+#define OS_IDMAP_ATOMIC_DECR(ptr)           __atomic_sub_fetch((ptr), 1, __ATOMIC_SEQ_CST)
+#else
+#define OS_IDMAP_ATOMIC_LOAD(ptr)           (*(ptr))
+#define OS_IDMAP_ATOMIC_STORE(ptr,val)      (*(ptr) = (val))
+#define OS_IDMAP_ATOMIC_INCR(ptr)           (++*(ptr))
+#define OS_IDMAP_ATOMIC_DECR(ptr)           (--*(ptr))
+#endif
+
 /*
  * This supplies a non-abstract definition of "OS_common_record_t"
  */
@@ -306,6 +331,18 @@ int32 OS_ObjectIdFinalizeNew(int32 operation_status, OS_common_record_t *record,
  ------------------------------------------------------------------*/
 int32 OS_ObjectIdRefcountDecr(OS_common_record_t *record);
 
+/*----------------------------------------------------------------
+   Function: OS_ObjectIdRefcountIncr
+
+    Purpose: Attempt to increment the reference count without the global table lock
+             This succeeds only if the ID is still valid, no exclusive request is
+             pending, and no task holds the global table lock for the type.
+             Otherwise the caller must fall back to the locked lookup.
+
+   Returns: true if the reference count was incremented, false otherwise
+ ------------------------------------------------------------------*/
+bool OS_ObjectIdRefcountIncr(uint32 idtype, uint32 reference_id, OS_common_record_t *obj);
+
 /*
  * Internal helper functions
  * These are not normally called outside this unit, but need
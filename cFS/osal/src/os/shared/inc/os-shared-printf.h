@@ -32,26 +32,101 @@
 
 /*
  * Variables related to the console buffer.
- * This is a simple ring buffer that decouples
+ * This is a ring of fixed size line slots that decouples
  * the OS_printf() call from actual console output.
  *
+ * Any number of tasks may write lines at once.  A writer claims
+ * the next free slot by advancing WritePos with a single compare
+ * and swap, copies its line into the slot, and then publishes the
+ * slot by storing its sequence number.  Writers never wait on each
+ * other or on the output; if the ring is full the line is dropped
+ * and counted.
+ *
+ * A single reader (the utility task, or the writer itself for a
+ * synchronous console) forwards every published line from ReadPos
+ * in one batch, and then returns the slots to the writers.  For a
+ * synchronous console several writers may try to read at once, so
+ * the reader first claims ReaderBusy; one that finds it claimed
+ * leaves the remaining lines to the current owner.
+ *
+ * WritePos, ReadPos and the slot sequence numbers count lines, and
+ * wrap at SeqLimit, which is a multiple of LineCount so that a
+ * sequence number always maps to the same slot.  A slot whose Seq
+ * equals the position that maps to it is free for that position,
+ * and one that is one past it holds a published line.
+ *
  * The implementation layer may optionally spawn a
  * "utility task" or equivalent to forward data, or
  * it may process data immediately.
  */
 
+/*
+ * If the compiler does not provide the atomic builtins, plain accesses
+ * are used and OS_ConsoleWrite() holds the console table lock instead.
+ */
+#ifdef __ATOMIC_SEQ_CST
+#define OS_CONSOLE_LOCKFREE
+#define OS_CONSOLE_ATOMIC_LOAD(ptr)             __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+#define OS_CONSOLE_ATOMIC_STORE(ptr,val)        __atomic_store_n((ptr), (val), __ATOMIC_RELEASE)
+#define OS_CONSOLE_ATOMIC_EXCHANGE(ptr,val)     __atomic_exchange_n((ptr), (val), __ATOMIC_ACQ_REL)
+#define OS_CONSOLE_ATOMIC_INCR(ptr)             __atomic_add_fetch((ptr), 1, __ATOMIC_RELAXED)
+#define OS_CONSOLE_ATOMIC_CAS(ptr,expptr,val)   \
+    __atomic_compare_exchange_n((ptr), (expptr), (val), false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)
+#define OS_CONSOLE_ATOMIC_FENCE()               __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#else
+#define OS_CONSOLE_ATOMIC_LOAD(ptr)             (*(ptr))
+#define OS_CONSOLE_ATOMIC_STORE(ptr,val)        (*(ptr) = (val))
+#define OS_CONSOLE_ATOMIC_EXCHANGE(ptr,val)     OS_Console_Exchange((ptr), (val))
+#define OS_CONSOLE_ATOMIC_INCR(ptr)             (++*(ptr))
+#define OS_CONSOLE_ATOMIC_CAS(ptr,expptr,val)   \
+    ((*(ptr) == *(expptr)) ? (*(ptr) = (val), true) : (*(expptr) = *(ptr), false))
+#define OS_CONSOLE_ATOMIC_FENCE()
+
+static inline uint32 OS_Console_Exchange(volatile uint32 *ptr, uint32 val)
+{
+    uint32 prev = *ptr;
+    *ptr = val;
+    return prev;
+}
+#endif
+
+/*
+ * Most lines the reader forwards in one call to the output device
+ */
+#define OS_CONSOLE_MAX_BATCH        16
+
+typedef struct
+{
+    volatile uint32 Seq;              /**< Position this slot is free for, or one past it when published */
+    uint32 Length;                    /**< Length of the published line */
+} OS_console_line_t;
+
 typedef struct
 {
     char device_name[OS_MAX_API_NAME];
 
     char *BufBase;                    /**< Start of the buffer memory */
     uint32 BufSize;                   /**< Total size of the buffer */
-    volatile uint32 ReadPos;          /**< Offset of next byte to read */
-    volatile uint32 WritePos;         /**< Offset of next byte to write */
-    uint32 OverflowEvents;            /**< Number of lines dropped due to overflow */
+    OS_console_line_t *Lines;         /**< Slot state, one entry per line slot */
+    uint32 LineSize;                  /**< Size of each line slot in BufBase */
+    uint32 LineCount;                 /**< Number of line slots */
+    uint32 SeqLimit;                  /**< Line positions wrap to zero here */
+    volatile uint32 ReadPos;          /**< Position of the next line to read */
+    volatile uint32 WritePos;         /**< Position of the next line to write */
+    volatile uint32 WakeupPending;    /**< Set when the reader has been notified but has not run */
+    volatile uint32 ReaderBusy;       /**< Set while a reader owns ReadPos */
+    volatile uint32 OverflowEvents;   /**< Number of lines dropped due to overflow */
+    volatile uint32 LinesWritten;     /**< Number of lines put into the ring */
+    uint32 OutputBatches;             /**< Number of batches forwarded by the reader */
+    uint32 MaxBatch;                  /**< Most lines forwarded in one batch */
 
 } OS_console_internal_record_t;
 
+/*
+ * Advance a line position by a number of lines, no more than LineCount
+ */
+#define OS_CONSOLE_SEQ_ADD(console,pos,n)   (((pos) + (n)) % (console)->SeqLimit)
+
 
 extern OS_console_internal_record_t        OS_console_table[OS_MAX_CONSOLES];
 
@@ -89,6 +164,7 @@ int32 OS_ConsoleCreate_Impl(uint32 local_id);
    ring buffer into the actual output device/descriptor
 
    The data is already formatted, this just writes the characters.
+   Only one task may run this for a given console at a time.
  ------------------------------------------------------------------*/
 void  OS_ConsoleOutput_Impl(uint32 local_id);
 
@@ -107,6 +183,27 @@ void  OS_ConsoleOutput_Impl(uint32 local_id);
  ------------------------------------------------------------------*/
 void  OS_ConsoleWakeup_Impl(uint32 local_id);
 
+/*----------------------------------------------------------------
+   Function: OS_ConsoleWrite
+
+    Purpose: Local helper routine, not part of OSAL API.
+             Write one line into the console ring buffer, or
+             drop it if the ring is full.
+
+    returns: OS_SUCCESS, or OS_QUEUE_FULL if the line was dropped
+ ------------------------------------------------------------------*/
+int32 OS_ConsoleWrite(uint32 console_id, const char *Str);
+
+/*----------------------------------------------------------------
+   Function: OS_ConsoleSetup
+
+    Purpose: Local helper routine, not part of OSAL API.
+             Divide the buffer of a console into line slots and
+             mark every slot free.
+ ------------------------------------------------------------------*/
+void OS_ConsoleSetup(OS_console_internal_record_t *console, char *Buffer,
+        OS_console_line_t *Lines, uint32 LineSize, uint32 LineCount);
+
 
 #endif  /* INCLUDE_OS_SHARED_PRINTF_H_ */
 
@@ -95,6 +95,19 @@ int32 OS_SocketConnect_Impl(uint32 sock_id, const OS_SockAddr_t *Addr, int32 tim
  ------------------------------------------------------------------*/
 int32 OS_SocketRecvFrom_Impl(uint32 sock_id, void *buffer, uint32 buflen, OS_SockAddr_t *RemoteAddr, int32 timeout);
 
+/*----------------------------------------------------------------
+   Function: OS_SocketRecvFromMulti_Impl
+
+    Purpose: Receives up to "count" datagrams from the specified socket (must be
+             of the DATAGRAM type), storing each in the next message buffer
+             Will wait up to "timeout" milliseconds for the first packet
+             (zero to poll, negative to wait forever), and then only read
+             the packets that are already available
+
+    Returns: Count of messages received, or relevant error code if none were
+ ------------------------------------------------------------------*/
+int32 OS_SocketRecvFromMulti_Impl(uint32 sock_id, OS_SockRecvMsg_t *msgs, uint32 count, int32 timeout);
+
 /*----------------------------------------------------------------
    Function: OS_SocketSendTo_Impl
 
@@ -106,6 +119,18 @@ int32 OS_SocketRecvFrom_Impl(uint32 sock_id, void *buffer, uint32 buflen, OS_Soc
  ------------------------------------------------------------------*/
 int32 OS_SocketSendTo_Impl(uint32 sock_id, const void *buffer, uint32 buflen, const OS_SockAddr_t *RemoteAddr);
 
+/*----------------------------------------------------------------
+   Function: OS_SocketSendToMulti_Impl
+
+    Purpose: Sends "count" datagrams from the specified socket (must be of the
+             DATAGRAM type) to the remote address specified by "RemoteAddr"
+             Messages are sent in order, and sending stops at the first
+             message that cannot be queued
+
+    Returns: Count of messages sent, or relevant error code if none were sent
+ ------------------------------------------------------------------*/
+int32 OS_SocketSendToMulti_Impl(uint32 sock_id, const OS_SockSendMsg_t *msgs, uint32 count, const OS_SockAddr_t *RemoteAddr);
+
 /*----------------------------------------------------------------
 
    Function: OS_SocketGetInfo_Impl
@@ -36,6 +36,7 @@ typedef struct
    char      task_name[OS_MAX_API_NAME];
    uint32    stack_size;
    uint32    priority;
+   uint32    cpu_affinity;
    osal_task_entry entry_function_pointer;
    osal_task_entry delete_hook_pointer;
    void      *entry_arg;
@@ -151,6 +152,25 @@ uint32 OS_TaskGetId_Impl             (void);
  ------------------------------------------------------------------*/
 int32  OS_TaskGetInfo_Impl           (uint32 task_id, OS_task_prop_t *task_prop);
 
+/*----------------------------------------------------------------
+   Function: OS_TaskGetStatsRef_Impl
+
+    Purpose: Obtain a reference to the task for OS_TaskGetStats_Impl(),
+             which is called after the global lock is released
+
+    Returns: The reference, or zero if the statistics are not available
+ ------------------------------------------------------------------*/
+uint32 OS_TaskGetStatsRef_Impl       (uint32 task_id);
+
+/*----------------------------------------------------------------
+   Function: OS_TaskGetStats_Impl
+
+    Purpose: Obtain the CPU placement and context switch statistics of a task.
+             This may block, so it is called without the global lock.
+             Values that cannot be read are left as-is.
+ ------------------------------------------------------------------*/
+void   OS_TaskGetStats_Impl          (uint32 stats_ref, OS_task_prop_t *task_prop);
+
 /*----------------------------------------------------------------
 
    Function: OS_TaskRegister_Impl
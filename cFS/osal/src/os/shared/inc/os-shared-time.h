@@ -41,7 +41,8 @@ typedef struct
     uint32              prev_ref;
     uint32              next_ref;
     uint32              backlog_resets;
-    int32               wait_time;
+    uint32              expiry_time;
+    uint32              heap_index;
     int32               interval_time;
     OS_ArgCallback_t    callback_ptr;
     void                *callback_arg;
@@ -40,6 +40,11 @@ typedef struct
     uint32              freerun_time;
     uint32              nominal_start_time;
     uint32              nominal_interval_time;
+    uint32              callback_count;
+    uint32              overrun_count;
+    uint32              max_callback_latency;
+    uint32              timer_count;
+    uint32              timer_heap[OS_MAX_TIMERS];
 } OS_timebase_internal_record_t;
 
 /*
@@ -134,6 +139,24 @@ int32 OS_TimeBaseGetInfo_Impl       (uint32 timer_id, OS_timebase_prop_t *timer_
  ------------------------------------------------------------------*/
 void  OS_TimeBase_CallbackThread    (uint32 timebase_id);
 
+/*----------------------------------------------------------------
+   Function: OS_TimeBase_ArmTimer
+
+    Purpose: Schedule a timer callback at its expiry_time
+             The timer is inserted into the time base heap, or moved
+             to its new position if it was already armed.
+             The time base lock must be held by the caller.
+ ------------------------------------------------------------------*/
+void  OS_TimeBase_ArmTimer          (uint32 timebase_id, uint32 timecb_id);
+
+/*----------------------------------------------------------------
+   Function: OS_TimeBase_DisarmTimer
+
+    Purpose: Remove a timer callback from the time base heap, if armed
+             The time base lock must be held by the caller.
+ ------------------------------------------------------------------*/
+void  OS_TimeBase_DisarmTimer       (uint32 timebase_id, uint32 timecb_id);
+
 
 #endif  /* INCLUDE_OS_SHARED_TIMEBASE_H_ */
 
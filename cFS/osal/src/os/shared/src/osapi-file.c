@@ -409,6 +409,63 @@ int32 OS_lseek  (uint32  filedes, int32 offset, uint32 whence)
 } /* end OS_lseek */
 
 
+/*----------------------------------------------------------------
+ *
+ * Function: OS_FileMap
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_FileMap (uint32 filedes, uint32 offset, uint32 length, void **addr)
+{
+   OS_common_record_t *record;
+   uint32 local_id;
+   int32 return_code;
+
+   if (addr == NULL)
+   {
+      return OS_INVALID_POINTER;
+   }
+
+   *addr = NULL;
+
+   if (length == 0)
+   {
+      return OS_ERROR;
+   }
+
+   /* Make sure the file descriptor is legit before using it */
+   return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, filedes, &local_id, &record);
+   if (return_code == OS_SUCCESS)
+   {
+      return_code = OS_FileMap_Impl (local_id, offset, length, addr);
+      OS_ObjectIdRefcountDecr(record);
+   }
+
+   return return_code;
+} /* end OS_FileMap */
+
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_FileUnmap
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_FileUnmap (void *addr, uint32 length)
+{
+   if (addr == NULL)
+   {
+      return OS_INVALID_POINTER;
+   }
+
+   return OS_FileUnmap_Impl (addr, length);
+} /* end OS_FileUnmap */
+
+
 /*----------------------------------------------------------------
  *
  * Function: OS_remove
@@ -55,6 +55,11 @@ enum
  */
 OS_filesys_internal_record_t OS_filesys_table[LOCAL_NUM_OBJECTS];
 
+/*
+ * Virtual mount points of the mounted file systems, for path translation
+ */
+OS_filesys_mount_table_t OS_filesys_mount_table;
+
 #ifndef OSAL_OMIT_DEPRECATED
 
 /*
@@ -106,6 +111,131 @@ bool OS_FileSys_FindVirtMountPoint(void *ref, uint32 local_id, const OS_common_r
 } /* end OS_FileSys_FindVirtMountPoint */
 
 
+/*----------------------------------------------------------------
+ *
+ * Function: OS_FileSys_RebuildMountTable
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Copies the mount points of every virtually mounted file system
+ *           into the mount table, longest first, so that the first match
+ *           of a path is the most specific mount point.
+ *
+ *           The caller must hold the file system table lock.
+ *
+ *-----------------------------------------------------------------*/
+void OS_FileSys_RebuildMountTable(void)
+{
+    OS_filesys_mount_table_t *table = &OS_filesys_mount_table;
+    OS_filesys_internal_record_t *rec;
+    OS_filesys_mount_entry_t *entry;
+    uint32 seq;
+    uint32 len;
+    uint32 i;
+    uint32 j;
+
+    seq = table->seq;
+    OS_FILESYS_SEQ_STORE(&table->seq, seq + 1);
+    OS_FILESYS_SEQ_FENCE();
+
+    table->num_entries = 0;
+    for (i = 0; i < LOCAL_NUM_OBJECTS; i++)
+    {
+        rec = &OS_filesys_table[i];
+        if (OS_global_filesys_table[i].active_id == 0 ||
+                (rec->flags & OS_FILESYS_FLAG_IS_MOUNTED_VIRTUAL) == 0)
+        {
+            continue;
+        }
+
+        len = strlen(rec->virtual_mountpt);
+        if (len == 0)
+        {
+            continue;
+        }
+
+        /* insertion sort, longest mount point first */
+        j = table->num_entries;
+        while (j > 0 && table->entry[j - 1].virtual_len < len)
+        {
+            table->entry[j] = table->entry[j - 1];
+            --j;
+        }
+
+        entry = &table->entry[j];
+        entry->virtual_len = len;
+        entry->system_len = strlen(rec->system_mountpt);
+        entry->is_mounted_system = ((rec->flags & OS_FILESYS_FLAG_IS_MOUNTED_SYSTEM) != 0);
+        memcpy(entry->virtual_mountpt, rec->virtual_mountpt, len + 1);
+        memcpy(entry->system_mountpt, rec->system_mountpt, entry->system_len + 1);
+
+        ++table->num_entries;
+    }
+
+    OS_FILESYS_SEQ_FENCE();
+    OS_FILESYS_SEQ_STORE(&table->seq, seq + 2);
+} /* end OS_FileSys_RebuildMountTable */
+
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_FileSys_MapMountPoint
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Translates a virtual path through the most specific mount
+ *           point in the mount table.  The result is only valid if the
+ *           mount table sequence number did not change while this ran.
+ *
+ *  Returns: OS_SUCCESS on success or appropriate error code.
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_FileSys_MapMountPoint(const char *VirtualPath, size_t VirtPathLen, char *LocalPath)
+{
+    const OS_filesys_mount_entry_t *entry;
+    uint32 num_entries;
+    uint32 i;
+
+    num_entries = OS_filesys_mount_table.num_entries;
+    if (num_entries > OS_MAX_FILE_SYSTEMS)
+    {
+        /* only possible while a rebuild is in progress; the caller retries */
+        return OS_FS_ERR_PATH_INVALID;
+    }
+
+    for (i = 0; i < num_entries; i++)
+    {
+        entry = &OS_filesys_mount_table.entry[i];
+        if (entry->virtual_len <= VirtPathLen &&
+                strncmp(VirtualPath, entry->virtual_mountpt, entry->virtual_len) == 0 &&
+                (VirtualPath[entry->virtual_len] == '/' || VirtualPath[entry->virtual_len] == 0))
+        {
+            break;
+        }
+    }
+
+    if (i >= num_entries)
+    {
+        return OS_FS_ERR_PATH_INVALID;
+    }
+
+    if (!entry->is_mounted_system)
+    {
+        return OS_ERR_INCORRECT_OBJ_STATE;
+    }
+
+    VirtPathLen -= entry->virtual_len;
+    if ((entry->system_len + VirtPathLen) >= OS_MAX_LOCAL_PATH_LEN)
+    {
+        return OS_FS_ERR_PATH_TOO_LONG;
+    }
+
+    memcpy(LocalPath, entry->system_mountpt, entry->system_len);
+    memcpy(&LocalPath[entry->system_len], &VirtualPath[entry->virtual_len], VirtPathLen);
+    LocalPath[entry->system_len + VirtPathLen] = 0;
+
+    return OS_SUCCESS;
+} /* end OS_FileSys_MapMountPoint */
+
+
 /*----------------------------------------------------------------
  *
  * Function: OS_FileSys_InitLocalFromVolTable
@@ -431,6 +561,10 @@ int32 OS_FileSysAPI_Init(void)
         }
         ++Vol;
     }
+
+    OS_Lock_Global(LOCAL_OBJID_TYPE);
+    OS_FileSys_RebuildMountTable();
+    OS_Unlock_Global(LOCAL_OBJID_TYPE);
 #endif
 
     return return_code;
@@ -529,6 +663,12 @@ int32 OS_FileSysAddFixedMap(uint32 *filesys_id, const char *phys_path, const cha
         /* Check result, finalize record, and unlock global table. */
         return_code = OS_ObjectIdFinalizeNew(return_code, global, filesys_id);
 
+        if (return_code == OS_SUCCESS)
+        {
+            OS_Lock_Global(LOCAL_OBJID_TYPE);
+            OS_FileSys_RebuildMountTable();
+            OS_Unlock_Global(LOCAL_OBJID_TYPE);
+        }
     }
 
     return return_code;
@@ -612,6 +752,7 @@ int32 OS_rmfs (const char *devname)
         {
            /* Only need to clear the ID as zero is the "unused" flag */
            global->active_id = 0;
+           OS_FileSys_RebuildMountTable();
         }
 
         OS_Unlock_Global(LOCAL_OBJID_TYPE);
@@ -722,6 +863,7 @@ int32 OS_mount (const char *devname, const char* mountpoint)
              * For now this does both sides (system and virtual) */
             local->flags |= OS_FILESYS_FLAG_IS_MOUNTED_SYSTEM | OS_FILESYS_FLAG_IS_MOUNTED_VIRTUAL;
             strcpy(local->virtual_mountpt, mountpoint);
+            OS_FileSys_RebuildMountTable();
         }
 
         OS_Unlock_Global(LOCAL_OBJID_TYPE);
@@ -795,6 +937,7 @@ int32 OS_unmount (const char *mountpoint)
             /* mark as mounted in the local table.
              * For now this does both sides (system and virtual) */
             local->flags &= ~(OS_FILESYS_FLAG_IS_MOUNTED_SYSTEM | OS_FILESYS_FLAG_IS_MOUNTED_VIRTUAL);
+            OS_FileSys_RebuildMountTable();
         }
 
         OS_Unlock_Global(LOCAL_OBJID_TYPE);
@@ -1083,14 +1226,12 @@ int32 OS_GetFsInfo(os_fsinfo_t  *filesys_info)
  *-----------------------------------------------------------------*/
 int32 OS_TranslatePath(const char *VirtualPath, char *LocalPath)
 {
-    uint32 local_id;
     int32 return_code;
     const char *name_ptr;
-    OS_common_record_t *global;
-    OS_filesys_internal_record_t *local;
-    size_t SysMountPointLen;
     size_t VirtPathLen;
-    size_t VirtPathBegin;
+#ifdef OS_FILESYS_LOCKFREE_MOUNT_TABLE
+    uint32 seq;
+#endif
 
     /*
     ** Check to see if the path pointers are NULL
@@ -1123,9 +1264,6 @@ int32 OS_TranslatePath(const char *VirtualPath, char *LocalPath)
         return OS_FS_ERR_NAME_TOO_LONG;
     }
 
-    SysMountPointLen = 0;
-    VirtPathBegin = VirtPathLen;
-
     /*
     ** All valid Virtual paths must start with a '/' character
     */
@@ -1134,56 +1272,29 @@ int32 OS_TranslatePath(const char *VirtualPath, char *LocalPath)
        return OS_FS_ERR_PATH_INVALID;
     }
 
-    /* Get a reference lock, as a filesystem check could take some time. */
-    return_code = OS_ObjectIdGetBySearch(OS_LOCK_MODE_GLOBAL, LOCAL_OBJID_TYPE,
-            OS_FileSys_FindVirtMountPoint, (void*)VirtualPath, &global);
-
-    if (return_code != OS_SUCCESS)
-    {
-        return_code = OS_FS_ERR_PATH_INVALID;
-    }
-    else
+#ifdef OS_FILESYS_LOCKFREE_MOUNT_TABLE
+    /*
+     * Translate through the mount table without locking, and
+     * try again if the table was rebuilt at the same time.
+     */
+    do
     {
-        OS_ObjectIdToArrayIndex(LOCAL_OBJID_TYPE, global->active_id, &local_id);
-        local = &OS_filesys_table[local_id];
-
-        if ((local->flags & OS_FILESYS_FLAG_IS_MOUNTED_SYSTEM) != 0)
-        {
-            SysMountPointLen = strlen(local->system_mountpt);
-            VirtPathBegin = strlen(local->virtual_mountpt);
-            if (SysMountPointLen < OS_MAX_LOCAL_PATH_LEN)
-            {
-                memcpy(LocalPath, local->system_mountpt, SysMountPointLen);
-            }
-        }
-        else
+        seq = OS_FILESYS_SEQ_LOAD(&OS_filesys_mount_table.seq);
+        if ((seq & 1) != 0)
         {
-            return_code = OS_ERR_INCORRECT_OBJ_STATE;
+            continue;
         }
 
-        OS_Unlock_Global(LOCAL_OBJID_TYPE);
-    }
+        return_code = OS_FileSys_MapMountPoint(VirtualPath, VirtPathLen, LocalPath);
 
-    if (return_code == OS_SUCCESS)
-    {
-        if (VirtPathLen < VirtPathBegin)
-        {
-            return_code = OS_FS_ERR_PATH_INVALID;
-        }
-        else
-        {
-            VirtPathLen -= VirtPathBegin;
-            if ((SysMountPointLen + VirtPathLen) < OS_MAX_LOCAL_PATH_LEN)
-            {
-                memcpy(&LocalPath[SysMountPointLen],&VirtualPath[VirtPathBegin], VirtPathLen);
-                LocalPath[SysMountPointLen + VirtPathLen] = 0;
-            }
-            else
-            {
-                return_code = OS_FS_ERR_PATH_TOO_LONG;
-            }
-        }
+        OS_FILESYS_SEQ_FENCE();
     }
+    while ((seq & 1) != 0 || OS_FILESYS_SEQ_LOAD(&OS_filesys_mount_table.seq) != seq);
+#else
+    OS_Lock_Global(LOCAL_OBJID_TYPE);
+    return_code = OS_FileSys_MapMountPoint(VirtualPath, VirtPathLen, LocalPath);
+    OS_Unlock_Global(LOCAL_OBJID_TYPE);
+#endif
 
     return return_code;
 
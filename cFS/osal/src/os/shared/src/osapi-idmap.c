@@ -282,7 +282,7 @@ int32 OS_ObjectIdConvertLock(OS_lock_mode_t lock_mode, uint32 idtype, uint32 ref
     {
         /* Validate the integrity of the ID.  As the "active_id" is a single
          * integer, we can do this check regardless of whether global is locked or not. */
-        if (obj->active_id != reference_id)
+        if (OS_IDMAP_ATOMIC_LOAD(&obj->active_id) != reference_id)
         {
             /* The ID does not match, so unlock and return error.
              * This basically means the ID was stale or otherwise no longer invalid */
@@ -300,7 +300,7 @@ int32 OS_ObjectIdConvertLock(OS_lock_mode_t lock_mode, uint32 idtype, uint32 ref
              * refcount and good to go. */
             if ((obj->flags & OS_OBJECT_EXCL_REQ_FLAG) == 0)
             {
-                ++obj->refcount;
+                OS_IDMAP_ATOMIC_INCR(&obj->refcount);
                 return_code = OS_SUCCESS;
                 break;
             }
@@ -317,15 +317,19 @@ int32 OS_ObjectIdConvertLock(OS_lock_mode_t lock_mode, uint32 idtype, uint32 ref
                 /*
                  * As long as nothing is referencing this object, we are good to go.
                  * The global table will be left in a locked state in this case.
+                 *
+                 * References taken without the table lock cannot be missed here: the
+                 * table owner was published before this load, and OS_ObjectIdRefcountIncr
+                 * checks the owner after incrementing the refcount.
                  */
-                if (obj->refcount == 0)
+                if (OS_IDMAP_ATOMIC_LOAD(&obj->refcount) == 0)
                 {
                     return_code = OS_SUCCESS;
                     break;
                 }
 
                 exclusive_bits = OS_OBJECT_EXCL_REQ_FLAG;
-                obj->flags |= exclusive_bits;
+                OS_IDMAP_ATOMIC_STORE(&obj->flags, obj->flags | exclusive_bits);
             }
         }
         else
@@ -369,7 +373,7 @@ int32 OS_ObjectIdConvertLock(OS_lock_mode_t lock_mode, uint32 idtype, uint32 ref
          * In case any exclusive bits were set locally, unset them now
          * before the lock is (maybe) released.
          */
-        obj->flags &= ~exclusive_bits;
+        OS_IDMAP_ATOMIC_STORE(&obj->flags, obj->flags & ~exclusive_bits);
 
         /*
          * If the operation failed, then we always unlock the global table.
@@ -464,6 +468,7 @@ int32 OS_ObjectIdFindNext(uint32 idtype, uint32 *array_index, OS_common_record_t
    uint32 base_id;
    uint32 local_id = 0;
    uint32 idvalue;
+   uint32 new_id;
    uint32 i;
    int32 return_code;
    OS_common_record_t *obj = NULL;
@@ -497,6 +502,28 @@ int32 OS_ObjectIdFindNext(uint32 idtype, uint32 *array_index, OS_common_record_t
       obj = &OS_common_table[local_id + base_id];
       if (obj->active_id == 0)
       {
+#ifdef OS_IDMAP_LOCKFREE_REFCOUNT
+         /*
+          * OS_ObjectIdRefcountIncr() with a stale ID may briefly hold a
+          * reference on a free record, and drops it without the lock, so
+          * the count cannot be reset here.  Pass over a referenced record;
+          * one that stays referenced has leaked a reference.
+          */
+         if (OS_IDMAP_ATOMIC_LOAD(&obj->refcount) != 0)
+         {
+            OS_DEBUG("WARNING: free record %u of type %u still referenced (refcount=%u)\n",
+                  (unsigned int)local_id, (unsigned int)idtype, (unsigned int)obj->refcount);
+            continue;
+         }
+#else
+         /* The refcount only changes under the lock, so this is a leaked reference */
+         if (obj->refcount != 0)
+         {
+            OS_DEBUG("ERROR: free record %u of type %u leaked %u references\n",
+                  (unsigned int)local_id, (unsigned int)idtype, (unsigned int)obj->refcount);
+            obj->refcount = 0;
+         }
+#endif
          return_code = OS_SUCCESS;
          break;
       }
@@ -504,12 +531,12 @@ int32 OS_ObjectIdFindNext(uint32 idtype, uint32 *array_index, OS_common_record_t
 
    if(return_code == OS_SUCCESS)
    {
-       OS_ObjectIdCompose_Impl(idtype, idvalue, &obj->active_id);
+       OS_ObjectIdCompose_Impl(idtype, idvalue, &new_id);
+       OS_IDMAP_ATOMIC_STORE(&obj->active_id, new_id);
 
-       /* Ensure any data in the record has been cleared */
+       /* Ensure any data in the record has been cleared, the refcount is checked above */
        obj->name_entry = NULL;
        obj->creator = OS_TaskGetId();
-       obj->refcount = 0;
    }
 
    if(return_code != OS_SUCCESS)
@@ -586,7 +613,7 @@ void OS_Lock_Global(uint32 idtype)
             }
             else
             {
-                objtype->table_owner = self_task_id;
+                OS_IDMAP_ATOMIC_STORE(&objtype->table_owner, self_task_id);
             }
         }
     }
@@ -644,7 +671,7 @@ void OS_Unlock_Global(uint32 idtype)
         }
         else
         {
-            objtype->table_owner = 0;
+            OS_IDMAP_ATOMIC_STORE(&objtype->table_owner, 0);
         }
 
         return_code = OS_Unlock_Global_Impl(idtype);
@@ -743,13 +770,13 @@ int32 OS_ObjectIdFinalizeNew(int32 operation_status, OS_common_record_t *record,
      */
     if (operation_status != OS_SUCCESS)
     {
-        record->active_id = 0;
+        OS_IDMAP_ATOMIC_STORE(&record->active_id, 0);
     }
     else if (idtype == 0 || idtype >= OS_OBJECT_TYPE_USER)
     {
         /* should never happen - indicates a bug. */
         operation_status = OS_ERR_INVALID_ID;
-        record->active_id = 0;
+        OS_IDMAP_ATOMIC_STORE(&record->active_id, 0);
     }
     else
     {
@@ -925,6 +952,16 @@ int32 OS_ObjectIdGetById(OS_lock_mode_t lock_mode, uint32 idtype, uint32 id, uin
 
    *record = &OS_common_table[*array_index + OS_GetBaseForObjectType(idtype)];
 
+   /*
+    * A reference can usually be taken without the global table lock.
+    * The locked path below handles contention with exclusive requests
+    * and reports the reason for failure.
+    */
+   if (lock_mode == OS_LOCK_MODE_REFCOUNT && OS_ObjectIdRefcountIncr(idtype, id, *record))
+   {
+      return OS_SUCCESS;
+   }
+
    OS_ObjectIdInitiateLock(lock_mode, idtype);
 
    /*
@@ -955,14 +992,35 @@ int32 OS_ObjectIdGetById(OS_lock_mode_t lock_mode, uint32 idtype, uint32 id, uin
 int32 OS_ObjectIdRefcountDecr(OS_common_record_t *record)
 {
    int32 return_code;
-   uint32 idtype = record->active_id >> OS_OBJECT_TYPE_SHIFT;
+   uint32 active_id = OS_IDMAP_ATOMIC_LOAD(&record->active_id);
+   uint32 idtype = active_id >> OS_OBJECT_TYPE_SHIFT;
+#ifdef OS_IDMAP_LOCKFREE_REFCOUNT
+   uint16 refcount;
+#endif
 
-   if (idtype == 0 || record->active_id == 0)
+   if (idtype == 0 || active_id == 0)
    {
       return_code = OS_ERR_INVALID_ID;
    }
    else
    {
+#ifdef OS_IDMAP_LOCKFREE_REFCOUNT
+      /*
+       * Never decrement past zero.  A pending exclusive request
+       * polls the refcount, so no lock is needed to wake it.
+       */
+      refcount = OS_IDMAP_ATOMIC_LOAD(&record->refcount);
+      return_code = OS_ERR_INCORRECT_OBJ_STATE;
+      while (refcount > 0)
+      {
+         if (__atomic_compare_exchange_n(&record->refcount, &refcount, refcount - 1,
+                 false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST))
+         {
+            return_code = OS_SUCCESS;
+            break;
+         }
+      }
+#else
       OS_Lock_Global(idtype);
 
       if (record->refcount > 0)
@@ -976,11 +1034,52 @@ int32 OS_ObjectIdRefcountDecr(OS_common_record_t *record)
       }
 
       OS_Unlock_Global(idtype);
+#endif
    }
 
    return return_code;
 } /* end OS_ObjectIdRefcountDecr */
 
+/*----------------------------------------------------------------
+ *
+ * Function: OS_ObjectIdRefcountIncr
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Take a reference on the record without locking the global table.
+ *
+ *           The refcount is incremented first and the record state checked
+ *           afterward, so this pairs with the EXCLUSIVE check in
+ *           OS_ObjectIdConvertLock(), which publishes the table owner (in
+ *           OS_Lock_Global) before it reads the refcount.  At least one of
+ *           the two always sees the other.  Any task holding the global table
+ *           lock may be about to change the record, so the reference is
+ *           dropped again and the caller takes the locked path.
+ *
+ *  returns: true if the reference was taken, false otherwise
+ *
+ *-----------------------------------------------------------------*/
+bool OS_ObjectIdRefcountIncr(uint32 idtype, uint32 reference_id, OS_common_record_t *obj)
+{
+#ifdef OS_IDMAP_LOCKFREE_REFCOUNT
+    OS_IDMAP_ATOMIC_INCR(&obj->refcount);
+
+    if (OS_IDMAP_ATOMIC_LOAD(&obj->active_id) == reference_id &&
+            (OS_IDMAP_ATOMIC_LOAD(&obj->flags) & OS_OBJECT_EXCL_REQ_FLAG) == 0 &&
+            OS_IDMAP_ATOMIC_LOAD(&OS_objtype_state[idtype].table_owner) == 0)
+    {
+        return true;
+    }
+
+    OS_IDMAP_ATOMIC_DECR(&obj->refcount);
+#else
+    (void)idtype;
+    (void)reference_id;
+    (void)obj;
+#endif
+
+    return false;
+} /* end OS_ObjectIdRefcountIncr */
+
 /*----------------------------------------------------------------
  *
  * Function: OS_ObjectIdAllocateNew
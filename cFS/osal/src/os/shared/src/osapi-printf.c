@@ -57,8 +57,9 @@
 #include "os-shared-printf.h"
 
 
-/* reserve buffer memory for the printf console device */
+/* reserve buffer memory for the printf console device, one line slot per buffered message */
 static char OS_printf_buffer_mem[(sizeof(OS_PRINTF_CONSOLE_NAME) + OS_BUFFER_SIZE) * OS_BUFFER_MSG_DEPTH];
+static OS_console_line_t OS_printf_line_mem[OS_BUFFER_MSG_DEPTH];
 
 /* The global console state table */
 OS_console_internal_record_t        OS_console_table[OS_MAX_CONSOLES];
@@ -100,10 +101,10 @@ int32 OS_ConsoleAPI_Init(void)
         console->device_name[sizeof(console->device_name)-1] = 0;
 
         /*
-         * Initialize the ring buffer pointers
+         * Initialize the ring buffer line slots
          */
-        console->BufBase = OS_printf_buffer_mem;
-        console->BufSize = sizeof(OS_printf_buffer_mem);
+        OS_ConsoleSetup(console, OS_printf_buffer_mem, OS_printf_line_mem,
+                sizeof(OS_PRINTF_CONSOLE_NAME) + OS_BUFFER_SIZE, OS_BUFFER_MSG_DEPTH);
 
         return_code = OS_ConsoleCreate_Impl(local_id);
 
@@ -119,64 +120,138 @@ int32 OS_ConsoleAPI_Init(void)
     return OS_SUCCESS;
 } /* end OS_ConsoleAPI_Init */
 
+/*----------------------------------------------------------------
+ *
+ * Function: OS_ConsoleSetup
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *
+ *-----------------------------------------------------------------*/
+void OS_ConsoleSetup(OS_console_internal_record_t *console, char *Buffer,
+        OS_console_line_t *Lines, uint32 LineSize, uint32 LineCount)
+{
+    uint32 i;
+
+    console->BufBase = Buffer;
+    console->BufSize = LineSize * LineCount;
+    console->Lines = Lines;
+    console->LineSize = LineSize;
+    console->LineCount = LineCount;
+
+    /*
+     * Positions wrap at the largest multiple of the line count that
+     * keeps the distance between any two positions within an int32
+     */
+    console->SeqLimit = (0x40000000 / LineCount) * LineCount;
+    console->ReadPos = 0;
+    console->WritePos = 0;
+    console->ReaderBusy = 0;
+
+    for (i = 0; i < LineCount; ++i)
+    {
+        Lines[i].Seq = i;
+        Lines[i].Length = 0;
+    }
+} /* end OS_ConsoleSetup */
+
 /*
  *********************************************************************************
  *          LOCAL HELPER FUNCTIONS
  *********************************************************************************
  */
 
+/*----------------------------------------------------------------
+ *
+ * Function: OS_Console_SeqDiff
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *    Signed distance from line position B to line position A,
+ *    accounting for the wrap at SeqLimit.
+ *
+ *-----------------------------------------------------------------*/
+static int32 OS_Console_SeqDiff(const OS_console_internal_record_t *console, uint32 A, uint32 B)
+{
+    uint32 diff;
+
+    diff = (A + console->SeqLimit - B) % console->SeqLimit;
+    if (diff >= (console->SeqLimit / 2))
+    {
+        return (int32)diff - (int32)console->SeqLimit;
+    }
+
+    return (int32)diff;
+} /* end OS_Console_SeqDiff */
+
 /*----------------------------------------------------------------
  *
  * Function: OS_Console_CopyOut
  *
  *  Purpose: Local helper routine, not part of OSAL API.
- *    Write into the console ring buffer
+ *    Write one line into the console ring buffer
  *
- *    The NextWritePos is an input-output and contains the position
- *    in the ring buffer to start writing into.  This may or may not
- *    be the same as the value in the global.  It is only updated
- *    if the string is written in its entirety.
+ *    A free slot is claimed by advancing WritePos past it, the
+ *    prefix and string are copied in, and then the slot is
+ *    published to the reader.  The slot content is never touched
+ *    by another writer once claimed, so no lock is needed.
  *
  *    The intent is to avoid truncating a string if it does not fit.
- *    Either the entire string should be written, or none of it.
+ *    Either the entire line is written, or none of it.
  *
  *-----------------------------------------------------------------*/
-static int32 OS_Console_CopyOut(OS_console_internal_record_t *console, const char *Str, uint32 *NextWritePos)
+static int32 OS_Console_CopyOut(OS_console_internal_record_t *console, const char *Prefix, const char *Str)
 {
-    const char *pmsg;
-    uint32 WriteOffset;
-    int32 return_code;
+    OS_console_line_t *line;
+    char *dest;
+    uint32 pos;
+    uint32 seq;
+    uint32 prefix_len;
+    uint32 str_len;
+    int32 diff;
+
+    prefix_len = strlen(Prefix);
+    str_len = strlen(Str);
+    if ((prefix_len + str_len) > console->LineSize)
+    {
+        return OS_ERROR;
+    }
 
-    return_code = OS_ERROR;
-    pmsg = Str;
-    WriteOffset = *NextWritePos;
+    pos = OS_CONSOLE_ATOMIC_LOAD(&console->WritePos);
     while (true)
     {
-        if (*pmsg == 0)
+        line = &console->Lines[pos % console->LineCount];
+        seq = OS_CONSOLE_ATOMIC_LOAD(&line->Seq);
+        diff = OS_Console_SeqDiff(console, seq, pos);
+
+        if (diff < 0)
         {
-            /* String is complete */
-            *NextWritePos = WriteOffset;
-            return_code = OS_SUCCESS;
-            break;
+            /* the slot still holds a line from the previous lap; out of space */
+            return OS_QUEUE_FULL;
         }
-        console->BufBase[WriteOffset] = *pmsg;
-        WriteOffset = WriteOffset + 1;
-        if (WriteOffset >= console->BufSize)
+
+        if (diff == 0)
         {
-            WriteOffset = 0;
+            /* the slot is free; claim it, unless another writer got there first */
+            if (OS_CONSOLE_ATOMIC_CAS(&console->WritePos, &pos, OS_CONSOLE_SEQ_ADD(console, pos, 1)))
+            {
+                break;
+            }
         }
-
-        if (WriteOffset == console->ReadPos)
+        else
         {
-            /* out of space */
-            return_code = OS_QUEUE_FULL;
-            break;
+            /* another writer already claimed this position */
+            pos = OS_CONSOLE_ATOMIC_LOAD(&console->WritePos);
         }
-
-        ++pmsg;
     }
 
-    return return_code;
+    dest = &console->BufBase[(pos % console->LineCount) * console->LineSize];
+    memcpy(dest, Prefix, prefix_len);
+    memcpy(dest + prefix_len, Str, str_len);
+    line->Length = prefix_len + str_len;
+
+    /* publish the line to the reader */
+    OS_CONSOLE_ATOMIC_STORE(&line->Seq, OS_CONSOLE_SEQ_ADD(console, pos, 1));
+
+    return OS_SUCCESS;
 } /* end OS_Console_CopyOut */
 
 /*
@@ -200,56 +275,96 @@ int32 OS_ConsoleWrite(uint32 console_id, const char *Str)
     OS_common_record_t *record;
     uint32 local_id;
     OS_console_internal_record_t *console;
-    uint32 PendingWritePos;
 
+    /*
+     * Consoles are never deleted, and writers only synchronize
+     * with each other through the ring itself, so the table does
+     * not need to be locked unless the atomic operations are
+     * not available.
+     */
+#ifdef OS_CONSOLE_LOCKFREE
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_NONE, OS_OBJECT_TYPE_OS_CONSOLE, console_id, &local_id, &record);
+#else
     return_code = OS_ObjectIdGetById(OS_LOCK_MODE_GLOBAL, OS_OBJECT_TYPE_OS_CONSOLE, console_id, &local_id, &record);
+#endif
     if (return_code == OS_SUCCESS)
     {
         console = &OS_console_table[local_id];
 
-        /*
-         * The entire string should be put to the ring buffer,
-         * or none of it.  Therefore the WritePos in the table
-         * is not updated until complete success.
-         */
-        PendingWritePos = console->WritePos;
-
-        if (console->device_name[0] != 0)
-        {
-            return_code = OS_Console_CopyOut(console, console->device_name, &PendingWritePos);
-        }
-        if (return_code == OS_SUCCESS)
-        {
-            return_code = OS_Console_CopyOut(console, Str, &PendingWritePos);
-        }
+        return_code = OS_Console_CopyOut(console, console->device_name, Str);
 
         if (return_code == OS_SUCCESS)
         {
-            /* the entire message was successfully written */
-            console->WritePos = PendingWritePos;
+            OS_CONSOLE_ATOMIC_INCR(&console->LinesWritten);
+
+            /*
+             * Notify the underlying console implementation of new data,
+             * unless it has already been notified and not yet run.  The
+             * reader clears the flag before it reads the ring, and checks
+             * it again once it is done, so every published line is either
+             * seen by a reader that is already due, or causes a new
+             * notification.
+             *
+             * This will forward the data to the actual console device.
+             */
+            if (OS_CONSOLE_ATOMIC_EXCHANGE(&console->WakeupPending, 1) == 0)
+            {
+                OS_ConsoleWakeup_Impl(local_id);
+            }
         }
         else
         {
             /* the message did not fit */
-            ++console->OverflowEvents;
+            OS_CONSOLE_ATOMIC_INCR(&console->OverflowEvents);
         }
 
-        /*
-         * Notify the underlying console implementation of new data.
-         * This will forward the data to the actual console device.
-         *
-         * This is done while still locked, so it can support
-         * either a synchronous or asynchronous implementation.
-         */
-        OS_ConsoleWakeup_Impl(local_id);
-
+#ifndef OS_CONSOLE_LOCKFREE
         OS_Unlock_Global(OS_OBJECT_TYPE_OS_CONSOLE);
+#endif
     }
 
 
     return return_code;
 } /* end OS_ConsoleWrite */
 
+/*----------------------------------------------------------------
+ *
+ * Function: OS_printf_GetStats
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_printf_GetStats(OS_printf_stats_t *stats)
+{
+    OS_console_internal_record_t *console;
+    OS_common_record_t *record;
+    uint32 local_id;
+    int32 return_code;
+
+    if (stats == NULL)
+    {
+        return OS_INVALID_POINTER;
+    }
+
+    memset(stats, 0, sizeof(*stats));
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_NONE, OS_OBJECT_TYPE_OS_CONSOLE,
+            OS_SharedGlobalVars.PrintfConsoleId, &local_id, &record);
+    if (return_code == OS_SUCCESS)
+    {
+        console = &OS_console_table[local_id];
+
+        stats->lines_written = console->LinesWritten;
+        stats->lines_dropped = console->OverflowEvents;
+        stats->output_batches = console->OutputBatches;
+        stats->max_batch = console->MaxBatch;
+        stats->ring_depth = console->LineCount;
+    }
+
+    return return_code;
+} /* end OS_printf_GetStats */
+
 
 
 /*----------------------------------------------------------------
@@ -52,6 +52,34 @@
  *********************************************************************************
  */
 
+/*----------------------------------------------------------------
+ *
+ * Function: OS_SelectFdLocate
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Finds the bitmap within an FdSet that holds the given OSAL ID,
+ *           which is the queue bitmap for queue IDs and the stream bitmap
+ *           for everything else, and the index of the ID within it.
+ *
+ *-----------------------------------------------------------------*/
+static int32 OS_SelectFdLocate(OS_FdSet *Set, uint32 objid, uint8 **bitmap, uint32 *local_id)
+{
+   int32 return_code;
+
+   if (OS_IdentifyObject(objid) == OS_OBJECT_TYPE_OS_QUEUE)
+   {
+      return_code = OS_ObjectIdToArrayIndex(OS_OBJECT_TYPE_OS_QUEUE, objid, local_id);
+      *bitmap = Set->queue_ids;
+   }
+   else
+   {
+      return_code = OS_ObjectIdToArrayIndex(OS_OBJECT_TYPE_OS_STREAM, objid, local_id);
+      *bitmap = Set->object_ids;
+   }
+
+   return return_code;
+} /* end OS_SelectFdLocate */
+
 /*----------------------------------------------------------------
  *
  * Function: OS_SelectSingle
@@ -129,13 +157,14 @@ int32 OS_SelectFdAdd(OS_FdSet *Set, uint32 objid)
 {
    int32 return_code;
    uint32 local_id;
+   uint8 *bitmap;
 
     if(Set == NULL) return OS_INVALID_POINTER;
 
-   return_code = OS_ObjectIdToArrayIndex(OS_OBJECT_TYPE_OS_STREAM, objid, &local_id);
+   return_code = OS_SelectFdLocate(Set, objid, &bitmap, &local_id);
    if (return_code == OS_SUCCESS)
    {
-      Set->object_ids[local_id >> 3] |= 1 << (local_id & 0x7);
+      bitmap[local_id >> 3] |= 1 << (local_id & 0x7);
    }
 
    return return_code;
@@ -153,13 +182,14 @@ int32 OS_SelectFdClear(OS_FdSet *Set, uint32 objid)
 {
    int32 return_code;
    uint32 local_id;
+   uint8 *bitmap;
 
     if(Set == NULL) return OS_INVALID_POINTER;
 
-   return_code = OS_ObjectIdToArrayIndex(OS_OBJECT_TYPE_OS_STREAM, objid, &local_id);
+   return_code = OS_SelectFdLocate(Set, objid, &bitmap, &local_id);
    if (return_code == OS_SUCCESS)
    {
-      Set->object_ids[local_id >> 3] &= ~(1 << (local_id & 0x7));
+      bitmap[local_id >> 3] &= ~(1 << (local_id & 0x7));
    }
 
    return return_code;
@@ -177,16 +207,17 @@ bool OS_SelectFdIsSet(OS_FdSet *Set, uint32 objid)
 {
    int32 return_code;
    uint32 local_id;
+   uint8 *bitmap;
 
     if(Set == NULL) return false;
 
-   return_code = OS_ObjectIdToArrayIndex(OS_OBJECT_TYPE_OS_STREAM, objid, &local_id);
+   return_code = OS_SelectFdLocate(Set, objid, &bitmap, &local_id);
    if (return_code != OS_SUCCESS)
    {
       return false;
    }
 
-   return ((Set->object_ids[local_id >> 3] >> (local_id & 0x7)) & 0x1);
+   return ((bitmap[local_id >> 3] >> (local_id & 0x7)) & 0x1);
 } /* end OS_SelectFdIsSet */
 
 
@@ -183,7 +183,7 @@ int32 OS_SocketBind(uint32 sock_id, const OS_SockAddr_t *Addr)
          /* Not a socket */
          return_code = OS_ERR_INCORRECT_OBJ_TYPE;
       }
-      else if (record->refcount != 0 ||
+      else if (OS_IDMAP_ATOMIC_LOAD(&record->refcount) != 0 ||
             (OS_stream_table[local_id].stream_state & (OS_STREAM_STATE_BOUND | OS_STREAM_STATE_CONNECTED)) != 0)
       {
          /* Socket must be neither bound nor connected */
@@ -262,7 +262,7 @@ int32 OS_SocketAccept(uint32 sock_id, uint32 *connsock_id, OS_SockAddr_t *Addr,
             memset(&OS_stream_table[conn_id], 0, sizeof(OS_stream_internal_record_t));
             OS_stream_table[conn_id].socket_domain = OS_stream_table[local_id].socket_domain;
             OS_stream_table[conn_id].socket_type = OS_stream_table[local_id].socket_type;
-            ++connrecord->refcount;
+            OS_IDMAP_ATOMIC_INCR(&connrecord->refcount);
             return_code = OS_ObjectIdFinalizeNew(return_code, connrecord, connsock_id);
          }
       }
@@ -296,8 +296,8 @@ int32 OS_SocketAccept(uint32 sock_id, uint32 *connsock_id, OS_SockAddr_t *Addr,
       }
 
       /* Decrement both ref counters that were increased earlier */
-      --record->refcount;
-      --connrecord->refcount;
+      OS_IDMAP_ATOMIC_DECR(&record->refcount);
+      OS_IDMAP_ATOMIC_DECR(&connrecord->refcount);
       OS_Unlock_Global(LOCAL_OBJID_TYPE);
    }
 
@@ -339,7 +339,7 @@ int32 OS_SocketConnect(uint32 sock_id, const OS_SockAddr_t *Addr, int32 Timeout)
       }
       else
       {
-         ++record->refcount;
+         OS_IDMAP_ATOMIC_INCR(&record->refcount);
       }
       OS_Unlock_Global(LOCAL_OBJID_TYPE);
    }
@@ -353,7 +353,7 @@ int32 OS_SocketConnect(uint32 sock_id, const OS_SockAddr_t *Addr, int32 Timeout)
       {
          OS_stream_table[local_id].stream_state |= OS_STREAM_STATE_CONNECTED | OS_STREAM_STATE_READABLE | OS_STREAM_STATE_WRITABLE;
       }
-      --record->refcount;
+      OS_IDMAP_ATOMIC_DECR(&record->refcount);
       OS_Unlock_Global(LOCAL_OBJID_TYPE);
    }
 
@@ -404,6 +404,58 @@ int32 OS_SocketRecvFrom(uint32 sock_id, void *buffer, uint32 buflen, OS_SockAddr
    return return_code;
 } /* end OS_SocketRecvFrom */
 
+/*----------------------------------------------------------------
+ *
+ * Function: OS_SocketRecvFromMulti
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SocketRecvFromMulti(uint32 sock_id, OS_SockRecvMsg_t *msgs, uint32 count, int32 timeout)
+{
+   OS_common_record_t *record;
+   uint32 local_id;
+   uint32 i;
+   int32 return_code;
+
+   /* Check Parameters */
+   if (msgs == NULL || count == 0)
+   {
+      return OS_INVALID_POINTER;
+   }
+
+   for (i = 0; i < count; ++i)
+   {
+      if (msgs[i].buffer == NULL || msgs[i].buflen == 0)
+      {
+         return OS_INVALID_POINTER;
+      }
+   }
+
+   return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, sock_id, &local_id, &record);
+   if (return_code == OS_SUCCESS)
+   {
+      if (OS_stream_table[local_id].socket_type != OS_SocketType_DATAGRAM)
+      {
+         return_code = OS_ERR_INCORRECT_OBJ_TYPE;
+      }
+      else if ((OS_stream_table[local_id].stream_state & OS_STREAM_STATE_BOUND) == 0)
+      {
+         /* Socket needs to be bound first */
+         return_code = OS_ERR_INCORRECT_OBJ_STATE;
+      }
+      else
+      {
+         return_code = OS_SocketRecvFromMulti_Impl (local_id, msgs, count, timeout);
+      }
+
+      OS_ObjectIdRefcountDecr(record);
+   }
+
+   return return_code;
+} /* end OS_SocketRecvFromMulti */
+
 /*----------------------------------------------------------------
  *
  * Function: OS_SocketSendTo
@@ -442,6 +494,53 @@ int32 OS_SocketSendTo(uint32 sock_id, const void *buffer, uint32 buflen, const O
    return return_code;
 } /* end OS_SocketSendTo */
 
+/*----------------------------------------------------------------
+ *
+ * Function: OS_SocketSendToMulti
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SocketSendToMulti(uint32 sock_id, const OS_SockSendMsg_t *msgs, uint32 count, const OS_SockAddr_t *RemoteAddr)
+{
+   OS_common_record_t *record;
+   uint32 local_id;
+   uint32 i;
+   int32 return_code;
+
+   /* Check Parameters */
+   if (msgs == NULL || count == 0 || RemoteAddr == NULL)
+   {
+      return OS_INVALID_POINTER;
+   }
+
+   for (i = 0; i < count; ++i)
+   {
+      if (msgs[i].buffer == NULL || msgs[i].buflen == 0)
+      {
+         return OS_INVALID_POINTER;
+      }
+   }
+
+   return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, sock_id, &local_id, &record);
+   if (return_code == OS_SUCCESS)
+   {
+      if (OS_stream_table[local_id].socket_type != OS_SocketType_DATAGRAM)
+      {
+         return_code = OS_ERR_INCORRECT_OBJ_TYPE;
+      }
+      else
+      {
+          return_code = OS_SocketSendToMulti_Impl (local_id, msgs, count, RemoteAddr);
+      }
+
+      OS_ObjectIdRefcountDecr(record);
+   }
+
+   return return_code;
+} /* end OS_SocketSendToMulti */
+
 
 /*----------------------------------------------------------------
  *
@@ -186,6 +186,22 @@ int32 OS_TaskAPI_Init(void)
  *-----------------------------------------------------------------*/
 int32 OS_TaskCreate (uint32 *task_id, const char *task_name, osal_task_entry function_pointer,
                       uint32 *stack_pointer, uint32 stack_size, uint32 priority, uint32 flags)
+{
+   return OS_TaskCreateWithAffinity(task_id, task_name, function_pointer, stack_pointer,
+         stack_size, priority, flags, OS_TASK_CPU_AFFINITY_ANY);
+} /* end OS_TaskCreate */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TaskCreateWithAffinity
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_TaskCreateWithAffinity (uint32 *task_id, const char *task_name, osal_task_entry function_pointer,
+                      uint32 *stack_pointer, uint32 stack_size, uint32 priority, uint32 flags,
+                      uint32 cpu_affinity)
 {
    OS_common_record_t *record;
    int32             return_code;
@@ -228,6 +244,7 @@ int32 OS_TaskCreate (uint32 *task_id, const char *task_name, osal_task_entry fun
       record->name_entry = OS_task_table[local_id].task_name;
       OS_task_table[local_id].stack_size = stack_size;
       OS_task_table[local_id].priority = priority;
+      OS_task_table[local_id].cpu_affinity = cpu_affinity;
       OS_task_table[local_id].entry_function_pointer = function_pointer;
       OS_task_table[local_id].stack_pointer = stack_pointer;
 
@@ -241,7 +258,7 @@ int32 OS_TaskCreate (uint32 *task_id, const char *task_name, osal_task_entry fun
 
 
    return return_code;
-} /* end OS_TaskCreate */
+} /* end OS_TaskCreateWithAffinity */
 
 
 
@@ -466,6 +483,7 @@ int32 OS_TaskGetInfo (uint32 task_id, OS_task_prop_t *task_prop)
    OS_common_record_t *record;
    int32             return_code;
    uint32            local_id;
+   uint32            stats_ref;
 
    /* Check parameters */
    if (task_prop == NULL)
@@ -486,10 +504,19 @@ int32 OS_TaskGetInfo (uint32 task_id, OS_task_prop_t *task_prop)
       task_prop->creator =    record->creator;
       task_prop->stack_size = OS_task_table[local_id].stack_size;
       task_prop->priority =   OS_task_table[local_id].priority;
+      task_prop->cpu_affinity = OS_task_table[local_id].cpu_affinity;
+      task_prop->current_cpu = OS_TASK_CPU_UNKNOWN;
 
       return_code = OS_TaskGetInfo_Impl(local_id, task_prop);
+      stats_ref = OS_TaskGetStatsRef_Impl(local_id);
 
       OS_Unlock_Global(LOCAL_OBJID_TYPE);
+
+      /* reading the statistics may block, so it is not done under the lock */
+      if (return_code == OS_SUCCESS)
+      {
+         OS_TaskGetStats_Impl(stats_ref, task_prop);
+      }
    }
 
    return return_code;
@@ -359,8 +359,20 @@ int32 OS_TimerSet(uint32 timer_id, uint32 start_time, uint32 interval_time)
            dedicated_timebase_id = OS_global_timebase_table[local->timebase_ref].active_id;
        }
 
-       local->wait_time = (int32)start_time;
+       /*
+        * A start time of zero means the first expiration is one interval from now,
+        * consistent with the remaining expirations.
+        */
+       if (start_time != 0)
+       {
+           local->expiry_time = OS_timebase_table[local->timebase_ref].freerun_time + start_time;
+       }
+       else
+       {
+           local->expiry_time = OS_timebase_table[local->timebase_ref].freerun_time + interval_time;
+       }
        local->interval_time = (int32)interval_time;
+       OS_TimeBase_ArmTimer(local->timebase_ref, local_id);
 
        OS_TimeBaseUnlock_Impl(local->timebase_ref);
 
@@ -459,6 +471,11 @@ int32 OS_TimerDelete(uint32 timer_id)
         local->next_ref = local_id;
         local->prev_ref = local_id;
 
+        /*
+         * And from the heap of armed timers
+         */
+        OS_TimeBase_DisarmTimer(local->timebase_ref, local_id);
+
         /* Clear the ID to zero */
         record->active_id = 0;
 
@@ -349,6 +349,9 @@ int32 OS_TimeBaseGetInfo (uint32 timebase_id, OS_timebase_prop_t *timebase_prop)
        timebase_prop->nominal_interval_time =   OS_timebase_table[local_id].nominal_interval_time;
        timebase_prop->freerun_time =   OS_timebase_table[local_id].freerun_time;
        timebase_prop->accuracy =   OS_timebase_table[local_id].accuracy_usec;
+       timebase_prop->callback_count =   OS_timebase_table[local_id].callback_count;
+       timebase_prop->overrun_count =   OS_timebase_table[local_id].overrun_count;
+       timebase_prop->max_callback_latency =   OS_timebase_table[local_id].max_callback_latency;
 
        return_code = OS_TimeBaseGetInfo_Impl(local_id, timebase_prop);
 
@@ -383,6 +386,158 @@ int32 OS_TimeBaseGetFreeRun     (uint32 timebase_id, uint32 *freerun_val)
     return return_code;
 } /* end OS_TimeBaseGetFreeRun */
 
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TimeBase_HeapBefore
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Checks if the first timer expires before the second.
+ *           Free run times wrap, so the difference is compared rather
+ *           than the absolute values.  Expiry times are never more than
+ *           half the range from the current free run time.
+ *
+ *-----------------------------------------------------------------*/
+static bool OS_TimeBase_HeapBefore(uint32 timecb_a, uint32 timecb_b)
+{
+    return ((int32)(OS_timecb_table[timecb_a].expiry_time - OS_timecb_table[timecb_b].expiry_time) < 0);
+} /* end OS_TimeBase_HeapBefore */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TimeBase_HeapPlace
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Stores a timer at a heap position and records the position
+ *           in the timer, so it can be found again without a search.
+ *
+ *-----------------------------------------------------------------*/
+static void OS_TimeBase_HeapPlace(OS_timebase_internal_record_t *timebase, uint32 pos, uint32 timecb_id)
+{
+    timebase->timer_heap[pos] = timecb_id;
+    OS_timecb_table[timecb_id].heap_index = pos + 1;
+} /* end OS_TimeBase_HeapPlace */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TimeBase_HeapFix
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Moves the timer at a heap position up or down until
+ *           it is no earlier than its parent and no later than
+ *           either of its children.
+ *
+ *-----------------------------------------------------------------*/
+static void OS_TimeBase_HeapFix(OS_timebase_internal_record_t *timebase, uint32 pos)
+{
+    uint32 timecb_id;
+    uint32 parent;
+    uint32 child;
+
+    timecb_id = timebase->timer_heap[pos];
+
+    while (pos > 0)
+    {
+        parent = (pos - 1) / 2;
+        if (!OS_TimeBase_HeapBefore(timecb_id, timebase->timer_heap[parent]))
+        {
+            break;
+        }
+        OS_TimeBase_HeapPlace(timebase, pos, timebase->timer_heap[parent]);
+        pos = parent;
+    }
+
+    while (1)
+    {
+        child = (2 * pos) + 1;
+        if (child >= timebase->timer_count)
+        {
+            break;
+        }
+        if ((child + 1) < timebase->timer_count &&
+                OS_TimeBase_HeapBefore(timebase->timer_heap[child + 1], timebase->timer_heap[child]))
+        {
+            ++child;
+        }
+        if (!OS_TimeBase_HeapBefore(timebase->timer_heap[child], timecb_id))
+        {
+            break;
+        }
+        OS_TimeBase_HeapPlace(timebase, pos, timebase->timer_heap[child]);
+        pos = child;
+    }
+
+    OS_TimeBase_HeapPlace(timebase, pos, timecb_id);
+} /* end OS_TimeBase_HeapFix */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TimeBase_ArmTimer
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           See description in header file for detail
+ *
+ *-----------------------------------------------------------------*/
+void OS_TimeBase_ArmTimer(uint32 timebase_id, uint32 timecb_id)
+{
+    OS_timebase_internal_record_t *timebase;
+    uint32 pos;
+
+    timebase = &OS_timebase_table[timebase_id];
+    pos = OS_timecb_table[timecb_id].heap_index;
+
+    if (pos == 0)
+    {
+        if (timebase->timer_count >= OS_MAX_TIMERS)
+        {
+            /* not possible with consistent tables, as every timer can only be armed once */
+            return;
+        }
+        pos = timebase->timer_count;
+        ++timebase->timer_count;
+    }
+    else
+    {
+        --pos;
+    }
+
+    timebase->timer_heap[pos] = timecb_id;
+    OS_TimeBase_HeapFix(timebase, pos);
+} /* end OS_TimeBase_ArmTimer */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TimeBase_DisarmTimer
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           See description in header file for detail
+ *
+ *-----------------------------------------------------------------*/
+void OS_TimeBase_DisarmTimer(uint32 timebase_id, uint32 timecb_id)
+{
+    OS_timebase_internal_record_t *timebase;
+    uint32 pos;
+
+    timebase = &OS_timebase_table[timebase_id];
+    pos = OS_timecb_table[timecb_id].heap_index;
+
+    if (pos == 0 || pos > timebase->timer_count)
+    {
+        /* not armed */
+        return;
+    }
+
+    --pos;
+    OS_timecb_table[timecb_id].heap_index = 0;
+    --timebase->timer_count;
+
+    /* move the last timer into the vacated position, unless this was the last one */
+    if (pos < timebase->timer_count)
+    {
+        timebase->timer_heap[pos] = timebase->timer_heap[timebase->timer_count];
+        OS_TimeBase_HeapFix(timebase, pos);
+    }
+} /* end OS_TimeBase_DisarmTimer */
+
 /*----------------------------------------------------------------
  *
  * Function: OS_TimeBase_CallbackThread
@@ -409,12 +564,11 @@ void OS_TimeBase_CallbackThread(uint32 timebase_id)
     OS_timecb_internal_record_t *timecb;
     OS_common_record_t *record;
     uint32 local_id;
-    uint32 timer_id;
     uint32 curr_cb_local_id;
     uint32 curr_cb_public_id;
     uint32 tick_time;
     uint32 spin_cycles;
-    int32 saved_wait_time;
+    int32 wait_time;
 
     /*
      * Register this task as a time base handler.
@@ -498,52 +652,61 @@ void OS_TimeBase_CallbackThread(uint32 timebase_id)
         }
 
         timebase->freerun_time += tick_time;
-        if (OS_ObjectIdToArrayIndex(OS_OBJECT_TYPE_OS_TIMECB, timebase->first_cb, &timer_id) == 0)
+
+        /*
+         * The armed timers are kept in a heap ordered by expiry time, so
+         * only the timers that are actually due are visited on each tick,
+         * rather than every timer attached to this time base.
+         */
+        while (timebase->timer_count > 0)
         {
-            curr_cb_local_id = timer_id;
-            do
+            curr_cb_local_id = timebase->timer_heap[0];
+            timecb = &OS_timecb_table[curr_cb_local_id];
+            wait_time = (int32)(timecb->expiry_time - timebase->freerun_time);
+            if (wait_time > 0)
+            {
+                break;
+            }
+
+            curr_cb_public_id = OS_global_timecb_table[curr_cb_local_id].active_id;
+
+            ++timebase->callback_count;
+            if ((uint32)(-wait_time) > timebase->max_callback_latency)
+            {
+                timebase->max_callback_latency = (uint32)(-wait_time);
+            }
+
+            if (timecb->interval_time > 0)
             {
-                curr_cb_public_id = OS_global_timecb_table[curr_cb_local_id].active_id;
-                timecb = &OS_timecb_table[curr_cb_local_id];
-                saved_wait_time = timecb->wait_time;
-                timecb->wait_time -= tick_time;
-                while (timecb->wait_time <= 0)
+                timecb->expiry_time += timecb->interval_time;
+
+                /*
+                 * Only allow the expiry time to fall behind the free run time by one interval.
+                 * This prevents a cb "interval_time" of less than the timebase interval_time from
+                 * accumulating infinitely
+                 */
+                if ((wait_time + timecb->interval_time) < -timecb->interval_time)
                 {
-                    timecb->wait_time += timecb->interval_time;
-
-                    /*
-                     * Only allow the "wait_time" underflow to go as far negative as one interval time
-                     * This prevents a cb "interval_time" of less than the timebase interval_time from
-                     * accumulating infinitely
-                     */
-                    if (timecb->wait_time < -timecb->interval_time)
-                    {
-                        ++timecb->backlog_resets;
-                        timecb->wait_time = -timecb->interval_time;
-                    }
-
-                    /*
-                     * Only give the callback if the wait_time actually transitioned from positive to negative.
-                     * This allows one-shot operation where the API sets the "wait_time" positive but keeps
-                     * the "interval_time" at zero.  With the interval_time at zero the wait time will never
-                     * go positive again unless the API sets it again.
-                     */
-                    if (saved_wait_time > 0 && timecb->callback_ptr != NULL)
-                    {
-                        (*timecb->callback_ptr)(curr_cb_public_id, timecb->callback_arg);
-                    }
-
-                    /*
-                     * Do not repeat the loop unless interval_time is configured.
-                     */
-                    if (timecb->interval_time <= 0)
-                    {
-                        break;
-                    }
+                    ++timecb->backlog_resets;
+                    ++timebase->overrun_count;
+                    timecb->expiry_time = timebase->freerun_time - timecb->interval_time;
                 }
-                curr_cb_local_id = timecb->next_ref;
+
+                OS_TimeBase_ArmTimer(local_id, curr_cb_local_id);
+            }
+            else
+            {
+                /*
+                 * One-shot operation: the API armed the timer with the "interval_time" at zero,
+                 * so it is not armed again unless the API sets it again.
+                 */
+                OS_TimeBase_DisarmTimer(local_id, curr_cb_local_id);
+            }
+
+            if (timecb->callback_ptr != NULL)
+            {
+                (*timecb->callback_ptr)(curr_cb_public_id, timecb->callback_arg);
             }
-            while (curr_cb_local_id != timer_id);
         }
 
         OS_TimeBaseUnlock_Impl(local_id);
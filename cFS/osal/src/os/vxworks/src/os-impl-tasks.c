@@ -448,6 +448,33 @@ int32 OS_TaskGetInfo_Impl (uint32 task_id, OS_task_prop_t *task_prop)
 
 } /* end OS_TaskGetInfo_Impl */
 
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TaskGetStatsRef_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *           The task statistics are not available on this OS.
+ *
+ *-----------------------------------------------------------------*/
+uint32 OS_TaskGetStatsRef_Impl (uint32 task_id)
+{
+    return 0;
+} /* end OS_TaskGetStatsRef_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TaskGetStats_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void OS_TaskGetStats_Impl (uint32 stats_ref, OS_task_prop_t *task_prop)
+{
+} /* end OS_TaskGetStats_Impl */
+
 /*----------------------------------------------------------------
  *
  * Function: OS_TaskValidateSystemData_Impl
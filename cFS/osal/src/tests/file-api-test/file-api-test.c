@@ -253,6 +253,7 @@ void TestReadWriteLseek(void)
     char copyofbuffer[30];
     char seekbuffer[30];
     char newbuffer[30];
+    void *mapaddr;
     int offset;
     int size;
     int status;
@@ -333,6 +334,25 @@ void TestReadWriteLseek(void)
                 "Read: %s, Written: %s",newbuffer,seekbuffer);
     }
 
+    /* map the same region of the file and compare it in place */
+    status = OS_FileMap(fd, offset, size - offset, &mapaddr);
+    if (status == OS_ERR_NOT_IMPLEMENTED)
+    {
+        UtAssert_Type(NA, false, "OS_FileMap not implemented");
+    }
+    else
+    {
+        UtAssert_True(status == OS_SUCCESS, "status after map = %d",(int)status);
+        if (status == OS_SUCCESS)
+        {
+            UtAssert_True(strncmp(mapaddr,seekbuffer, size - offset) == 0,
+                    "Mapped: %.*s, Written: %s",size - offset,(char*)mapaddr,seekbuffer);
+
+            status = OS_FileUnmap(mapaddr, size - offset);
+            UtAssert_True(status == OS_SUCCESS, "status after unmap = %d",(int)status);
+        }
+    }
+
     /* close the file */
     status = OS_close(fd);
     UtAssert_True(status == OS_SUCCESS, "status after close = %d",(int)status);
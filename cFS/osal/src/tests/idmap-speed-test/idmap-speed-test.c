@@ -0,0 +1,188 @@
+/*
+ *  NASA Docket No. GSC-18,370-1, and identified as "Operating System Abstraction Layer"
+ *
+ *  Copyright (c) 2019 United States Government as represented by
+ *  the Administrator of the National Aeronautics and Space Administration.
+ *  All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*
+** Object ID Contention Speed Test
+**
+** This is a simple way to gauge the cost of resolving
+** OSAL object IDs when many tasks use the same object
+** at once.
+**
+** In the first phase, several tasks share one queue.
+** Each task puts a message and then gets a message,
+** so the queue never overflows and a get never waits
+** for long.  In the second phase, the same number of
+** tasks share one file descriptor and repeatedly seek
+** on it, which takes and releases a reference on the
+** stream record for every call.
+**
+** Each phase runs for 2 seconds.  At the end of each
+** phase the total number of operations per second is
+** indicated.  Higher numbers indicate better performance.
+** Only the results of the operations are checked, as the
+** rate depends on the load of the machine.
+**
+*/
+#include "common_types.h"
+#include "osapi.h"
+#include "utassert.h"
+#include "uttest.h"
+#include "utbsp.h"
+
+#include "speed-test-workers.h"
+
+/*
+ * Number of worker tasks sharing each object.
+ *
+ * This must not exceed the queue depth, as each task
+ * has at most one message in the queue at a time.
+ */
+#define IDTEST_NUM_TASKS        8
+#define IDTEST_QUEUE_DEPTH      10
+
+/*
+ * Duration of each phase, in milliseconds
+ */
+#define IDTEST_RUN_TIME         2000
+
+/* Define setup and test functions for UT assert */
+void QueueSetup(void);
+void QueueRun(void);
+void StreamSetup(void);
+void StreamRun(void);
+
+uint32 queue_id;
+int32  stream_fd;
+
+void queue_task(void)
+{
+    uint32 idx;
+    uint32 msg;
+    uint32 size_copied;
+    int32  status;
+
+    idx = WorkerBegin();
+
+    while(!worker_stop && idx < IDTEST_NUM_TASKS && worker_work[idx] < WORKER_WORK_LIMIT)
+    {
+        msg = idx;
+        status = OS_QueuePut(queue_id, &msg, sizeof(msg), 0);
+        if (status == OS_SUCCESS)
+        {
+            status = OS_QueueGet(queue_id, &msg, sizeof(msg), &size_copied, OS_PEND);
+        }
+
+        if (status != OS_SUCCESS)
+        {
+            ++worker_errors[idx];
+            break;
+        }
+
+        ++worker_work[idx];
+    }
+
+    WorkerEnd(idx);
+}
+
+void stream_task(void)
+{
+    uint32 idx;
+    int32  status;
+
+    idx = WorkerBegin();
+
+    while(!worker_stop && idx < IDTEST_NUM_TASKS && worker_work[idx] < WORKER_WORK_LIMIT)
+    {
+        status = OS_lseek(stream_fd, 0, OS_SEEK_SET);
+        if (status != 0)
+        {
+            ++worker_errors[idx];
+            break;
+        }
+
+        ++worker_work[idx];
+    }
+
+    WorkerEnd(idx);
+}
+
+void UtTest_Setup(void)
+{
+    if (OS_API_Init() != OS_SUCCESS)
+    {
+        UtAssert_Abort("OS_API_Init() failed");
+    }
+
+    /*
+     * Register the test setup and check routines in UT assert
+     */
+    UtTest_Add(QueueRun, QueueSetup, NULL, "QueueContention");
+    UtTest_Add(StreamRun, StreamSetup, NULL, "StreamContention");
+}
+
+void QueueSetup(void)
+{
+    int32 status;
+
+    status = OS_QueueCreate(&queue_id, "Queue", IDTEST_QUEUE_DEPTH, sizeof(uint32), 0);
+    UtAssert_True(status == OS_SUCCESS, "Queue create Id=%u Rc=%d", (unsigned int)queue_id, (int)status);
+}
+
+void QueueRun(void)
+{
+    int32 status;
+
+    StartWorkers(queue_task, IDTEST_NUM_TASKS);
+    StopWorkers("queue put/get", IDTEST_RUN_TIME);
+
+    status = OS_QueueDelete(queue_id);
+    UtAssert_True(status == OS_SUCCESS, "Queue delete Rc=%d", (int)status);
+}
+
+void StreamSetup(void)
+{
+    int32 status;
+
+    status = OS_mkfs(0,"/ramdev0","RAM",512,20);
+    UtAssert_True(status == OS_SUCCESS, "status after mkfs = %d",(int)status);
+
+    status = OS_mount("/ramdev0","/drive0");
+    UtAssert_True(status == OS_SUCCESS, "status after mount = %d",(int)status);
+
+    stream_fd = OS_creat("/drive0/speed", OS_READ_WRITE);
+    UtAssert_True(stream_fd >= 0, "File create Id=%d", (int)stream_fd);
+}
+
+void StreamRun(void)
+{
+    int32 status;
+
+    StartWorkers(stream_task, IDTEST_NUM_TASKS);
+    StopWorkers("file seek", IDTEST_RUN_TIME);
+
+    status = OS_close(stream_fd);
+    UtAssert_True(status == OS_SUCCESS, "File close Rc=%d", (int)status);
+
+    status = OS_remove("/drive0/speed");
+    UtAssert_True(status == OS_SUCCESS, "File remove Rc=%d", (int)status);
+
+    status = OS_unmount("/drive0");
+    UtAssert_True(status == OS_SUCCESS, "status after unmount = %d",(int)status);
+}
@@ -0,0 +1,218 @@
+/*
+ *  NASA Docket No. GSC-18,370-1, and identified as "Operating System Abstraction Layer"
+ *
+ *  Copyright (c) 2019 United States Government as represented by
+ *  the Administrator of the National Aeronautics and Space Administration.
+ *  All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*
+** Path Translation Speed Test
+**
+** This is a simple way to gauge the cost of translating
+** virtual paths, which every OSAL file API call does
+** before it reaches the file system.
+**
+** Two RAM file systems are mounted.  In the first phase,
+** several tasks translate paths on both of them, and on
+** a mount point that does not exist, checking every
+** result.  In the second phase, the same number of tasks
+** repeatedly stat a file, and open and close it, which
+** is the pattern of a file manager scanning a directory.
+**
+** Each phase runs for 2 seconds.  At the end of each
+** phase the total number of operations per second is
+** indicated.  Higher numbers indicate better performance.
+** Only the results of the operations are checked, as the
+** rate depends on the load of the machine.
+**
+*/
+#include <string.h>
+#include "common_types.h"
+#include "osapi.h"
+#include "utassert.h"
+#include "uttest.h"
+#include "utbsp.h"
+
+#include "speed-test-workers.h"
+
+/*
+ * Number of worker tasks
+ */
+#define PATHTEST_NUM_TASKS      4
+
+/*
+ * Duration of each phase, in milliseconds
+ */
+#define PATHTEST_RUN_TIME       2000
+
+/* Define setup and test functions for UT assert */
+void PathSetup(void);
+void TranslateRun(void);
+void FileRun(void);
+void PathTeardown(void);
+
+char drive0_local[OS_MAX_LOCAL_PATH_LEN];
+char drive1_local[OS_MAX_LOCAL_PATH_LEN];
+
+/*
+ * Checks that a translated path is the local mount point followed by the file name
+ */
+bool CheckPath(const char *LocalPath, const char *MountPoint, const char *Name)
+{
+    size_t len = strlen(MountPoint);
+
+    return (strncmp(LocalPath, MountPoint, len) == 0 && strcmp(&LocalPath[len], Name) == 0);
+}
+
+void translate_task(void)
+{
+    char   local[OS_MAX_LOCAL_PATH_LEN];
+    uint32 idx;
+    int32  status;
+
+    idx = WorkerBegin();
+
+    while(!worker_stop && idx < PATHTEST_NUM_TASKS && worker_work[idx] < WORKER_WORK_LIMIT)
+    {
+        status = OS_TranslatePath("/drive0/data/file.dat", local);
+        if (status != OS_SUCCESS || !CheckPath(local, drive0_local, "/data/file.dat"))
+        {
+            ++worker_errors[idx];
+        }
+
+        status = OS_TranslatePath("/drive1/file.dat", local);
+        if (status != OS_SUCCESS || !CheckPath(local, drive1_local, "/file.dat"))
+        {
+            ++worker_errors[idx];
+        }
+
+        status = OS_TranslatePath("/drive2/file.dat", local);
+        if (status != OS_FS_ERR_PATH_INVALID)
+        {
+            ++worker_errors[idx];
+        }
+
+        worker_work[idx] += 3;
+    }
+
+    WorkerEnd(idx);
+}
+
+void file_task(void)
+{
+    os_fstat_t stats;
+    uint32 idx;
+    int32  fd;
+    int32  status;
+
+    idx = WorkerBegin();
+
+    while(!worker_stop && idx < PATHTEST_NUM_TASKS && worker_work[idx] < WORKER_WORK_LIMIT)
+    {
+        status = OS_stat("/drive1/speed", &stats);
+        if (status != OS_SUCCESS)
+        {
+            ++worker_errors[idx];
+            break;
+        }
+
+        fd = OS_open("/drive1/speed", OS_READ_ONLY, 0);
+        if (fd < 0)
+        {
+            ++worker_errors[idx];
+            break;
+        }
+
+        OS_close(fd);
+
+        worker_work[idx] += 2;
+    }
+
+    WorkerEnd(idx);
+}
+
+void UtTest_Setup(void)
+{
+    if (OS_API_Init() != OS_SUCCESS)
+    {
+        UtAssert_Abort("OS_API_Init() failed");
+    }
+
+    /*
+     * Register the test setup and check routines in UT assert
+     */
+    UtTest_Add(TranslateRun, PathSetup, NULL, "PathTranslate");
+    UtTest_Add(FileRun, NULL, PathTeardown, "PathFileOps");
+}
+
+void PathSetup(void)
+{
+    int32 status;
+    int32 fd;
+
+    status = OS_mkfs(0,"/ramdev0","RAM0",512,20);
+    UtAssert_True(status == OS_SUCCESS, "status after mkfs 0 = %d",(int)status);
+
+    status = OS_mount("/ramdev0","/drive0");
+    UtAssert_True(status == OS_SUCCESS, "status after mount 0 = %d",(int)status);
+
+    status = OS_mkfs(0,"/ramdev1","RAM1",512,20);
+    UtAssert_True(status == OS_SUCCESS, "status after mkfs 1 = %d",(int)status);
+
+    status = OS_mount("/ramdev1","/drive1");
+    UtAssert_True(status == OS_SUCCESS, "status after mount 1 = %d",(int)status);
+
+    /* the translation of each mount point itself is the local mount point */
+    status = OS_TranslatePath("/drive0", drive0_local);
+    UtAssert_True(status == OS_SUCCESS, "/drive0 is %s Rc=%d", drive0_local, (int)status);
+
+    status = OS_TranslatePath("/drive1", drive1_local);
+    UtAssert_True(status == OS_SUCCESS, "/drive1 is %s Rc=%d", drive1_local, (int)status);
+
+    fd = OS_creat("/drive1/speed", OS_READ_WRITE);
+    UtAssert_True(fd >= 0, "File create Id=%d", (int)fd);
+    OS_close(fd);
+}
+
+void TranslateRun(void)
+{
+    StartWorkers(translate_task, PATHTEST_NUM_TASKS);
+    StopWorkers("path translate", PATHTEST_RUN_TIME);
+}
+
+void FileRun(void)
+{
+    StartWorkers(file_task, PATHTEST_NUM_TASKS);
+    StopWorkers("file stat/open/close", PATHTEST_RUN_TIME);
+}
+
+void PathTeardown(void)
+{
+    int32 status;
+
+    status = OS_remove("/drive1/speed");
+    UtAssert_True(status == OS_SUCCESS, "File remove Rc=%d", (int)status);
+
+    status = OS_unmount("/drive0");
+    UtAssert_True(status == OS_SUCCESS, "status after unmount 0 = %d",(int)status);
+
+    status = OS_unmount("/drive1");
+    UtAssert_True(status == OS_SUCCESS, "status after unmount 1 = %d",(int)status);
+
+    /* after unmounting, the paths no longer translate */
+    status = OS_TranslatePath("/drive0", drive0_local);
+    UtAssert_True(status == OS_FS_ERR_PATH_INVALID, "/drive0 after unmount Rc=%d", (int)status);
+}
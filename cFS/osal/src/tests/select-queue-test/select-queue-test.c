@@ -0,0 +1,206 @@
+/*
+ *  NASA Docket No. GSC-18,370-1, and identified as "Operating System Abstraction Layer"
+ *
+ *  Copyright (c) 2019 United States Government as represented by
+ *  the Administrator of the National Aeronautics and Space Administration.
+ *  All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*
+** Select On Queues Test
+**
+** Waits with OS_SelectMultiple on a message queue and a bound
+** datagram socket together, checking that each one wakes the
+** wait as soon as it has data and that neither is reported
+** ready when it does not.
+**
+** The time from a message being put on the queue by another
+** task to the waiting task waking up is also reported.
+**
+** On implementations that cannot wait on queues with select,
+** the queue checks are reported as not applicable.
+**
+*/
+#include <stdio.h>
+#include <string.h>
+#include "common_types.h"
+#include "osapi.h"
+#include "utassert.h"
+#include "uttest.h"
+#include "utbsp.h"
+
+#define SELQ_TEST_PORT          9872
+#define SELQ_TEST_TASK_PRIORITY 150
+
+/*
+ * Time the sender task waits before putting its message, and the
+ * longest the test waits for it, in milliseconds
+ */
+#define SELQ_TEST_PUT_DELAY     100
+#define SELQ_TEST_TIMEOUT       2000
+
+void SelectQueueSetup(void);
+void SelectQueueCheck(void);
+void SelectQueueWake(void);
+void SelectQueueTeardown(void);
+
+uint32 queue_id;
+uint32 sock_id;
+uint32 tx_sock;
+uint32 task_id;
+OS_SockAddr_t sock_addr;
+OS_time_t put_time;
+
+void sender_task(void)
+{
+    uint32 msg = 0x5A5A5A5A;
+
+    OS_TaskDelay(SELQ_TEST_PUT_DELAY);
+    OS_GetLocalTime(&put_time);
+    OS_QueuePut(queue_id, &msg, sizeof(msg), 0);
+}
+
+void UtTest_Setup(void)
+{
+    if (OS_API_Init() != OS_SUCCESS)
+    {
+        UtAssert_Abort("OS_API_Init() failed");
+    }
+
+    /*
+     * Register the test setup and check routines in UT assert
+     */
+    UtTest_Add(SelectQueueCheck, SelectQueueSetup, NULL, "SelectQueueCheck");
+    UtTest_Add(SelectQueueWake, NULL, SelectQueueTeardown, "SelectQueueWake");
+}
+
+void SelectQueueSetup(void)
+{
+    int32 status;
+
+    status = OS_QueueCreate(&queue_id, "SelectQueue", 4, sizeof(uint32), 0);
+    UtAssert_True(status == OS_SUCCESS, "Queue create Id=%u Rc=%d", (unsigned int)queue_id, (int)status);
+
+    status = OS_SocketOpen(&sock_id, OS_SocketDomain_INET, OS_SocketType_DATAGRAM);
+    UtAssert_True(status == OS_SUCCESS, "Socket open Id=%u Rc=%d", (unsigned int)sock_id, (int)status);
+
+    status = OS_SocketOpen(&tx_sock, OS_SocketDomain_INET, OS_SocketType_DATAGRAM);
+    UtAssert_True(status == OS_SUCCESS, "Tx socket open Id=%u Rc=%d", (unsigned int)tx_sock, (int)status);
+
+    OS_SocketAddrInit(&sock_addr, OS_SocketDomain_INET);
+    OS_SocketAddrFromString(&sock_addr, "127.0.0.1");
+    OS_SocketAddrSetPort(&sock_addr, SELQ_TEST_PORT);
+
+    status = OS_SocketBind(sock_id, &sock_addr);
+    UtAssert_True(status == OS_SUCCESS, "Socket bind Rc=%d", (int)status);
+}
+
+/*
+ * Fills a read set with the queue and the socket, then waits on it
+ */
+int32 SelectBoth(OS_FdSet *ReadSet, int32 msecs)
+{
+    OS_SelectFdZero(ReadSet);
+    OS_SelectFdAdd(ReadSet, queue_id);
+    OS_SelectFdAdd(ReadSet, sock_id);
+
+    return OS_SelectMultiple(ReadSet, NULL, msecs);
+}
+
+void SelectQueueCheck(void)
+{
+    OS_FdSet ReadSet;
+    uint32 msg = 1;
+    uint32 size_copied;
+    uint8 buf[16];
+    int32 status;
+
+    OS_SelectFdZero(&ReadSet);
+    OS_SelectFdAdd(&ReadSet, queue_id);
+    status = OS_SelectMultiple(&ReadSet, NULL, 0);
+    if (status == OS_ERR_OPERATION_NOT_SUPPORTED)
+    {
+        UtAssertEx(false, UTASSERT_CASETYPE_NA, __FILE__, __LINE__, "Select on queues not supported");
+        return;
+    }
+
+    UtAssert_True(status == OS_ERROR_TIMEOUT, "Select on empty queue Rc=%d", (int)status);
+
+    status = OS_QueuePut(queue_id, &msg, sizeof(msg), 0);
+    UtAssert_True(status == OS_SUCCESS, "Queue put Rc=%d", (int)status);
+
+    status = SelectBoth(&ReadSet, 0);
+    UtAssert_True(status == OS_SUCCESS, "Select with queued message Rc=%d", (int)status);
+    UtAssert_True(OS_SelectFdIsSet(&ReadSet, queue_id), "Queue readable");
+    UtAssert_True(!OS_SelectFdIsSet(&ReadSet, sock_id), "Socket not readable");
+
+    status = OS_QueueGet(queue_id, &msg, sizeof(msg), &size_copied, OS_CHECK);
+    UtAssert_True(status == OS_SUCCESS, "Queue get Rc=%d", (int)status);
+
+    status = OS_SocketSendTo(tx_sock, "select", 6, &sock_addr);
+    UtAssert_True(status == 6, "Socket send Rc=%d", (int)status);
+
+    status = SelectBoth(&ReadSet, 100);
+    UtAssert_True(status == OS_SUCCESS, "Select with queued datagram Rc=%d", (int)status);
+    UtAssert_True(!OS_SelectFdIsSet(&ReadSet, queue_id), "Queue not readable");
+    UtAssert_True(OS_SelectFdIsSet(&ReadSet, sock_id), "Socket readable");
+
+    status = OS_SocketRecvFrom(sock_id, buf, sizeof(buf), NULL, OS_CHECK);
+    UtAssert_True(status == 6, "Socket receive Rc=%d", (int)status);
+
+    status = SelectBoth(&ReadSet, 0);
+    UtAssert_True(status == OS_ERROR_TIMEOUT, "Select with nothing pending Rc=%d", (int)status);
+}
+
+void SelectQueueWake(void)
+{
+    OS_FdSet ReadSet;
+    OS_time_t wake_time;
+    uint32 msg;
+    uint32 size_copied;
+    int32 latency;
+    int32 status;
+
+    OS_SelectFdZero(&ReadSet);
+    OS_SelectFdAdd(&ReadSet, queue_id);
+    if (OS_SelectMultiple(&ReadSet, NULL, 0) == OS_ERR_OPERATION_NOT_SUPPORTED)
+    {
+        UtAssertEx(false, UTASSERT_CASETYPE_NA, __FILE__, __LINE__, "Select on queues not supported");
+        return;
+    }
+
+    status = OS_TaskCreate(&task_id, "Sender", sender_task, NULL, 4096, SELQ_TEST_TASK_PRIORITY, 0);
+    UtAssert_True(status == OS_SUCCESS, "Task create Id=%u Rc=%d", (unsigned int)task_id, (int)status);
+
+    status = SelectBoth(&ReadSet, SELQ_TEST_TIMEOUT);
+    OS_GetLocalTime(&wake_time);
+
+    UtAssert_True(status == OS_SUCCESS, "Select woken by queue put Rc=%d", (int)status);
+    UtAssert_True(OS_SelectFdIsSet(&ReadSet, queue_id), "Queue readable");
+
+    latency = (int32)(wake_time.seconds - put_time.seconds) * 1000000 +
+            ((int32)wake_time.microsecs - (int32)put_time.microsecs);
+    UtAssert_True(latency < (SELQ_TEST_TIMEOUT * 1000), "Woke %ld us after the put", (long)latency);
+
+    status = OS_QueueGet(queue_id, &msg, sizeof(msg), &size_copied, OS_CHECK);
+    UtAssert_True(status == OS_SUCCESS && msg == 0x5A5A5A5A, "Queue get Rc=%d", (int)status);
+}
+
+void SelectQueueTeardown(void)
+{
+    OS_close(tx_sock);
+    OS_close(sock_id);
+    OS_QueueDelete(queue_id);
+}
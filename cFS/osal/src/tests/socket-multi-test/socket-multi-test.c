@@ -0,0 +1,317 @@
+/*
+ *  NASA Docket No. GSC-18,370-1, and identified as "Operating System Abstraction Layer"
+ *
+ *  Copyright (c) 2019 United States Government as represented by
+ *  the Administrator of the National Aeronautics and Space Administration.
+ *  All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*
+** Multiple Message Socket Test
+**
+** Sends datagrams over the loopback interface, first checking
+** that multiple message sends and receives deliver every message
+** intact and in order, then comparing the rate of sending the
+** same datagrams one call per message and one call per batch.
+**
+** The receive phases include the time to send the datagrams.
+** Each timed phase runs for 1 second.  Higher numbers indicate
+** better performance.
+**
+*/
+#include <stdio.h>
+#include <string.h>
+#include "common_types.h"
+#include "osapi.h"
+#include "utassert.h"
+#include "uttest.h"
+#include "utbsp.h"
+
+/*
+ * Datagrams per batch, and size of each datagram
+ */
+#define MULTI_TEST_BATCH        32
+#define MULTI_TEST_MSG_SIZE     64
+#define MULTI_TEST_PORT         9871
+
+/*
+ * Duration of each timed phase, in milliseconds
+ */
+#define MULTI_TEST_RUN_TIME     1000
+
+void MultiSetup(void);
+void MultiCheck(void);
+void MultiRecvCheck(void);
+void MultiSpeed(void);
+void MultiTeardown(void);
+
+uint32 rx_sock;
+uint32 tx_sock;
+OS_SockAddr_t rx_addr;
+
+uint8 msg_data[MULTI_TEST_BATCH][MULTI_TEST_MSG_SIZE];
+OS_SockSendMsg_t msgs[MULTI_TEST_BATCH];
+uint8 rx_data[MULTI_TEST_BATCH][MULTI_TEST_MSG_SIZE];
+OS_SockAddr_t rx_from[MULTI_TEST_BATCH];
+OS_SockRecvMsg_t rx_msgs[MULTI_TEST_BATCH];
+
+void UtTest_Setup(void)
+{
+    if (OS_API_Init() != OS_SUCCESS)
+    {
+        UtAssert_Abort("OS_API_Init() failed");
+    }
+
+    /*
+     * Register the test setup and check routines in UT assert
+     */
+    UtTest_Add(MultiCheck, MultiSetup, NULL, "SendToMultiCheck");
+    UtTest_Add(MultiRecvCheck, NULL, NULL, "RecvFromMultiCheck");
+    UtTest_Add(MultiSpeed, NULL, MultiTeardown, "SendToMultiSpeed");
+}
+
+void MultiSetup(void)
+{
+    int32 status;
+    uint32 i;
+
+    status = OS_SocketOpen(&rx_sock, OS_SocketDomain_INET, OS_SocketType_DATAGRAM);
+    UtAssert_True(status == OS_SUCCESS, "Rx socket open Id=%u Rc=%d", (unsigned int)rx_sock, (int)status);
+
+    status = OS_SocketOpen(&tx_sock, OS_SocketDomain_INET, OS_SocketType_DATAGRAM);
+    UtAssert_True(status == OS_SUCCESS, "Tx socket open Id=%u Rc=%d", (unsigned int)tx_sock, (int)status);
+
+    OS_SocketAddrInit(&rx_addr, OS_SocketDomain_INET);
+    OS_SocketAddrFromString(&rx_addr, "127.0.0.1");
+    OS_SocketAddrSetPort(&rx_addr, MULTI_TEST_PORT);
+
+    status = OS_SocketBind(rx_sock, &rx_addr);
+    UtAssert_True(status == OS_SUCCESS, "Rx socket bind Rc=%d", (int)status);
+
+    for (i = 0; i < MULTI_TEST_BATCH; ++i)
+    {
+        memset(msg_data[i], 'A' + i, sizeof(msg_data[i]));
+        msgs[i].buffer = msg_data[i];
+        msgs[i].buflen = 1 + i;
+
+        rx_msgs[i].buffer = rx_data[i];
+        rx_msgs[i].buflen = sizeof(rx_data[i]);
+        rx_msgs[i].RemoteAddr = &rx_from[i];
+    }
+}
+
+void MultiCheck(void)
+{
+    uint8 buf[MULTI_TEST_MSG_SIZE];
+    uint32 errors;
+    uint32 i;
+    int32 status;
+
+    status = OS_SocketSendToMulti(tx_sock, msgs, MULTI_TEST_BATCH, &rx_addr);
+    UtAssert_True(status == MULTI_TEST_BATCH, "SendToMulti sent %d of %u", (int)status,
+            (unsigned int)MULTI_TEST_BATCH);
+
+    errors = 0;
+    for (i = 0; i < MULTI_TEST_BATCH; ++i)
+    {
+        status = OS_SocketRecvFrom(rx_sock, buf, sizeof(buf), NULL, 100);
+        if (status != msgs[i].buflen || memcmp(buf, msgs[i].buffer, msgs[i].buflen) != 0)
+        {
+            ++errors;
+        }
+    }
+
+    UtAssert_True(errors == 0, "%u of %u datagrams differ", (unsigned int)errors, (unsigned int)MULTI_TEST_BATCH);
+
+    status = OS_SocketSendToMulti(tx_sock, msgs, MULTI_TEST_BATCH, NULL);
+    UtAssert_True(status == OS_INVALID_POINTER, "SendToMulti(NULL) Rc=%d", (int)status);
+}
+
+void MultiRecvCheck(void)
+{
+    uint32 errors;
+    uint32 received;
+    uint32 i;
+    uint16 port;
+    int32 status;
+
+    status = OS_SocketRecvFromMulti(rx_sock, rx_msgs, MULTI_TEST_BATCH, 0);
+    UtAssert_True(status == OS_QUEUE_EMPTY || status == OS_ERROR_TIMEOUT, "RecvFromMulti with nothing sent Rc=%d",
+            (int)status);
+
+    status = OS_SocketSendToMulti(tx_sock, msgs, MULTI_TEST_BATCH, &rx_addr);
+    UtAssert_True(status == MULTI_TEST_BATCH, "SendToMulti sent %d of %u", (int)status,
+            (unsigned int)MULTI_TEST_BATCH);
+
+    /* the datagrams may not all be readable at once, so read until all arrive */
+    errors = 0;
+    received = 0;
+    while (received < MULTI_TEST_BATCH)
+    {
+        status = OS_SocketRecvFromMulti(rx_sock, &rx_msgs[received], MULTI_TEST_BATCH - received, 100);
+        if (status <= 0)
+        {
+            break;
+        }
+        received += status;
+    }
+
+    UtAssert_True(received == MULTI_TEST_BATCH, "RecvFromMulti received %u of %u", (unsigned int)received,
+            (unsigned int)MULTI_TEST_BATCH);
+
+    for (i = 0; i < received; ++i)
+    {
+        if (rx_msgs[i].msglen != msgs[i].buflen || memcmp(rx_msgs[i].buffer, msgs[i].buffer, msgs[i].buflen) != 0 ||
+                OS_SocketAddrGetPort(&port, rx_msgs[i].RemoteAddr) != OS_SUCCESS || port == 0)
+        {
+            ++errors;
+        }
+    }
+
+    UtAssert_True(errors == 0, "%u of %u datagrams differ", (unsigned int)errors, (unsigned int)received);
+}
+
+/*
+ * Drains datagrams that were not read, so the timed phases start alike
+ */
+void MultiDrain(void)
+{
+    uint8 buf[MULTI_TEST_MSG_SIZE];
+
+    while (OS_SocketRecvFrom(rx_sock, buf, sizeof(buf), NULL, 0) > 0)
+    {
+    }
+}
+
+void MultiSpeed(void)
+{
+    OS_time_t start;
+    OS_time_t now;
+    uint32 elapsed;
+    uint32 single_count;
+    uint32 multi_count;
+    uint32 calls;
+    uint32 i;
+    int32 status;
+
+    /*
+     * Datagrams that do not fit in the receive buffer are dropped on
+     * arrival, not refused, so neither loop is limited by the reader.
+     */
+    single_count = 0;
+    OS_GetLocalTime(&start);
+    do
+    {
+        for (i = 0; i < MULTI_TEST_BATCH; ++i)
+        {
+            status = OS_SocketSendTo(tx_sock, msgs[i].buffer, msgs[i].buflen, &rx_addr);
+            if (status > 0)
+            {
+                ++single_count;
+            }
+        }
+        OS_GetLocalTime(&now);
+        elapsed = (now.seconds - start.seconds) * 1000 + now.microsecs / 1000 - start.microsecs / 1000;
+    }
+    while (elapsed < MULTI_TEST_RUN_TIME);
+
+    UtAssert_True(single_count != 0, "SendTo sent %u datagrams", (unsigned int)single_count);
+    UtPrintf("SendTo: %lu datagrams/sec, 1 per call\n", (unsigned long)single_count * 1000 / elapsed);
+
+    MultiDrain();
+
+    multi_count = 0;
+    calls = 0;
+    OS_GetLocalTime(&start);
+    do
+    {
+        status = OS_SocketSendToMulti(tx_sock, msgs, MULTI_TEST_BATCH, &rx_addr);
+        if (status > 0)
+        {
+            multi_count += status;
+        }
+        ++calls;
+        OS_GetLocalTime(&now);
+        elapsed = (now.seconds - start.seconds) * 1000 + now.microsecs / 1000 - start.microsecs / 1000;
+    }
+    while (elapsed < MULTI_TEST_RUN_TIME);
+
+    UtAssert_True(multi_count != 0, "SendToMulti sent %u datagrams", (unsigned int)multi_count);
+    UtPrintf("SendToMulti: %lu datagrams/sec, %lu per call\n", (unsigned long)multi_count * 1000 / elapsed,
+            (unsigned long)multi_count / calls);
+
+    MultiDrain();
+
+    /*
+     * Receive rates, each pass receiving one batch sent in a single call
+     */
+    single_count = 0;
+    OS_GetLocalTime(&start);
+    do
+    {
+        OS_SocketSendToMulti(tx_sock, msgs, MULTI_TEST_BATCH, &rx_addr);
+        for (i = 0; i < MULTI_TEST_BATCH; ++i)
+        {
+            status = OS_SocketRecvFrom(rx_sock, rx_data[0], sizeof(rx_data[0]), NULL, 0);
+            if (status <= 0)
+            {
+                break;
+            }
+            ++single_count;
+        }
+        OS_GetLocalTime(&now);
+        elapsed = (now.seconds - start.seconds) * 1000 + now.microsecs / 1000 - start.microsecs / 1000;
+    }
+    while (elapsed < MULTI_TEST_RUN_TIME);
+
+    UtAssert_True(single_count != 0, "RecvFrom received %u datagrams", (unsigned int)single_count);
+    UtPrintf("RecvFrom: %lu datagrams/sec received, 1 per call\n", (unsigned long)single_count * 1000 / elapsed);
+
+    MultiDrain();
+
+    multi_count = 0;
+    calls = 0;
+    OS_GetLocalTime(&start);
+    do
+    {
+        OS_SocketSendToMulti(tx_sock, msgs, MULTI_TEST_BATCH, &rx_addr);
+        status = OS_SocketRecvFromMulti(rx_sock, rx_msgs, MULTI_TEST_BATCH, 0);
+        if (status > 0)
+        {
+            multi_count += status;
+        }
+        ++calls;
+        OS_GetLocalTime(&now);
+        elapsed = (now.seconds - start.seconds) * 1000 + now.microsecs / 1000 - start.microsecs / 1000;
+    }
+    while (elapsed < MULTI_TEST_RUN_TIME);
+
+    UtAssert_True(multi_count != 0, "RecvFromMulti received %u datagrams", (unsigned int)multi_count);
+    UtPrintf("RecvFromMulti: %lu datagrams/sec received, %lu per call\n", (unsigned long)multi_count * 1000 / elapsed,
+            (unsigned long)multi_count / calls);
+
+    MultiDrain();
+}
+
+void MultiTeardown(void)
+{
+    int32 status;
+
+    status = OS_close(tx_sock);
+    UtAssert_True(status == OS_SUCCESS, "Tx socket close Rc=%d", (int)status);
+
+    status = OS_close(rx_sock);
+    UtAssert_True(status == OS_SUCCESS, "Rx socket close Rc=%d", (int)status);
+}
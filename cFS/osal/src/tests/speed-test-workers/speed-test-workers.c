@@ -0,0 +1,151 @@
+/*
+ *  NASA Docket No. GSC-18,370-1, and identified as "Operating System Abstraction Layer"
+ *
+ *  Copyright (c) 2019 United States Government as represented by
+ *  the Administrator of the National Aeronautics and Space Administration.
+ *  All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*
+** Worker tasks for the multi-task speed tests
+*/
+#include <stdio.h>
+#include "common_types.h"
+#include "osapi.h"
+#include "utassert.h"
+#include "uttest.h"
+#include "utbsp.h"
+
+#include "speed-test-workers.h"
+
+/*
+ * Number of 10 millisecond waits for the workers to see the stop flag.
+ * This is generous, as a loaded machine may not run them for a while.
+ */
+#define WORKER_STOP_WAITS       1000
+
+uint32 worker_work[WORKER_MAX_TASKS];
+uint32 worker_errors[WORKER_MAX_TASKS];
+volatile bool worker_stop;
+
+static uint32 worker_id[WORKER_MAX_TASKS];
+static uint32 worker_count;
+static volatile bool worker_started[WORKER_MAX_TASKS];
+static volatile bool worker_done[WORKER_MAX_TASKS];
+static volatile bool worker_go;
+
+uint32 WorkerBegin(void)
+{
+    uint32 self;
+    uint32 i;
+
+    /* the IDs are only complete once all workers are created */
+    while (!worker_go)
+    {
+        OS_TaskDelay(1);
+    }
+
+    self = OS_TaskGetId();
+
+    for (i = 0; i < worker_count; ++i)
+    {
+        if (worker_id[i] == self)
+        {
+            worker_started[i] = true;
+            break;
+        }
+    }
+
+    return i;
+}
+
+void WorkerEnd(uint32 idx)
+{
+    if (idx < worker_count)
+    {
+        worker_done[idx] = true;
+    }
+}
+
+void StartWorkers(osal_task_entry entry, uint32 num_tasks)
+{
+    char   name[OS_MAX_API_NAME];
+    uint32 i;
+    int32  status;
+
+    worker_go = false;
+    worker_stop = false;
+    worker_count = num_tasks;
+
+    for (i = 0; i < worker_count; ++i)
+    {
+        worker_work[i] = 0;
+        worker_errors[i] = 0;
+        worker_started[i] = false;
+        worker_done[i] = false;
+    }
+
+    for (i = 0; i < worker_count; ++i)
+    {
+        snprintf(name, sizeof(name), "Worker %u", (unsigned int)i);
+        status = OS_TaskCreate(&worker_id[i], name, entry, NULL, 4096, WORKER_TASK_PRIORITY, 0);
+        UtAssert_True(status == OS_SUCCESS, "Task %u create Id=%u Rc=%d",
+                (unsigned int)i, (unsigned int)worker_id[i], (int)status);
+    }
+
+    worker_go = true;
+}
+
+void StopWorkers(const char *what, uint32 run_time)
+{
+    uint32 total_work = 0;
+    uint32 total_errors = 0;
+    uint32 tasks_started = 0;
+    uint32 tasks_done = 0;
+    uint32 wait;
+    uint32 i;
+
+    /* Time Limited Execution */
+    OS_TaskDelay(run_time);
+    worker_stop = true;
+
+    /* the tasks exit on their own once the flag is seen */
+    for (wait = 0; wait < WORKER_STOP_WAITS && tasks_done < worker_count; ++wait)
+    {
+        OS_TaskDelay(10);
+
+        tasks_done = 0;
+        for (i = 0; i < worker_count; ++i)
+        {
+            tasks_done += worker_done[i];
+        }
+    }
+
+    for (i = 0; i < worker_count; ++i)
+    {
+        tasks_started += worker_started[i];
+        total_work += worker_work[i];
+        total_errors += worker_errors[i];
+    }
+
+    UtAssert_True(tasks_started == worker_count, "%u of %u tasks started",
+            (unsigned int)tasks_started, (unsigned int)worker_count);
+    UtAssert_True(tasks_done == worker_count, "%u of %u tasks finished",
+            (unsigned int)tasks_done, (unsigned int)worker_count);
+    UtAssert_True(total_errors == 0, "%s errors = %u", what, (unsigned int)total_errors);
+
+    UtPrintf("%u tasks, %s: %lu operations/sec\n", (unsigned int)worker_count, what,
+            (unsigned long)total_work * 1000 / run_time);
+}
@@ -0,0 +1,85 @@
+/*
+ *  NASA Docket No. GSC-18,370-1, and identified as "Operating System Abstraction Layer"
+ *
+ *  Copyright (c) 2019 United States Government as represented by
+ *  the Administrator of the National Aeronautics and Space Administration.
+ *  All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*
+** Worker tasks for the multi-task speed tests
+**
+** The speed tests start a number of worker tasks that
+** all run the same function for a fixed time.  Each
+** worker calls WorkerBegin() to learn its index, counts
+** its operations and errors in worker_work[] and
+** worker_errors[] until worker_stop is set, and then
+** calls WorkerEnd().
+**
+** Only the errors are asserted.  The operation rate
+** depends on the load of the machine running the test,
+** so it is printed for information only.
+*/
+#ifndef _SPEED_TEST_WORKERS_H_
+#define _SPEED_TEST_WORKERS_H_
+
+#include "common_types.h"
+#include "osapi.h"
+
+/*
+ * Note the worker priority must be lower than that of
+ * the executive (init) task.  Otherwise, the test
+ * functions may never get CPU time to stop the test.
+ */
+#define WORKER_TASK_PRIORITY    150
+
+/*
+ * Maximum number of worker tasks
+ */
+#define WORKER_MAX_TASKS        8
+
+/*
+ * A limit for the maximum amount of iterations that each
+ * task will perform, in case the stop flag is not seen.
+ */
+#define WORKER_WORK_LIMIT       100000000
+
+extern uint32 worker_work[WORKER_MAX_TASKS];
+extern uint32 worker_errors[WORKER_MAX_TASKS];
+extern volatile bool worker_stop;
+
+/*
+ * Called by each worker before it starts working.
+ * Waits for all workers to be created and returns the index
+ * of the calling worker.
+ */
+uint32 WorkerBegin(void);
+
+/*
+ * Called by each worker after it has stopped working
+ */
+void WorkerEnd(uint32 idx);
+
+/*
+ * Creates the given number of worker tasks, all running the same function
+ */
+void StartWorkers(osal_task_entry entry, uint32 num_tasks);
+
+/*
+ * Lets the workers run for the given time, then stops them and reports the results
+ */
+void StopWorkers(const char *what, uint32 run_time);
+
+#endif  /* _SPEED_TEST_WORKERS_H_ */
@@ -0,0 +1,155 @@
+/*
+ *  NASA Docket No. GSC-18,370-1, and identified as "Operating System Abstraction Layer"
+ *
+ *  Copyright (c) 2019 United States Government as represented by
+ *  the Administrator of the National Aeronautics and Space Administration.
+ *  All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*
+** Time Base Jitter Test
+**
+** Runs a simulated time base at a fast interval with a timer
+** attached to every tick, then reports the measured lateness
+** of the ticks as a histogram, along with the timer callback
+** statistics.
+**
+** On implementations that do not measure jitter the histogram
+** is all zero, and only the callback statistics are checked.
+**
+*/
+#include <stdio.h>
+#include "common_types.h"
+#include "osapi.h"
+#include "utassert.h"
+#include "uttest.h"
+#include "utbsp.h"
+
+/*
+ * Interval of the time base, and run time of the test
+ */
+#define JITTER_TEST_INTERVAL    1000
+#define JITTER_TEST_RUN_TIME    2000
+
+void JitterSetup(void);
+void JitterRun(void);
+void JitterTeardown(void);
+
+uint32 timebase_id;
+uint32 timer_id;
+uint32 callback_count;
+
+void JitterCallback(uint32 object_id, void *arg)
+{
+    ++callback_count;
+}
+
+void UtTest_Setup(void)
+{
+    if (OS_API_Init() != OS_SUCCESS)
+    {
+        UtAssert_Abort("OS_API_Init() failed");
+    }
+
+    /*
+     * Register the test setup and check routines in UT assert
+     */
+    UtTest_Add(JitterRun, JitterSetup, JitterTeardown, "TimeBaseJitter");
+}
+
+void JitterSetup(void)
+{
+    int32 status;
+
+    callback_count = 0;
+
+    status = OS_TimeBaseCreate(&timebase_id, "JitterTB", NULL);
+    UtAssert_True(status == OS_SUCCESS, "Time base create Id=%u Rc=%d", (unsigned int)timebase_id, (int)status);
+
+    status = OS_TimerAdd(&timer_id, "JitterTimer", timebase_id, JitterCallback, NULL);
+    UtAssert_True(status == OS_SUCCESS, "Timer add Id=%u Rc=%d", (unsigned int)timer_id, (int)status);
+}
+
+void JitterRun(void)
+{
+    OS_timebase_prop_t prop;
+    uint32 ticks;
+    uint32 highest;
+    uint32 i;
+    int32  status;
+
+    status = OS_TimerSet(timer_id, JITTER_TEST_INTERVAL, JITTER_TEST_INTERVAL);
+    UtAssert_True(status == OS_SUCCESS, "Timer set Rc=%d", (int)status);
+
+    status = OS_TimeBaseSet(timebase_id, JITTER_TEST_INTERVAL, JITTER_TEST_INTERVAL);
+    UtAssert_True(status == OS_SUCCESS, "Time base set Rc=%d", (int)status);
+
+    OS_TaskDelay(JITTER_TEST_RUN_TIME);
+
+    status = OS_TimeBaseGetInfo(timebase_id, &prop);
+    UtAssert_True(status == OS_SUCCESS, "Time base get info Rc=%d", (int)status);
+
+    UtAssert_True(callback_count > 0, "Callbacks = %u", (unsigned int)callback_count);
+    UtAssert_True(prop.callback_count >= callback_count, "Reported callbacks = %u",
+            (unsigned int)prop.callback_count);
+
+    UtPrintf("%u us interval: %u callbacks, %u overruns, max callback latency %u us\n",
+            (unsigned int)JITTER_TEST_INTERVAL, (unsigned int)prop.callback_count,
+            (unsigned int)prop.overrun_count, (unsigned int)prop.max_callback_latency);
+
+    ticks = 0;
+    highest = 0;
+    for (i = 0; i < OS_TIMEBASE_JITTER_BUCKETS; ++i)
+    {
+        if (prop.jitter_histogram[i] != 0)
+        {
+            ticks += prop.jitter_histogram[i];
+            highest = i;
+            if (i == 0)
+            {
+                UtPrintf("  jitter < 1 us: %u\n", (unsigned int)prop.jitter_histogram[i]);
+            }
+            else
+            {
+                UtPrintf("  jitter >= %u us: %u\n", (unsigned int)(1 << (i - 1)),
+                        (unsigned int)prop.jitter_histogram[i]);
+            }
+        }
+    }
+
+    UtPrintf("  max jitter %u us\n", (unsigned int)prop.max_jitter);
+
+    if (ticks != 0)
+    {
+        /* the max must fall in the highest bucket that was used */
+        UtAssert_True(highest == (OS_TIMEBASE_JITTER_BUCKETS - 1) ||
+                (prop.max_jitter >> highest) == 0, "Max jitter %u us within bucket %u",
+                (unsigned int)prop.max_jitter, (unsigned int)highest);
+        UtAssert_True(highest == 0 || (prop.max_jitter >> (highest - 1)) != 0,
+                "Max jitter %u us reaches bucket %u",
+                (unsigned int)prop.max_jitter, (unsigned int)highest);
+    }
+}
+
+void JitterTeardown(void)
+{
+    int32 status;
+
+    status = OS_TimerDelete(timer_id);
+    UtAssert_True(status == OS_SUCCESS, "Timer delete Rc=%d", (int)status);
+
+    status = OS_TimeBaseDelete(timebase_id);
+    UtAssert_True(status == OS_SUCCESS, "Time base delete Rc=%d", (int)status);
+}
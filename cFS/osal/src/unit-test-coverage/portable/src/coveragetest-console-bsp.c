@@ -31,32 +31,97 @@
 #include <OCS_stdio.h>
 #include <OCS_bsp-impl.h>
 
-#define TEST_BUFFER_LEN     16
+#define TEST_LINE_SIZE      4
+#define TEST_LINE_COUNT     4
 
-const char TEST_BUF_INITIALIZER[1+TEST_BUFFER_LEN] = "abcdefghijklmnop";
+const char TEST_BUF_INITIALIZER[1+(TEST_LINE_SIZE * TEST_LINE_COUNT)] = "abcdefghijklmnop";
+
+/*
+ * Notify the reader again while it is forwarding, as a writer that
+ * finds the ring owned by another reader does
+ */
+static int32 UT_ConsoleNotifyHook(void *UserObj, int32 StubRetcode, uint32 CallCount, const UT_StubContext_t *Context)
+{
+    OS_console_table[0].WakeupPending = 1;
+    UT_SetHookFunction(UT_KEY(OCS_OS_BSP_ConsoleOutputVec_Impl), NULL, NULL);
+    return StubRetcode;
+}
 
 void Test_OS_ConsoleOutput_Impl(void)
 {
-    char TestConsoleBspBuffer[TEST_BUFFER_LEN];
+    char TestConsoleBspBuffer[TEST_LINE_SIZE * TEST_LINE_COUNT];
+    OS_console_line_t TestConsoleLines[TEST_LINE_COUNT];
     char TestOutputBuffer[32];
+    uint32 i;
+    uint32 CallCount;
 
     memcpy(TestConsoleBspBuffer, TEST_BUF_INITIALIZER, sizeof(TestConsoleBspBuffer));
     memset(TestOutputBuffer, 0, sizeof(TestOutputBuffer));
 
     OS_console_table[0].BufBase = TestConsoleBspBuffer;
     OS_console_table[0].BufSize = sizeof(TestConsoleBspBuffer);
-
-    UT_SetDataBuffer(UT_KEY(OCS_OS_BSP_ConsoleOutput_Impl), TestOutputBuffer, sizeof(TestOutputBuffer), false);
-
-    OS_console_table[0].WritePos = 4;
+    OS_console_table[0].Lines = TestConsoleLines;
+    OS_console_table[0].LineSize = TEST_LINE_SIZE;
+    OS_console_table[0].LineCount = TEST_LINE_COUNT;
+    OS_console_table[0].SeqLimit = 2 * TEST_LINE_COUNT;
+
+    for (i = 0; i < TEST_LINE_COUNT; ++i)
+    {
+        TestConsoleLines[i].Seq = i;
+        TestConsoleLines[i].Length = i + 1;
+    }
+
+    UT_SetDataBuffer(UT_KEY(OCS_OS_BSP_ConsoleOutputVec_Impl), TestOutputBuffer, sizeof(TestOutputBuffer), false);
+
+    /* another reader owns the ring: the notification is left for it */
+    OS_console_table[0].ReaderBusy = 1;
+    OS_console_table[0].WakeupPending = 1;
+    TestConsoleLines[0].Seq = 1;
+    OS_ConsoleOutput_Impl(0);
+    CallCount = UT_GetStubCount(UT_KEY(OCS_OS_BSP_ConsoleOutputVec_Impl));
+    UtAssert_True(CallCount == 0, "OS_BSP_ConsoleOutputVec_Impl() call count (%lu) == 0", (unsigned long)CallCount);
+    UtAssert_True(OS_console_table[0].WakeupPending == 1, "WakeupPending kept");
+    OS_console_table[0].ReaderBusy = 0;
+    OS_console_table[0].WakeupPending = 0;
+    TestConsoleLines[0].Seq = 0;
+
+    /* nothing published */
     OS_ConsoleOutput_Impl(0);
-    UtAssert_True(strcmp(TestOutputBuffer, "abcd") == 0,
-            "TestOutputBuffer (%s) == abcd", TestOutputBuffer);
+    CallCount = UT_GetStubCount(UT_KEY(OCS_OS_BSP_ConsoleOutputVec_Impl));
+    UtAssert_True(CallCount == 0, "OS_BSP_ConsoleOutputVec_Impl() call count (%lu) == 0", (unsigned long)CallCount);
 
-    OS_console_table[0].WritePos = 2;
+    /* lines 0 and 1 are published, line 2 is still being written */
+    OS_console_table[0].WakeupPending = 1;
+    TestConsoleLines[0].Seq = 1;
+    TestConsoleLines[1].Seq = 2;
+    OS_ConsoleOutput_Impl(0);
+    UtAssert_True(strcmp(TestOutputBuffer, "aef") == 0,
+            "TestOutputBuffer (%s) == aef", TestOutputBuffer);
+    UtAssert_True(OS_console_table[0].ReadPos == 2, "ReadPos (%lu) == 2", (unsigned long)OS_console_table[0].ReadPos);
+    UtAssert_True(OS_console_table[0].WakeupPending == 0, "WakeupPending cleared");
+    UtAssert_True(OS_console_table[0].ReaderBusy == 0, "ReaderBusy released");
+    UtAssert_True(TestConsoleLines[0].Seq == 4 && TestConsoleLines[1].Seq == 5, "Slots freed for the next lap");
+    UtAssert_True(OS_console_table[0].OutputBatches == 1 && OS_console_table[0].MaxBatch == 2,
+            "OutputBatches (%lu) == 1, MaxBatch (%lu) == 2",
+            (unsigned long)OS_console_table[0].OutputBatches, (unsigned long)OS_console_table[0].MaxBatch);
+
+    /* lines 2, 3 and 4 are published, with line 4 in slot 0 after the wrap of the ring */
+    TestConsoleLines[2].Seq = 3;
+    TestConsoleLines[3].Seq = 4;
+    TestConsoleLines[0].Seq = 5;
+    OS_ConsoleOutput_Impl(0);
+    UtAssert_True(strcmp(TestOutputBuffer, "aefijkmnopa") == 0,
+            "TestOutputBuffer (%s) == aefijkmnopa", TestOutputBuffer);
+    UtAssert_True(OS_console_table[0].ReadPos == 5, "ReadPos (%lu) == 5", (unsigned long)OS_console_table[0].ReadPos);
+    UtAssert_True(TestConsoleLines[0].Seq == 0, "Slot 0 Seq (%lu) wraps to 0", (unsigned long)TestConsoleLines[0].Seq);
+
+    /* a notification that arrives during the output is handled before returning */
+    TestConsoleLines[1].Seq = 6;
+    UT_SetHookFunction(UT_KEY(OCS_OS_BSP_ConsoleOutputVec_Impl), UT_ConsoleNotifyHook, NULL);
     OS_ConsoleOutput_Impl(0);
-    UtAssert_True(strcmp(TestOutputBuffer, "abcdefghijklmnopab") == 0,
-            "TestOutputBuffer (%s) == abcdefghijklmnopab", TestOutputBuffer);
+    UtAssert_True(OS_console_table[0].ReadPos == 6, "ReadPos (%lu) == 6", (unsigned long)OS_console_table[0].ReadPos);
+    UtAssert_True(OS_console_table[0].WakeupPending == 0, "WakeupPending cleared");
+    UtAssert_True(OS_console_table[0].ReaderBusy == 0, "ReaderBusy released");
 }
 
 
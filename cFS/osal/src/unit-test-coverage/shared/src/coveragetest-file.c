@@ -229,6 +229,51 @@ void Test_OS_lseek(void)
 }
 
 
+void Test_OS_FileMap(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_FileMap (uint32 filedes, uint32 offset, uint32 length, void **addr)
+     */
+    int32 expected = OS_SUCCESS;
+    void *addr = NULL;
+    int32 actual = OS_FileMap(1, 0, 4, &addr);
+
+    UtAssert_True(actual == expected, "OS_FileMap() (%ld) == OS_SUCCESS", (long)actual);
+
+    expected = OS_INVALID_POINTER;
+    actual = OS_FileMap(1, 0, 4, NULL);
+    UtAssert_True(actual == expected, "OS_FileMap() (%ld) == OS_INVALID_POINTER", (long)actual);
+
+    expected = OS_ERROR;
+    actual = OS_FileMap(1, 0, 0, &addr);
+    UtAssert_True(actual == expected, "OS_FileMap() (%ld) == OS_ERROR", (long)actual);
+
+    UT_SetForceFail(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    expected = OS_ERR_INVALID_ID;
+    actual = OS_FileMap(1, 0, 4, &addr);
+    UtAssert_True(actual == expected, "OS_FileMap() (%ld) == OS_ERR_INVALID_ID", (long)actual);
+}
+
+
+void Test_OS_FileUnmap(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_FileUnmap (void *addr, uint32 length)
+     */
+    int32 expected = OS_SUCCESS;
+    uint32 buffer;
+    int32 actual = OS_FileUnmap(&buffer, sizeof(buffer));
+
+    UtAssert_True(actual == expected, "OS_FileUnmap() (%ld) == OS_SUCCESS", (long)actual);
+
+    expected = OS_INVALID_POINTER;
+    actual = OS_FileUnmap(NULL, sizeof(buffer));
+    UtAssert_True(actual == expected, "OS_FileUnmap() (%ld) == OS_INVALID_POINTER", (long)actual);
+}
+
+
 void Test_OS_remove(void)
 {
     /*
@@ -465,6 +510,8 @@ void UtTest_Setup(void)
     ADD_TEST(OS_chmod);
     ADD_TEST(OS_stat);
     ADD_TEST(OS_lseek);
+    ADD_TEST(OS_FileMap);
+    ADD_TEST(OS_FileUnmap);
     ADD_TEST(OS_remove);
     ADD_TEST(OS_rename);
     ADD_TEST(OS_cp);
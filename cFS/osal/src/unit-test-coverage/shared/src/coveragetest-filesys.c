@@ -453,14 +453,20 @@ void Test_OS_TranslatePath(void)
     int32 actual = ~OS_SUCCESS;
 
     /* Set up the local record for success */
+    OS_global_filesys_table[1].active_id = 1;
     OS_filesys_table[1].flags = OS_FILESYS_FLAG_IS_READY | OS_FILESYS_FLAG_IS_MOUNTED_SYSTEM | OS_FILESYS_FLAG_IS_MOUNTED_VIRTUAL;
     strcpy(OS_filesys_table[1].virtual_mountpt,"/cf");
     strcpy(OS_filesys_table[1].system_mountpt,"/mnt/cf");
+    OS_FileSys_RebuildMountTable();
 
     actual = OS_TranslatePath("/cf/test",LocalBuffer);
     UtAssert_True(actual == expected, "OS_TranslatePath(/cf/test) (%ld) == OS_SUCCESS", (long)actual);
     UtAssert_True(strcmp(LocalBuffer,"/mnt/cf/test") == 0, "OS_TranslatePath(/cf/test) (%s)  == /mnt/cf/test", LocalBuffer);
 
+    actual = OS_TranslatePath("/cf",LocalBuffer);
+    UtAssert_True(actual == expected, "OS_TranslatePath(/cf) (%ld) == OS_SUCCESS", (long)actual);
+    UtAssert_True(strcmp(LocalBuffer,"/mnt/cf") == 0, "OS_TranslatePath(/cf) (%s)  == /mnt/cf", LocalBuffer);
+
     /* Check various error paths */
     expected = OS_INVALID_POINTER;
     actual = OS_TranslatePath(NULL, NULL);
@@ -487,28 +493,83 @@ void Test_OS_TranslatePath(void)
     actual = OS_TranslatePath("invalid/",LocalBuffer);
     UtAssert_True(actual == expected, "OS_TranslatePath() (%ld) == OS_FS_ERR_PATH_INVALID", (long)actual);
 
-    UT_SetForceFail(UT_KEY(OS_ObjectIdGetBySearch), OS_ERR_NAME_NOT_FOUND);
-    actual = OS_TranslatePath("/cf/test",LocalBuffer);
-    UtAssert_True(actual == expected, "OS_TranslatePath() (%ld) == OS_FS_ERR_PATH_INVALID", (long)actual);
-    UT_ClearForceFail(UT_KEY(OS_ObjectIdGetBySearch));
-
-   /* VirtPathLen < VirtPathBegin */
-    UT_SetDeferredRetcode(UT_KEY(OCS_strlen), 4, OS_MAX_PATH_LEN);
-    expected = OS_FS_ERR_PATH_INVALID;
-    actual = OS_TranslatePath("/cf/test",LocalBuffer);
-    UtAssert_True(actual == expected, "OS_TranslatePath(/cf/test) (%ld) == OS_FS_ERR_PATH_INVALID", (long)actual);
+    /* No mount point, and a mount point that is only a prefix of the first name */
+    actual = OS_TranslatePath("/other/test",LocalBuffer);
+    UtAssert_True(actual == expected, "OS_TranslatePath(/other/test) (%ld) == OS_FS_ERR_PATH_INVALID", (long)actual);
+    actual = OS_TranslatePath("/cfx/test",LocalBuffer);
+    UtAssert_True(actual == expected, "OS_TranslatePath(/cfx/test) (%ld) == OS_FS_ERR_PATH_INVALID", (long)actual);
 
     /* (SysMountPointLen + VirtPathLen) > OS_MAX_LOCAL_PATH_LEN */
-    UT_SetDeferredRetcode(UT_KEY(OCS_strlen), 3, OS_MAX_LOCAL_PATH_LEN);
+    OS_filesys_mount_table.entry[0].system_len = OS_MAX_LOCAL_PATH_LEN;
     expected = OS_FS_ERR_PATH_TOO_LONG;
     actual = OS_TranslatePath("/cf/test",LocalBuffer);
     UtAssert_True(actual == expected, "OS_TranslatePath(/cf/test) (%ld) == OS_FS_ERR_PATH_TOO_LONG", (long)actual);
- 
-    OS_filesys_table[1].flags = 0;
+
+    OS_filesys_table[1].flags = OS_FILESYS_FLAG_IS_READY | OS_FILESYS_FLAG_IS_MOUNTED_VIRTUAL;
+    OS_FileSys_RebuildMountTable();
     expected = OS_ERR_INCORRECT_OBJ_STATE;
     actual = OS_TranslatePath("/cf/test",LocalBuffer);
     UtAssert_True(actual == expected, "OS_TranslatePath(/cf/test) (%ld) == OS_ERR_INCORRECT_OBJ_STATE", (long)actual);
 
+    /* Not virtually mounted */
+    OS_filesys_table[1].flags = 0;
+    OS_FileSys_RebuildMountTable();
+    expected = OS_FS_ERR_PATH_INVALID;
+    actual = OS_TranslatePath("/cf/test",LocalBuffer);
+    UtAssert_True(actual == expected, "OS_TranslatePath(/cf/test) (%ld) == OS_FS_ERR_PATH_INVALID", (long)actual);
+
+    /* A table in the middle of a rebuild is not used */
+    OS_filesys_mount_table.num_entries = OS_MAX_FILE_SYSTEMS + 1;
+    actual = OS_FileSys_MapMountPoint("/cf/test", 8, LocalBuffer);
+    UtAssert_True(actual == expected, "OS_FileSys_MapMountPoint(/cf/test) (%ld) == OS_FS_ERR_PATH_INVALID", (long)actual);
+
+    OS_global_filesys_table[1].active_id = 0;
+}
+
+void Test_OS_FileSys_RebuildMountTable(void)
+{
+    /*
+     * Test Case For:
+     * void OS_FileSys_RebuildMountTable(void)
+     */
+    char LocalBuffer[OS_MAX_PATH_LEN];
+    uint32 seq;
+    int32 actual;
+
+    /* Nested mount points, the shorter one in the lower table entry */
+    OS_global_filesys_table[0].active_id = 1;
+    OS_filesys_table[0].flags = OS_FILESYS_FLAG_IS_MOUNTED_SYSTEM | OS_FILESYS_FLAG_IS_MOUNTED_VIRTUAL;
+    strcpy(OS_filesys_table[0].virtual_mountpt,"/cf");
+    strcpy(OS_filesys_table[0].system_mountpt,"/mnt/cf");
+    OS_global_filesys_table[1].active_id = 2;
+    OS_filesys_table[1].flags = OS_FILESYS_FLAG_IS_MOUNTED_SYSTEM | OS_FILESYS_FLAG_IS_MOUNTED_VIRTUAL;
+    strcpy(OS_filesys_table[1].virtual_mountpt,"/cf/apps");
+    strcpy(OS_filesys_table[1].system_mountpt,"/mnt/apps");
+
+    /* Free and unmounted records are left out */
+    OS_filesys_table[2].flags = OS_FILESYS_FLAG_IS_MOUNTED_SYSTEM | OS_FILESYS_FLAG_IS_MOUNTED_VIRTUAL;
+    strcpy(OS_filesys_table[2].virtual_mountpt,"/free");
+    OS_global_filesys_table[3].active_id = 4;
+    strcpy(OS_filesys_table[3].virtual_mountpt,"/unmounted");
+
+    seq = OS_filesys_mount_table.seq;
+    OS_FileSys_RebuildMountTable();
+    UtAssert_True(OS_filesys_mount_table.seq == seq + 2, "seq (%lu) == %lu",
+            (unsigned long)OS_filesys_mount_table.seq, (unsigned long)seq + 2);
+    UtAssert_True(OS_filesys_mount_table.num_entries == 2, "num_entries (%lu) == 2",
+            (unsigned long)OS_filesys_mount_table.num_entries);
+    UtAssert_True(strcmp(OS_filesys_mount_table.entry[0].virtual_mountpt, "/cf/apps") == 0,
+            "entry[0] (%s) == /cf/apps", OS_filesys_mount_table.entry[0].virtual_mountpt);
+
+    /* The longest matching mount point is used */
+    actual = OS_TranslatePath("/cf/apps/test",LocalBuffer);
+    UtAssert_True(actual == OS_SUCCESS, "OS_TranslatePath(/cf/apps/test) (%ld) == OS_SUCCESS", (long)actual);
+    UtAssert_True(strcmp(LocalBuffer,"/mnt/apps/test") == 0, "OS_TranslatePath(/cf/apps/test) (%s) == /mnt/apps/test", LocalBuffer);
+    actual = OS_TranslatePath("/cf/test",LocalBuffer);
+    UtAssert_True(actual == OS_SUCCESS, "OS_TranslatePath(/cf/test) (%ld) == OS_SUCCESS", (long)actual);
+    UtAssert_True(strcmp(LocalBuffer,"/mnt/cf/test") == 0, "OS_TranslatePath(/cf/test) (%s) == /mnt/cf/test", LocalBuffer);
+
+    memset(OS_global_filesys_table, 0, sizeof(OS_common_record_t) * OS_MAX_FILE_SYSTEMS);
 }
 
 void Test_OS_FileSys_FindVirtMountPoint(void)
@@ -557,6 +618,7 @@ void Osapi_Test_Setup(void)
 {
     UT_ResetState(0);
     memset(OS_filesys_table, 0, sizeof(OS_filesys_table));
+    memset(&OS_filesys_mount_table, 0, sizeof(OS_filesys_mount_table));
 }
 
 /*
@@ -588,6 +650,7 @@ void UtTest_Setup(void)
     ADD_TEST(OS_FS_GetPhysDriveName);
     ADD_TEST(OS_GetFsInfo);
     ADD_TEST(OS_TranslatePath);
+    ADD_TEST(OS_FileSys_RebuildMountTable);
     ADD_TEST(OS_FileSys_FindVirtMountPoint);
 }
 
@@ -402,6 +402,48 @@ void Test_OS_ObjectIdGetById(void)
 
 }
 
+void Test_OS_ObjectIdRefcountIncr(void)
+{
+    /*
+     * Test Case For:
+     * bool OS_ObjectIdRefcountIncr(uint32 idtype, uint32 reference_id, OS_common_record_t *obj);
+     */
+    uint32 refobjid = 0;
+    uint32 local_idx = 0;
+    OS_common_record_t *rptr;
+
+    OS_ObjectIdCompose_Impl(OS_OBJECT_TYPE_OS_TASK, 1, &refobjid);
+    OS_ObjectIdToArrayIndex(OS_OBJECT_TYPE_OS_TASK, refobjid, &local_idx);
+    rptr = &OS_global_task_table[local_idx];
+    rptr->active_id = refobjid;
+
+    /* nominal - a valid ID is referenced without the table lock */
+    UtAssert_True(OS_ObjectIdRefcountIncr(OS_OBJECT_TYPE_OS_TASK, refobjid, rptr),
+            "OS_ObjectIdRefcountIncr() nominal");
+    UtAssert_True(rptr->refcount == 1, "refcount (%u) == 1", (unsigned int)rptr->refcount);
+
+    /* a stale ID must not take a reference */
+    UtAssert_True(!OS_ObjectIdRefcountIncr(OS_OBJECT_TYPE_OS_TASK, refobjid + OS_MAX_TASKS, rptr),
+            "OS_ObjectIdRefcountIncr() stale ID");
+    UtAssert_True(rptr->refcount == 1, "refcount (%u) == 1", (unsigned int)rptr->refcount);
+
+    /* nor may one be taken while an exclusive request is pending */
+    rptr->flags = OS_OBJECT_EXCL_REQ_FLAG;
+    UtAssert_True(!OS_ObjectIdRefcountIncr(OS_OBJECT_TYPE_OS_TASK, refobjid, rptr),
+            "OS_ObjectIdRefcountIncr() exclusive pending");
+    rptr->flags = 0;
+
+    /* nor while the global table is locked */
+    OS_Lock_Global(OS_OBJECT_TYPE_OS_TASK);
+    UtAssert_True(!OS_ObjectIdRefcountIncr(OS_OBJECT_TYPE_OS_TASK, refobjid, rptr),
+            "OS_ObjectIdRefcountIncr() table locked");
+    OS_Unlock_Global(OS_OBJECT_TYPE_OS_TASK);
+    UtAssert_True(rptr->refcount == 1, "refcount (%u) == 1", (unsigned int)rptr->refcount);
+
+    UtAssert_True(OS_ObjectIdRefcountDecr(rptr) == OS_SUCCESS, "OS_ObjectIdRefcountDecr() == OS_SUCCESS");
+    UtAssert_True(rptr->refcount == 0, "refcount (%u) == 0", (unsigned int)rptr->refcount);
+}
+
 void Test_OS_ObjectIdFindNext(void)
 {
     /*
@@ -418,6 +460,7 @@ void Test_OS_ObjectIdFindNext(void)
     int32 actual;
     OS_common_record_t *rec1;
     OS_common_record_t *rec2;
+    OS_common_record_t *rec3;
     uint32 id1;
     uint32 id2;
     uint32 saved_id;
@@ -471,6 +514,19 @@ void Test_OS_ObjectIdFindNext(void)
     UtAssert_True(id2 == 0, "OS_ObjectIdFinalizeNew() id (%lx) == 0", (unsigned long)id2);
     UtAssert_True(rec2->active_id == 0, "OS_ObjectIdFinalizeNew() active_id cleared");
 
+    /* a free record that is still referenced is not handed out again */
+    rec2->refcount = 1;
+    expected = OS_SUCCESS;
+    actual = OS_ObjectIdFindNext(OS_OBJECT_TYPE_OS_TASK, NULL, &rec3);
+    UtAssert_True(actual == expected, "OS_ObjectIdFindNext() (%ld) == OS_SUCCESS", (long)actual);
+#ifdef OS_IDMAP_LOCKFREE_REFCOUNT
+    UtAssert_True(rec3 != rec2, "OS_ObjectIdFindNext() skipped referenced record");
+#else
+    UtAssert_True(rec3 == rec2 && rec2->refcount == 0, "OS_ObjectIdFindNext() reset leaked refcount");
+#endif
+    rec3->active_id = 0;
+    rec2->refcount = 0;
+
     /*
      * Finally - test the wrap-around function to verify that object IDs
      * will continue to allocate correctly after OS_OBJECT_INDEX_MASK
@@ -712,6 +768,7 @@ void UtTest_Setup(void)
     ADD_TEST(OS_ObjectIdToArrayIndex);
     ADD_TEST(OS_ObjectIdFindByName);
     ADD_TEST(OS_ObjectIdGetById);
+    ADD_TEST(OS_ObjectIdRefcountIncr);
     ADD_TEST(OS_ObjectIdAllocateNew);
     ADD_TEST(OS_ObjectIdConvertLock);
     ADD_TEST(OS_ObjectIdGetBySearch);
@@ -30,7 +30,11 @@
 
 #include <OCS_stdio.h>
 
-char TestConsoleBuffer[16];
+#define TEST_LINE_SIZE      16
+#define TEST_LINE_COUNT     2
+
+char TestConsoleBuffer[TEST_LINE_SIZE * TEST_LINE_COUNT];
+OS_console_line_t TestConsoleLines[TEST_LINE_COUNT];
 
 void Test_OS_ConsoleAPI_Init(void)
 {
@@ -78,24 +82,128 @@ void Test_OS_printf(void)
     OS_printf("UnitTest3");
     CallCount = UT_GetStubCount(UT_KEY(OS_ConsoleWakeup_Impl));
     UtAssert_True(CallCount == 1, "OS_ConsoleWakeup_Impl() call count (%lu) == 1", (unsigned long)CallCount);
-    UtAssert_True(OS_console_table[0].WritePos >= 9, "WritePos (%lu) >= 9", (unsigned long)OS_console_table[0].WritePos);
+    UtAssert_True(OS_console_table[0].WritePos == 1, "WritePos (%lu) == 1", (unsigned long)OS_console_table[0].WritePos);
+    UtAssert_True(OS_console_table[0].Lines[0].Seq == 1 && OS_console_table[0].Lines[0].Length == 9,
+            "Line 0 published, length (%lu) == 9", (unsigned long)OS_console_table[0].Lines[0].Length);
+    UtAssert_True(memcmp(TestConsoleBuffer, "UnitTest3", 9) == 0, "Line 0 content");
 
-    /* print a long string that does not fit in the 16-char buffer */
-    OS_printf_enable();
+    /* print a long string that does not fit in the 16-char line */
     OS_printf("UnitTest4BufferLengthExceeded");
+    UtAssert_True(OS_console_table[0].OverflowEvents == 1, "OverflowEvents (%lu) == 1",
+            (unsigned long)OS_console_table[0].OverflowEvents);
 
-    /* test writing with a non-empty console name */
+    /* test writing with a non-empty console name; the reader is still due so no new wakeup */
     strncpy(OS_console_table[0].device_name,"ut",sizeof(OS_console_table[0].device_name)-1);
     OS_printf("UnitTest5");
+    CallCount = UT_GetStubCount(UT_KEY(OS_ConsoleWakeup_Impl));
+    UtAssert_True(CallCount == 1, "OS_ConsoleWakeup_Impl() call count (%lu) == 1", (unsigned long)CallCount);
+    UtAssert_True(memcmp(&TestConsoleBuffer[TEST_LINE_SIZE], "utUnitTest5", 11) == 0, "Line 1 content");
+
+    /* the ring is now full, so the line is dropped */
+    OS_printf("UnitTest6");
+    UtAssert_True(OS_console_table[0].OverflowEvents == 2, "OverflowEvents (%lu) == 2",
+            (unsigned long)OS_console_table[0].OverflowEvents);
+    UtAssert_True(OS_console_table[0].LinesWritten == 2, "LinesWritten (%lu) == 2",
+            (unsigned long)OS_console_table[0].LinesWritten);
+
+    /* free the first slot as the reader would; the next line goes there and wakes the reader */
+    OS_console_table[0].Lines[0].Seq = 2;
+    OS_console_table[0].ReadPos = 1;
+    OS_console_table[0].WakeupPending = 0;
+    OS_printf("UnitTest7");
+    CallCount = UT_GetStubCount(UT_KEY(OS_ConsoleWakeup_Impl));
+    UtAssert_True(CallCount == 2, "OS_ConsoleWakeup_Impl() call count (%lu) == 2", (unsigned long)CallCount);
+    UtAssert_True(OS_console_table[0].WritePos == 3, "WritePos (%lu) == 3", (unsigned long)OS_console_table[0].WritePos);
+    UtAssert_True(OS_console_table[0].Lines[0].Seq == 3, "Line 0 Seq (%lu) == 3",
+            (unsigned long)OS_console_table[0].Lines[0].Seq);
 
     /*
      * For coverage, exercise different paths depending on the return value
      */
     UT_SetForceFail(UT_KEY(OCS_vsnprintf), -1);
-    OS_printf("UnitTest6");
+    OS_printf("UnitTest8");
 
     UT_SetForceFail(UT_KEY(OCS_vsnprintf), OS_BUFFER_SIZE+10);
-    OS_printf("UnitTest7");
+    OS_printf("UnitTest9");
+}
+
+void Test_OS_ConsoleSetup(void)
+{
+    /*
+     * Test Case For:
+     * void OS_ConsoleSetup(OS_console_internal_record_t *console, char *Buffer,
+     *         OS_console_line_t *Lines, uint32 LineSize, uint32 LineCount)
+     */
+    OS_console_internal_record_t *console = &OS_console_table[0];
+
+    OS_ConsoleSetup(console, TestConsoleBuffer, TestConsoleLines, TEST_LINE_SIZE, TEST_LINE_COUNT);
+
+    UtAssert_True(console->BufSize == sizeof(TestConsoleBuffer), "BufSize (%lu) == %lu",
+            (unsigned long)console->BufSize, (unsigned long)sizeof(TestConsoleBuffer));
+    UtAssert_True(console->SeqLimit > 0 && (console->SeqLimit % TEST_LINE_COUNT) == 0,
+            "SeqLimit (%lu) is a multiple of the line count", (unsigned long)console->SeqLimit);
+    UtAssert_True(TestConsoleLines[0].Seq == 0 && TestConsoleLines[1].Seq == 1, "Lines marked free");
+}
+
+void Test_OS_ConsoleWrite_Wrap(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_ConsoleWrite(uint32 console_id, const char *Str)
+     * across the wrap of the line positions
+     */
+    OS_console_internal_record_t *console = &OS_console_table[0];
+    int32 actual;
+
+    console->SeqLimit = 4;
+    console->WritePos = 3;
+    console->ReadPos = 3;
+    TestConsoleLines[0].Seq = 2;
+    TestConsoleLines[1].Seq = 3;
+
+    /* position 3 is slot 1, and is published as position 0 */
+    actual = OS_ConsoleWrite(0, "wrap");
+    UtAssert_True(actual == OS_SUCCESS, "OS_ConsoleWrite() (%ld) == OS_SUCCESS", (long)actual);
+    UtAssert_True(console->WritePos == 0, "WritePos (%lu) == 0", (unsigned long)console->WritePos);
+    UtAssert_True(TestConsoleLines[1].Seq == 0, "Line 1 Seq (%lu) == 0", (unsigned long)TestConsoleLines[1].Seq);
+
+    /* position 0 is slot 0, which still holds the line from position 2 */
+    actual = OS_ConsoleWrite(0, "full");
+    UtAssert_True(actual == OS_QUEUE_FULL, "OS_ConsoleWrite() (%ld) == OS_QUEUE_FULL", (long)actual);
+
+    /* once the reader frees slot 0 for position 0, the line fits */
+    TestConsoleLines[0].Seq = 0;
+    actual = OS_ConsoleWrite(0, "next");
+    UtAssert_True(actual == OS_SUCCESS, "OS_ConsoleWrite() (%ld) == OS_SUCCESS", (long)actual);
+    UtAssert_True(console->WritePos == 1, "WritePos (%lu) == 1", (unsigned long)console->WritePos);
+}
+
+void Test_OS_printf_GetStats(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_printf_GetStats(OS_printf_stats_t *stats)
+     */
+    OS_printf_stats_t stats;
+    int32 actual;
+
+    OS_console_table[0].LinesWritten = 5;
+    OS_console_table[0].OverflowEvents = 2;
+    OS_console_table[0].OutputBatches = 3;
+    OS_console_table[0].MaxBatch = 4;
+
+    actual = OS_printf_GetStats(&stats);
+    UtAssert_True(actual == OS_SUCCESS, "OS_printf_GetStats() (%ld) == OS_SUCCESS", (long)actual);
+    UtAssert_True(stats.lines_written == 5 && stats.lines_dropped == 2 &&
+            stats.output_batches == 3 && stats.max_batch == 4 && stats.ring_depth == TEST_LINE_COUNT,
+            "OS_printf_GetStats() reports the console counters");
+
+    actual = OS_printf_GetStats(NULL);
+    UtAssert_True(actual == OS_INVALID_POINTER, "OS_printf_GetStats(NULL) (%ld) == OS_INVALID_POINTER", (long)actual);
+
+    UT_SetForceFail(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    actual = OS_printf_GetStats(&stats);
+    UtAssert_True(actual == OS_ERR_INVALID_ID, "OS_printf_GetStats() (%ld) == OS_ERR_INVALID_ID", (long)actual);
 }
 
 /* Osapi_Test_Setup
@@ -108,8 +216,7 @@ void Osapi_Test_Setup(void)
     UT_ResetState(0);
     memset(OS_console_table, 0, sizeof(OS_console_table));
     memset(&OS_SharedGlobalVars, 0, sizeof(OS_SharedGlobalVars));
-    OS_console_table[0].BufBase = TestConsoleBuffer;
-    OS_console_table[0].BufSize = sizeof(TestConsoleBuffer);
+    OS_ConsoleSetup(&OS_console_table[0], TestConsoleBuffer, TestConsoleLines, TEST_LINE_SIZE, TEST_LINE_COUNT);
 }
 
 /*
@@ -130,6 +237,9 @@ void UtTest_Setup(void)
 {
     ADD_TEST(OS_ConsoleAPI_Init);
     ADD_TEST(OS_printf);
+    ADD_TEST(OS_ConsoleSetup);
+    ADD_TEST(OS_ConsoleWrite_Wrap);
+    ADD_TEST(OS_printf_GetStats);
 }
 
 
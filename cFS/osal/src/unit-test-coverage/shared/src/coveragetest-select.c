@@ -119,6 +119,23 @@ void Test_OS_SelectFdAddClearOps(void)
     UT_ClearForceFail(UT_KEY(OS_ObjectIdToArrayIndex));
     UtAssert_True(OS_SelectFdIsSet(&UtSet, 1), "OS_SelectFdIsSet(1) == true");
     UtAssert_True(!OS_SelectFdIsSet(&UtSet, 2), "OS_SelectFdIsSet(2) == false");
+
+    /* queue IDs are held apart from stream IDs with the same index */
+    expected = OS_SUCCESS;
+    UT_SetForceFail(UT_KEY(OS_IdentifyObject), OS_OBJECT_TYPE_OS_QUEUE);
+    actual = OS_SelectFdAdd(&UtSet, 2);
+    UtAssert_True(actual == expected, "OS_SelectFdAdd(queue) (%ld) == %ld", (long)actual, (long)expected);
+    UtAssert_True(OS_SelectFdIsSet(&UtSet, 2), "OS_SelectFdIsSet(queue 2) == true");
+    UtAssert_True(!OS_SelectFdIsSet(&UtSet, 1), "OS_SelectFdIsSet(queue 1) == false");
+
+    UT_ClearForceFail(UT_KEY(OS_IdentifyObject));
+    UtAssert_True(OS_SelectFdIsSet(&UtSet, 1), "OS_SelectFdIsSet(1) == true");
+    UtAssert_True(!OS_SelectFdIsSet(&UtSet, 2), "OS_SelectFdIsSet(2) == false");
+
+    UT_SetForceFail(UT_KEY(OS_IdentifyObject), OS_OBJECT_TYPE_OS_QUEUE);
+    actual = OS_SelectFdClear(&UtSet, 2);
+    UtAssert_True(actual == expected, "OS_SelectFdClear(queue) (%ld) == %ld", (long)actual, (long)expected);
+    UtAssert_True(!OS_SelectFdIsSet(&UtSet, 2), "OS_SelectFdIsSet(queue 2) == false");
 }
 
 /* Osapi_Test_Setup
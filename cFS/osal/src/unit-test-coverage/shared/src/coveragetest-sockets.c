@@ -295,6 +295,72 @@ void Test_OS_SocketRecvFrom(void)
     UtAssert_True(actual == expected, "OS_SocketRecvFrom() non-bound (%ld) == OS_ERR_INCORRECT_OBJ_STATE", (long)actual);
 }
 
+/*****************************************************************************
+ *
+ * Test case for OS_SocketRecvFromMulti()
+ *
+ *****************************************************************************/
+void Test_OS_SocketRecvFromMulti(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_SocketRecvFromMulti(uint32 sock_id, OS_SockRecvMsg_t *msgs, uint32 count, int32 timeout)
+     */
+    char Buf[2];
+    OS_SockRecvMsg_t Msgs[2];
+    int32 expected;
+    int32 actual;
+    uint32 idbuf;
+
+    memset(Msgs, 0, sizeof(Msgs));
+    Msgs[0].buffer = &Buf[0];
+    Msgs[0].buflen = 1;
+    Msgs[1].buffer = &Buf[1];
+    Msgs[1].buflen = 1;
+
+    idbuf = 1;
+    UT_SetDataBuffer(UT_KEY(OS_ObjectIdGetById),&idbuf, sizeof(idbuf), false);
+    OS_stream_table[idbuf].socket_type = OS_SocketType_DATAGRAM;
+    OS_stream_table[idbuf].stream_state = OS_STREAM_STATE_BOUND;
+    UT_SetForceFail(UT_KEY(OS_SocketRecvFromMulti_Impl), 2);
+    expected = 2;
+    actual = OS_SocketRecvFromMulti(1, Msgs, 2, 0);
+    UtAssert_True(actual == expected, "OS_SocketRecvFromMulti() (%ld) == 2", (long)actual);
+    UT_ClearForceFail(UT_KEY(OS_SocketRecvFromMulti_Impl));
+
+    expected = OS_INVALID_POINTER;
+    actual = OS_SocketRecvFromMulti(1, NULL, 2, 0);
+    UtAssert_True(actual == expected, "OS_SocketRecvFromMulti(NULL) (%ld) == OS_INVALID_POINTER", (long)actual);
+    actual = OS_SocketRecvFromMulti(1, Msgs, 0, 0);
+    UtAssert_True(actual == expected, "OS_SocketRecvFromMulti(count=0) (%ld) == OS_INVALID_POINTER", (long)actual);
+    Msgs[1].buflen = 0;
+    actual = OS_SocketRecvFromMulti(1, Msgs, 2, 0);
+    UtAssert_True(actual == expected, "OS_SocketRecvFromMulti(buflen=0) (%ld) == OS_INVALID_POINTER", (long)actual);
+    Msgs[1].buflen = 1;
+    Msgs[1].buffer = NULL;
+    actual = OS_SocketRecvFromMulti(1, Msgs, 2, 0);
+    UtAssert_True(actual == expected, "OS_SocketRecvFromMulti(buffer=NULL) (%ld) == OS_INVALID_POINTER", (long)actual);
+    Msgs[1].buffer = &Buf[1];
+
+    /*
+     * Should fail if not a datagram socket
+     */
+    OS_stream_table[1].socket_type = OS_SocketType_INVALID;
+    expected = OS_ERR_INCORRECT_OBJ_TYPE;
+    actual = OS_SocketRecvFromMulti(1, Msgs, 2, 0);
+    UtAssert_True(actual == expected, "OS_SocketRecvFromMulti() non-datagram (%ld) == OS_ERR_INCORRECT_OBJ_TYPE", (long)actual);
+
+    /*
+     * Should fail if not bound
+     */
+    OS_stream_table[1].socket_type = OS_SocketType_DATAGRAM;
+    OS_stream_table[1].stream_state = 0;
+    expected = OS_ERR_INCORRECT_OBJ_STATE;
+    actual = OS_SocketRecvFromMulti(1, Msgs, 2, 0);
+    UtAssert_True(actual == expected, "OS_SocketRecvFromMulti() non-bound (%ld) == OS_ERR_INCORRECT_OBJ_STATE", (long)actual);
+}
+
+
 /*****************************************************************************
  *
  * Test case for OS_SocketSendTo()
@@ -335,6 +401,71 @@ void Test_OS_SocketSendTo(void)
 }
 
 
+/*****************************************************************************
+ *
+ * Test case for OS_SocketSendToMulti()
+ *
+ *****************************************************************************/
+void Test_OS_SocketSendToMulti(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_SocketSendToMulti(uint32 sock_id, const OS_SockSendMsg_t *msgs, uint32 count, const OS_SockAddr_t *RemoteAddr)
+     */
+    char Buf[2] = { 'A', 'B' };
+    OS_SockSendMsg_t Msgs[2];
+    int32 expected;
+    int32 actual;
+    OS_SockAddr_t Addr;
+    uint32 idbuf;
+
+    memset(&Addr,0,sizeof(Addr));
+    Msgs[0].buffer = &Buf[0];
+    Msgs[0].buflen = 1;
+    Msgs[1].buffer = &Buf[1];
+    Msgs[1].buflen = 1;
+
+    idbuf = 1;
+    UT_SetDataBuffer(UT_KEY(OS_ObjectIdGetById),&idbuf, sizeof(idbuf), false);
+    OS_stream_table[idbuf].socket_type = OS_SocketType_DATAGRAM;
+    UT_SetForceFail(UT_KEY(OS_SocketSendToMulti_Impl), 2);
+    expected = 2;
+    actual = OS_SocketSendToMulti(1, Msgs, 2, &Addr);
+    UtAssert_True(actual == expected, "OS_SocketSendToMulti() (%ld) == 2", (long)actual);
+    UtAssert_True(UT_GetStubCount(UT_KEY(OS_SocketSendToMulti_Impl)) == 1, "OS_SocketSendToMulti_Impl() called once");
+    UT_ClearForceFail(UT_KEY(OS_SocketSendToMulti_Impl));
+
+    expected = OS_INVALID_POINTER;
+    actual = OS_SocketSendToMulti(1, NULL, 2, &Addr);
+    UtAssert_True(actual == expected, "OS_SocketSendToMulti(NULL) (%ld) == OS_INVALID_POINTER", (long)actual);
+    actual = OS_SocketSendToMulti(1, Msgs, 0, &Addr);
+    UtAssert_True(actual == expected, "OS_SocketSendToMulti(count=0) (%ld) == OS_INVALID_POINTER", (long)actual);
+    actual = OS_SocketSendToMulti(1, Msgs, 2, NULL);
+    UtAssert_True(actual == expected, "OS_SocketSendToMulti(Addr=NULL) (%ld) == OS_INVALID_POINTER", (long)actual);
+    Msgs[1].buflen = 0;
+    actual = OS_SocketSendToMulti(1, Msgs, 2, &Addr);
+    UtAssert_True(actual == expected, "OS_SocketSendToMulti(buflen=0) (%ld) == OS_INVALID_POINTER", (long)actual);
+    Msgs[1].buflen = 1;
+    Msgs[1].buffer = NULL;
+    actual = OS_SocketSendToMulti(1, Msgs, 2, &Addr);
+    UtAssert_True(actual == expected, "OS_SocketSendToMulti(buffer=NULL) (%ld) == OS_INVALID_POINTER", (long)actual);
+    Msgs[1].buffer = &Buf[1];
+
+    /*
+     * Should fail if not a datagram socket
+     */
+    OS_stream_table[1].socket_type = OS_SocketType_INVALID;
+    expected = OS_ERR_INCORRECT_OBJ_TYPE;
+    actual = OS_SocketSendToMulti(1, Msgs, 2, &Addr);
+    UtAssert_True(actual == expected, "OS_SocketSendToMulti() non-datagram (%ld) == OS_ERR_INCORRECT_OBJ_TYPE", (long)actual);
+
+    UT_SetForceFail(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    expected = OS_ERR_INVALID_ID;
+    actual = OS_SocketSendToMulti(1, Msgs, 2, &Addr);
+    UtAssert_True(actual == expected, "OS_SocketSendToMulti() bad id (%ld) == OS_ERR_INVALID_ID", (long)actual);
+}
+
+
 /*****************************************************************************
  *
  * Test case for OS_SocketGetIdByName()
@@ -492,7 +623,9 @@ void UtTest_Setup(void)
     ADD_TEST(OS_SocketAccept);
     ADD_TEST(OS_SocketConnect);
     ADD_TEST(OS_SocketRecvFrom);
+    ADD_TEST(OS_SocketRecvFromMulti);
     ADD_TEST(OS_SocketSendTo);
+    ADD_TEST(OS_SocketSendToMulti);
     ADD_TEST(OS_SocketGetIdByName);
     ADD_TEST(OS_SocketGetInfo);
     ADD_TEST(OS_CreateSocketName);
@@ -36,6 +36,15 @@ static void UT_TestHook(void)
     ++UT_TestHook_Count;
 }
 
+static uint32 UT_StatsUnlockCount = 0;
+
+static int32 UT_TaskGetStatsHook(void *UserObj, int32 StubRetcode, uint32 CallCount, const UT_StubContext_t *Context)
+{
+    /* records whether the global lock was already released */
+    UT_StatsUnlockCount = UT_GetStubCount(UT_KEY(OS_Unlock_Global));
+    return StubRetcode;
+}
+
 /*
 **********************************************************************************
 **          INTERNAL API TEST CASES
@@ -125,6 +134,37 @@ void Test_OS_TaskCreate(void)
     OSAPI_TEST_FUNCTION_RC(OS_TaskCreate(&objid, "UT", UT_TestHook, NULL, 128, 0,0), OS_ERR_NAME_TOO_LONG);
 }
 
+void Test_OS_TaskCreateWithAffinity(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_TaskCreateWithAffinity (uint32 *task_id, const char *task_name, osal_task_entry function_pointer,
+     *                uint32 *stack_pointer, uint32 stack_size, uint32 priority, uint32 flags, uint32 cpu_affinity)
+     */
+    int32 expected = OS_SUCCESS;
+    uint32 objid = 0xFFFFFFFF;
+    uint32 local_index = 1;
+    int32 actual;
+
+    UT_SetDataBuffer(UT_KEY(OS_ObjectIdAllocateNew), &local_index, sizeof(local_index), false);
+    actual = OS_TaskCreateWithAffinity(&objid, "UT", UT_TestHook, NULL, 128, 0, 0, 0x6);
+
+    UtAssert_True(actual == expected, "OS_TaskCreateWithAffinity() (%ld) == OS_SUCCESS", (long)actual);
+    UtAssert_True(objid != 0, "objid (%lu) != 0", (unsigned long)objid);
+    UtAssert_True(OS_task_table[1].cpu_affinity == 0x6, "cpu_affinity (0x%lx) == 0x6",
+            (unsigned long)OS_task_table[1].cpu_affinity);
+
+    /* the plain create places no restriction on the task */
+    UT_SetDataBuffer(UT_KEY(OS_ObjectIdAllocateNew), &local_index, sizeof(local_index), false);
+    actual = OS_TaskCreate(&objid, "UT", UT_TestHook, NULL, 128, 0, 0);
+    UtAssert_True(actual == expected, "OS_TaskCreate() (%ld) == OS_SUCCESS", (long)actual);
+    UtAssert_True(OS_task_table[1].cpu_affinity == OS_TASK_CPU_AFFINITY_ANY,
+            "cpu_affinity (0x%lx) == OS_TASK_CPU_AFFINITY_ANY",
+            (unsigned long)OS_task_table[1].cpu_affinity);
+
+    OSAPI_TEST_FUNCTION_RC(OS_TaskCreateWithAffinity(NULL, NULL, NULL, NULL, 0, 0, 0, 0x1), OS_INVALID_POINTER);
+}
+
 void Test_OS_TaskDelete(void)
 {
     /*
@@ -261,8 +301,11 @@ void Test_OS_TaskGetInfo(void)
     utrec.name_entry = "ABC";
     OS_task_table[1].stack_size = 222;
     OS_task_table[1].priority = 333;
+    OS_task_table[1].cpu_affinity = 0x5;
     UT_SetDataBuffer(UT_KEY(OS_ObjectIdGetById), &local_index, sizeof(local_index), false);
     UT_SetDataBuffer(UT_KEY(OS_ObjectIdGetById), &rptr, sizeof(rptr), false);
+    UT_SetHookFunction(UT_KEY(OS_TaskGetStats_Impl), UT_TaskGetStatsHook, NULL);
+    UT_StatsUnlockCount = 0;
     actual = OS_TaskGetInfo(1, &task_prop);
 
     UtAssert_True(actual == expected, "OS_TaskGetInfo() (%ld) == OS_SUCCESS", (long)actual);
@@ -274,9 +317,16 @@ void Test_OS_TaskGetInfo(void)
             (unsigned long)task_prop.stack_size);
     UtAssert_True(task_prop.priority == 333, "task_prop.priority (%lu) == 333",
             (unsigned long)task_prop.priority);
+    UtAssert_True(task_prop.cpu_affinity == 0x5, "task_prop.cpu_affinity (0x%lx) == 0x5",
+            (unsigned long)task_prop.cpu_affinity);
+    UtAssert_True(task_prop.current_cpu == OS_TASK_CPU_UNKNOWN, "task_prop.current_cpu (%lu) == OS_TASK_CPU_UNKNOWN",
+            (unsigned long)task_prop.current_cpu);
+    UtAssert_True(UT_GetStubCount(UT_KEY(OS_TaskGetStats_Impl)) == 1, "OS_TaskGetStats_Impl() called");
+    UtAssert_True(UT_StatsUnlockCount == 1, "OS_TaskGetStats_Impl() called after OS_Unlock_Global()");
 
     OS_task_table[1].stack_size = 0;
     OS_task_table[1].priority = 0;
+    OS_task_table[1].cpu_affinity = 0;
 
     OSAPI_TEST_FUNCTION_RC(OS_TaskGetInfo(0, NULL), OS_INVALID_POINTER);
 }
@@ -376,6 +426,7 @@ void UtTest_Setup(void)
     ADD_TEST(OS_TaskAPI_Init);
     ADD_TEST(OS_TaskEntryPoint);
     ADD_TEST(OS_TaskCreate);
+    ADD_TEST(OS_TaskCreateWithAffinity);
     ADD_TEST(OS_TaskDelete);
     ADD_TEST(OS_TaskExit);
     ADD_TEST(OS_TaskDelay);
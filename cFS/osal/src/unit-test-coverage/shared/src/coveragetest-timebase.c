@@ -262,9 +262,23 @@ void Test_OS_TimeBase_CallbackThread(void)
     memset(&fake_record, 0, sizeof(fake_record));
     fake_record.active_id = 2;
 
+    memset(OS_timebase_table, 0, sizeof(OS_timebase_table));
+    memset(OS_timecb_table, 0, sizeof(OS_timecb_table));
     OS_timebase_table[2].external_sync = UT_TimerSync;
-    OS_timecb_table[0].wait_time = 2000;
+
+    /* a one-shot timer, and two periodic timers, one faster than the time base */
+    OS_timecb_table[0].expiry_time = 2000;
     OS_timecb_table[0].callback_ptr = UT_TimeCB;
+    OS_TimeBase_ArmTimer(2, 0);
+    OS_timecb_table[1].expiry_time = 1500;
+    OS_timecb_table[1].interval_time = 1000;
+    OS_timecb_table[1].callback_ptr = UT_TimeCB;
+    OS_TimeBase_ArmTimer(2, 1);
+    OS_timecb_table[2].expiry_time = 1000;
+    OS_timecb_table[2].interval_time = 100;
+    OS_timecb_table[2].callback_ptr = UT_TimeCB;
+    OS_TimeBase_ArmTimer(2, 2);
+
     TimerSyncCount = 0;
     TimerSyncRetVal = 0;
     TimeCB = 0;
@@ -286,14 +300,103 @@ void Test_OS_TimeBase_CallbackThread(void)
     UT_SetHookFunction(UT_KEY(OS_TimeBaseLock_Impl), ClearObjectsHook, recptr);
     OS_TimeBase_CallbackThread(2);
 
-    /* Check that the TimeCB function was called */
-    UtAssert_True(TimeCB > 0, "TimeCB (%lu) > 0", (unsigned long)TimeCB);
+    /*
+     * Ten ticks of 1000 were processed:
+     *  - the one-shot timer expires once, at 2000, and is disarmed
+     *  - the 1000 interval timer expires on every tick from 2000, 500 late
+     *  - the 100 interval timer expires at 1000, then falls 900 behind on every
+     *    later tick, is reset to one interval behind and catches up with 3 callbacks
+     */
+    UtAssert_True(TimeCB == 38, "TimeCB (%lu) == 38", (unsigned long)TimeCB);
+    UtAssert_True(OS_timebase_table[2].callback_count == 38, "callback_count (%lu) == 38",
+            (unsigned long)OS_timebase_table[2].callback_count);
+    UtAssert_True(OS_timebase_table[2].overrun_count == 9, "overrun_count (%lu) == 9",
+            (unsigned long)OS_timebase_table[2].overrun_count);
+    UtAssert_True(OS_timecb_table[2].backlog_resets == 9, "backlog_resets (%lu) == 9",
+            (unsigned long)OS_timecb_table[2].backlog_resets);
+    UtAssert_True(OS_timebase_table[2].max_callback_latency == 900, "max_callback_latency (%lu) == 900",
+            (unsigned long)OS_timebase_table[2].max_callback_latency);
+    UtAssert_True(OS_timecb_table[0].heap_index == 0, "one-shot timer disarmed");
+    UtAssert_True(OS_timebase_table[2].timer_count == 2, "timer_count (%lu) == 2",
+            (unsigned long)OS_timebase_table[2].timer_count);
 
 
     UT_SetForceFail(UT_KEY(OS_ObjectIdGetById), OS_ERROR);
     OS_TimeBase_CallbackThread(2);
 }
 
+void Test_OS_TimeBase_ArmTimer(void)
+{
+    /*
+     * Test Case For:
+     * void OS_TimeBase_ArmTimer(uint32 timebase_id, uint32 timecb_id)
+     * void OS_TimeBase_DisarmTimer(uint32 timebase_id, uint32 timecb_id)
+     */
+    static const uint32 expiry[10] = { 700, 300, 900, 100, 500, 800, 200, 1000, 400, 600 };
+    OS_timebase_internal_record_t *timebase;
+    uint32 i;
+    uint32 heap_ok;
+    uint32 saved_index;
+
+    memset(OS_timebase_table, 0, sizeof(OS_timebase_table));
+    memset(OS_timecb_table, 0, sizeof(OS_timecb_table));
+    timebase = &OS_timebase_table[1];
+
+    /* expiry times straddle the wrap point of the free run counter */
+    for (i = 0; i < OS_MAX_TIMERS; ++i)
+    {
+        OS_timecb_table[i].expiry_time = expiry[i % 10] - 500;
+        OS_TimeBase_ArmTimer(1, i);
+    }
+
+    UtAssert_True(timebase->timer_count == OS_MAX_TIMERS, "timer_count (%lu) == OS_MAX_TIMERS",
+            (unsigned long)timebase->timer_count);
+    UtAssert_True(OS_timecb_table[timebase->timer_heap[0]].expiry_time == (uint32)(100 - 500),
+            "earliest timer at root");
+
+    /* a full heap cannot take another timer */
+    saved_index = OS_timecb_table[OS_MAX_TIMERS - 1].heap_index;
+    OS_timecb_table[OS_MAX_TIMERS - 1].heap_index = 0;
+    OS_TimeBase_ArmTimer(1, OS_MAX_TIMERS - 1);
+    UtAssert_True(timebase->timer_count == OS_MAX_TIMERS, "timer_count unchanged when full");
+    OS_timecb_table[OS_MAX_TIMERS - 1].heap_index = saved_index;
+
+    /* re-arming an armed timer moves it */
+    OS_timecb_table[0].expiry_time = 50 - 500;
+    OS_TimeBase_ArmTimer(1, 0);
+    UtAssert_True(timebase->timer_heap[0] == 0, "re-armed timer moved to root");
+    UtAssert_True(timebase->timer_count == OS_MAX_TIMERS, "timer_count unchanged when re-armed");
+
+    /* remove the root and a timer in the middle */
+    OS_TimeBase_DisarmTimer(1, 0);
+    OS_TimeBase_DisarmTimer(1, 4);
+    OS_TimeBase_DisarmTimer(1, 4);
+    UtAssert_True(timebase->timer_count == OS_MAX_TIMERS - 2, "timer_count (%lu) == OS_MAX_TIMERS - 2",
+            (unsigned long)timebase->timer_count);
+
+    heap_ok = 1;
+    for (i = 1; i < timebase->timer_count; ++i)
+    {
+        if ((int32)(OS_timecb_table[timebase->timer_heap[i]].expiry_time -
+                OS_timecb_table[timebase->timer_heap[(i - 1) / 2]].expiry_time) < 0)
+        {
+            heap_ok = 0;
+        }
+        if (OS_timecb_table[timebase->timer_heap[i]].heap_index != (i + 1))
+        {
+            heap_ok = 0;
+        }
+    }
+    UtAssert_True(heap_ok, "heap order and positions consistent after disarm");
+    UtAssert_True(OS_timecb_table[timebase->timer_heap[0]].expiry_time == (uint32)(100 - 500),
+            "earliest remaining timer at root");
+
+    /* removing the last timer in the heap */
+    i = timebase->timer_heap[timebase->timer_count - 1];
+    OS_TimeBase_DisarmTimer(1, i);
+    UtAssert_True(OS_timecb_table[i].heap_index == 0, "last timer disarmed");
+}
+
 void Test_OS_Tick2Micros(void)
 {
     /*
@@ -355,6 +458,7 @@ void UtTest_Setup(void)
     ADD_TEST(OS_TimeBaseGetInfo);
     ADD_TEST(OS_TimeBaseGetFreeRun);
     ADD_TEST(OS_TimeBase_CallbackThread);
+    ADD_TEST(OS_TimeBase_ArmTimer);
     ADD_TEST(OS_Tick2Micros);
     ADD_TEST(OS_Milli2Ticks);
 }
@@ -54,6 +54,12 @@
 #define OCS_OS_BSP_CONSOLEMODE_BLUE      0x2108
 #define OCS_OS_BSP_CONSOLEMODE_HIGHLIGHT 0x2110
 
+typedef struct
+{
+    const char *Str;
+    uint32_t    DataLen;
+} OCS_OS_BSP_ConsoleVec_t;
+
 /********************************************************************/
 /* INTERNAL BSP IMPLEMENTATION FUNCTIONS                            */
 /********************************************************************/
@@ -73,6 +79,13 @@
  ------------------------------------------------------------------*/
 extern void OCS_OS_BSP_ConsoleOutput_Impl(const char *Str, uint32_t DataLen);
 
+/*----------------------------------------------------------------
+   Function: OS_BSP_ConsoleOutputVec_Impl
+
+    Purpose: Low level raw console data output of several pieces at once.
+ ------------------------------------------------------------------*/
+extern void OCS_OS_BSP_ConsoleOutputVec_Impl(const OCS_OS_BSP_ConsoleVec_t *Vec, uint32_t NumVec);
+
 /*----------------------------------------------------------------
    Function: OS_BSP_ConsoleSetMode_Impl
 
@@ -36,7 +36,9 @@
 #define OS_BSP_CONSOLEMODE_BLUE      OCS_OS_BSP_CONSOLEMODE_BLUE
 #define OS_BSP_CONSOLEMODE_HIGHLIGHT OCS_OS_BSP_CONSOLEMODE_HIGHLIGHT
 
+#define OS_BSP_ConsoleVec_t        OCS_OS_BSP_ConsoleVec_t
 #define OS_BSP_ConsoleOutput_Impl  OCS_OS_BSP_ConsoleOutput_Impl
+#define OS_BSP_ConsoleOutputVec_Impl OCS_OS_BSP_ConsoleOutputVec_Impl
 #define OS_BSP_ConsoleSetMode_Impl OCS_OS_BSP_ConsoleSetMode_Impl
 
 /*********************
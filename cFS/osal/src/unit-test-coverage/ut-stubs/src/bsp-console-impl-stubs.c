@@ -53,6 +53,26 @@ void OCS_OS_BSP_ConsoleOutput_Impl(const char *Str, uint32_t DataLen)
     }
 }
 
+/*----------------------------------------------------------------
+   Function: OS_BSP_ConsoleOutputVec_Impl
+
+    Purpose: Low level raw console data output of several pieces at once.
+ ------------------------------------------------------------------*/
+void OCS_OS_BSP_ConsoleOutputVec_Impl(const OCS_OS_BSP_ConsoleVec_t *Vec, uint32_t NumVec)
+{
+    int32_t retcode = UT_DEFAULT_IMPL(OCS_OS_BSP_ConsoleOutputVec_Impl);
+
+    if (retcode == 0)
+    {
+        while (NumVec > 0)
+        {
+            UT_Stub_CopyFromLocal(UT_KEY(OCS_OS_BSP_ConsoleOutputVec_Impl), Vec->Str, Vec->DataLen);
+            ++Vec;
+            --NumVec;
+        }
+    }
+}
+
 /*----------------------------------------------------------------
    Function: OS_BSP_ConsoleSetMode_Impl
 
@@ -46,6 +46,8 @@ UT_DEFAULT_STUB(OS_FileRemove_Impl,(const char *local_path))
 UT_DEFAULT_STUB(OS_FileRename_Impl,(const char *old_path, const char *new_path))
 UT_DEFAULT_STUB(OS_FileChmod_Impl, (const char *local_path, uint32 access))
 UT_DEFAULT_STUB(OS_ShellOutputToFile_Impl,(uint32 file_id, const char* Cmd))
+UT_DEFAULT_STUB(OS_FileMap_Impl,(uint32 file_id, uint32 offset, uint32 length, void **addr))
+UT_DEFAULT_STUB(OS_FileUnmap_Impl,(void *addr, uint32 length))
 
 /*
  * Directory API abstraction layer
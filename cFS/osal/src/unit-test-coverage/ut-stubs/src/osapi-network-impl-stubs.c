@@ -43,7 +43,9 @@ UT_DEFAULT_STUB(OS_SocketBind_Impl,(uint32 sock_id, const OS_SockAddr_t *Addr))
 UT_DEFAULT_STUB(OS_SocketAccept_Impl,(uint32 sock_id, uint32 connsock_id, OS_SockAddr_t *Addr, int32 timeout))
 UT_DEFAULT_STUB(OS_SocketConnect_Impl,(uint32 sock_id, const OS_SockAddr_t *Addr, int32 timeout))
 UT_DEFAULT_STUB(OS_SocketRecvFrom_Impl,(uint32 sock_id, void *buffer, uint32 buflen, OS_SockAddr_t *RemoteAddr, int32 timeout))
+UT_DEFAULT_STUB(OS_SocketRecvFromMulti_Impl,(uint32 sock_id, OS_SockRecvMsg_t *msgs, uint32 count, int32 timeout))
 UT_DEFAULT_STUB(OS_SocketSendTo_Impl,(uint32 sock_id, const void *buffer, uint32 buflen, const OS_SockAddr_t *RemoteAddr))
+UT_DEFAULT_STUB(OS_SocketSendToMulti_Impl,(uint32 sock_id, const OS_SockSendMsg_t *msgs, uint32 count, const OS_SockAddr_t *RemoteAddr))
 UT_DEFAULT_STUB(OS_SocketGetInfo_Impl,(uint32 sock_id, OS_socket_prop_t *sock_prop))
 
 UT_DEFAULT_STUB(OS_SocketAddrInit_Impl,(OS_SockAddr_t *Addr, OS_SocketDomain_t Domain))
@@ -53,6 +53,14 @@ uint32 OS_TaskGetId_Impl            (void)
     return UT_DEFAULT_IMPL(OS_TaskGetId_Impl);
 }
 UT_DEFAULT_STUB(OS_TaskGetInfo_Impl,(uint32 task_id, OS_task_prop_t *task_prop))
+uint32 OS_TaskGetStatsRef_Impl      (uint32 task_id)
+{
+    return UT_DEFAULT_IMPL(OS_TaskGetStatsRef_Impl);
+}
+void OS_TaskGetStats_Impl           (uint32 stats_ref, OS_task_prop_t *task_prop)
+{
+    UT_DEFAULT_IMPL(OS_TaskGetStats_Impl);
+}
 UT_DEFAULT_STUB(OS_TaskRegister_Impl,(uint32 global_task_id))
 
 bool OS_TaskIdMatchSystemData_Impl(void *ref, uint32 local_id, const OS_common_record_t *obj)
@@ -44,6 +44,19 @@ void Test_OS_VxWorks_StreamAPI_Impl_Init(void)
     OSAPI_TEST_FUNCTION_RC(UT_Call_OS_VxWorks_StreamAPI_Impl_Init(), OS_SUCCESS);
 }
 
+void Test_OS_FileMap_Impl(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_FileMap_Impl(uint32 local_id, uint32 offset, uint32 length, void **addr)
+     * int32 OS_FileUnmap_Impl(void *addr, uint32 length)
+     */
+    void *addr = NULL;
+
+    OSAPI_TEST_FUNCTION_RC(OS_FileMap_Impl(0, 0, 4, &addr), OS_ERR_NOT_IMPLEMENTED);
+    OSAPI_TEST_FUNCTION_RC(OS_FileUnmap_Impl(&addr, 4), OS_ERR_NOT_IMPLEMENTED);
+}
+
 
 /* ------------------- End of test cases --------------------------------------*/
 
@@ -76,6 +89,7 @@ void Osapi_Test_Teardown(void)
 void UtTest_Setup(void)
 {
     ADD_TEST(OS_VxWorks_StreamAPI_Impl_Init);
+    ADD_TEST(OS_FileMap_Impl);
 }
 
 
@@ -195,6 +195,28 @@ void Test_OS_TaskGetInfo_Impl(void)
     OSAPI_TEST_FUNCTION_RC(OS_TaskGetInfo_Impl(0,&task_prop), OS_SUCCESS);
 }
 
+void Test_OS_TaskGetStatsRef_Impl(void)
+{
+    /*
+     * Test Case For:
+     * uint32 OS_TaskGetStatsRef_Impl (uint32 task_id)
+     */
+    OSAPI_TEST_FUNCTION_RC(OS_TaskGetStatsRef_Impl(0), 0);
+}
+
+void Test_OS_TaskGetStats_Impl(void)
+{
+    /*
+     * Test Case For:
+     * void OS_TaskGetStats_Impl (uint32 stats_ref, OS_task_prop_t *task_prop)
+     */
+    OS_task_prop_t task_prop;
+    memset(&task_prop, 0, sizeof(task_prop));
+    OS_TaskGetStats_Impl(0, &task_prop);
+    UtAssert_True(task_prop.migrations == 0, "task_prop.migrations (%lu) == 0",
+            (unsigned long)task_prop.migrations);
+}
+
 void Test_OS_TaskValidateSystemData_Impl(void)
 {
     /*
@@ -273,6 +295,8 @@ void UtTest_Setup(void)
     ADD_TEST(OS_TaskRegister_Impl);
     ADD_TEST(OS_TaskGetId_Impl);
     ADD_TEST(OS_TaskGetInfo_Impl);
+    ADD_TEST(OS_TaskGetStatsRef_Impl);
+    ADD_TEST(OS_TaskGetStats_Impl);
     ADD_TEST(OS_TaskValidateSystemData_Impl);
     ADD_TEST(OS_TaskIdMatchSystemData_Impl);
 }
@@ -311,6 +311,49 @@ int32 OS_lseek(uint32 filedes, int32 offset, uint32 whence)
     return status;
 }
 
+/*****************************************************************************
+ *
+ * Stub function for OS_FileMap()
+ *
+ *****************************************************************************/
+int32 OS_FileMap (uint32 filedes, uint32 offset, uint32 length, void **addr)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_FileMap), filedes);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_FileMap), offset);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_FileMap), length);
+    UT_Stub_RegisterContext(UT_KEY(OS_FileMap), addr);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_FileMap);
+
+    /* The user may supply the address of a buffer to serve as the mapping */
+    if (status != OS_SUCCESS ||
+            UT_Stub_CopyToLocal(UT_KEY(OS_FileMap), addr, sizeof(*addr)) < sizeof(*addr))
+    {
+        *addr = NULL;
+    }
+
+    return status;
+}
+
+/*****************************************************************************
+ *
+ * Stub function for OS_FileUnmap()
+ *
+ *****************************************************************************/
+int32 OS_FileUnmap (void *addr, uint32 length)
+{
+    UT_Stub_RegisterContext(UT_KEY(OS_FileUnmap), addr);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_FileUnmap), length);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_FileUnmap);
+
+    return status;
+}
+
 /*****************************************************************************
  *
  * Stub function for OS_remove()
@@ -323,6 +323,20 @@ int32 OS_ObjectIdRefcountDecr(OS_common_record_t *record)
     return Status;
 }
 
+/*****************************************************************************
+ *
+ * Stub function for OS_ObjectIdRefcountIncr()
+ *
+ *****************************************************************************/
+bool OS_ObjectIdRefcountIncr(uint32 idtype, uint32 reference_id, OS_common_record_t *obj)
+{
+    int32 Status;
+
+    Status = UT_DEFAULT_IMPL(OS_ObjectIdRefcountIncr);
+
+    return (Status != 0);
+}
+
 /*****************************************************************************
  *
  * Stub function for OS_ObjectIdGetNext()
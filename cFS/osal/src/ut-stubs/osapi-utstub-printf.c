@@ -121,3 +121,24 @@ void OS_printf_enable(void)
     UT_DEFAULT_IMPL(OS_printf_enable);
 }
 
+/*****************************************************************************
+ *
+ * Stub function for OS_printf_GetStats()
+ *
+ *****************************************************************************/
+int32 OS_printf_GetStats(OS_printf_stats_t *stats)
+{
+    int32 status;
+
+    UT_Stub_RegisterContext(UT_KEY(OS_printf_GetStats), stats);
+
+    status = UT_DEFAULT_IMPL(OS_printf_GetStats);
+
+    if (status == OS_SUCCESS &&
+            UT_Stub_CopyToLocal(UT_KEY(OS_printf_GetStats), stats, sizeof(*stats)) < sizeof(*stats))
+    {
+        memset(stats, 0, sizeof(*stats));
+    }
+
+    return status;
+}
@@ -155,6 +155,38 @@ int32 OS_SocketRecvFrom(uint32 sock_id, void *buffer, uint32 buflen, OS_SockAddr
     return status;
 }
 
+/*****************************************************************************
+ *
+ * Stub function for OS_SocketRecvFromMulti()
+ *
+ *****************************************************************************/
+int32 OS_SocketRecvFromMulti(uint32 sock_id, OS_SockRecvMsg_t *msgs, uint32 count, int32 timeout)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_SocketRecvFromMulti), sock_id);
+    UT_Stub_RegisterContext(UT_KEY(OS_SocketRecvFromMulti), msgs);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_SocketRecvFromMulti), count);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_SocketRecvFromMulti), timeout);
+
+    int32 status;
+    uint32 i;
+
+    status = UT_DEFAULT_IMPL(OS_SocketRecvFromMulti);
+
+    /* each message received takes its data from the test buffer, or is zero filled */
+    for (i = 0; status > 0 && i < status && i < count; ++i)
+    {
+        msgs[i].msglen = UT_Stub_CopyToLocal(UT_KEY(OS_SocketRecvFromMulti), msgs[i].buffer, msgs[i].buflen);
+        if (msgs[i].msglen == 0)
+        {
+            memset(msgs[i].buffer, 0, msgs[i].buflen);
+            msgs[i].msglen = msgs[i].buflen;
+        }
+    }
+
+    return status;
+}
+
+
 /*****************************************************************************
  *
  * Stub function for OS_SocketSendTo()
@@ -193,6 +225,26 @@ int32 OS_SocketSendTo(uint32 sock_id, const void *buffer, uint32 buflen, const O
 }
 
 
+/*****************************************************************************
+ *
+ * Stub function for OS_SocketSendToMulti()
+ *
+ *****************************************************************************/
+int32 OS_SocketSendToMulti(uint32 sock_id, const OS_SockSendMsg_t *msgs, uint32 count, const OS_SockAddr_t *RemoteAddr)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_SocketSendToMulti), sock_id);
+    UT_Stub_RegisterContext(UT_KEY(OS_SocketSendToMulti), msgs);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_SocketSendToMulti), count);
+    UT_Stub_RegisterContext(UT_KEY(OS_SocketSendToMulti), RemoteAddr);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL_RC(OS_SocketSendToMulti, count);
+
+    return status;
+}
+
+
 /*****************************************************************************
  *
  * Stub function for OS_SocketGetIdByName()
@@ -84,6 +84,48 @@ int32 OS_TaskCreate(uint32 *task_id, const char *task_name,
     return status;
 }
 
+/*****************************************************************************/
+/**
+** \brief OS_TaskCreateWithAffinity stub function
+**
+** \par Description
+**        This function is used to mimic the response of the OS API function
+**        OS_TaskCreateWithAffinity.  Unless a failure is set for this function,
+**        it behaves as the OS_TaskCreate stub, so that tests of code which
+**        creates tasks either way can set up hooks and failures on OS_TaskCreate.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either OS_SUCCESS or OS_ERROR.
+**
+******************************************************************************/
+int32 OS_TaskCreateWithAffinity(uint32 *task_id, const char *task_name,
+                    osal_task_entry function_pointer,
+                    uint32 *stack_pointer,
+                    uint32 stack_size, uint32 priority,
+                    uint32 flags, uint32 cpu_affinity)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_TaskCreateWithAffinity), cpu_affinity);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_TaskCreateWithAffinity);
+
+    if (status == OS_SUCCESS)
+    {
+        status = OS_TaskCreate(task_id, task_name, function_pointer, stack_pointer,
+                stack_size, priority, flags);
+    }
+    else
+    {
+        *task_id = 0xDEADBEEFU;
+    }
+
+    return status;
+}
+
 /*****************************************************************************/
 /**
 ** \brief OS_TaskDelete stub function
@@ -294,6 +336,13 @@ int32 OS_TaskGetInfo(uint32 task_id, OS_task_prop_t *task_prop)
         UT_FIXUP_ID(task_prop->creator, UT_OBJTYPE_TASK);
         task_prop->stack_size = 100;
         task_prop->priority = 150;
+        task_prop->cpu_affinity = OS_TASK_CPU_AFFINITY_ANY;
+        task_prop->current_cpu = OS_TASK_CPU_UNKNOWN;
+        task_prop->migrations = 0;
+        task_prop->cpu_time.seconds = 0;
+        task_prop->cpu_time.microsecs = 0;
+        task_prop->voluntary_switches = 0;
+        task_prop->involuntary_switches = 0;
         strncpy(task_prop->name, "UnitTest", OS_MAX_API_NAME - 1);
         task_prop->name[OS_MAX_API_NAME - 1] = '\0';
     }
@@ -206,6 +206,26 @@ void OS_TimeBase_CallbackThread(uint32 timebase_id)
     UT_DEFAULT_IMPL(OS_TimeBase_CallbackThread);
 }
 
+/*****************************************************************************
+ *
+ * Stub for OS_TimeBase_ArmTimer() function
+ *
+ *****************************************************************************/
+void OS_TimeBase_ArmTimer(uint32 timebase_id, uint32 timecb_id)
+{
+    UT_DEFAULT_IMPL(OS_TimeBase_ArmTimer);
+}
+
+/*****************************************************************************
+ *
+ * Stub for OS_TimeBase_DisarmTimer() function
+ *
+ *****************************************************************************/
+void OS_TimeBase_DisarmTimer(uint32 timebase_id, uint32 timecb_id)
+{
+    UT_DEFAULT_IMPL(OS_TimeBase_DisarmTimer);
+}
+
 /*****************************************************************************
  *
  * Stub for OS_Tick2Micros() function
@@ -385,8 +385,12 @@ int32 CFE_PSP_MemWrite16        (cpuaddr MemoryAddress, uint16 uint16Value);
 int32 CFE_PSP_MemRead32         (cpuaddr MemoryAddress, uint32 *uint32Value);
 int32 CFE_PSP_MemWrite32        (cpuaddr MemoryAddress, uint32 uint32Value);
 
+int32 CFE_PSP_MemReadBlock      (cpuaddr MemoryAddress, void *Buffer, uint32 Size);
+int32 CFE_PSP_MemWriteBlock     (cpuaddr MemoryAddress, const void *Buffer, uint32 Size);
+
 int32 CFE_PSP_MemCpy            (void *dest, const void *src, uint32 n);
 int32 CFE_PSP_MemSet            (void *dest, uint8 value, uint32 n);
+int32 CFE_PSP_MemCpyCrc         (void *dest, const void *src, uint32 n, uint32 *crc);
 
 int32  CFE_PSP_MemValidateRange (cpuaddr Address, uint32 Size, uint32 MemoryType);
 uint32 CFE_PSP_MemRanges        (void);
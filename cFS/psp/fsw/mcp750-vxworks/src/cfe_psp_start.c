@@ -144,12 +144,22 @@ void OS_Application_Startup(void)
    */
    sysPciWrite32(0xFC0011D0, 0x0D6937E5);
 
+   /*
+   ** Set up the memory copy routines, which the reserved memory uses
+   */
+   CFE_PSP_MemOpsInit();
+
    /*
    ** Setup the pointer to the reserved area in vxWorks.
    ** This must be done before any of the reset variables are used.
    */
    CFE_PSP_SetupReservedMemoryMap();
 
+   /*
+   ** Index the memory range table for range validation
+   */
+   CFE_PSP_MemRangeInit();
+
    /*
    ** Determine Reset type by reading the hardware reset register.
    */
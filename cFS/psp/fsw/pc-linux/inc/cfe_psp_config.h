@@ -68,6 +68,45 @@
 /* use the "USR1" signal to wake the idle thread when an exception occurs */
 #define CFE_PSP_EXCEPTION_EVENT_SIGNAL      SIGUSR1
 
+/*
+ * Backing store for the preserved memory areas (CDS, reset area, user reserved area)
+ *
+ * SHM uses SysV shared memory segments, which survive a restart of the cFE
+ * but not of the host.  FILE maps regular files in the working directory, so
+ * the areas also survive a host reboot, and CDS writes go through a journal so
+ * that an interrupted write is either completed or discarded at the next start.
+ *
+ * The msync policy only applies to the FILE backend:
+ *   SYNC     - flush the journal and the data on every CDS write
+ *   PERIODIC - flush dirty areas from the idle thread every CFE_PSP_MSYNC_PERIOD_MSEC
+ *   ON_EXIT  - flush only on an orderly shutdown
+ *
+ * Both can be overridden at run time with the --memory and --msync options.
+ */
+#define CFE_PSP_MEMORY_SHM                  1
+#define CFE_PSP_MEMORY_FILE                 2
+
+#define CFE_PSP_MSYNC_SYNC                  1
+#define CFE_PSP_MSYNC_PERIODIC              2
+#define CFE_PSP_MSYNC_ON_EXIT               3
+
+#define CFE_PSP_MEMORY_BACKEND_DEFAULT      CFE_PSP_MEMORY_SHM
+#define CFE_PSP_MSYNC_POLICY_DEFAULT        CFE_PSP_MSYNC_PERIODIC
+#define CFE_PSP_MSYNC_PERIOD_MSEC           1000
+
+/*
+ * Timebase used by CFE_PSP_Get_Timebase() and CFE_PSP_GetTime()
+ *
+ * If the CPU has an invariant TSC and the kernel also uses it as its
+ * clocksource, the timebase is the TSC itself, calibrated against
+ * CLOCK_MONOTONIC_RAW for CFE_PSP_TIMEBASE_CALIBRATION_MSEC at startup.
+ * Otherwise it is CLOCK_MONOTONIC_RAW in nanoseconds.  Either way it is
+ * a free running 64 bit count, so the low 32 bits roll over at 2^32.
+ * Set CFE_PSP_TIMEBASE_USE_TSC to 0 to always use the kernel clock.
+ */
+#define CFE_PSP_TIMEBASE_USE_TSC            1
+#define CFE_PSP_TIMEBASE_CALIBRATION_MSEC   50
+
 
 /*
 ** Global variables
@@ -0,0 +1,133 @@
+/*
+**  GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**  Copyright (c) 2006-2019 United States Government as represented by
+**  the Administrator of the National Aeronautics and Space Administration.
+**  All Rights Reserved.
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**    http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+*/
+
+/*
+**  File Name:  cfe_psp_memfile.h
+**
+**  Purpose:  File-backed storage for the pc-linux preserved memory areas.
+**            These routines are internal to the pc-linux PSP.
+**
+*/
+
+#ifndef _cfe_psp_memfile_
+#define _cfe_psp_memfile_
+
+/*
+** Include Files
+*/
+#include <stddef.h>
+#include <pthread.h>
+#include "common_types.h"
+#include "cfe_psp_config.h"
+
+#define CFE_PSP_MEMFILE_PATH_LENGTH     64
+
+/*
+ * Journal record header, stored in the mapping directly after the data area
+ * and followed by Length bytes of data.  A record is valid when Magic is set
+ * and the CRC over the header fields and the data matches.
+ */
+typedef struct
+{
+    uint32 Magic;
+    uint32 Offset;
+    uint32 Length;
+    uint32 Crc;
+} CFE_PSP_MemFileJournal_t;
+
+typedef struct
+{
+    int     fd;
+    uint8  *BlockPtr;       /* start of the data area */
+    size_t  DataSize;       /* usable size of the data area */
+    size_t  MapSize;        /* size of the mapping, including the journal */
+    CFE_PSP_MemFileJournal_t *Journal; /* NULL if writes are not journaled */
+    uint32  Policy;         /* CFE_PSP_MSYNC_xxx */
+    bool    Dirty;
+    bool    Removed;
+    uint64  LastSyncMsec;
+    pthread_mutex_t Lock;   /* serializes writes and flushes of the area */
+    char    Path[CFE_PSP_MEMFILE_PATH_LENGTH];
+} CFE_PSP_MemFile_t;
+
+/**
+ * \brief Map a file as a preserved memory area, creating it if needed
+ *
+ * If Journaled is set, room for one journal record is reserved after the
+ * data area and any record left by an interrupted write is replayed.
+ */
+int32 CFE_PSP_MemFile_Open(CFE_PSP_MemFile_t *File, const char *Path, size_t DataSize,
+        bool Journaled, uint32 Policy);
+
+/**
+ * \brief Write to a journaled area, flushing according to the msync policy
+ */
+int32 CFE_PSP_MemFile_Write(CFE_PSP_MemFile_t *File, uint32 Offset, const void *Data, uint32 NumBytes);
+
+/**
+ * \brief Store a journal record without applying it
+ *
+ * First step of CFE_PSP_MemFile_Write(), exposed so that an interrupted
+ * write can be reproduced by tests.
+ */
+int32 CFE_PSP_MemFile_Journal(CFE_PSP_MemFile_t *File, uint32 Offset, const void *Data, uint32 NumBytes);
+
+/**
+ * \brief Flush the whole area to the backing file
+ */
+void CFE_PSP_MemFile_Sync(CFE_PSP_MemFile_t *File);
+
+/**
+ * \brief Flush the area if the PERIODIC policy interval has expired
+ */
+void CFE_PSP_MemFile_Poll(CFE_PSP_MemFile_t *File);
+
+/**
+ * \brief Remove the backing file
+ *
+ * The mapping stays usable until the process ends, as with the SysV segments.
+ */
+void CFE_PSP_MemFile_Remove(CFE_PSP_MemFile_t *File);
+
+/**
+ * \brief Flush and unmap the area
+ */
+void CFE_PSP_MemFile_Close(CFE_PSP_MemFile_t *File);
+
+/*
+ * Reserved memory hooks used by the pc-linux startup code
+ */
+
+/**
+ * \brief Select the reserved memory backend and msync policy
+ *
+ * Must be called before CFE_PSP_SetupReservedMemoryMap().
+ */
+void CFE_PSP_SetReservedMemoryBackend(uint32 Backend, uint32 Policy);
+
+/**
+ * \brief Flush the file-backed reserved memory areas
+ *
+ * If Force is false, only the areas due under the PERIODIC policy are
+ * flushed.  Does nothing with the SHM backend.
+ */
+void CFE_PSP_SyncReservedMemory(bool Force);
+
+#endif  /* _cfe_psp_memfile_ */
@@ -0,0 +1,50 @@
+/*
+**  GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**  Copyright (c) 2006-2019 United States Government as represented by
+**  the Administrator of the National Aeronautics and Space Administration.
+**  All Rights Reserved.
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**    http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+*/
+
+/*
+**  File Name:  cfe_psp_timebase.h
+**
+**  Purpose:  Timebase selection for the pc-linux PSP.
+**            These routines are internal to the pc-linux PSP.
+**
+*/
+
+#ifndef _cfe_psp_timebase_
+#define _cfe_psp_timebase_
+
+/*
+** Include Files
+*/
+#include "common_types.h"
+
+#define CFE_PSP_TIMEBASE_CLOCK      1   /* CLOCK_MONOTONIC_RAW, in nanoseconds */
+#define CFE_PSP_TIMEBASE_TSC        2   /* calibrated invariant TSC */
+
+/**
+ * \brief Select and calibrate the timebase
+ *
+ * Called once at startup, before any task reads the timebase.  Until
+ * then the timebase is CLOCK_MONOTONIC_RAW.
+ *
+ * \returns the timebase in use, CFE_PSP_TIMEBASE_CLOCK or CFE_PSP_TIMEBASE_TSC
+ */
+uint32 CFE_PSP_InitTimebase(void);
+
+#endif  /* _cfe_psp_timebase_ */
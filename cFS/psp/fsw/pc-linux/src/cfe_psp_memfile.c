@@ -0,0 +1,438 @@
+/*
+**  GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**  Copyright (c) 2006-2019 United States Government as represented by
+**  the Administrator of the National Aeronautics and Space Administration.
+**  All Rights Reserved.
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**    http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+*/
+
+/******************************************************************************
+** File:  cfe_psp_memfile.c
+**
+**      pc-linux Version
+**
+** Purpose:
+**   File-backed storage for the preserved memory areas.  Each area is a
+**   regular file mapped with MAP_SHARED, so its content survives both a
+**   restart of the cFE and a reboot of the host.
+**
+**   Journaled areas reserve room for one record after the data.  A write
+**   first stores the record (offset, length, data and a CRC), then updates
+**   the data and finally clears the record.  If the process dies in between,
+**   the record is replayed at the next start if its CRC is good, and
+**   discarded otherwise, so each write is either fully applied or not at all.
+**
+**   An area has a single journal record, so writes to it are serialized by
+**   a per-area mutex, which also covers the flushes.
+**
+******************************************************************************/
+
+/*
+**  Include Files
+*/
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <time.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <pthread.h>
+
+#include "common_types.h"
+#include "osapi.h"
+
+#include "cfe_psp.h"
+#include "cfe_psp_config.h"
+#include "cfe_psp_memfile.h"
+
+#define CFE_PSP_MEMFILE_JOURNAL_MAGIC   ((uint32)0x4a524e4c)
+
+
+/*
+** Internal helpers
+*/
+
+static size_t CFE_PSP_MemFile_PageMask(void)
+{
+    return sysconf(_SC_PAGESIZE) - 1;
+}
+
+static uint64 CFE_PSP_MemFile_Msec(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((uint64)now.tv_sec * 1000) + (now.tv_nsec / 1000000);
+}
+
+/*
+ * CRC-32 (IEEE 802.3) over the record header fields and the data.
+ */
+static uint32 CFE_PSP_MemFile_Crc(const CFE_PSP_MemFileJournal_t *Record)
+{
+    uint32 Crc;
+    uint32 Hdr[2];
+
+    Hdr[0] = Record->Offset;
+    Hdr[1] = Record->Length;
+
+    Crc = 0;
+    CFE_PSP_MemCpyCrc(NULL, Hdr, sizeof(Hdr), &Crc);
+    CFE_PSP_MemCpyCrc(NULL, Record + 1, Record->Length, &Crc);
+
+    return Crc;
+}
+
+/*
+ * msync() a range of the mapping; the start must be rounded down to a page
+ */
+static void CFE_PSP_MemFile_Flush(const void *Ptr, size_t Size)
+{
+    cpuaddr start;
+
+    start = (cpuaddr)Ptr & ~(cpuaddr)CFE_PSP_MemFile_PageMask();
+    msync((void *)start, ((cpuaddr)Ptr + Size) - start, MS_SYNC);
+}
+
+/*
+ * Complete or discard a record left by an interrupted write
+ */
+static void CFE_PSP_MemFile_Replay(CFE_PSP_MemFile_t *File)
+{
+    CFE_PSP_MemFileJournal_t *Record = File->Journal;
+
+    if (Record->Magic != CFE_PSP_MEMFILE_JOURNAL_MAGIC)
+    {
+        return;
+    }
+
+    if (Record->Offset <= File->DataSize &&
+            Record->Length <= (File->DataSize - Record->Offset) &&
+            Record->Crc == CFE_PSP_MemFile_Crc(Record))
+    {
+        OS_printf("CFE_PSP: Replaying interrupted write of %u bytes at offset %u in %s\n",
+                (unsigned int)Record->Length, (unsigned int)Record->Offset, File->Path);
+        memcpy(File->BlockPtr + Record->Offset, Record + 1, Record->Length);
+    }
+    else
+    {
+        OS_printf("CFE_PSP: Discarding incomplete journal record in %s\n", File->Path);
+    }
+
+    /* the data must be on disk before the record is dropped */
+    CFE_PSP_MemFile_Flush(File->BlockPtr, File->DataSize);
+    Record->Magic = 0;
+    CFE_PSP_MemFile_Flush(Record, sizeof(*Record));
+}
+
+/*
+ * Store the journal record for a write; the caller holds the area lock
+ */
+static int32 CFE_PSP_MemFile_StoreRecord(CFE_PSP_MemFile_t *File, uint32 Offset, const void *Data, uint32 NumBytes)
+{
+    CFE_PSP_MemFileJournal_t *Record = File->Journal;
+    uint32 Hdr[2];
+    uint32 Crc;
+
+    if (Record == NULL || Data == NULL ||
+            Offset > File->DataSize || NumBytes > (File->DataSize - Offset))
+    {
+        return CFE_PSP_ERROR;
+    }
+
+    /*
+     * The CRC covers everything, so a partially written record is
+     * rejected at replay no matter which of these stores made it out.
+     */
+    Record->Magic = 0;
+    Record->Offset = Offset;
+    Record->Length = NumBytes;
+
+    /* the data is copied into the record and checked in one pass */
+    Hdr[0] = Offset;
+    Hdr[1] = NumBytes;
+    Crc = 0;
+    CFE_PSP_MemCpyCrc(NULL, Hdr, sizeof(Hdr), &Crc);
+    CFE_PSP_MemCpyCrc(Record + 1, Data, NumBytes, &Crc);
+    Record->Crc = Crc;
+    Record->Magic = CFE_PSP_MEMFILE_JOURNAL_MAGIC;
+
+    if (File->Policy == CFE_PSP_MSYNC_SYNC)
+    {
+        CFE_PSP_MemFile_Flush(Record, sizeof(*Record) + NumBytes);
+    }
+
+    return CFE_PSP_SUCCESS;
+}
+
+
+/******************************************************************************
+**  Function: CFE_PSP_MemFile_Open
+**
+**  Purpose:
+**    Maps a file as a preserved memory area, creating or resizing it as needed.
+**    New files are sparse, so unused space does not take any disk blocks.
+**
+**  Arguments:
+**    File       - area state to fill in
+**    Path       - backing file name
+**    DataSize   - usable size of the area
+**    Journaled  - reserve a journal record and replay any pending one
+**    Policy     - CFE_PSP_MSYNC_xxx
+**
+**  Return:
+**    CFE_PSP_SUCCESS or CFE_PSP_ERROR
+*/
+int32 CFE_PSP_MemFile_Open(CFE_PSP_MemFile_t *File, const char *Path, size_t DataSize,
+        bool Journaled, uint32 Policy)
+{
+    size_t page_mask;
+    size_t data_span;
+    struct stat st;
+    void *addr;
+
+    memset(File, 0, sizeof(*File));
+    File->fd = -1;
+    strncpy(File->Path, Path, sizeof(File->Path) - 1);
+    File->DataSize = DataSize;
+    File->Policy = Policy;
+    pthread_mutex_init(&File->Lock, NULL);
+
+    page_mask = CFE_PSP_MemFile_PageMask();
+    data_span = (DataSize + page_mask) & ~page_mask;
+    File->MapSize = data_span;
+    if (Journaled)
+    {
+        File->MapSize += (sizeof(CFE_PSP_MemFileJournal_t) + DataSize + page_mask) & ~page_mask;
+    }
+
+    File->fd = open(Path, O_RDWR | O_CREAT, S_IRUSR | S_IWUSR);
+    if (File->fd < 0)
+    {
+        return CFE_PSP_ERROR;
+    }
+
+    if (fstat(File->fd, &st) != 0 ||
+            ((size_t)st.st_size != File->MapSize && ftruncate(File->fd, File->MapSize) != 0))
+    {
+        close(File->fd);
+        File->fd = -1;
+        return CFE_PSP_ERROR;
+    }
+
+    addr = mmap(NULL, File->MapSize, PROT_READ | PROT_WRITE, MAP_SHARED, File->fd, 0);
+    if (addr == MAP_FAILED)
+    {
+        close(File->fd);
+        File->fd = -1;
+        return CFE_PSP_ERROR;
+    }
+
+    File->BlockPtr = addr;
+    if (Journaled)
+    {
+        File->Journal = (CFE_PSP_MemFileJournal_t *)(File->BlockPtr + data_span);
+        CFE_PSP_MemFile_Replay(File);
+    }
+
+    File->LastSyncMsec = CFE_PSP_MemFile_Msec();
+
+    return CFE_PSP_SUCCESS;
+}
+
+/******************************************************************************
+**  Function: CFE_PSP_MemFile_Journal
+**
+**  Purpose:
+**    Stores the journal record for a write.  Under the SYNC policy the record
+**    is on disk before this returns.
+**
+**  Arguments:
+**    File      - journaled area
+**    Offset    - offset of the write within the area
+**    Data      - data to be written
+**    NumBytes  - size of the write
+**
+**  Return:
+**    CFE_PSP_SUCCESS or CFE_PSP_ERROR
+*/
+int32 CFE_PSP_MemFile_Journal(CFE_PSP_MemFile_t *File, uint32 Offset, const void *Data, uint32 NumBytes)
+{
+    int32 Status;
+
+    pthread_mutex_lock(&File->Lock);
+    Status = CFE_PSP_MemFile_StoreRecord(File, Offset, Data, NumBytes);
+    pthread_mutex_unlock(&File->Lock);
+
+    return Status;
+}
+
+/******************************************************************************
+**  Function: CFE_PSP_MemFile_Write
+**
+**  Purpose:
+**    Journaled write to the area.  Under the SYNC policy both the record and
+**    the data are on disk before this returns; otherwise the area is marked
+**    dirty and flushed later.
+**
+**  Arguments:
+**    File      - journaled area
+**    Offset    - offset of the write within the area
+**    Data      - data to be written
+**    NumBytes  - size of the write
+**
+**  Return:
+**    CFE_PSP_SUCCESS or CFE_PSP_ERROR
+*/
+int32 CFE_PSP_MemFile_Write(CFE_PSP_MemFile_t *File, uint32 Offset, const void *Data, uint32 NumBytes)
+{
+    int32 Status;
+
+    /*
+     * The record, the data and the clearing of the record go together:
+     * another writer must neither reuse the record nor see it cleared
+     * before this write is applied.
+     */
+    pthread_mutex_lock(&File->Lock);
+
+    Status = CFE_PSP_MemFile_StoreRecord(File, Offset, Data, NumBytes);
+    if (Status == CFE_PSP_SUCCESS)
+    {
+        memcpy(File->BlockPtr + Offset, Data, NumBytes);
+
+        if (File->Policy == CFE_PSP_MSYNC_SYNC)
+        {
+            CFE_PSP_MemFile_Flush(File->BlockPtr + Offset, NumBytes);
+        }
+        else
+        {
+            File->Dirty = true;
+        }
+
+        /*
+         * No need to flush this: replaying the latest record again
+         * after a crash rewrites the same data.
+         */
+        File->Journal->Magic = 0;
+    }
+
+    pthread_mutex_unlock(&File->Lock);
+
+    return Status;
+}
+
+/******************************************************************************
+**  Function: CFE_PSP_MemFile_Sync
+**
+**  Purpose:
+**    Flushes the whole area to the backing file.
+**
+**  Arguments:
+**    File - the area
+**
+**  Return:
+**    (none)
+*/
+void CFE_PSP_MemFile_Sync(CFE_PSP_MemFile_t *File)
+{
+    if (File->BlockPtr == NULL || File->Removed)
+    {
+        return;
+    }
+
+    pthread_mutex_lock(&File->Lock);
+    File->Dirty = false;
+    msync(File->BlockPtr, File->MapSize, MS_SYNC);
+    File->LastSyncMsec = CFE_PSP_MemFile_Msec();
+    pthread_mutex_unlock(&File->Lock);
+}
+
+/******************************************************************************
+**  Function: CFE_PSP_MemFile_Poll
+**
+**  Purpose:
+**    Flushes the area if it uses the PERIODIC policy and the interval expired.
+**    Areas without a journal are written directly by their users, so they are
+**    always assumed to be dirty.
+**
+**  Arguments:
+**    File - the area
+**
+**  Return:
+**    (none)
+*/
+void CFE_PSP_MemFile_Poll(CFE_PSP_MemFile_t *File)
+{
+    if (File->Policy == CFE_PSP_MSYNC_PERIODIC &&
+            (File->Journal == NULL || File->Dirty) &&
+            (CFE_PSP_MemFile_Msec() - File->LastSyncMsec) >= CFE_PSP_MSYNC_PERIOD_MSEC)
+    {
+        CFE_PSP_MemFile_Sync(File);
+    }
+}
+
+/******************************************************************************
+**  Function: CFE_PSP_MemFile_Remove
+**
+**  Purpose:
+**    Removes the backing file.  The mapping stays usable until the process
+**    ends but is no longer flushed.
+**
+**  Arguments:
+**    File - the area
+**
+**  Return:
+**    (none)
+*/
+void CFE_PSP_MemFile_Remove(CFE_PSP_MemFile_t *File)
+{
+    if (File->fd >= 0 && !File->Removed)
+    {
+        unlink(File->Path);
+        File->Removed = true;
+    }
+}
+
+/******************************************************************************
+**  Function: CFE_PSP_MemFile_Close
+**
+**  Purpose:
+**    Flushes and unmaps the area.
+**
+**  Arguments:
+**    File - the area
+**
+**  Return:
+**    (none)
+*/
+void CFE_PSP_MemFile_Close(CFE_PSP_MemFile_t *File)
+{
+    if (File->BlockPtr != NULL)
+    {
+        CFE_PSP_MemFile_Sync(File);
+        munmap(File->BlockPtr, File->MapSize);
+        File->BlockPtr = NULL;
+        File->Journal = NULL;
+    }
+
+    if (File->fd >= 0)
+    {
+        close(File->fd);
+        File->fd = -1;
+    }
+}
@@ -63,11 +63,16 @@
 */
 #include "cfe_psp_config.h"
 #include "cfe_psp_memory.h"
+#include "cfe_psp_memfile.h"
 
 #define CFE_PSP_CDS_KEY_FILE ".cdskeyfile"
 #define CFE_PSP_RESET_KEY_FILE ".resetkeyfile"
 #define CFE_PSP_RESERVED_KEY_FILE ".reservedkeyfile"
 
+#define CFE_PSP_CDS_MEM_FILE ".cdsmemfile"
+#define CFE_PSP_RESET_MEM_FILE ".resetmemfile"
+#define CFE_PSP_RESERVED_MEM_FILE ".reservedmemfile"
+
 #include <target_config.h>
 
 /*
@@ -106,6 +111,16 @@ extern unsigned int _fini;
 int    ResetAreaShmId;
 int    CDSShmId;
 int    UserShmId;
+
+/*
+** Backend selection and state of the file-backed areas
+*/
+uint32 CFE_PSP_MemoryBackend = CFE_PSP_MEMORY_BACKEND_DEFAULT;
+uint32 CFE_PSP_MsyncPolicy = CFE_PSP_MSYNC_POLICY_DEFAULT;
+
+CFE_PSP_MemFile_t CDSMemFile;
+CFE_PSP_MemFile_t ResetAreaMemFile;
+CFE_PSP_MemFile_t UserMemFile;
                                                                               
 /*
 ** Pointer to the vxWorks USER_RESERVED_MEMORY area
@@ -140,6 +155,23 @@ void CFE_PSP_InitCDS(void)
 {
    key_t key;
 
+   if (CFE_PSP_MemoryBackend == CFE_PSP_MEMORY_FILE)
+   {
+      /*
+      ** Map the CDS file; this also completes any write that was interrupted
+      */
+      if (CFE_PSP_MemFile_Open(&CDSMemFile, CFE_PSP_CDS_MEM_FILE, CFE_PSP_CDS_SIZE,
+            true, CFE_PSP_MsyncPolicy) != CFE_PSP_SUCCESS)
+      {
+         OS_printf("CFE_PSP: Cannot map CDS memory file!\n");
+         exit(-1);
+      }
+
+      CFE_PSP_ReservedMemoryMap.CDSMemory.BlockPtr = CDSMemFile.BlockPtr;
+      CFE_PSP_ReservedMemoryMap.CDSMemory.BlockSize = CFE_PSP_CDS_SIZE;
+      return;
+   }
+
    /* 
    ** Make the Shared memory key
    */
@@ -189,6 +221,13 @@ void CFE_PSP_DeleteCDS(void)
 
    int    ReturnCode;
    struct shmid_ds ShmCtrl;
+
+   if (CFE_PSP_MemoryBackend == CFE_PSP_MEMORY_FILE)
+   {
+      CFE_PSP_MemFile_Remove(&CDSMemFile);
+      OS_printf("CFE_PSP: Critical Data Store memory file removed\n");
+      return;
+   }
    
    ReturnCode = shmctl(CDSShmId, IPC_RMID, &ShmCtrl);
    
@@ -261,11 +300,18 @@ int32 CFE_PSP_WriteToCDS(const void *PtrToDataToWrite, uint32 CDSOffset, uint32
    {
        if ( (CDSOffset < CFE_PSP_CDS_SIZE ) && ( (CDSOffset + NumBytes) <= CFE_PSP_CDS_SIZE ))
        {
-           CopyPtr = CFE_PSP_ReservedMemoryMap.CDSMemory.BlockPtr;
-           CopyPtr += CDSOffset;
-           memcpy(CopyPtr, (char *)PtrToDataToWrite,NumBytes);
-          
-           return_code = CFE_PSP_SUCCESS;
+           if (CFE_PSP_MemoryBackend == CFE_PSP_MEMORY_FILE)
+           {
+              return_code = CFE_PSP_MemFile_Write(&CDSMemFile, CDSOffset, PtrToDataToWrite, NumBytes);
+           }
+           else
+           {
+              CopyPtr = CFE_PSP_ReservedMemoryMap.CDSMemory.BlockPtr;
+              CopyPtr += CDSOffset;
+              memcpy(CopyPtr, (char *)PtrToDataToWrite,NumBytes);
+
+              return_code = CFE_PSP_SUCCESS;
+           }
        }
        else
        {
@@ -350,14 +396,6 @@ void CFE_PSP_InitResetArea(void)
    size_t align_mask;
    cpuaddr block_addr;
    CFE_PSP_LinuxReservedAreaFixedLayout_t *FixedBlocksPtr;
-   /* 
-   ** Make the Shared memory key
-   */
-   if ((key = ftok(CFE_PSP_RESET_KEY_FILE, 'R')) == -1) 
-   {
-        OS_printf("CFE_PSP: Cannot Create Reset Area Shared memory key!\n");
-        exit(-1);
-   }
 
    /*
     * NOTE: Historically the CFE ES reset area also contains the Exception log.
@@ -372,23 +410,49 @@ void CFE_PSP_InitResetArea(void)
    total_size += CFE_PSP_RESET_AREA_SIZE;
    total_size = (total_size + align_mask) & ~align_mask;
 
-   /* 
-   ** connect to (and possibly create) the segment: 
-   */
-   if ((ResetAreaShmId = shmget(key, total_size, 0644 | IPC_CREAT)) == -1)
+   if (CFE_PSP_MemoryBackend == CFE_PSP_MEMORY_FILE)
    {
-        OS_printf("CFE_PSP: Cannot shmget Reset Area Shared memory Segment!\n");
-        exit(-1);
+      /*
+      ** ES updates the reset area in place, so it is mapped without a journal
+      */
+      if (CFE_PSP_MemFile_Open(&ResetAreaMemFile, CFE_PSP_RESET_MEM_FILE, total_size,
+            false, CFE_PSP_MsyncPolicy) != CFE_PSP_SUCCESS)
+      {
+         OS_printf("CFE_PSP: Cannot map Reset Area memory file!\n");
+         exit(-1);
+      }
+
+      block_addr = (cpuaddr)ResetAreaMemFile.BlockPtr;
    }
-
-   /* 
-   ** attach to the segment to get a pointer to it: 
-   */
-   block_addr = (cpuaddr)shmat(ResetAreaShmId, (void *)0, 0);
-   if (block_addr == (cpuaddr)(-1))
+   else
    {
-        OS_printf("CFE_PSP: Cannot shmat to Reset Area Shared memory Segment!\n");
-        exit(-1);
+      /*
+      ** Make the Shared memory key
+      */
+      if ((key = ftok(CFE_PSP_RESET_KEY_FILE, 'R')) == -1)
+      {
+         OS_printf("CFE_PSP: Cannot Create Reset Area Shared memory key!\n");
+         exit(-1);
+      }
+
+      /*
+      ** connect to (and possibly create) the segment:
+      */
+      if ((ResetAreaShmId = shmget(key, total_size, 0644 | IPC_CREAT)) == -1)
+      {
+         OS_printf("CFE_PSP: Cannot shmget Reset Area Shared memory Segment!\n");
+         exit(-1);
+      }
+
+      /*
+      ** attach to the segment to get a pointer to it:
+      */
+      block_addr = (cpuaddr)shmat(ResetAreaShmId, (void *)0, 0);
+      if (block_addr == (cpuaddr)(-1))
+      {
+         OS_printf("CFE_PSP: Cannot shmat to Reset Area Shared memory Segment!\n");
+         exit(-1);
+      }
    }
 
    FixedBlocksPtr = (CFE_PSP_LinuxReservedAreaFixedLayout_t *)block_addr;
@@ -418,6 +482,13 @@ void CFE_PSP_DeleteResetArea(void)
 {
    int    ReturnCode;
    struct shmid_ds ShmCtrl;
+
+   if (CFE_PSP_MemoryBackend == CFE_PSP_MEMORY_FILE)
+   {
+      CFE_PSP_MemFile_Remove(&ResetAreaMemFile);
+      OS_printf("Reset Area memory file removed\n");
+      return;
+   }
    
    ReturnCode = shmctl(ResetAreaShmId, IPC_RMID, &ShmCtrl);
    
@@ -492,6 +563,20 @@ void CFE_PSP_InitUserReservedArea(void)
 {
    key_t key;
 
+   if (CFE_PSP_MemoryBackend == CFE_PSP_MEMORY_FILE)
+   {
+      if (CFE_PSP_MemFile_Open(&UserMemFile, CFE_PSP_RESERVED_MEM_FILE, CFE_PSP_USER_RESERVED_SIZE,
+            false, CFE_PSP_MsyncPolicy) != CFE_PSP_SUCCESS)
+      {
+         OS_printf("CFE_PSP: Cannot map User Reserved Area memory file!\n");
+         exit(-1);
+      }
+
+      CFE_PSP_ReservedMemoryMap.UserReservedMemory.BlockPtr = UserMemFile.BlockPtr;
+      CFE_PSP_ReservedMemoryMap.UserReservedMemory.BlockSize = CFE_PSP_USER_RESERVED_SIZE;
+      return;
+   }
+
    /* 
    ** Make the Shared memory key
    */
@@ -539,6 +624,13 @@ void CFE_PSP_DeleteUserReservedArea(void)
 {
    int    ReturnCode;
    struct shmid_ds ShmCtrl;
+
+   if (CFE_PSP_MemoryBackend == CFE_PSP_MEMORY_FILE)
+   {
+      CFE_PSP_MemFile_Remove(&UserMemFile);
+      OS_printf("User Reserved Area memory file removed\n");
+      return;
+   }
    
    ReturnCode = shmctl(UserShmId, IPC_RMID, &ShmCtrl);
    
@@ -671,12 +763,15 @@ void CFE_PSP_SetupReservedMemoryMap(void)
    ** Create the key files for the shared memory segments
    ** The files are not needed, so they are closed right away.
    */
-   tempFd = open(CFE_PSP_CDS_KEY_FILE, O_RDONLY | O_CREAT, S_IRWXU );
-   close(tempFd);
-   tempFd = open(CFE_PSP_RESET_KEY_FILE, O_RDONLY | O_CREAT, S_IRWXU );
-   close(tempFd);
-   tempFd = open(CFE_PSP_RESERVED_KEY_FILE, O_RDONLY | O_CREAT, S_IRWXU );
-   close(tempFd);
+   if (CFE_PSP_MemoryBackend != CFE_PSP_MEMORY_FILE)
+   {
+      tempFd = open(CFE_PSP_CDS_KEY_FILE, O_RDONLY | O_CREAT, S_IRWXU );
+      close(tempFd);
+      tempFd = open(CFE_PSP_RESET_KEY_FILE, O_RDONLY | O_CREAT, S_IRWXU );
+      close(tempFd);
+      tempFd = open(CFE_PSP_RESERVED_KEY_FILE, O_RDONLY | O_CREAT, S_IRWXU );
+      close(tempFd);
+   }
 
    /*
     * The setup of each section is done as a separate init.
@@ -741,6 +836,10 @@ int32 CFE_PSP_InitProcessorReservedMemory( uint32 RestartType )
      */
     CFE_PSP_ReservedMemoryMap.BootPtr->ValidityFlag = CFE_PSP_BOOTRECORD_INVALID;
 
+    /*
+     * Get the cleared areas and the boot record out to the backing files
+     */
+    CFE_PSP_SyncReservedMemory(true);
 
     return(CFE_PSP_SUCCESS);
 }
@@ -765,6 +864,60 @@ void CFE_PSP_DeleteProcessorReservedMemory(void)
    CFE_PSP_DeleteResetArea();
    CFE_PSP_DeleteUserReservedArea();
 }
+
+/******************************************************************************
+**  Function: CFE_PSP_SetReservedMemoryBackend
+**
+**  Purpose:
+**    Selects the backing store and msync policy of the reserved memory areas.
+**    Must be called before CFE_PSP_SetupReservedMemoryMap().
+**
+**  Arguments:
+**    Backend - CFE_PSP_MEMORY_SHM or CFE_PSP_MEMORY_FILE
+**    Policy  - CFE_PSP_MSYNC_xxx, only used by the FILE backend
+**
+**  Return:
+**    (none)
+*/
+void CFE_PSP_SetReservedMemoryBackend(uint32 Backend, uint32 Policy)
+{
+   CFE_PSP_MemoryBackend = Backend;
+   CFE_PSP_MsyncPolicy = Policy;
+}
+
+/******************************************************************************
+**  Function: CFE_PSP_SyncReservedMemory
+**
+**  Purpose:
+**    Flushes the file-backed reserved memory areas.  This is called
+**    periodically from the idle thread and on an orderly shutdown.
+**
+**  Arguments:
+**    Force - flush now, regardless of the msync policy
+**
+**  Return:
+**    (none)
+*/
+void CFE_PSP_SyncReservedMemory(bool Force)
+{
+   if (CFE_PSP_MemoryBackend != CFE_PSP_MEMORY_FILE)
+   {
+      return;
+   }
+
+   if (Force)
+   {
+      CFE_PSP_MemFile_Sync(&CDSMemFile);
+      CFE_PSP_MemFile_Sync(&ResetAreaMemFile);
+      CFE_PSP_MemFile_Sync(&UserMemFile);
+   }
+   else
+   {
+      CFE_PSP_MemFile_Poll(&CDSMemFile);
+      CFE_PSP_MemFile_Poll(&ResetAreaMemFile);
+      CFE_PSP_MemFile_Poll(&UserMemFile);
+   }
+}
    
 /*
 *********************************************************************************
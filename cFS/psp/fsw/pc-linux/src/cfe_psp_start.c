@@ -55,6 +55,8 @@
 
 #include "cfe_psp.h"
 #include "cfe_psp_memory.h"
+#include "cfe_psp_memfile.h"
+#include "cfe_psp_timebase.h"
 
 /*
  * The preferred way to obtain the CFE tunable values at runtime is via
@@ -77,6 +79,7 @@
 
 #define CFE_PSP_CPU_NAME_LENGTH  32
 #define CFE_PSP_RESET_NAME_LENGTH 10
+#define CFE_PSP_OPTION_NAME_LENGTH 10
 
 /*
 ** Typedefs for this module
@@ -101,6 +104,12 @@ typedef struct
 
    uint32   SpacecraftId;     /* Spacecraft ID */ 
    uint32   GotSpacecraftId;  /* Did we get a Spacecraft ID */
+
+   uint32   MemoryBackend;    /* Reserved memory backend: CFE_PSP_MEMORY_SHM or CFE_PSP_MEMORY_FILE */
+   uint32   GotMemoryBackend; /* Did we get a memory backend ? */
+
+   uint32   MsyncPolicy;      /* msync policy for the FILE backend: CFE_PSP_MSYNC_xxx */
+   uint32   GotMsyncPolicy;   /* Did we get an msync policy ? */
    
 } CFE_PSP_CommandData_t;
 
@@ -126,7 +135,7 @@ CFE_PSP_IdleTaskState_t  CFE_PSP_IdleTaskState;
 /*
 ** getopts parameter passing options string
 */
-static const char *optString = "R:S:C:I:N:h";
+static const char *optString = "R:S:C:I:N:M:Y:h";
 
 /*
 ** getopts_long long form argument table
@@ -137,6 +146,8 @@ static const struct option longOpts[] = {
    { "cpuid",     required_argument, NULL, 'C' },
    { "scid",      required_argument, NULL, 'I'},
    { "cpuname",   required_argument, NULL, 'N'},
+   { "memory",    required_argument, NULL, 'M'},
+   { "msync",     required_argument, NULL, 'Y'},
    { "help",      no_argument,       NULL, 'h' },
    { NULL,        no_argument,       NULL,  0 }
 };
@@ -232,6 +243,48 @@ void OS_Application_Startup(void)
             CommandData.GotSpacecraftId = 1;
             break;
 
+         case 'M':
+            if (strncmp(optarg, "shm", CFE_PSP_OPTION_NAME_LENGTH) == 0)
+            {
+               CommandData.MemoryBackend = CFE_PSP_MEMORY_SHM;
+            }
+            else if (strncmp(optarg, "file", CFE_PSP_OPTION_NAME_LENGTH) == 0)
+            {
+               CommandData.MemoryBackend = CFE_PSP_MEMORY_FILE;
+            }
+            else
+            {
+               printf("\nERROR: Invalid Memory Backend: %s\n\n",optarg);
+               CFE_PSP_DisplayUsage(argv[0]);
+               break;
+            }
+            printf("CFE_PSP: Memory Backend: %s\n",optarg);
+            CommandData.GotMemoryBackend = 1;
+            break;
+
+         case 'Y':
+            if (strncmp(optarg, "sync", CFE_PSP_OPTION_NAME_LENGTH) == 0)
+            {
+               CommandData.MsyncPolicy = CFE_PSP_MSYNC_SYNC;
+            }
+            else if (strncmp(optarg, "periodic", CFE_PSP_OPTION_NAME_LENGTH) == 0)
+            {
+               CommandData.MsyncPolicy = CFE_PSP_MSYNC_PERIODIC;
+            }
+            else if (strncmp(optarg, "exit", CFE_PSP_OPTION_NAME_LENGTH) == 0)
+            {
+               CommandData.MsyncPolicy = CFE_PSP_MSYNC_ON_EXIT;
+            }
+            else
+            {
+               printf("\nERROR: Invalid msync Policy: %s\n\n",optarg);
+               CFE_PSP_DisplayUsage(argv[0]);
+               break;
+            }
+            printf("CFE_PSP: msync Policy: %s\n",optarg);
+            CommandData.GotMsyncPolicy = 1;
+            break;
+
          case 'h':
             CFE_PSP_DisplayUsage(argv[0]);
             break;
@@ -276,11 +329,27 @@ void OS_Application_Startup(void)
        CFE_PSP_Panic(Status);
    }
 
+   /*
+    * Select the timebase before anything is timestamped
+    */
+   CFE_PSP_InitTimebase();
+
+   /*
+    * Set up the memory copy routines, which the reserved memory uses
+    */
+   CFE_PSP_MemOpsInit();
+
    /*
     * Map the PSP shared memory segments
     */
+   CFE_PSP_SetReservedMemoryBackend(CommandData.MemoryBackend, CommandData.MsyncPolicy);
    CFE_PSP_SetupReservedMemoryMap();
 
+   /*
+    * Index the memory range table for range validation
+    */
+   CFE_PSP_MemRangeInit();
+
    /*
     * Prepare for exception handling in the idle task
     */
@@ -414,8 +483,8 @@ void OS_Application_Startup(void)
 void OS_Application_Run(void)
 {
     int sig;
-    int ret;
     sigset_t sigset;
+    struct timespec timeout;
 
 
     /*
@@ -447,13 +516,22 @@ void OS_Application_Run(void)
     **
     ** "shutdownreq" will become true if CFE calls CFE_PSP_Restart(),
     ** indicating a request to gracefully exit and restart CFE.
+    **
+    ** The wait times out once per msync period so that file-backed
+    ** reserved memory can be flushed from here.
     */
+    timeout.tv_sec = CFE_PSP_MSYNC_PERIOD_MSEC / 1000;
+    timeout.tv_nsec = (CFE_PSP_MSYNC_PERIOD_MSEC % 1000) * 1000000;
     while (!CFE_PSP_IdleTaskState.ShutdownReq)
     {
         /* go idle and wait for an event */
-        ret = sigwait(&sigset, &sig);
+        sig = sigtimedwait(&sigset, NULL, &timeout);
 
-        if (ret == 0 && !CFE_PSP_IdleTaskState.ShutdownReq &&
+        if (sig < 0)
+        {
+            CFE_PSP_SyncReservedMemory(false);
+        }
+        else if (!CFE_PSP_IdleTaskState.ShutdownReq &&
                 sig == CFE_PSP_EXCEPTION_EVENT_SIGNAL &&
                 GLOBAL_CFE_CONFIGDATA.SystemNotify != NULL)
         {
@@ -468,6 +546,8 @@ void OS_Application_Run(void)
    OS_printf("\nCFE_PSP: Shutdown initiated - Exiting cFE\n");
    OS_TaskDelay(100);
 
+   CFE_PSP_SyncReservedMemory(true);
+
    OS_DeleteAllObjects();
 }
 
@@ -510,7 +590,7 @@ void CFE_PSP_TimerHandler (int signum)
 void CFE_PSP_DisplayUsage(char *Name )
 {
 
-   printf("usage : %s [-R <value>] [-S <value>] [-C <value] [-N <value] [-I <value] [-h] \n", Name);
+   printf("usage : %s [-R <value>] [-S <value>] [-C <value] [-N <value] [-I <value] [-M <value>] [-Y <value>] [-h] \n", Name);
    printf("\n");
    printf("        All parameters are optional and can be used in any order\n");
    printf("\n");
@@ -530,6 +610,15 @@ void CFE_PSP_DisplayUsage(char *Name )
    printf("             The default  CPU Name is from the platform configuration file: %s\n",CFE_PSP_CPU_NAME);
    printf("        -I [ --scid ]    Spacecraft ID is an integer Spacecraft identifier.\n");
    printf("             The default Spacecraft ID is from the mission configuration file: %d\n",CFE_PSP_SPACECRAFT_ID);
+   printf("        -M [ --memory ]  Reserved memory backend is one of:\n");
+   printf("             shm    for SysV shared memory segments\n");
+   printf("             file   for memory mapped files with a journaled CDS\n");
+   printf("             The default is from the PSP configuration file: %s\n",
+         CFE_PSP_MEMORY_BACKEND_DEFAULT == CFE_PSP_MEMORY_FILE ? "file" : "shm");
+   printf("        -Y [ --msync ]   msync policy of the file backend is one of:\n");
+   printf("             sync       flush on every CDS write\n");
+   printf("             periodic   flush every %d msec ( default )\n", CFE_PSP_MSYNC_PERIOD_MSEC);
+   printf("             exit       flush on shutdown only\n");
    printf("        -h [ --help ]    This message.\n");
    printf("\n");
    printf("       Example invocation:\n");
@@ -586,6 +675,18 @@ void CFE_PSP_ProcessArgumentDefaults(CFE_PSP_CommandData_t *CommandDataDefault)
       CommandDataDefault->GotCpuName = 1;
    }
 
+   if ( CommandDataDefault->GotMemoryBackend == 0 )
+   {
+      CommandDataDefault->MemoryBackend = CFE_PSP_MEMORY_BACKEND_DEFAULT;
+      CommandDataDefault->GotMemoryBackend = 1;
+   }
+
+   if ( CommandDataDefault->GotMsyncPolicy == 0 )
+   {
+      CommandDataDefault->MsyncPolicy = CFE_PSP_MSYNC_POLICY_DEFAULT;
+      CommandDataDefault->GotMsyncPolicy = 1;
+   }
+
 }
 
 /******************************************************************************
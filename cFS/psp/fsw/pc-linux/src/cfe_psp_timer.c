@@ -26,6 +26,11 @@
 **   The functions here allow the cFE to interface functions that are board and OS specific
 **   and usually dont fit well in the OS abstraction layer.
 **
+**   The timebase is read directly from the invariant TSC where the CPU and
+**   the kernel allow it, so that performance log entries and time latching
+**   do not need a system call.  CFE_PSP_GetTime() uses the same count, so
+**   both are monotonic and agree with each other.
+**
 ** History:
 **   2005/06/05  K.Audra    | Initial version,
 **
@@ -47,24 +52,185 @@
 */
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <time.h>
 
 /*
 ** Types and prototypes for this module
 */
 #include "cfe_psp.h"
+#include "cfe_psp_config.h"
+#include "cfe_psp_timebase.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define CFE_PSP_TIMEBASE_HAVE_TSC
+#include <cpuid.h>
+#include <x86intrin.h>
+#endif
 
 
 /******************* Macro Definitions ***********************/
 
-#define CFE_PSP_TIMER_TICKS_PER_SECOND       1000000     /* Resolution of the least significant 32 bits of the 64 bit
-                                                           time stamp returned by OS_BSPGet_Timebase in timer ticks per second.
-                                                           The timer resolution for accuracy should not be any slower than 1000000
-                                                           ticks per second or 1 us per tick */
-#define CFE_PSP_TIMER_LOW32_ROLLOVER         1000000     /* The number that the least significant 32 bits of the 64 bit
-                                                           time stamp returned by OS_BSPGet_Timebase rolls over.  If the lower 32
-                                                           bits rolls at 1 second, then the OS_BSP_TIMER_LOW32_ROLLOVER will be 1000000.
-                                                           if the lower 32 bits rolls at its maximum value (2^32) then
-                                                           OS_BSP_TIMER_LOW32_ROLLOVER will be 0. */
+#define CFE_PSP_TIMER_NSEC_PER_SEC           1000000000
+#define CFE_PSP_TIMER_USEC_PER_SEC           1000000
+
+/* the kernel only uses the TSC as its clocksource if it found it reliable */
+#define CFE_PSP_TIMER_CLOCKSOURCE_FILE       "/sys/devices/system/clocksource/clocksource0/current_clocksource"
+
+/*
+ * Timebase state, set once by CFE_PSP_InitTimebase()
+ */
+typedef struct
+{
+    uint32    Source;           /* CFE_PSP_TIMEBASE_xxx */
+    uint32    TicksPerSecond;
+    uint32    Shift;            /* right shift applied to the TSC to keep TicksPerSecond in 32 bits */
+    uint64    BaseTicks;        /* timebase at the end of calibration */
+    OS_time_t BaseTime;         /* CLOCK_MONOTONIC_RAW at the same point */
+} CFE_PSP_TimebaseState_t;
+
+static CFE_PSP_TimebaseState_t CFE_PSP_TimebaseState =
+{
+    CFE_PSP_TIMEBASE_CLOCK, CFE_PSP_TIMER_NSEC_PER_SEC, 0, 0, { 0, 0 }
+};
+
+/*
+ * Current value of the 64 bit timebase
+ */
+static inline uint64 CFE_PSP_TimebaseRead(void)
+{
+    struct timespec now;
+
+#ifdef CFE_PSP_TIMEBASE_HAVE_TSC
+    if (CFE_PSP_TimebaseState.Source == CFE_PSP_TIMEBASE_TSC)
+    {
+        return __rdtsc() >> CFE_PSP_TimebaseState.Shift;
+    }
+#endif
+
+    clock_gettime(CLOCK_MONOTONIC_RAW, &now);
+    return ((uint64)now.tv_sec * CFE_PSP_TIMER_NSEC_PER_SEC) + now.tv_nsec;
+}
+
+#ifdef CFE_PSP_TIMEBASE_HAVE_TSC
+
+/*
+ * The TSC is usable if it runs at a constant rate in all power states
+ * (CPUID 80000007h, EDX bit 8) and the kernel has not rejected it.
+ */
+static bool CFE_PSP_TimebaseTscUsable(void)
+{
+    unsigned int eax, ebx, ecx, edx;
+    char clocksource[16];
+    FILE *fp;
+    bool usable;
+
+    if (!__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) || (edx & (1 << 8)) == 0)
+    {
+        return false;
+    }
+
+    usable = false;
+    fp = fopen(CFE_PSP_TIMER_CLOCKSOURCE_FILE, "r");
+    if (fp != NULL)
+    {
+        if (fgets(clocksource, sizeof(clocksource), fp) != NULL)
+        {
+            usable = (strncmp(clocksource, "tsc", 3) == 0);
+        }
+        fclose(fp);
+    }
+
+    return usable;
+}
+
+/*
+ * Read the TSC on either side of the kernel clock and take the midpoint
+ */
+static uint64 CFE_PSP_TimebaseSample(struct timespec *ts)
+{
+    uint64 before;
+    uint64 after;
+
+    before = __rdtsc();
+    clock_gettime(CLOCK_MONOTONIC_RAW, ts);
+    after = __rdtsc();
+
+    return before + ((after - before) / 2);
+}
+
+/*
+ * Measure the TSC rate against CLOCK_MONOTONIC_RAW and switch to it
+ */
+static void CFE_PSP_TimebaseCalibrate(void)
+{
+    struct timespec start;
+    struct timespec end;
+    struct timespec delay;
+    uint64 tsc_start;
+    uint64 tsc_end;
+    uint64 nsecs;
+    uint64 freq;
+    uint32 shift;
+
+    delay.tv_sec = CFE_PSP_TIMEBASE_CALIBRATION_MSEC / 1000;
+    delay.tv_nsec = (CFE_PSP_TIMEBASE_CALIBRATION_MSEC % 1000) * 1000000;
+
+    tsc_start = CFE_PSP_TimebaseSample(&start);
+    nanosleep(&delay, NULL);
+    tsc_end = CFE_PSP_TimebaseSample(&end);
+
+    nsecs = ((uint64)(end.tv_sec - start.tv_sec) * CFE_PSP_TIMER_NSEC_PER_SEC) + end.tv_nsec - start.tv_nsec;
+    if (nsecs == 0 || tsc_end <= tsc_start)
+    {
+        return;
+    }
+
+    freq = (uint64)((((double)(tsc_end - tsc_start) * CFE_PSP_TIMER_NSEC_PER_SEC) / nsecs) + 0.5);
+
+    shift = 0;
+    while ((freq >> shift) > 0xFFFFFFFF)
+    {
+        ++shift;
+    }
+
+    CFE_PSP_TimebaseState.TicksPerSecond = (uint32)(freq >> shift);
+    CFE_PSP_TimebaseState.Shift = shift;
+    CFE_PSP_TimebaseState.BaseTicks = tsc_end >> shift;
+    CFE_PSP_TimebaseState.BaseTime.seconds = end.tv_sec;
+    CFE_PSP_TimebaseState.BaseTime.microsecs = end.tv_nsec / 1000;
+    CFE_PSP_TimebaseState.Source = CFE_PSP_TIMEBASE_TSC;
+}
+
+#endif /* CFE_PSP_TIMEBASE_HAVE_TSC */
+
+/******************************************************************************
+**  Function:  CFE_PSP_InitTimebase()
+**
+**  Purpose:
+**    Selects the timebase.  The TSC is calibrated here, which takes
+**    CFE_PSP_TIMEBASE_CALIBRATION_MSEC.
+**
+**  Arguments:
+**
+**  Return:
+**    CFE_PSP_TIMEBASE_CLOCK or CFE_PSP_TIMEBASE_TSC
+*/
+uint32 CFE_PSP_InitTimebase(void)
+{
+#ifdef CFE_PSP_TIMEBASE_HAVE_TSC
+    if (CFE_PSP_TIMEBASE_USE_TSC && CFE_PSP_TimebaseTscUsable())
+    {
+        CFE_PSP_TimebaseCalibrate();
+    }
+#endif
+
+    OS_printf("CFE_PSP: Timebase is %s at %lu ticks per second\n",
+            (CFE_PSP_TimebaseState.Source == CFE_PSP_TIMEBASE_TSC) ? "the TSC" : "CLOCK_MONOTONIC_RAW",
+            (unsigned long)CFE_PSP_TimebaseState.TicksPerSecond);
+
+    return CFE_PSP_TimebaseState.Source;
+}
 
 /******************************************************************************
 **  Function:  CFE_PSP_GetTime()
@@ -76,11 +242,39 @@
 
 void CFE_PSP_GetTime( OS_time_t *LocalTime)
 {
+    struct timespec now;
+    uint64 ticks;
+    uint32 secs;
+    uint32 usecs;
+
+    /*
+     * Time since the host started, taken from the timebase so that
+     * latched times and performance log entries line up
+     */
+    if (CFE_PSP_TimebaseState.Source == CFE_PSP_TIMEBASE_TSC)
+    {
+        ticks = CFE_PSP_TimebaseRead() - CFE_PSP_TimebaseState.BaseTicks;
+        secs = ticks / CFE_PSP_TimebaseState.TicksPerSecond;
+        ticks -= (uint64)secs * CFE_PSP_TimebaseState.TicksPerSecond;
+        usecs = (ticks * CFE_PSP_TIMER_USEC_PER_SEC) / CFE_PSP_TimebaseState.TicksPerSecond;
 
-    /* since we don't have a hardware register to access like the mcp750,
-     * we use a call to the OS to get the time */
+        secs += CFE_PSP_TimebaseState.BaseTime.seconds;
+        usecs += CFE_PSP_TimebaseState.BaseTime.microsecs;
+        if (usecs >= CFE_PSP_TIMER_USEC_PER_SEC)
+        {
+            usecs -= CFE_PSP_TIMER_USEC_PER_SEC;
+            ++secs;
+        }
 
-    OS_GetLocalTime(LocalTime);
+        LocalTime->seconds = secs;
+        LocalTime->microsecs = usecs;
+    }
+    else
+    {
+        clock_gettime(CLOCK_MONOTONIC_RAW, &now);
+        LocalTime->seconds = now.tv_sec;
+        LocalTime->microsecs = now.tv_nsec / 1000;
+    }
 
 }/* end CFE_PSP_GetLocalTime */
 
@@ -122,7 +316,7 @@ uint32 CFE_PSP_Get_Timer_Tick(void)
 */
 uint32 CFE_PSP_GetTimerTicksPerSecond(void)
 {
-    return(CFE_PSP_TIMER_TICKS_PER_SECOND);
+    return(CFE_PSP_TimebaseState.TicksPerSecond);
 }
 
 /******************************************************************************
@@ -143,7 +337,8 @@ uint32 CFE_PSP_GetTimerTicksPerSecond(void)
 */
 uint32 CFE_PSP_GetTimerLow32Rollover(void)
 {
-    return(CFE_PSP_TIMER_LOW32_ROLLOVER);
+    /* both timebases are a plain 64 bit count */
+    return(0);
 }
 
 /******************************************************************************
@@ -161,11 +356,11 @@ uint32 CFE_PSP_GetTimerLow32Rollover(void)
 */
 void CFE_PSP_Get_Timebase(uint32 *Tbu, uint32* Tbl)
 {
-   OS_time_t        time;
+   uint64 ticks;
 
-   OS_GetLocalTime(&time);
-   *Tbu = time.seconds;
-   *Tbl = time.microsecs;
+   ticks = CFE_PSP_TimebaseRead();
+   *Tbu = (uint32)(ticks >> 32);
+   *Tbl = (uint32)ticks;
 }
 
 /******************************************************************************
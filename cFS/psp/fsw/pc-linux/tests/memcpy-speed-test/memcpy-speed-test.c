@@ -0,0 +1,243 @@
+/*
+**  GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**  Copyright (c) 2006-2019 United States Government as represented by
+**  the Administrator of the National Aeronautics and Space Administration.
+**  All Rights Reserved.
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**    http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+*/
+
+/*
+** Memory Copy, Fill and CRC Speed Test
+**
+** The first phase checks CFE_PSP_MemCpy() and CFE_PSP_MemSet()
+** against the C library with random alignments and sizes, from
+** a few bytes up to past the size at which streaming stores are
+** used, and checks that the bytes around the target are intact.
+**
+** The second phase checks CFE_PSP_MemCpyCrc() against the CRC-32
+** check value, with the data split at every possible point.
+**
+** The last phase gauges each call for sizes from 8 bytes to
+** 1 MiB, next to memcpy() and next to a copy followed by a
+** separate CRC pass.  Higher numbers indicate better performance.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "common_types.h"
+#include "osapi.h"
+#include "utassert.h"
+#include "uttest.h"
+#include "utbsp.h"
+
+#include "cfe_psp.h"
+#include "cfe_psp_memory.h"
+
+#define COPYTEST_MAX_SIZE       (1024 * 1024)
+#define COPYTEST_BIG_SIZE       (4 * 1024 * 1024)
+#define COPYTEST_GUARD          64
+#define COPYTEST_NUM_CHECKS     2000
+#define COPYTEST_RUN_TIME       20
+#define COPYTEST_BATCH_BYTES    65536
+
+uint8 src_buf[COPYTEST_BIG_SIZE + COPYTEST_GUARD];
+uint8 dst_buf[COPYTEST_BIG_SIZE + 3 * COPYTEST_GUARD];
+uint8 ref_buf[COPYTEST_BIG_SIZE + 3 * COPYTEST_GUARD];
+
+uint32 msec_since(const struct timespec *start)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((now.tv_sec - start->tv_sec) * 1000) + ((now.tv_nsec - start->tv_nsec) / 1000000);
+}
+
+uint32 RandomSize(uint32 i)
+{
+    /* mostly message-sized, with the occasional large block */
+    if ((i % 100) == 0)
+    {
+        return COPYTEST_BIG_SIZE - (rand() % 256);
+    }
+    if ((i % 4) == 0)
+    {
+        return 8 * (rand() % 9);
+    }
+    return rand() % 4096;
+}
+
+void CopyCheck(void)
+{
+    uint32 i;
+    uint32 size;
+    uint32 src_off;
+    uint32 dst_off;
+    uint32 errors;
+
+    for (i = 0; i < sizeof(src_buf); ++i)
+    {
+        src_buf[i] = rand();
+    }
+
+    errors = 0;
+    for (i = 0; i < COPYTEST_NUM_CHECKS; ++i)
+    {
+        size = RandomSize(i);
+        src_off = rand() % COPYTEST_GUARD;
+        dst_off = COPYTEST_GUARD + (rand() % COPYTEST_GUARD) - COPYTEST_GUARD / 2;
+
+        memset(dst_buf, 0xEE, dst_off + size + COPYTEST_GUARD);
+        memset(ref_buf, 0xEE, dst_off + size + COPYTEST_GUARD);
+        memcpy(ref_buf + dst_off, src_buf + src_off, size);
+        CFE_PSP_MemCpy(dst_buf + dst_off, src_buf + src_off, size);
+
+        if (memcmp(dst_buf, ref_buf, dst_off + size + COPYTEST_GUARD) != 0)
+        {
+            UtPrintf("MemCpy mismatch: size %u, src offset %u, dst offset %u\n",
+                    (unsigned int)size, (unsigned int)src_off, (unsigned int)dst_off);
+            ++errors;
+        }
+
+        memset(ref_buf + dst_off, i & 0xFF, size);
+        CFE_PSP_MemSet(dst_buf + dst_off, i & 0xFF, size);
+
+        if (memcmp(dst_buf, ref_buf, dst_off + size + COPYTEST_GUARD) != 0)
+        {
+            UtPrintf("MemSet mismatch: size %u, dst offset %u\n", (unsigned int)size, (unsigned int)dst_off);
+            ++errors;
+        }
+    }
+
+    UtAssert_True(errors == 0, "%u copies and fills, %u errors", (unsigned int)COPYTEST_NUM_CHECKS,
+            (unsigned int)errors);
+}
+
+void CrcCheck(void)
+{
+    static const char check[] = "123456789";
+    char copy[sizeof(check)];
+    uint32 crc;
+    uint32 split;
+    uint32 errors;
+    int32 status;
+
+    crc = 0;
+    memset(copy, 0, sizeof(copy));
+    status = CFE_PSP_MemCpyCrc(copy, check, 9, &crc);
+    UtAssert_True(status == CFE_PSP_SUCCESS, "MemCpyCrc Rc=%d", (int)status);
+    UtAssert_True(crc == 0xCBF43926, "CRC of \"%s\" = 0x%08x", check, (unsigned int)crc);
+    UtAssert_True(memcmp(copy, check, 9) == 0, "data copied");
+
+    errors = 0;
+    for (split = 0; split <= 9; ++split)
+    {
+        crc = 0;
+        CFE_PSP_MemCpyCrc(NULL, check, split, &crc);
+        CFE_PSP_MemCpyCrc(NULL, check + split, 9 - split, &crc);
+        if (crc != 0xCBF43926)
+        {
+            ++errors;
+        }
+    }
+    UtAssert_True(errors == 0, "CRC chained over two pieces, %u errors", (unsigned int)errors);
+
+    crc = 0;
+    UtAssert_True(CFE_PSP_MemCpyCrc(copy, NULL, 9, &crc) == CFE_PSP_INVALID_POINTER, "NULL source rejected");
+    UtAssert_True(CFE_PSP_MemCpyCrc(copy, check, 9, NULL) == CFE_PSP_INVALID_POINTER, "NULL CRC rejected");
+}
+
+/*
+ * Run one operation over and over for the test time and return MiB/sec
+ */
+unsigned long MeasureOp(uint32 Op, uint32 size)
+{
+    struct timespec start;
+    unsigned long count;
+    uint32 elapsed;
+    uint32 batch;
+    uint32 crc;
+    uint32 i;
+
+    batch = (COPYTEST_BATCH_BYTES / size) + 1;
+    count = 0;
+    crc = 0;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    do
+    {
+        for (i = 0; i < batch; ++i)
+        {
+            switch (Op)
+            {
+            case 0:
+                memcpy(dst_buf, src_buf, size);
+                break;
+            case 1:
+                CFE_PSP_MemCpy(dst_buf, src_buf, size);
+                break;
+            case 2:
+                CFE_PSP_MemSet(dst_buf, i & 0xFF, size);
+                break;
+            case 3:
+                CFE_PSP_MemCpyCrc(dst_buf, src_buf, size, &crc);
+                break;
+            default:
+                memcpy(dst_buf, src_buf, size);
+                CFE_PSP_MemCpyCrc(NULL, dst_buf, size, &crc);
+                break;
+            }
+        }
+        count += batch;
+        elapsed = msec_since(&start);
+    }
+    while (elapsed < COPYTEST_RUN_TIME);
+
+    return (unsigned long)(((double)count * size * 1000.0) / ((double)elapsed * 1024.0 * 1024.0));
+}
+
+void CopySpeed(void)
+{
+    uint32 size;
+
+    for (size = 8; size <= COPYTEST_MAX_SIZE; size *= 2)
+    {
+        UtPrintf("%8u bytes: memcpy %6lu, MemCpy %6lu, MemSet %6lu, MemCpyCrc %5lu, copy then CRC %5lu MiB/sec\n",
+                (unsigned int)size, MeasureOp(0, size), MeasureOp(1, size), MeasureOp(2, size),
+                MeasureOp(3, size), MeasureOp(4, size));
+    }
+}
+
+void UtTest_Setup(void)
+{
+    if (OS_API_Init() != OS_SUCCESS)
+    {
+        UtAssert_Abort("OS_API_Init() failed");
+    }
+
+    /* as done by the PSP startup */
+    CFE_PSP_MemOpsInit();
+
+    srand(1234);
+
+    /*
+     * Register the test setup and check routines in UT assert
+     */
+    UtTest_Add(CopyCheck, NULL, NULL, "CopyCheck");
+    UtTest_Add(CrcCheck, NULL, NULL, "CrcCheck");
+    UtTest_Add(CopySpeed, NULL, NULL, "CopySpeed");
+}
@@ -0,0 +1,353 @@
+/*
+**  GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**  Copyright (c) 2006-2019 United States Government as represented by
+**  the Administrator of the National Aeronautics and Space Administration.
+**  All Rights Reserved.
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**    http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+*/
+
+/*
+** File-backed CDS Write Latency Test
+**
+** This checks that an interrupted journaled write is completed
+** (or discarded, if the record is torn) when the file is mapped
+** again, and that writes from two tasks, interleaved with flushes,
+** all land and leave no journal record behind.  It then gauges the
+** latency of CDS-sized writes under each msync policy.
+**
+** For each policy a fixed number of writes is timed individually
+** and the average and worst case are indicated, along with the
+** time taken to close the file, which is where the ON_EXIT policy
+** pays for its deferred flush.  Lower numbers indicate better
+** performance; SYNC is expected to be orders of magnitude slower
+** as it waits for the disk twice per write.
+*/
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "common_types.h"
+#include "osapi.h"
+#include "utassert.h"
+#include "uttest.h"
+#include "utbsp.h"
+
+#include "cfe_psp.h"
+#include "cfe_psp_memory.h"
+#include "cfe_psp_memfile.h"
+
+#define MEMTEST_FILE            "memfile-speed.dat"
+#define MEMTEST_AREA_SIZE       65536
+#define MEMTEST_WRITE_SIZE      256
+#define MEMTEST_NUM_WRITES      200
+
+/*
+ * Note the writer priority must be lower than that of the
+ * executive (init) task, which flushes while they run.
+ */
+#define MEMTEST_WRITER_PRIORITY 150
+#define MEMTEST_NUM_WRITERS     2
+#define MEMTEST_WRITER_WAITS    1000
+
+uint8 write_buf[MEMTEST_WRITE_SIZE];
+uint8 read_buf[MEMTEST_WRITE_SIZE];
+
+CFE_PSP_MemFile_t shared_file;
+uint32 writer_errors[MEMTEST_NUM_WRITERS];
+volatile bool writer_done[MEMTEST_NUM_WRITERS];
+
+uint32 usec_since(const struct timespec *start)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((now.tv_sec - start->tv_sec) * 1000000) + ((now.tv_nsec - start->tv_nsec) / 1000);
+}
+
+/*
+ * Leave a journal record behind without applying it, as if the
+ * process had died in the middle of CFE_PSP_MemFile_Write().
+ * If Torn is set, the record data is damaged as well.
+ */
+void InterruptWrite(bool Torn)
+{
+    CFE_PSP_MemFile_t file;
+    int32 status;
+
+    status = CFE_PSP_MemFile_Open(&file, MEMTEST_FILE, MEMTEST_AREA_SIZE, true, CFE_PSP_MSYNC_SYNC);
+    UtAssert_True(status == CFE_PSP_SUCCESS, "Open Rc=%d", (int)status);
+    if (status != CFE_PSP_SUCCESS)
+    {
+        return;
+    }
+
+    memset(write_buf, 0xA5, sizeof(write_buf));
+    status = CFE_PSP_MemFile_Write(&file, 100, write_buf, sizeof(write_buf));
+    UtAssert_True(status == CFE_PSP_SUCCESS, "Write Rc=%d", (int)status);
+
+    memset(write_buf, 0x5A, sizeof(write_buf));
+    status = CFE_PSP_MemFile_Journal(&file, 100, write_buf, sizeof(write_buf));
+    UtAssert_True(status == CFE_PSP_SUCCESS, "Journal Rc=%d", (int)status);
+
+    if (Torn)
+    {
+        ((uint8 *)(file.Journal + 1))[MEMTEST_WRITE_SIZE / 2] ^= 0xFF;
+    }
+
+    CFE_PSP_MemFile_Close(&file);
+}
+
+void ReopenAndCheck(uint8 Expected, const char *what)
+{
+    CFE_PSP_MemFile_t file;
+    int32 status;
+    uint32 i;
+
+    status = CFE_PSP_MemFile_Open(&file, MEMTEST_FILE, MEMTEST_AREA_SIZE, true, CFE_PSP_MSYNC_SYNC);
+    UtAssert_True(status == CFE_PSP_SUCCESS, "Reopen Rc=%d", (int)status);
+    if (status != CFE_PSP_SUCCESS)
+    {
+        return;
+    }
+
+    memcpy(read_buf, file.BlockPtr + 100, sizeof(read_buf));
+    for (i = 0; i < sizeof(read_buf); ++i)
+    {
+        if (read_buf[i] != Expected)
+        {
+            break;
+        }
+    }
+
+    UtAssert_True(i == sizeof(read_buf), "%s: data 0x%02x at byte %u, expected 0x%02x", what,
+            (unsigned int)read_buf[i % sizeof(read_buf)], (unsigned int)i, (unsigned int)Expected);
+
+    CFE_PSP_MemFile_Remove(&file);
+    CFE_PSP_MemFile_Close(&file);
+}
+
+void JournalReplay(void)
+{
+    InterruptWrite(false);
+    ReopenAndCheck(0x5A, "interrupted write replayed");
+}
+
+void JournalDiscard(void)
+{
+    InterruptWrite(true);
+    ReopenAndCheck(0xA5, "torn record discarded");
+}
+
+/*
+ * Each writer fills its own half of the area with its own pattern
+ */
+void WriterLoop(uint32 idx)
+{
+    uint8  buf[MEMTEST_WRITE_SIZE];
+    uint32 half = MEMTEST_AREA_SIZE / MEMTEST_NUM_WRITERS;
+    uint32 i;
+
+    memset(buf, 0x11 * (idx + 1), sizeof(buf));
+
+    for (i = 0; i < MEMTEST_NUM_WRITES; ++i)
+    {
+        if (CFE_PSP_MemFile_Write(&shared_file, (idx * half) + ((i * MEMTEST_WRITE_SIZE) % half),
+                buf, sizeof(buf)) != CFE_PSP_SUCCESS)
+        {
+            ++writer_errors[idx];
+        }
+    }
+
+    writer_done[idx] = true;
+}
+
+void writer_task_1(void)
+{
+    WriterLoop(0);
+}
+
+void writer_task_2(void)
+{
+    WriterLoop(1);
+}
+
+void ConcurrentWriters(void)
+{
+    osal_task_entry entry[MEMTEST_NUM_WRITERS] = { writer_task_1, writer_task_2 };
+    char   name[OS_MAX_API_NAME];
+    uint32 task_id;
+    uint32 half = MEMTEST_AREA_SIZE / MEMTEST_NUM_WRITERS;
+    uint32 done;
+    uint32 wait;
+    uint32 bad;
+    uint32 i;
+    int32  status;
+
+    status = CFE_PSP_MemFile_Open(&shared_file, MEMTEST_FILE, MEMTEST_AREA_SIZE, true, CFE_PSP_MSYNC_ON_EXIT);
+    UtAssert_True(status == CFE_PSP_SUCCESS, "Open Rc=%d", (int)status);
+    if (status != CFE_PSP_SUCCESS)
+    {
+        return;
+    }
+
+    for (i = 0; i < MEMTEST_NUM_WRITERS; ++i)
+    {
+        writer_errors[i] = 0;
+        writer_done[i] = false;
+        snprintf(name, sizeof(name), "Writer %u", (unsigned int)i);
+        status = OS_TaskCreate(&task_id, name, entry[i], NULL, 4096, MEMTEST_WRITER_PRIORITY, 0);
+        UtAssert_True(status == OS_SUCCESS, "Task %u create Rc=%d", (unsigned int)i, (int)status);
+        if (status != OS_SUCCESS)
+        {
+            writer_done[i] = true;
+        }
+    }
+
+    /* flush alongside the writers, as the PSP main loop does */
+    done = 0;
+    for (wait = 0; wait < MEMTEST_WRITER_WAITS && done < MEMTEST_NUM_WRITERS; ++wait)
+    {
+        CFE_PSP_MemFile_Sync(&shared_file);
+        OS_TaskDelay(1);
+
+        done = 0;
+        for (i = 0; i < MEMTEST_NUM_WRITERS; ++i)
+        {
+            done += writer_done[i];
+        }
+    }
+
+    UtAssert_True(done == MEMTEST_NUM_WRITERS, "%u of %u writers finished",
+            (unsigned int)done, (unsigned int)MEMTEST_NUM_WRITERS);
+
+    for (i = 0; i < MEMTEST_NUM_WRITERS; ++i)
+    {
+        UtAssert_True(writer_errors[i] == 0, "Writer %u errors = %u",
+                (unsigned int)i, (unsigned int)writer_errors[i]);
+    }
+
+    UtAssert_True(shared_file.Journal->Magic == 0, "journal record cleared");
+
+    bad = 0;
+    for (i = 0; i < MEMTEST_AREA_SIZE; ++i)
+    {
+        if (shared_file.BlockPtr[i] != 0x11 * ((i / half) + 1))
+        {
+            ++bad;
+        }
+    }
+    UtAssert_True(bad == 0, "%u bytes not written by their writer", (unsigned int)bad);
+
+    CFE_PSP_MemFile_Remove(&shared_file);
+    CFE_PSP_MemFile_Close(&shared_file);
+}
+
+void MeasurePolicy(uint32 Policy, const char *what)
+{
+    CFE_PSP_MemFile_t file;
+    struct timespec start;
+    uint32 usec;
+    uint32 total_usec;
+    uint32 max_usec;
+    uint32 close_usec;
+    uint32 errors;
+    uint32 i;
+    int32 status;
+
+    status = CFE_PSP_MemFile_Open(&file, MEMTEST_FILE, MEMTEST_AREA_SIZE, true, Policy);
+    UtAssert_True(status == CFE_PSP_SUCCESS, "%s open Rc=%d", what, (int)status);
+    if (status != CFE_PSP_SUCCESS)
+    {
+        return;
+    }
+
+    total_usec = 0;
+    max_usec = 0;
+    errors = 0;
+    for (i = 0; i < MEMTEST_NUM_WRITES; ++i)
+    {
+        memset(write_buf, i, sizeof(write_buf));
+
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        status = CFE_PSP_MemFile_Write(&file, (i * MEMTEST_WRITE_SIZE) % MEMTEST_AREA_SIZE,
+                write_buf, sizeof(write_buf));
+        CFE_PSP_MemFile_Poll(&file);
+        usec = usec_since(&start);
+
+        if (status != CFE_PSP_SUCCESS)
+        {
+            ++errors;
+        }
+
+        total_usec += usec;
+        if (usec > max_usec)
+        {
+            max_usec = usec;
+        }
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    CFE_PSP_MemFile_Close(&file);
+    close_usec = usec_since(&start);
+    unlink(MEMTEST_FILE);
+
+    UtAssert_True(errors == 0, "%s write errors = %u", what, (unsigned int)errors);
+
+    UtPrintf("%s: %u writes of %u bytes, avg %u usec, max %u usec, close %u usec\n", what,
+            (unsigned int)MEMTEST_NUM_WRITES, (unsigned int)MEMTEST_WRITE_SIZE,
+            (unsigned int)(total_usec / MEMTEST_NUM_WRITES), (unsigned int)max_usec,
+            (unsigned int)close_usec);
+}
+
+void SyncLatency(void)
+{
+    MeasurePolicy(CFE_PSP_MSYNC_SYNC, "msync sync");
+}
+
+void PeriodicLatency(void)
+{
+    MeasurePolicy(CFE_PSP_MSYNC_PERIODIC, "msync periodic");
+}
+
+void OnExitLatency(void)
+{
+    MeasurePolicy(CFE_PSP_MSYNC_ON_EXIT, "msync on exit");
+}
+
+void UtTest_Setup(void)
+{
+    if (OS_API_Init() != OS_SUCCESS)
+    {
+        UtAssert_Abort("OS_API_Init() failed");
+    }
+
+    /* as done by the PSP startup */
+    CFE_PSP_MemOpsInit();
+
+    /* start from a fresh file */
+    unlink(MEMTEST_FILE);
+
+    /*
+     * Register the test setup and check routines in UT assert
+     */
+    UtTest_Add(JournalReplay, NULL, NULL, "JournalReplay");
+    UtTest_Add(JournalDiscard, NULL, NULL, "JournalDiscard");
+    UtTest_Add(ConcurrentWriters, NULL, NULL, "ConcurrentWriters");
+    UtTest_Add(SyncLatency, NULL, NULL, "SyncLatency");
+    UtTest_Add(PeriodicLatency, NULL, NULL, "PeriodicLatency");
+    UtTest_Add(OnExitLatency, NULL, NULL, "OnExitLatency");
+}
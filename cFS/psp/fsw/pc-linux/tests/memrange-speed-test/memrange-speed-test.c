@@ -0,0 +1,468 @@
+/*
+**  GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**  Copyright (c) 2006-2019 United States Government as represented by
+**  the Administrator of the National Aeronautics and Space Administration.
+**  All Rights Reserved.
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**    http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+*/
+
+/*
+** Memory Range Validation and Block Copy Speed Test
+**
+** The first phase checks the interval index behind
+** CFE_PSP_MemValidateRange() against a plain scan of the
+** memory table, using random (and often overlapping) tables
+** and random queries, and then checks lookups made while
+** another task keeps rebuilding the index.  Addresses are
+** never dereferenced here.
+**
+** The second phase checks CFE_PSP_MemReadBlock() and
+** CFE_PSP_MemWriteBlock() on RAM and EEPROM ranges backed by
+** local buffers, with unaligned start addresses and sizes.
+**
+** The last phase gauges validation with a full table, and a
+** 4 KiB dump through CFE_PSP_MemReadBlock() against the same
+** dump done one validated byte at a time.  Higher numbers
+** indicate better performance.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "common_types.h"
+#include "osapi.h"
+#include "utassert.h"
+#include "uttest.h"
+#include "utbsp.h"
+
+#include "cfe_psp.h"
+#include "cfe_psp_config.h"
+#include "cfe_psp_configdata.h"
+#include "cfe_psp_memory.h"
+
+#define RANGETEST_NUM_TABLES    200
+#define RANGETEST_NUM_QUERIES   500
+#define RANGETEST_ADDR_SPAN     0x10000
+#define RANGETEST_BLOCK_SIZE    4096
+#define RANGETEST_RUN_TIME      1000
+#define RANGETEST_BATCH         1000
+
+/*
+ * Note the rebuild task priority must be lower than that of
+ * the executive (init) task, which stops it.
+ */
+#define RANGETEST_TASK_PRIORITY 150
+
+/*
+ * The PSP code under test looks up this table
+ */
+CFE_PSP_MemTable_t CFE_PSP_MemoryTable[CFE_PSP_MEM_TABLE_SIZE];
+
+uint32 ram_buf[RANGETEST_BLOCK_SIZE / sizeof(uint32)];
+uint32 eeprom_buf[RANGETEST_BLOCK_SIZE / sizeof(uint32)];
+uint8  pattern[RANGETEST_BLOCK_SIZE];
+uint8  readback[RANGETEST_BLOCK_SIZE];
+
+volatile bool   rebuild_stop;
+volatile bool   rebuild_done;
+volatile uint32 rebuild_count;
+
+/*
+ * Reference result: does a single table entry of the given type hold the range?
+ */
+bool RefRangeIsValid(cpuaddr Address, uint32 Size, uint32 MemoryType)
+{
+    cpuaddr EndAddress = Address + Size - 1;
+    cpuaddr EntryEnd;
+    uint32 i;
+
+    if (Size == 0 || EndAddress < Address)
+    {
+        return false;
+    }
+
+    for (i = 0; i < CFE_PSP_MEM_TABLE_SIZE; i++)
+    {
+        if (CFE_PSP_MemoryTable[i].MemoryType == CFE_PSP_MEM_INVALID || CFE_PSP_MemoryTable[i].Size == 0)
+        {
+            continue;
+        }
+
+        EntryEnd = CFE_PSP_MemoryTable[i].StartAddr + CFE_PSP_MemoryTable[i].Size - 1;
+        if (Address >= CFE_PSP_MemoryTable[i].StartAddr && EndAddress <= EntryEnd &&
+                (MemoryType == CFE_PSP_MEM_ANY || MemoryType == CFE_PSP_MemoryTable[i].MemoryType))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+uint32 msec_since(const struct timespec *start)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((now.tv_sec - start->tv_sec) * 1000) + ((now.tv_nsec - start->tv_nsec) / 1000000);
+}
+
+void SetRandomTable(uint32 NumEntries)
+{
+    uint32 i;
+
+    /* the unused entries are written directly, and indexed by the last set */
+    memset(CFE_PSP_MemoryTable, 0, sizeof(CFE_PSP_MemoryTable));
+    for (i = 0; i < CFE_PSP_MEM_TABLE_SIZE; i++)
+    {
+        CFE_PSP_MemoryTable[i].MemoryType = CFE_PSP_MEM_INVALID;
+    }
+
+    for (i = 0; i < NumEntries; i++)
+    {
+        CFE_PSP_MemRangeSet(i, (rand() & 1) ? CFE_PSP_MEM_RAM : CFE_PSP_MEM_EEPROM,
+                rand() % RANGETEST_ADDR_SPAN, 1 + (rand() % (RANGETEST_ADDR_SPAN / 4)),
+                CFE_PSP_MEM_SIZE_BYTE, CFE_PSP_MEM_ATTR_READWRITE);
+    }
+}
+
+void IndexMatchesScan(void)
+{
+    static const uint32 Types[] = { CFE_PSP_MEM_ANY, CFE_PSP_MEM_RAM, CFE_PSP_MEM_EEPROM };
+    uint32 mismatches = 0;
+    uint32 checked = 0;
+    uint32 valid = 0;
+    uint32 t;
+    uint32 q;
+    uint32 k;
+    cpuaddr Address;
+    uint32 Size;
+    bool expected;
+    int32 status;
+
+    srand(1);
+    for (t = 0; t < RANGETEST_NUM_TABLES; t++)
+    {
+        SetRandomTable(1 + (t % CFE_PSP_MEM_TABLE_SIZE));
+
+        for (q = 0; q < RANGETEST_NUM_QUERIES; q++)
+        {
+            /* bias queries toward entry edges, where the bugs would be */
+            k = rand() % CFE_PSP_MEM_TABLE_SIZE;
+            if ((q & 1) && CFE_PSP_MemoryTable[k].MemoryType != CFE_PSP_MEM_INVALID)
+            {
+                Address = CFE_PSP_MemoryTable[k].StartAddr + (rand() % 3) - 1;
+            }
+            else
+            {
+                Address = rand() % (RANGETEST_ADDR_SPAN + RANGETEST_ADDR_SPAN / 4);
+            }
+            Size = rand() % (RANGETEST_ADDR_SPAN / 4);
+
+            for (k = 0; k < 3; k++)
+            {
+                expected = RefRangeIsValid(Address, Size, Types[k]);
+                status = CFE_PSP_MemValidateRange(Address, Size, Types[k]);
+                if (expected != (status == CFE_PSP_SUCCESS))
+                {
+                    ++mismatches;
+                }
+                valid += expected;
+                ++checked;
+            }
+        }
+    }
+
+    UtAssert_True(mismatches == 0, "%u of %u validations differ from a table scan (%u valid)",
+            (unsigned int)mismatches, (unsigned int)checked, (unsigned int)valid);
+}
+
+/*
+ * Moves an EEPROM entry from below to above a fixed RAM entry and back,
+ * which shifts every segment of the index, until told to stop
+ */
+void RebuildTask(void)
+{
+    cpuaddr Address;
+
+    while (!rebuild_stop)
+    {
+        Address = (rebuild_count & 1) ? 0x8000 : 0x0800;
+        CFE_PSP_MemRangeSet(1, CFE_PSP_MEM_EEPROM, Address, 0x100,
+                CFE_PSP_MEM_SIZE_BYTE, CFE_PSP_MEM_ATTR_READWRITE);
+        ++rebuild_count;
+    }
+
+    rebuild_done = true;
+}
+
+void ValidateDuringRebuild(void)
+{
+    struct timespec start;
+    uint32 task_id;
+    uint32 count;
+    uint32 mismatches;
+    uint32 wait;
+    uint32 i;
+    int32 status;
+
+    SetRandomTable(0);
+    CFE_PSP_MemRangeSet(0, CFE_PSP_MEM_RAM, 0x1000, 0x1000, CFE_PSP_MEM_SIZE_BYTE, CFE_PSP_MEM_ATTR_READWRITE);
+
+    rebuild_stop = false;
+    rebuild_done = false;
+    rebuild_count = 0;
+    status = OS_TaskCreate(&task_id, "Rebuild", RebuildTask, NULL, 4096, RANGETEST_TASK_PRIORITY, 0);
+    UtAssert_True(status == OS_SUCCESS, "Task create Rc=%d", (int)status);
+    if (status != OS_SUCCESS)
+    {
+        return;
+    }
+
+    /* the answers for these ranges do not depend on where the EEPROM entry is */
+    count = 0;
+    mismatches = 0;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    do
+    {
+        for (i = 0; i < RANGETEST_BATCH; i++, count++)
+        {
+            mismatches += (CFE_PSP_MemValidateRange(0x1800, 16, CFE_PSP_MEM_RAM) != CFE_PSP_SUCCESS);
+            mismatches += (CFE_PSP_MemValidateRange(0x3000, 16, CFE_PSP_MEM_ANY) != CFE_PSP_INVALID_MEM_ADDR);
+        }
+
+        /* give the rebuild task its turn */
+        OS_TaskDelay(1);
+    }
+    while (msec_since(&start) < RANGETEST_RUN_TIME / 2);
+
+    rebuild_stop = true;
+    for (wait = 0; wait < 1000 && !rebuild_done; ++wait)
+    {
+        OS_TaskDelay(1);
+    }
+
+    UtAssert_True(rebuild_done, "rebuild task finished after %u rebuilds", (unsigned int)rebuild_count);
+    UtAssert_True(mismatches == 0, "%u of %u validations wrong during rebuilds",
+            (unsigned int)mismatches, (unsigned int)count * 2);
+}
+
+void ValidateErrorCodes(void)
+{
+    memset(CFE_PSP_MemoryTable, 0, sizeof(CFE_PSP_MemoryTable));
+    CFE_PSP_MemRangeSet(0, CFE_PSP_MEM_RAM, 0x1000, 0x1000, CFE_PSP_MEM_SIZE_BYTE, CFE_PSP_MEM_ATTR_READWRITE);
+    CFE_PSP_MemRangeSet(1, CFE_PSP_MEM_EEPROM, 0x1800, 0x100, CFE_PSP_MEM_SIZE_BYTE, CFE_PSP_MEM_ATTR_READWRITE);
+    CFE_PSP_MemRangeSet(3, CFE_PSP_MEM_RAM, 0x2000, 0x1000, CFE_PSP_MEM_SIZE_BYTE, CFE_PSP_MEM_ATTR_READWRITE);
+
+    UtAssert_True(CFE_PSP_MemValidateRange(0x1000, 0x1000, CFE_PSP_MEM_RAM) == CFE_PSP_SUCCESS,
+            "whole RAM entry");
+    UtAssert_True(CFE_PSP_MemValidateRange(0x1810, 0x10, CFE_PSP_MEM_EEPROM) == CFE_PSP_SUCCESS,
+            "EEPROM inside RAM, as EEPROM");
+    UtAssert_True(CFE_PSP_MemValidateRange(0x1810, 0x10, CFE_PSP_MEM_RAM) == CFE_PSP_SUCCESS,
+            "EEPROM inside RAM, as RAM");
+    UtAssert_True(CFE_PSP_MemValidateRange(0x1810, 0x100, CFE_PSP_MEM_EEPROM) == CFE_PSP_INVALID_MEM_TYPE,
+            "past the EEPROM end but within RAM, as EEPROM");
+    UtAssert_True(CFE_PSP_MemValidateRange(0x1F00, 0x200, CFE_PSP_MEM_RAM) == CFE_PSP_INVALID_MEM_RANGE,
+            "across two adjacent RAM entries");
+    UtAssert_True(CFE_PSP_MemValidateRange(0x0FFF, 1, CFE_PSP_MEM_ANY) == CFE_PSP_INVALID_MEM_ADDR,
+            "below the first entry");
+    UtAssert_True(CFE_PSP_MemValidateRange(0x3000, 1, CFE_PSP_MEM_ANY) == CFE_PSP_INVALID_MEM_ADDR,
+            "past the last entry");
+    UtAssert_True(CFE_PSP_MemValidateRange(0x1000, 0, CFE_PSP_MEM_ANY) == CFE_PSP_INVALID_MEM_RANGE,
+            "zero size");
+    UtAssert_True(CFE_PSP_MemValidateRange(0x1000, 1, 99) == CFE_PSP_INVALID_MEM_TYPE,
+            "bad type");
+}
+
+void BlockCopy(void)
+{
+    uint32 i;
+    uint32 errors;
+    uint32 offset;
+    uint32 size;
+    int32 status;
+
+    for (i = 0; i < sizeof(pattern); i++)
+    {
+        pattern[i] = (uint8)(i * 7 + 3);
+    }
+
+    memset(CFE_PSP_MemoryTable, 0, sizeof(CFE_PSP_MemoryTable));
+    for (i = 2; i < CFE_PSP_MEM_TABLE_SIZE; i++)
+    {
+        CFE_PSP_MemoryTable[i].MemoryType = CFE_PSP_MEM_INVALID;
+    }
+    CFE_PSP_MemRangeSet(0, CFE_PSP_MEM_RAM, (cpuaddr)ram_buf, sizeof(ram_buf),
+            CFE_PSP_MEM_SIZE_BYTE, CFE_PSP_MEM_ATTR_READWRITE);
+    CFE_PSP_MemRangeSet(1, CFE_PSP_MEM_EEPROM, (cpuaddr)eeprom_buf, sizeof(eeprom_buf),
+            CFE_PSP_MEM_SIZE_DWORD, CFE_PSP_MEM_ATTR_READWRITE);
+
+    errors = 0;
+    for (offset = 0; offset < 8; offset++)
+    {
+        for (size = 1; size < 40; size += 3)
+        {
+            memset(ram_buf, 0xEE, sizeof(ram_buf));
+            memset(eeprom_buf, 0xEE, sizeof(eeprom_buf));
+
+            status = CFE_PSP_MemWriteBlock((cpuaddr)ram_buf + offset, pattern, size);
+            errors += (status != CFE_PSP_SUCCESS);
+            status = CFE_PSP_MemWriteBlock((cpuaddr)eeprom_buf + offset, pattern, size);
+            errors += (status != CFE_PSP_SUCCESS);
+
+            /* the bytes around the block must be left alone */
+            errors += (memcmp((uint8 *)ram_buf + offset, pattern, size) != 0);
+            errors += (memcmp((uint8 *)eeprom_buf + offset, pattern, size) != 0);
+            errors += (offset > 0 && ((uint8 *)eeprom_buf)[offset - 1] != 0xEE);
+            errors += (((uint8 *)eeprom_buf)[offset + size] != 0xEE);
+
+            memset(readback, 0, sizeof(readback));
+            status = CFE_PSP_MemReadBlock((cpuaddr)eeprom_buf + offset, readback, size);
+            errors += (status != CFE_PSP_SUCCESS);
+            errors += (memcmp(readback, pattern, size) != 0);
+        }
+    }
+
+    UtAssert_True(errors == 0, "block read/write errors = %u", (unsigned int)errors);
+
+    status = CFE_PSP_MemReadBlock((cpuaddr)ram_buf + 1, readback, sizeof(ram_buf));
+    UtAssert_True(status == CFE_PSP_INVALID_MEM_RANGE, "read past the end Rc=%d", (int)status);
+    status = CFE_PSP_MemWriteBlock((cpuaddr)ram_buf, NULL, 4);
+    UtAssert_True(status == CFE_PSP_INVALID_POINTER, "write from NULL Rc=%d", (int)status);
+    status = CFE_PSP_MemWriteBlock((cpuaddr)ram_buf, pattern, 0);
+    UtAssert_True(status == CFE_PSP_SUCCESS, "empty write Rc=%d", (int)status);
+}
+
+void ValidateSpeed(void)
+{
+    struct timespec start;
+    uint32 count;
+    uint32 elapsed;
+    uint32 ok;
+    uint32 i;
+
+    srand(2);
+    SetRandomTable(CFE_PSP_MEM_TABLE_SIZE);
+
+    /* index */
+    count = 0;
+    ok = 0;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    do
+    {
+        for (i = 0; i < RANGETEST_BATCH; i++, count++)
+        {
+            ok += (CFE_PSP_MemValidateRange(count % RANGETEST_ADDR_SPAN, 16, CFE_PSP_MEM_RAM) == CFE_PSP_SUCCESS);
+        }
+        elapsed = msec_since(&start);
+    }
+    while (elapsed < RANGETEST_RUN_TIME);
+
+    UtAssert_True(count > 0, "index validations = %u (%u valid)", (unsigned int)count, (unsigned int)ok);
+    UtPrintf("MemValidateRange, %u entries: %lu validations/sec\n", (unsigned int)CFE_PSP_MEM_TABLE_SIZE,
+            (unsigned long)count * 1000 / elapsed);
+
+    /* table scan, for comparison */
+    count = 0;
+    ok = 0;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    do
+    {
+        for (i = 0; i < RANGETEST_BATCH; i++, count++)
+        {
+            ok += RefRangeIsValid(count % RANGETEST_ADDR_SPAN, 16, CFE_PSP_MEM_RAM);
+        }
+        elapsed = msec_since(&start);
+    }
+    while (elapsed < RANGETEST_RUN_TIME);
+
+    UtPrintf("table scan, %u entries: %lu validations/sec\n", (unsigned int)CFE_PSP_MEM_TABLE_SIZE,
+            (unsigned long)count * 1000 / elapsed);
+}
+
+void BlockSpeed(void)
+{
+    struct timespec start;
+    uint32 count;
+    uint32 elapsed;
+    uint32 errors;
+    uint32 i;
+    uint8  value;
+
+    memset(CFE_PSP_MemoryTable, 0, sizeof(CFE_PSP_MemoryTable));
+    for (i = 1; i < CFE_PSP_MEM_TABLE_SIZE; i++)
+    {
+        CFE_PSP_MemoryTable[i].MemoryType = CFE_PSP_MEM_INVALID;
+    }
+    CFE_PSP_MemRangeSet(0, CFE_PSP_MEM_RAM, (cpuaddr)ram_buf, sizeof(ram_buf),
+            CFE_PSP_MEM_SIZE_BYTE, CFE_PSP_MEM_ATTR_READWRITE);
+
+    count = 0;
+    errors = 0;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    do
+    {
+        errors += (CFE_PSP_MemReadBlock((cpuaddr)ram_buf, readback, sizeof(readback)) != CFE_PSP_SUCCESS);
+        ++count;
+        elapsed = msec_since(&start);
+    }
+    while (elapsed < RANGETEST_RUN_TIME);
+
+    UtAssert_True(errors == 0, "block read errors = %u", (unsigned int)errors);
+    UtPrintf("MemReadBlock: %lu KiB/sec\n", (unsigned long)count * 1000 / elapsed * (sizeof(readback) / 1024));
+
+    count = 0;
+    errors = 0;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    do
+    {
+        for (i = 0; i < sizeof(readback); i++)
+        {
+            errors += (CFE_PSP_MemValidateRange((cpuaddr)ram_buf + i, 1, CFE_PSP_MEM_ANY) != CFE_PSP_SUCCESS);
+            errors += (CFE_PSP_MemRead8((cpuaddr)ram_buf + i, &value) != CFE_PSP_SUCCESS);
+            readback[i] = value;
+        }
+        ++count;
+        elapsed = msec_since(&start);
+    }
+    while (elapsed < RANGETEST_RUN_TIME);
+
+    UtAssert_True(errors == 0, "byte read errors = %u", (unsigned int)errors);
+    UtPrintf("MemValidateRange + MemRead8 per byte: %lu KiB/sec\n",
+            (unsigned long)count * 1000 / elapsed * (sizeof(readback) / 1024));
+}
+
+void UtTest_Setup(void)
+{
+    if (OS_API_Init() != OS_SUCCESS)
+    {
+        UtAssert_Abort("OS_API_Init() failed");
+    }
+
+    /* as done by the PSP startup */
+    CFE_PSP_MemRangeInit();
+
+    /*
+     * Register the test setup and check routines in UT assert
+     */
+    UtTest_Add(IndexMatchesScan, NULL, NULL, "IndexMatchesScan");
+    UtTest_Add(ValidateErrorCodes, NULL, NULL, "ValidateErrorCodes");
+    UtTest_Add(ValidateDuringRebuild, NULL, NULL, "ValidateDuringRebuild");
+    UtTest_Add(BlockCopy, NULL, NULL, "BlockCopy");
+    UtTest_Add(ValidateSpeed, NULL, NULL, "ValidateSpeed");
+    UtTest_Add(BlockSpeed, NULL, NULL, "BlockSpeed");
+}
@@ -0,0 +1,212 @@
+/*
+**  GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**  Copyright (c) 2006-2019 United States Government as represented by
+**  the Administrator of the National Aeronautics and Space Administration.
+**  All Rights Reserved.
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**    http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+*/
+
+/*
+** PSP Timebase Speed Test
+**
+** The first phase checks that CFE_PSP_Get_Timebase() and
+** CFE_PSP_GetTime() never go backwards, and that the low 32
+** bits roll over as CFE_PSP_GetTimerLow32Rollover() says.
+**
+** The second phase checks the reported ticks per second
+** against CLOCK_MONOTONIC_RAW over a longer interval than the
+** startup calibration, and that CFE_PSP_GetTime() agrees with
+** that clock.
+**
+** The last phase gauges the cost of reading the timebase and
+** the time, next to OS_GetLocalTime().  Lower numbers indicate
+** better performance.
+*/
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "common_types.h"
+#include "osapi.h"
+#include "utassert.h"
+#include "uttest.h"
+#include "utbsp.h"
+
+#include "cfe_psp.h"
+#include "cfe_psp_timebase.h"
+
+#define TIMETEST_NUM_READS      1000000
+#define TIMETEST_RATE_MSEC      500
+#define TIMETEST_MAX_PPM        1000
+#define TIMETEST_MAX_SKEW_USEC  1000
+#define TIMETEST_RUN_TIME       500
+#define TIMETEST_BATCH          1000
+
+uint32 Source;
+
+uint64 read_timebase(void)
+{
+    uint32 Tbu;
+    uint32 Tbl;
+
+    CFE_PSP_Get_Timebase(&Tbu, &Tbl);
+
+    return ((uint64)Tbu << 32) | Tbl;
+}
+
+uint64 raw_nsecs(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC_RAW, &now);
+
+    return ((uint64)now.tv_sec * 1000000000) + now.tv_nsec;
+}
+
+void Monotonic(void)
+{
+    OS_time_t now;
+    OS_time_t last;
+    uint64 prev;
+    uint64 curr;
+    uint32 backwards;
+    uint32 i;
+
+    UtAssert_True(CFE_PSP_GetTimerLow32Rollover() == 0, "low 32 bits roll over at 2^32");
+
+    backwards = 0;
+    prev = read_timebase();
+    for (i = 0; i < TIMETEST_NUM_READS; ++i)
+    {
+        curr = read_timebase();
+        if (curr < prev)
+        {
+            ++backwards;
+        }
+        prev = curr;
+    }
+    UtAssert_True(backwards == 0, "CFE_PSP_Get_Timebase went backwards %u times", (unsigned int)backwards);
+
+    backwards = 0;
+    CFE_PSP_GetTime(&last);
+    for (i = 0; i < TIMETEST_NUM_READS; ++i)
+    {
+        CFE_PSP_GetTime(&now);
+        if (now.microsecs >= 1000000 || now.seconds < last.seconds ||
+                (now.seconds == last.seconds && now.microsecs < last.microsecs))
+        {
+            ++backwards;
+        }
+        last = now;
+    }
+    UtAssert_True(backwards == 0, "CFE_PSP_GetTime went backwards %u times", (unsigned int)backwards);
+}
+
+void Rate(void)
+{
+    struct timespec delay;
+    OS_time_t now;
+    uint64 tb_start;
+    uint64 ns_start;
+    uint64 tb_end;
+    uint64 ns_end;
+    double expected;
+    double ppm;
+    int64 skew;
+
+    tb_start = read_timebase();
+    ns_start = raw_nsecs();
+
+    delay.tv_sec = TIMETEST_RATE_MSEC / 1000;
+    delay.tv_nsec = (TIMETEST_RATE_MSEC % 1000) * 1000000;
+    nanosleep(&delay, NULL);
+
+    tb_end = read_timebase();
+    ns_end = raw_nsecs();
+
+    expected = ((double)(ns_end - ns_start) * CFE_PSP_GetTimerTicksPerSecond()) / 1000000000.0;
+    ppm = (((double)(tb_end - tb_start) - expected) * 1000000.0) / expected;
+    UtAssert_True(ppm < TIMETEST_MAX_PPM && ppm > -TIMETEST_MAX_PPM,
+            "%lu ticks per second, off by %d ppm", (unsigned long)CFE_PSP_GetTimerTicksPerSecond(), (int)ppm);
+
+    CFE_PSP_GetTime(&now);
+    skew = (((int64)now.seconds * 1000000) + now.microsecs) - (int64)(raw_nsecs() / 1000);
+    UtAssert_True(skew < TIMETEST_MAX_SKEW_USEC && skew > -TIMETEST_MAX_SKEW_USEC,
+            "CFE_PSP_GetTime is %ld usec from CLOCK_MONOTONIC_RAW", (long)skew);
+}
+
+void MeasureCall(uint32 Call, const char *what)
+{
+    uint64 start;
+    uint64 elapsed;
+    unsigned long count;
+    OS_time_t now;
+    uint32 Tbu;
+    uint32 Tbl;
+    uint32 i;
+
+    count = 0;
+    start = raw_nsecs();
+    do
+    {
+        for (i = 0; i < TIMETEST_BATCH; ++i)
+        {
+            switch (Call)
+            {
+            case 0:
+                CFE_PSP_Get_Timebase(&Tbu, &Tbl);
+                break;
+            case 1:
+                CFE_PSP_GetTime(&now);
+                break;
+            default:
+                OS_GetLocalTime(&now);
+                break;
+            }
+        }
+        count += TIMETEST_BATCH;
+        elapsed = raw_nsecs() - start;
+    }
+    while (elapsed < (uint64)TIMETEST_RUN_TIME * 1000000);
+
+    UtPrintf("%s: %lu.%02lu nsec per call\n", what, (unsigned long)(elapsed / count),
+            (unsigned long)(((elapsed % count) * 100) / count));
+}
+
+void ReadSpeed(void)
+{
+    UtPrintf("timebase is %s\n", (Source == CFE_PSP_TIMEBASE_TSC) ? "the TSC" : "CLOCK_MONOTONIC_RAW");
+
+    MeasureCall(0, "CFE_PSP_Get_Timebase");
+    MeasureCall(1, "CFE_PSP_GetTime");
+    MeasureCall(2, "OS_GetLocalTime");
+}
+
+void UtTest_Setup(void)
+{
+    if (OS_API_Init() != OS_SUCCESS)
+    {
+        UtAssert_Abort("OS_API_Init() failed");
+    }
+
+    Source = CFE_PSP_InitTimebase();
+
+    /*
+     * Register the test setup and check routines in UT assert
+     */
+    UtTest_Add(Monotonic, NULL, NULL, "Monotonic");
+    UtTest_Add(Rate, NULL, NULL, "Rate");
+    UtTest_Add(ReadSpeed, NULL, NULL, "ReadSpeed");
+}
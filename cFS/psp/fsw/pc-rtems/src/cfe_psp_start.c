@@ -252,11 +252,21 @@ void CFE_PSP_Main(void)
        CFE_PSP_Panic(Status);
    }
 
+   /*
+    * Set up the memory copy routines, which the reserved memory uses
+    */
+   CFE_PSP_MemOpsInit();
+
    /*
     * Initialize the CFE reserved memory map
     */
    CFE_PSP_SetupReservedMemoryMap();
 
+   /*
+    * Index the memory range table for range validation
+    */
+   CFE_PSP_MemRangeInit();
+
    /*
    ** Set up the virtual FS mapping for the "/cf" directory
    */
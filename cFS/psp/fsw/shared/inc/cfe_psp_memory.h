@@ -94,6 +94,26 @@ extern int32 CFE_PSP_InitProcessorReservedMemory(uint32 RestartType );
 extern void CFE_PSP_DeleteProcessorReservedMemory(void);
 
 
+/**
+ * \brief Build the lookup index of the CFE_PSP_MemoryTable
+ *
+ * This must be called by the startup code after OS_API_Init() and before
+ * any memory range is validated or set.  Afterwards the index is only
+ * rebuilt by CFE_PSP_MemRangeSet().
+ */
+extern void CFE_PSP_MemRangeInit(void);
+
+
+/**
+ * \brief Select the memory copy implementation and build the CRC tables
+ *
+ * This must be called by the startup code before CFE_PSP_MemCpy(),
+ * CFE_PSP_MemSet() or CFE_PSP_MemCpyCrc() is used, including by the
+ * reserved memory setup.
+ */
+extern void CFE_PSP_MemOpsInit(void);
+
+
 /*
 ** External variables
 */
@@ -41,6 +41,294 @@
  */
 #include "cfe_psp_config.h"
 #include "cfe_psp_configdata.h"
+#include "cfe_psp_memory.h"
+
+/*
+** Interval index over CFE_PSP_MemoryTable
+**
+** The table entries may overlap (e.g. an EEPROM range inside a RAM range), so
+** the address space is split at every entry boundary into sorted, disjoint
+** segments.  Every entry either covers a segment completely or not at all, so
+** for each segment it is enough to keep the furthest end address reached by
+** an entry of each type that covers it.  A range then fits in a single entry of
+** type T if and only if the segment holding its start address has a type T end
+** at or beyond the range end, which takes one binary search to find.
+**
+** The index is built by CFE_PSP_MemRangeInit() at PSP startup and rebuilt by
+** CFE_PSP_MemRangeSet().  Changes made to CFE_PSP_MemoryTable directly are not
+** seen until the next rebuild.
+**
+** Rebuilds are serialized by a mutex, which CFE_PSP_MemRangeInit() creates.
+** Lookups do not take it: there are two copies of the index, and a rebuild
+** fills the one that is not current and then publishes its version number,
+** as the TIME reference state is updated.  Each copy holds the version it was
+** built for, which a rebuild changes before it touches the segments, so a
+** lookup that finds the version of its copy changed when it is done has raced
+** with a rebuild and is repeated.
+*/
+#define CFE_PSP_MEM_INDEX_SIZE      (2 * CFE_PSP_MEM_TABLE_SIZE)
+
+#define CFE_PSP_MEM_INDEX_RAM       0x01
+#define CFE_PSP_MEM_INDEX_EEPROM    0x02
+
+typedef struct
+{
+   cpuaddr StartAddr;     /* first address of the segment */
+   cpuaddr RamEnd;        /* furthest end of a RAM entry covering the segment */
+   cpuaddr EepromEnd;     /* furthest end of an EEPROM entry covering the segment */
+   uint32  Types;         /* CFE_PSP_MEM_INDEX_xxx bits of the entries covering the segment */
+} CFE_PSP_MemIndexSegment_t;
+
+typedef struct
+{
+   volatile uint32           Version;   /* rebuild this copy holds, see above */
+   uint32                    Count;
+   CFE_PSP_MemIndexSegment_t Segment[CFE_PSP_MEM_INDEX_SIZE];
+} CFE_PSP_MemIndex_t;
+
+static CFE_PSP_MemIndex_t  CFE_PSP_MemIndexBuf[2];
+static volatile uint32     CFE_PSP_MemIndexVersion;
+static uint32              CFE_PSP_MemIndexMutex;
+
+/*
+** The current version is read and written with atomic operations where the
+** compiler has them, and the fences keep the segment accesses between the
+** version accesses on both sides
+*/
+#ifdef __ATOMIC_RELEASE
+#define CFE_PSP_MemIndexPublish(Version)  __atomic_store_n(&CFE_PSP_MemIndexVersion, (Version), __ATOMIC_RELEASE)
+#define CFE_PSP_MemIndexCurrent()         __atomic_load_n(&CFE_PSP_MemIndexVersion, __ATOMIC_ACQUIRE)
+#define CFE_PSP_MemIndexWriteFence()      __atomic_thread_fence(__ATOMIC_RELEASE)
+#define CFE_PSP_MemIndexReadFence()       __atomic_thread_fence(__ATOMIC_ACQUIRE)
+#else
+#define CFE_PSP_MemIndexPublish(Version)  (CFE_PSP_MemIndexVersion = (Version))
+#define CFE_PSP_MemIndexCurrent()         (CFE_PSP_MemIndexVersion)
+#define CFE_PSP_MemIndexWriteFence()
+#define CFE_PSP_MemIndexReadFence()
+#endif
+
+/*
+** Name: CFE_PSP_MemIndexBuild
+**
+** Purpose:
+**		Rebuild the interval index from CFE_PSP_MemoryTable
+**
+** Global Inputs: Reads CFE_PSP_MemoryTable
+**
+** Assumptions and Notes:
+**    The caller serializes rebuilds.
+**
+** Global Outputs: Changes CFE_PSP_MemIndexBuf and CFE_PSP_MemIndexVersion
+*/
+static void CFE_PSP_MemIndexBuild(void)
+{
+   CFE_PSP_MemIndex_t *Index;
+   uint32  Version;
+   cpuaddr Bounds[CFE_PSP_MEM_INDEX_SIZE];
+   cpuaddr StartAddr;
+   cpuaddr EndAddr;
+   cpuaddr Temp;
+   uint32  NumBounds;
+   uint32  i;
+   uint32  j;
+   CFE_PSP_MemIndexSegment_t *Segment;
+
+   /*
+   ** Fill the copy that is not current.  A lookup still using it from
+   ** two rebuilds ago sees its version change and starts over.
+   */
+   Version = CFE_PSP_MemIndexVersion + 1;
+   Index = &CFE_PSP_MemIndexBuf[Version & 1];
+   Index->Version = Version;
+   CFE_PSP_MemIndexWriteFence();
+
+   /*
+   ** Collect the segment start addresses: every entry start, and the address
+   ** just past every entry end
+   */
+   NumBounds = 0;
+   for ( i = 0; i < CFE_PSP_MEM_TABLE_SIZE; i++ )
+   {
+      if ( CFE_PSP_MemoryTable[i].MemoryType == CFE_PSP_MEM_INVALID || CFE_PSP_MemoryTable[i].Size == 0 )
+      {
+         continue;
+      }
+
+      StartAddr = CFE_PSP_MemoryTable[i].StartAddr;
+      EndAddr   = StartAddr + CFE_PSP_MemoryTable[i].Size - 1;
+      Bounds[NumBounds++] = StartAddr;
+      if ( EndAddr + 1 > EndAddr )
+      {
+         Bounds[NumBounds++] = EndAddr + 1;
+      }
+   }
+
+   /* insertion sort - the table is small */
+   for ( i = 1; i < NumBounds; i++ )
+   {
+      Temp = Bounds[i];
+      for ( j = i; j > 0 && Bounds[j - 1] > Temp; j-- )
+      {
+         Bounds[j] = Bounds[j - 1];
+      }
+      Bounds[j] = Temp;
+   }
+
+   /* drop duplicates */
+   j = 0;
+   for ( i = 0; i < NumBounds; i++ )
+   {
+      if ( j == 0 || Bounds[i] != Bounds[j - 1] )
+      {
+         Bounds[j++] = Bounds[i];
+      }
+   }
+   NumBounds = j;
+
+   /*
+   ** Record the types and furthest end address covering each segment
+   */
+   for ( i = 0; i < NumBounds; i++ )
+   {
+      Segment = &Index->Segment[i];
+      Segment->StartAddr = Bounds[i];
+      Segment->RamEnd    = 0;
+      Segment->EepromEnd = 0;
+      Segment->Types     = 0;
+
+      for ( j = 0; j < CFE_PSP_MEM_TABLE_SIZE; j++ )
+      {
+         if ( CFE_PSP_MemoryTable[j].MemoryType == CFE_PSP_MEM_INVALID || CFE_PSP_MemoryTable[j].Size == 0 )
+         {
+            continue;
+         }
+
+         StartAddr = CFE_PSP_MemoryTable[j].StartAddr;
+         EndAddr   = StartAddr + CFE_PSP_MemoryTable[j].Size - 1;
+         if ( Bounds[i] < StartAddr || Bounds[i] > EndAddr )
+         {
+            continue;
+         }
+
+         if ( CFE_PSP_MemoryTable[j].MemoryType == CFE_PSP_MEM_RAM )
+         {
+            if ( !(Segment->Types & CFE_PSP_MEM_INDEX_RAM) || EndAddr > Segment->RamEnd )
+            {
+               Segment->RamEnd = EndAddr;
+            }
+            Segment->Types |= CFE_PSP_MEM_INDEX_RAM;
+         }
+         else if ( CFE_PSP_MemoryTable[j].MemoryType == CFE_PSP_MEM_EEPROM )
+         {
+            if ( !(Segment->Types & CFE_PSP_MEM_INDEX_EEPROM) || EndAddr > Segment->EepromEnd )
+            {
+               Segment->EepromEnd = EndAddr;
+            }
+            Segment->Types |= CFE_PSP_MEM_INDEX_EEPROM;
+         }
+      }
+   }
+
+   Index->Count = NumBounds;
+   CFE_PSP_MemIndexPublish(Version);
+}
+
+/*
+** Name: CFE_PSP_MemIndexLookup
+**
+** Purpose:
+**		Check a range against one copy of the interval index
+**
+** Return Values: as CFE_PSP_MemValidateRange
+*/
+static int32 CFE_PSP_MemIndexLookup(const CFE_PSP_MemIndex_t *Index, cpuaddr StartAddressToTest,
+                                    cpuaddr EndAddressToTest, uint32 MemoryType)
+{
+   const CFE_PSP_MemIndexSegment_t *Segment;
+   uint32 FitTypes;
+   uint32 Low;
+   uint32 High;
+   uint32 Mid;
+
+   /*
+   ** Find the last segment starting at or below the address
+   */
+   Low = 0;
+   High = Index->Count;
+   while ( Low < High )
+   {
+      Mid = (Low + High) / 2;
+      if ( Index->Segment[Mid].StartAddr <= StartAddressToTest )
+      {
+         Low = Mid + 1;
+      }
+      else
+      {
+         High = Mid;
+      }
+   }
+
+   if ( Low == 0 || Index->Segment[Low - 1].Types == 0 )
+   {
+      return(CFE_PSP_INVALID_MEM_ADDR);
+   }
+
+   Segment = &Index->Segment[Low - 1];
+
+   /*
+   ** Which types have an entry that holds the whole range?
+   */
+   FitTypes = 0;
+   if ( (Segment->Types & CFE_PSP_MEM_INDEX_RAM) && EndAddressToTest <= Segment->RamEnd )
+   {
+      FitTypes |= CFE_PSP_MEM_INDEX_RAM;
+   }
+   if ( (Segment->Types & CFE_PSP_MEM_INDEX_EEPROM) && EndAddressToTest <= Segment->EepromEnd )
+   {
+      FitTypes |= CFE_PSP_MEM_INDEX_EEPROM;
+   }
+
+   if ( FitTypes == 0 )
+   {
+      return(CFE_PSP_INVALID_MEM_RANGE);
+   }
+
+   if ( MemoryType == CFE_PSP_MEM_ANY ||
+        ( MemoryType == CFE_PSP_MEM_RAM && (FitTypes & CFE_PSP_MEM_INDEX_RAM) ) ||
+        ( MemoryType == CFE_PSP_MEM_EEPROM && (FitTypes & CFE_PSP_MEM_INDEX_EEPROM) ) )
+   {
+      return(CFE_PSP_SUCCESS);
+   }
+
+   return(CFE_PSP_INVALID_MEM_TYPE);
+}
+
+/*
+** Name: CFE_PSP_MemRangeInit
+**
+** Purpose:
+**		Build the interval index from CFE_PSP_MemoryTable at PSP startup
+**
+** Global Inputs: Reads CFE_PSP_MemoryTable
+**
+** Assumptions and Notes:
+**    Also creates the mutex that serializes rebuilds, so it is called
+**    before CFE_PSP_MemRangeSet().
+**
+** Global Outputs: Changes CFE_PSP_MemIndexBuf and CFE_PSP_MemIndexVersion
+*/
+void CFE_PSP_MemRangeInit(void)
+{
+   int32 Status;
+
+   Status = OS_MutSemCreate(&CFE_PSP_MemIndexMutex, "PSP_MemRange", 0);
+   if ( Status != OS_SUCCESS )
+   {
+      OS_printf("CFE_PSP: Error creating memory range mutex (Status=%d)\n", (int)Status);
+   }
+
+   CFE_PSP_MemIndexBuild();
+}
 
 /*
 ** Name: CFE_PSP_MemValidateRange
@@ -49,6 +337,8 @@
 **		Validate the memory range and type using the global CFE_PSP_MemoryTable
 **
 ** Assumptions and Notes:
+**    The range must fit within a single table entry.  The lookup uses the
+**    interval index described above rather than scanning the table.
 **
 ** Parameters: 
 **    Address -- A 32 bit starting address of the memory range
@@ -72,11 +362,9 @@ int32 CFE_PSP_MemValidateRange(cpuaddr Address, uint32 Size, uint32 MemoryType)
 {
    cpuaddr StartAddressToTest = Address;
    cpuaddr EndAddressToTest = Address + Size - 1;
-   cpuaddr StartAddressInTable;
-   cpuaddr EndAddressInTable;
-   uint32 TypeInTable;
-   int32  ReturnCode = CFE_PSP_INVALID_MEM_ADDR;
-   uint32 i;
+   const CFE_PSP_MemIndex_t *Index;
+   uint32 Version;
+   int32  Status;
    
    /*
    ** Before searching table, do a preliminary parameter validation
@@ -90,70 +378,22 @@ int32 CFE_PSP_MemValidateRange(cpuaddr Address, uint32 Size, uint32 MemoryType)
    {
       return(CFE_PSP_INVALID_MEM_RANGE);
    }
-   
-   for ( i = 0; i < CFE_PSP_MEM_TABLE_SIZE; i++ )
+
+   /*
+   ** Repeat the lookup if a rebuild reused the copy it was reading
+   */
+   do
    {
-      /*
-      ** Only look at valid memory table entries
-      */
-      if ( CFE_PSP_MemoryTable[i].MemoryType != CFE_PSP_MEM_INVALID )
-      {
-         StartAddressInTable = CFE_PSP_MemoryTable[i].StartAddr;
-         EndAddressInTable   = CFE_PSP_MemoryTable[i].StartAddr + CFE_PSP_MemoryTable[i].Size - 1;
-         TypeInTable         = CFE_PSP_MemoryTable[i].MemoryType;
-      
-         /*
-         ** Step 1: Get the Address to Fit within the range
-         */
-         if (( StartAddressToTest >= StartAddressInTable ) && ( StartAddressToTest <= EndAddressInTable ))
-         {
-            /*
-            ** Step 2: Does the End Address Fit within the Range?
-            **         should not have to test the lower address,
-            **         since the StartAddressToTest is already in the range.
-            **         Can it be fooled by overflowing the 32 bit int?
-            */
-            if ( EndAddressToTest <= EndAddressInTable )
-            {
-               /*
-               ** Step 3: Is the type OK?
-               */
-               if ( MemoryType == CFE_PSP_MEM_ANY )
-               {
-                  ReturnCode = CFE_PSP_SUCCESS;
-                  break;  /* The range is valid, break out of the loop */
-               }
-               else if ( MemoryType == CFE_PSP_MEM_RAM && TypeInTable == CFE_PSP_MEM_RAM )
-               {
-                  ReturnCode = CFE_PSP_SUCCESS;
-                  break; /* The range is valid, break out of the loop */
-               }   
-               else if ( MemoryType == CFE_PSP_MEM_EEPROM && TypeInTable == CFE_PSP_MEM_EEPROM )
-               {
-                  ReturnCode = CFE_PSP_SUCCESS;
-                  break; /* The range is valid, break out of the loop */
-               }
-               else
-               {
-                  ReturnCode = CFE_PSP_INVALID_MEM_TYPE;
-                  /* The range is not valid, move to the next entry */
-               }
-            }
-            else
-            {
-               ReturnCode = CFE_PSP_INVALID_MEM_RANGE;
-               /* The range is not valid, move to the next entry */
-            }
-         }
-         else
-         {
-            ReturnCode = CFE_PSP_INVALID_MEM_ADDR;
-            /* The range is not valid, move to the next entry */
-         }
-      } /* End if MemoryType != CFE_PSP_MEM_INVALID */
-      
-   } /* End for */
-   return(ReturnCode);
+      Version = CFE_PSP_MemIndexCurrent();
+      Index = &CFE_PSP_MemIndexBuf[Version & 1];
+
+      Status = CFE_PSP_MemIndexLookup(Index, StartAddressToTest, EndAddressToTest, MemoryType);
+
+      CFE_PSP_MemIndexReadFence();
+   }
+   while ( Index->Version != Version );
+
+   return(Status);
 }
 
 /*
@@ -189,6 +429,7 @@ uint32 CFE_PSP_MemRanges(void)
 ** Assumptions and Notes:
 **    Because the table is fixed size, the entries are set by using the integer index.
 **    No validation is done with the address or size. 
+**    CFE_PSP_MemRangeInit() must have been called first.
 **
 ** Parameters: 
 **    RangeNum --   A 32 bit integer ( starting with 0 ) specifying the MemoryTable entry.
@@ -204,7 +445,7 @@ uint32 CFE_PSP_MemRanges(void)
 **
 ** Global Inputs: Reads CFE_PSP_MemoryTable
 **
-** Global Outputs: Changes CFE_PSP_MemoryTable
+** Global Outputs: Changes CFE_PSP_MemoryTable, rebuilds the interval index
 **
 ** Return Values:
 **   CFE_PSP_SUCCESS -- Memory range set successfuly.
@@ -245,11 +486,17 @@ int32  CFE_PSP_MemRangeSet      (uint32 RangeNum, uint32 MemoryType, cpuaddr Sta
    /*
    ** Parameters check out, add the range
    */
+   OS_MutSemTake(CFE_PSP_MemIndexMutex);
+
    CFE_PSP_MemoryTable[RangeNum].MemoryType = MemoryType;
    CFE_PSP_MemoryTable[RangeNum].StartAddr = StartAddr;
    CFE_PSP_MemoryTable[RangeNum].Size = Size;
    CFE_PSP_MemoryTable[RangeNum].WordSize = WordSize;
    CFE_PSP_MemoryTable[RangeNum].Attributes = Attributes;
+
+   CFE_PSP_MemIndexBuild();
+
+   OS_MutSemGive(CFE_PSP_MemIndexMutex);
    
 	return(CFE_PSP_SUCCESS) ;
 }
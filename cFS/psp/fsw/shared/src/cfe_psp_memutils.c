@@ -27,6 +27,13 @@
 **		   This file  contains some of the cFE Platform Support Layer.
 **        It contains the processor architecture specific calls.
 **
+**        Copies of one or two words that are word aligned, which covers
+**        command and telemetry headers, are done inline.
+**        Copies and fills at or above the size of the L2 cache use
+**        non-temporal stores where the CPU supports them, so that a large
+**        transfer does not evict the working set of every other task.  The
+**        implementation is selected by CFE_PSP_MemOpsInit() at PSP startup.
+**        Everything else goes to the C library.
 **
 */
 
@@ -43,20 +50,223 @@
 */
 
 #include "cfe_psp.h"
+#include "cfe_psp_memory.h"
+
+/*
+ * Streaming stores are only used on x86 hosts built with GCC or clang,
+ * where the CPU can be queried at run time.  Other targets keep using
+ * the C library for every size.
+ */
+#if defined(__GNUC__) && defined(__linux__) && (defined(__x86_64__) || defined(__i386__))
+#define CFE_PSP_MEM_HAVE_SSE2
+#include <emmintrin.h>
+#define CFE_PSP_MEM_SSE2_FUNC   __attribute__((target("sse2")))
+#endif
+
+/*
+ * Largest copy handled by the inline word loop.  The source, the
+ * destination and the size must all be multiples of the word size.
+ */
+#ifndef CFE_PSP_MEM_SMALL_COPY_SIZE
+#define CFE_PSP_MEM_SMALL_COPY_SIZE     16
+#endif
+
+/*
+ * Size from which streaming stores are used, if the L2 cache size
+ * cannot be obtained from the system.  Zero disables streaming.
+ */
+#ifndef CFE_PSP_MEM_STREAM_THRESHOLD
+#define CFE_PSP_MEM_STREAM_THRESHOLD    (1024 * 1024)
+#endif
+
+/*
+ * Block size for CFE_PSP_MemCpyCrc, small enough to stay in the L1 cache
+ */
+#ifndef CFE_PSP_MEM_CRC_CHUNK_SIZE
+#define CFE_PSP_MEM_CRC_CHUNK_SIZE      512
+#endif
+
+typedef void (*CFE_PSP_MemCopyFunc_t)(void *dst, const void *src, size_t size);
+typedef void (*CFE_PSP_MemFillFunc_t)(void *dst, uint8 value, size_t size);
+
 /*
 ** global memory
 */
 
+static size_t                CFE_PSP_MemStreamThreshold = 0;
+static CFE_PSP_MemCopyFunc_t CFE_PSP_MemStreamCopy = NULL;
+static CFE_PSP_MemFillFunc_t CFE_PSP_MemStreamFill = NULL;
+
+/*
+ * CRC-32 tables for CFE_PSP_MemCpyCrc, four bytes per step
+ */
+static uint32 CFE_PSP_MemCrcTable[4][256];
+
+#ifdef CFE_PSP_MEM_HAVE_SSE2
+
+/*
+ * Copy with 16-byte non-temporal stores.  The head is copied normally
+ * until the destination is aligned, the source may stay unaligned.
+ */
+CFE_PSP_MEM_SSE2_FUNC
+static void CFE_PSP_MemStreamCopy_SSE2(void *dst, const void *src, size_t size)
+{
+    uint8       *d = dst;
+    const uint8 *s = src;
+    size_t       head;
+    __m128i      x0, x1, x2, x3;
+
+    head = (16 - ((cpuaddr)d & 15)) & 15;
+    memcpy(d, s, head);
+    d += head;
+    s += head;
+    size -= head;
+
+    while (size >= 64)
+    {
+        x0 = _mm_loadu_si128((const __m128i *)s);
+        x1 = _mm_loadu_si128((const __m128i *)(s + 16));
+        x2 = _mm_loadu_si128((const __m128i *)(s + 32));
+        x3 = _mm_loadu_si128((const __m128i *)(s + 48));
+        _mm_stream_si128((__m128i *)d, x0);
+        _mm_stream_si128((__m128i *)(d + 16), x1);
+        _mm_stream_si128((__m128i *)(d + 32), x2);
+        _mm_stream_si128((__m128i *)(d + 48), x3);
+        d += 64;
+        s += 64;
+        size -= 64;
+    }
+
+    /* order the streaming stores before anything that follows */
+    _mm_sfence();
+    memcpy(d, s, size);
+}
+
+CFE_PSP_MEM_SSE2_FUNC
+static void CFE_PSP_MemStreamFill_SSE2(void *dst, uint8 value, size_t size)
+{
+    uint8   *d = dst;
+    size_t   head;
+    __m128i  x;
+
+    head = (16 - ((cpuaddr)d & 15)) & 15;
+    memset(d, value, head);
+    d += head;
+    size -= head;
+
+    x = _mm_set1_epi8((char)value);
+    while (size >= 64)
+    {
+        _mm_stream_si128((__m128i *)d, x);
+        _mm_stream_si128((__m128i *)(d + 16), x);
+        _mm_stream_si128((__m128i *)(d + 32), x);
+        _mm_stream_si128((__m128i *)(d + 48), x);
+        d += 64;
+        size -= 64;
+    }
+
+    _mm_sfence();
+    memset(d, value, size);
+}
+
+#endif /* CFE_PSP_MEM_HAVE_SSE2 */
+
+/*
+** Name: CFE_PSP_MemOpsInit
+**
+** Purpose:
+**	Selects the streaming implementation for this CPU, sets the size at
+**  which it is used and builds the CRC tables.  This is called once by
+**  the PSP startup code, before any other task is running.
+*/
+void CFE_PSP_MemOpsInit(void)
+{
+    uint32 i;
+    uint32 j;
+    uint32 crc;
+    long   cache_size;
+
+    for (i = 0; i < 256; ++i)
+    {
+        crc = i;
+        for (j = 0; j < 8; ++j)
+        {
+            crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+        }
+        CFE_PSP_MemCrcTable[0][i] = crc;
+    }
+    for (i = 0; i < 256; ++i)
+    {
+        crc = CFE_PSP_MemCrcTable[0][i];
+        for (j = 1; j < 4; ++j)
+        {
+            crc = (crc >> 8) ^ CFE_PSP_MemCrcTable[0][crc & 0xFF];
+            CFE_PSP_MemCrcTable[j][i] = crc;
+        }
+    }
+
+    CFE_PSP_MemStreamThreshold = CFE_PSP_MEM_STREAM_THRESHOLD;
+#ifdef _SC_LEVEL2_CACHE_SIZE
+    cache_size = sysconf(_SC_LEVEL2_CACHE_SIZE);
+    if (cache_size > 0 && CFE_PSP_MemStreamThreshold != 0)
+    {
+        CFE_PSP_MemStreamThreshold = cache_size;
+    }
+#else
+    (void)cache_size;
+#endif
+
+#ifdef CFE_PSP_MEM_HAVE_SSE2
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("sse2"))
+    {
+        CFE_PSP_MemStreamCopy = CFE_PSP_MemStreamCopy_SSE2;
+        CFE_PSP_MemStreamFill = CFE_PSP_MemStreamFill_SSE2;
+    }
+#endif
+
+    if (CFE_PSP_MemStreamThreshold == 0)
+    {
+        CFE_PSP_MemStreamCopy = NULL;
+        CFE_PSP_MemStreamFill = NULL;
+    }
+}
+
+/*
+ * Update a (pre-inverted) CRC-32 with a block of data
+ */
+static uint32 CFE_PSP_MemCrcUpdate(uint32 c, const uint8 *s, uint32 size)
+{
+    while (size >= 4)
+    {
+        /* assembled bytewise so the result does not depend on byte order */
+        c ^= (uint32)s[0] | ((uint32)s[1] << 8) | ((uint32)s[2] << 16) | ((uint32)s[3] << 24);
+        c = CFE_PSP_MemCrcTable[3][c & 0xFF] ^
+            CFE_PSP_MemCrcTable[2][(c >> 8) & 0xFF] ^
+            CFE_PSP_MemCrcTable[1][(c >> 16) & 0xFF] ^
+            CFE_PSP_MemCrcTable[0][c >> 24];
+        s += 4;
+        size -= 4;
+    }
+    while (size > 0)
+    {
+        c = (c >> 8) ^ CFE_PSP_MemCrcTable[0][(c ^ *s) & 0xFF];
+        ++s;
+        --size;
+    }
+
+    return c;
+}
+
 /*
 ** Name: CFE_PSP_MemCpy
 **
 ** Purpose:
 **	Copies 'size' byte from memory address pointed by 'src' to memory
-**  address pointed by ' dst' For now we are using the standard c library
-**  call 'memcpy' but if we find we need to make it more efficient then
-**  we'll implement it in assembly.
+**  address pointed by ' dst'.
 **
 ** Assumptions and Notes:
+**  The areas must not overlap.
 **
 ** Parameters:
 **	dst : pointer to an address to copy to
@@ -71,9 +281,36 @@
 */
 int32 CFE_PSP_MemCpy ( void *dst, const void *src, uint32 size)
 {
-	memcpy( dst, src, size);
-	return(CFE_PSP_SUCCESS) ;
-} 
+    uint8       *d;
+    const uint8 *s;
+
+    if (size <= CFE_PSP_MEM_SMALL_COPY_SIZE &&
+            (((cpuaddr)dst | (cpuaddr)src | size) & (sizeof(uint64) - 1)) == 0)
+    {
+        /* constant-size copies, which the compiler turns into plain moves */
+        d = dst;
+        s = src;
+        while (size > 0)
+        {
+            memcpy(d, s, sizeof(uint64));
+            d += sizeof(uint64);
+            s += sizeof(uint64);
+            size -= sizeof(uint64);
+        }
+        return(CFE_PSP_SUCCESS) ;
+    }
+
+    if (CFE_PSP_MemStreamCopy != NULL && size >= CFE_PSP_MemStreamThreshold)
+    {
+        CFE_PSP_MemStreamCopy(dst, src, size);
+    }
+    else
+    {
+        memcpy( dst, src, size);
+    }
+
+    return(CFE_PSP_SUCCESS) ;
+}
 
 
 
@@ -82,9 +319,7 @@ int32 CFE_PSP_MemCpy ( void *dst, const void *src, uint32 size)
 **
 ** Purpose:
 **	Copies 'size' number of byte of value 'value' to memory address pointed
-**  by 'dst' .For now we are using the standard c library call 'memset'
-**  but if we find we need to make it more efficient then we'll implement
-**  it in assembly.
+**  by 'dst'.
 **
 **
 ** Assumptions and Notes:
@@ -103,7 +338,80 @@ int32 CFE_PSP_MemCpy ( void *dst, const void *src, uint32 size)
 */
 int32 CFE_PSP_MemSet ( void *dst, uint8 value , uint32 size)
 {
-    memset( dst, (int)value, (size_t)size);
-	 return(CFE_PSP_SUCCESS) ;
-} 
+    if (CFE_PSP_MemStreamFill != NULL && size >= CFE_PSP_MemStreamThreshold)
+    {
+        CFE_PSP_MemStreamFill(dst, value, size);
+    }
+    else
+    {
+        memset( dst, (int)value, (size_t)size);
+    }
+
+    return(CFE_PSP_SUCCESS) ;
+}
+
+/*
+** Name: CFE_PSP_MemCpyCrc
+**
+** Purpose:
+**	Copies 'size' bytes from 'src' to 'dst' and computes the CRC-32
+**  (IEEE 802.3) of the data in the same pass, so that data which has
+**  to be both stored and protected is only read once.
+**
+** Assumptions and Notes:
+**  The CRC is chained through 'crc': it holds the CRC of the data seen
+**  so far on entry (0 to start) and the CRC including this block on
+**  return, so a record can be processed in several pieces.
+**  If 'dst' is NULL nothing is copied and only the CRC is computed.
+**
+** Parameters:
+**	dst : pointer to an address to copy to, or NULL
+**  src : pointer address to copy from
+**  size : number of bytes
+**  crc : CRC value, updated
+**
+** Global Inputs: None
+**
+** Global Outputs: None
+**
+**
+** Return Values: CFE_PSP_SUCCESS, CFE_PSP_INVALID_POINTER
+*/
+int32 CFE_PSP_MemCpyCrc ( void *dst, const void *src, uint32 size, uint32 *crc)
+{
+    uint8       *d = dst;
+    const uint8 *s = src;
+    uint32       chunk;
+    uint32       c;
+
+    if (src == NULL || crc == NULL)
+    {
+        return(CFE_PSP_INVALID_POINTER) ;
+    }
+
+    /*
+     * Each chunk is copied right after it has been checked, while it is
+     * still in the L1 cache, so the source is only fetched from memory once.
+     */
+    c = ~(*crc);
+    while (size > 0)
+    {
+        chunk = size;
+        if (chunk > CFE_PSP_MEM_CRC_CHUNK_SIZE)
+        {
+            chunk = CFE_PSP_MEM_CRC_CHUNK_SIZE;
+        }
+
+        c = CFE_PSP_MemCrcUpdate(c, s, chunk);
+        if (d != NULL)
+        {
+            memcpy(d, s, chunk);
+            d += chunk;
+        }
+        s += chunk;
+        size -= chunk;
+    }
+    *crc = ~c;
 
+    return(CFE_PSP_SUCCESS) ;
+}
@@ -36,6 +36,8 @@
 ** Include section
 */
 
+#include <string.h>
+
 #include "cfe_psp.h"
 
 
@@ -236,5 +238,148 @@ int32 CFE_PSP_MemWrite32 ( cpuaddr MemoryAddress, uint32 uint32Value )
 	return(CFE_PSP_SUCCESS) ;
 }
 
+/*
+ ** Name: CFE_PSP_MemReadBlock
+ **
+ ** Purpose:
+ **         Read a block of memory.  The block is validated against the memory
+ **         range table once and then copied in a single pass, instead of
+ **         going through CFE_PSP_MemRead8/16/32 for every byte or word.
+ **
+ **
+ ** Parameters:
+ **	MemoryAddress : Address to be read
+ **  Buffer     : The block content will be copied to this buffer
+ **  Size       : Number of bytes to read
+ **
+ ** Global Inputs: None
+ **
+ ** Global Outputs: None
+ **
+ **
+ **
+ ** Return Values:
+ **		CFE_PSP_SUCCESS
+ **		CFE_PSP_INVALID_POINTER Buffer is NULL
+ **		CFE_PSP_INVALID_MEM_ADDR, CFE_PSP_INVALID_MEM_RANGE The block is not
+ **      within a single valid memory range
+ */
+int32 CFE_PSP_MemReadBlock( cpuaddr MemoryAddress, void *Buffer, uint32 Size )
+{
+    int32 Status;
+
+    if ( Buffer == NULL )
+    {
+        return(CFE_PSP_INVALID_POINTER) ;
+    }
+
+    if ( Size == 0 )
+    {
+        return(CFE_PSP_SUCCESS) ;
+    }
+
+    Status = CFE_PSP_MemValidateRange(MemoryAddress, Size, CFE_PSP_MEM_ANY);
+    if ( Status == CFE_PSP_SUCCESS )
+    {
+        memcpy(Buffer, (const void *)MemoryAddress, Size);
+    }
+
+    return(Status) ;
+}
+
+/*
+ ** Name: CFE_PSP_MemWriteEeprom
+ **
+ ** Purpose:
+ **         Write a block to EEPROM one aligned 32 bit word at a time.  Partial
+ **         words at either end are merged with the current content, so each
+ **         word is written once rather than once per byte.
+ */
+static int32 CFE_PSP_MemWriteEeprom( cpuaddr MemoryAddress, const uint8 *Buffer, uint32 Size )
+{
+    int32   Status = CFE_PSP_SUCCESS;
+    cpuaddr AlignedAddress;
+    uint32  Offset;
+    uint32  Chunk;
+    uint32  Word;
+
+    while ( Size > 0 && Status == CFE_PSP_SUCCESS )
+    {
+        Offset = MemoryAddress & 0x00000003;
+        AlignedAddress = MemoryAddress - Offset;
+        Chunk = 4 - Offset;
+        if ( Chunk > Size )
+        {
+            Chunk = Size;
+        }
+
+        if ( Chunk < 4 )
+        {
+            memcpy(&Word, (const void *)AlignedAddress, sizeof(Word));
+        }
+        memcpy((uint8 *)&Word + Offset, Buffer, Chunk);
+
+        Status = CFE_PSP_EepromWrite32(AlignedAddress, Word);
+
+        MemoryAddress += Chunk;
+        Buffer += Chunk;
+        Size -= Chunk;
+    }
+
+    return(Status) ;
+}
+
+/*
+ ** Name: CFE_PSP_MemWriteBlock
+ **
+ ** Purpose:
+ **         Write a block of memory.  The block is validated against the memory
+ **         range table once; RAM is then written in a single copy and EEPROM
+ **         in aligned 32 bit words through CFE_PSP_EepromWrite32.
+ **
+ **
+ ** Parameters:
+ **	MemoryAddress : Address to be written to
+ **  Buffer     : The content of this buffer will be copied to the address
+ **  Size       : Number of bytes to write
+ **
+ ** Global Inputs: None
+ **
+ ** Global Outputs: None
+ **
+ **
+ **
+ ** Return Values:
+ **		CFE_PSP_SUCCESS
+ **		CFE_PSP_INVALID_POINTER Buffer is NULL
+ **		CFE_PSP_INVALID_MEM_ADDR, CFE_PSP_INVALID_MEM_RANGE The block is not
+ **      within a single valid memory range
+ **		Any error returned by CFE_PSP_EepromWrite32
+ */
+int32 CFE_PSP_MemWriteBlock( cpuaddr MemoryAddress, const void *Buffer, uint32 Size )
+{
+    int32 Status;
 
+    if ( Buffer == NULL )
+    {
+        return(CFE_PSP_INVALID_POINTER) ;
+    }
 
+    if ( Size == 0 )
+    {
+        return(CFE_PSP_SUCCESS) ;
+    }
+
+    Status = CFE_PSP_MemValidateRange(MemoryAddress, Size, CFE_PSP_MEM_RAM);
+    if ( Status == CFE_PSP_SUCCESS )
+    {
+        memcpy((void *)MemoryAddress, Buffer, Size);
+    }
+    else if ( Status == CFE_PSP_INVALID_MEM_TYPE )
+    {
+        /* the block fits, but not in RAM - so it is in EEPROM */
+        Status = CFE_PSP_MemWriteEeprom(MemoryAddress, Buffer, Size);
+    }
+
+    return(Status) ;
+}
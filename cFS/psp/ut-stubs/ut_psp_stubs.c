@@ -570,6 +570,66 @@ int32 CFE_PSP_MemRead8(cpuaddr Address, uint8 *Data)
     return status;
 }
 
+/*****************************************************************************/
+/**
+** \brief CFE_PSP_MemReadBlock stub function
+**
+** \par Description
+**        This function is used to mimic the response of the PSP function
+**        CFE_PSP_MemReadBlock.  The buffer is filled from the data buffer
+**        registered for this stub, if any.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either a user-defined status flag or OS_SUCCESS.
+**
+******************************************************************************/
+int32 CFE_PSP_MemReadBlock(cpuaddr MemoryAddress, void *Buffer, uint32 Size)
+{
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(CFE_PSP_MemReadBlock);
+
+    if (status >= 0)
+    {
+        UT_Stub_CopyToLocal(UT_KEY(CFE_PSP_MemReadBlock), (uint8*)Buffer, Size);
+    }
+
+    return status;
+}
+
+/*****************************************************************************/
+/**
+** \brief CFE_PSP_MemWriteBlock stub function
+**
+** \par Description
+**        This function is used to mimic the response of the PSP function
+**        CFE_PSP_MemWriteBlock.  The written data is saved to the data buffer
+**        registered for this stub, if any.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either a user-defined status flag or OS_SUCCESS.
+**
+******************************************************************************/
+int32 CFE_PSP_MemWriteBlock(cpuaddr MemoryAddress, const void *Buffer, uint32 Size)
+{
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(CFE_PSP_MemWriteBlock);
+
+    if (status >= 0)
+    {
+        UT_Stub_CopyFromLocal(UT_KEY(CFE_PSP_MemWriteBlock), (const uint8*)Buffer, Size);
+    }
+
+    return status;
+}
+
 /*****************************************************************************/
 /**
 ** \brief CFE_PSP_MemValidateRange stub function
@@ -659,6 +719,41 @@ int32 CFE_PSP_MemSet(void *dst, uint8 value , uint32 size)
     return status;
 }
 
+/*****************************************************************************/
+/**
+** \brief CFE_PSP_MemCpyCrc stub function
+**
+** \par Description
+**        This function is used to mimic the response of the PSP function
+**        CFE_PSP_MemCpyCrc.  The data is copied; the CRC is taken from the
+**        data buffer registered for this stub, if any, and otherwise left
+**        unchanged.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either a user-defined status flag or OS_SUCCESS.
+**
+******************************************************************************/
+int32 CFE_PSP_MemCpyCrc(void *dst, const void *src, uint32 size, uint32 *crc)
+{
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(CFE_PSP_MemCpyCrc);
+
+    if (status >= 0)
+    {
+        if (dst != NULL)
+        {
+            memcpy(dst, src, size);
+        }
+        UT_Stub_CopyToLocal(UT_KEY(CFE_PSP_MemCpyCrc), (uint8*)crc, sizeof(*crc));
+    }
+
+    return status;
+}
+
 uint32 CFE_PSP_Exception_GetCount(void)
 {
     int32 status;
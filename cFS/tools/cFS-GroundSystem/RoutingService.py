@@ -30,6 +30,15 @@ from PyQt5.QtCore import QThread, pyqtSignal
 # Receive port where the CFS TO_Lab app sends the telemetry packets
 udpRecvPort = 1235
 
+# Start of a datagram that carries several packets, see TO_LAB_FrameHdr_t
+frameSync = b'\x1a\xcf\xfc\x1d'
+frameHdrLen = 8
+
+# Message ID of TO_Lab compressed packets, see TO_LAB_CompressHdr_t
+compressedPktId = 0x0885
+tlmHdrLen = 12
+compressHdrLen = 8
+
 
 #
 # Receive telemetry packets, apply the appropriate header
@@ -48,6 +57,9 @@ class RoutingService(QThread):
         self.specialPktId = []
         self.specialPktName = []
 
+        # Last packet of each stream, that compressed packets are coded against
+        self.references = {}
+
         self.sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
 
         # Init zeroMQ
@@ -70,7 +82,7 @@ class RoutingService(QThread):
                 try:
                     # Receive message
                     datagram, host = self.sock.recvfrom(
-                        4096)  # buffer size is 1024 bytes
+                        65535)  # large enough for jumbo frames
 
                     # Ignore datagram if it is not long enough (doesnt contain tlm header?)
                     if len(datagram) < 6:
@@ -96,7 +108,10 @@ class RoutingService(QThread):
                     # Forward the message using zeroMQ
                     name = self.spacecraftNames[self.ipAddressesList.index(
                         hostIpAddress)]
-                    self.forwardMessage(datagram, name)
+                    for packet in self.deframe(datagram):
+                        packet = self.decompress(packet)
+                        if packet is not None:
+                            self.forwardMessage(packet, name)
 
                 # Handle errors
                 except socket.error:
@@ -114,6 +129,87 @@ class RoutingService(QThread):
         self.publisher.send_multipart([my_header_as_bytes, datagram])
         # print(header)
 
+    # Split a TO_Lab frame into its packets, other datagrams pass as they are
+    @staticmethod
+    def deframe(datagram):
+        if len(datagram) < frameHdrLen or datagram[:4] != frameSync:
+            return [datagram]
+
+        packets = []
+        count = unpack(">H", datagram[6:8])[0]
+        offset = frameHdrLen
+        while count > 0 and offset + 6 <= len(datagram):
+            # CCSDS length field is the packet length minus 7
+            pktLen = unpack(">H", datagram[offset + 4:offset + 6])[0] + 7
+            if offset + pktLen > len(datagram):
+                print("Dropped truncated packet in frame")
+                break
+            packets.append(datagram[offset:offset + pktLen])
+            offset += pktLen
+            count -= 1
+        return packets
+
+    # Restore a TO_Lab compressed packet, other packets pass as they are
+    def decompress(self, packet):
+        if unpack(">H", packet[:2])[0] != compressedPktId:
+            self.references[packet[:2]] = packet
+            return packet
+
+        hdr = packet[tlmHdrLen:tlmHdrLen + compressHdrLen]
+        if len(hdr) < compressHdrLen:
+            return None
+        streamId = hdr[0:2]
+        method = hdr[2]
+        refSequence = unpack(">H", hdr[4:6])[0] & 0x3FFF
+        length = unpack(">H", hdr[6:8])[0]
+
+        ref = None
+        if method == 1:
+            ref = self.references.get(streamId)
+            if (ref is None or len(ref) != length
+                    or unpack(">H", ref[2:4])[0] & 0x3FFF != refSequence):
+                print("Dropped compressed packet, reference was lost")
+                return None
+
+        try:
+            out = self.decode(packet[tlmHdrLen + compressHdrLen:], length, ref)
+        except IndexError:
+            print("Dropped malformed compressed packet")
+            return None
+
+        self.references[streamId] = out
+        return out
+
+    # Undo the TO_Lab coder, see to_lab_compress.h
+    @staticmethod
+    def decode(coded, length, ref):
+        def readLength(pos, nibble):
+            if nibble == 15:
+                while True:
+                    nibble += coded[pos]
+                    pos += 1
+                    if coded[pos - 1] != 255:
+                        break
+            return pos, nibble
+
+        out = bytearray()
+        pos = 0
+        while len(out) < length:
+            token = coded[pos]
+            pos, litLen = readLength(pos + 1, token >> 4)
+            if pos + litLen > len(coded):
+                raise IndexError
+            out += coded[pos:pos + litLen]
+            pos += litLen
+            pos, zeroLen = readLength(pos, token & 0xF)
+            out += bytes(zeroLen)
+
+        if len(out) != length:
+            raise IndexError
+        if ref is not None:
+            out = bytearray(a ^ b for a, b in zip(out, ref))
+        return bytes(out)
+
     # Read the packet id from the telemetry packet
     @staticmethod
     def getPktId(datagram):
@@ -2565,7 +2565,7 @@ int32 OutputDataToTargetFile()
     /* If this machine is little endian, the TBL header must be swapped */
     if (ThisMachineIsLittleEndian == true)
     {
-        SwapUInt32(&TableHeader.Reserved);
+        SwapUInt32(&TableHeader.NumSegments);
         SwapUInt32(&TableHeader.Offset);
         SwapUInt32(&TableHeader.NumBytes);
     }
@@ -2581,7 +2581,7 @@ int32 OutputDataToTargetFile()
     fwrite(&FileHeader.TimeSubSeconds, sizeof(uint32), 1, DstFileDesc);
     fwrite(&FileHeader.Description[0], sizeof(FileHeader.Description), 1, DstFileDesc);
 
-    fwrite(&TableHeader.Reserved, sizeof(uint32), 1, DstFileDesc);
+    fwrite(&TableHeader.NumSegments, sizeof(uint32), 1, DstFileDesc);
     fwrite(&TableHeader.Offset, sizeof(uint32), 1, DstFileDesc);
     fwrite(&TableHeader.NumBytes, sizeof(uint32), 1, DstFileDesc);
     fwrite(&TableHeader.TableName[0], sizeof(TableHeader.TableName), 1, DstFileDesc);